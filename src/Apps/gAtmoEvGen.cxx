@@ -29,6 +29,7 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--workers n_of_worker_processes]
 
          *** Options :
 
@@ -166,6 +167,18 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --workers
+              Splits the job between the specified number of worker processes,
+              forked once the job is initialized (cross-section splines, flux,
+              geometry, ...) so that they share its memory. The requested
+              events are split between the workers, each one using its own
+              random number seed and writing its own output event file,
+              tagged with the worker index (eg gntp.[run_number].w3.ghep.root).
+              The number of generated events and of flux neutrinos is summed
+              over the workers, printed at the end of the job and written,
+              along with the values and the output file of each worker, to a
+              summary file (gntp.[run_number].workers.txt).
+              [default: 1]
 
          *** Examples:
 
@@ -222,6 +235,7 @@
 #include <sstream>
 #include <map>
 
+#include <TMath.h>
 #include <TRotation.h>
 
 #include "Framework/Conventions/Units.h"
@@ -243,6 +257,7 @@
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/ForkedWorkers.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #include "Tools/Flux/GFLUKAAtmoFlux.h"
@@ -289,6 +304,7 @@ string          gOptEvFilePrefix;              // event file prefix
 TRotation       gOptRot;                       // coordinate rotation matrix: topocentric horizontal -> user-defined topocentric system
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+unsigned int    gOptNWorkers;                  // number of worker processes
 
 // Defaults:
 //
@@ -332,20 +348,48 @@ int main(int argc, char** argv)
   mcj_driver->UseSplines();
   mcj_driver->ForceSingleProbScale();
 
-  // initialize an ntuple writer
+  // name the output event file (opened by each worker, see below)
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
   ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  string ntpsuffix = Form(".%s.root", NtpMCFormat::FilenameTag(kDefOptNtpFormat));
+
+  // fork the worker processes, if requested, now that the job is initialized
+  ForkedWorkers workers(gOptNWorkers);
+  if(workers.Fork() < 0) {
+    bool ok = workers.Wait();
+    LOG("gevgen_atmo", pNOTICE)
+        << "\n >> N of worker processes:                   " << workers.NWorkers()
+        << "\n >> N of flux v generated by flux drivers:   " << workers.Sum(2)
+        << "\n >> N of flux v thrown to event gen drivers: " << workers.Sum(1)
+        << "\n >> N of generated v interactions:           " << workers.Sum(0);
+    vector<string> names;
+    names.push_back("events");
+    names.push_back("flux_neutrinos_thrown");
+    names.push_back("flux_neutrinos_generated");
+    ok = workers.WriteSummary(
+       ForkedWorkers::SummaryFilename(ntpw.Filename(), ntpsuffix), names) && ok;
+    delete geom_driver;
+    delete flux_driver;
+    delete mcj_driver;
+    return (ok) ? 0 : 1;
+  }
+  int iev0 = workers.First(gOptNev);
+  int nev  = workers.Share(gOptNev);
+
+  // initialize the ntuple writer
+  ntpw.CustomizeFilename(workers.TagFilename(ntpw.Filename(), ntpsuffix));
   ntpw.Initialize();
 
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
+  mcjmonitor.CustomizeFilename(workers.TagFilename(mcjmonitor.Filename()));
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
   // event loop
-  for(int iev = 0; iev < gOptNev; iev++) {
+  for(int iev = iev0; iev < iev0 + nev; iev++) {
 
     // generate next event
     EventRecord* event = mcj_driver->GenerateEvent();
@@ -367,6 +411,18 @@ int main(int argc, char** argv)
   // save the event file
   ntpw.Save();
 
+  // report the normalization of this worker's sample (workers exit here)
+  double nflx = 0;
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+  GAtmoFlux * atmo_flux_driver = dynamic_cast<GAtmoFlux *>(flux_driver);
+  if(atmo_flux_driver) nflx = atmo_flux_driver->NFluxNeutrinos();
+#endif
+  vector<double> norm(3);
+  norm[0] = nev;
+  norm[1] = mcj_driver->NFluxNeutrinos();
+  norm[2] = nflx;
+  workers.Finish(norm, vector<string>(1, ntpw.Filename()));
+
   // clean-up
   delete geom_driver;
   delete flux_driver;
@@ -859,6 +915,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  //
+  // *** number of worker processes
+  //
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  } else {
+    gOptNWorkers = 1;
+  }
+
   //
   // print-out summary
   //
@@ -918,6 +984,7 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n"
      << "\n @@ Run number: " << gOptRunNu
      << "\n @@ Random number seed: " << gOptRanSeed
+     << "\n @@ Worker processes: " << gOptNWorkers
      << "\n @@ Using cross-section file: " << gOptInpXSecFile
      << "\n @@ Geometry"
      << "\n\t" << gminfo.str()
@@ -969,6 +1036,7 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--workers n_of_worker_processes]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << "\n";
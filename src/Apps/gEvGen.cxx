@@ -35,6 +35,7 @@
                   [--mc-job-status-refresh-rate  rate]
                   [--cache-file root_file]
                   [--xml-path config_xml_dir]
+                  [--workers n_of_worker_processes]
 
          Options :
            [] Denotes an optional argument.
@@ -107,6 +108,18 @@
               re-used in subsequent MC jobs.
            --xml-path
               A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+           --workers
+              Splits the job between the specified number of worker processes,
+              forked once the job is initialized (cross-section splines, flux,
+              event generation drivers, ...) so that they share its memory.
+              The requested events are split between the workers, each one
+              using its own random number seed and writing its own output
+              event file, tagged with the worker index (eg for -o out.root:
+              out.w3.root). The number of generated events and of flux
+              neutrinos is summed over the workers, printed at the end and
+              written, along with the values and the output file of each
+              worker, to a summary file (eg out.workers.txt).
+              [default: 1]
 
         ***  See the User Manual for more details and examples. ***
 
@@ -162,6 +175,7 @@
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/ForkedWorkers.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
@@ -213,6 +227,7 @@ long int        gOptRanSeed;      // random number seed
 string          gOptInpXSecFile;  // cross-section splines
 string          gOptOutFileName;  // Optional outfile name
 string          gOptStatFileName; // Status file name, set if gOptOutFileName was set.
+unsigned int    gOptNWorkers;     // number of worker processes
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -286,6 +301,25 @@ void GenerateEventsAtFixedInitState(void)
   if (!gOptOutFileName.empty()){
     ntpw.CustomizeFilename(gOptOutFileName);
   }
+  string ntpsuffix = Form(".%s.root", NtpMCFormat::FilenameTag(kDefOptNtpFormat));
+
+  // Fork the worker processes, if requested
+  ForkedWorkers workers(gOptNWorkers);
+  if(workers.Fork() < 0) {
+    bool ok = workers.Wait();
+    LOG("gevgen", pNOTICE)
+      << "\n ** " << workers.Sum(0) << " events generated by "
+      << workers.NWorkers() << " worker processes";
+    vector<string> names(1, "events");
+    ok = workers.WriteSummary(
+       ForkedWorkers::SummaryFilename(ntpw.Filename(), ntpsuffix), names) && ok;
+    if(!ok) exit(1);
+    return;
+  }
+  int iev0 = workers.First(gOptNevents);
+  int nev  = workers.Share(gOptNevents);
+
+  ntpw.CustomizeFilename(workers.TagFilename(ntpw.Filename(), ntpsuffix));
   ntpw.Initialize();
 
 
@@ -297,15 +331,16 @@ void GenerateEventsAtFixedInitState(void)
   if (!gOptStatFileName.empty()){
     mcjmonitor.CustomizeFilename(gOptStatFileName);
   }
+  mcjmonitor.CustomizeFilename(workers.TagFilename(mcjmonitor.Filename()));
 
 
   LOG("gevgen", pNOTICE)
-    << "\n ** Will generate " << gOptNevents << " events for \n"
+    << "\n ** Will generate " << nev << " events for \n"
     << init_state << " at Ev = " << Ev << " GeV";
 
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while (ievent < gOptNevents) {
+  int ievent = iev0;
+  while (ievent < iev0 + nev) {
      LOG("gevgen", pNOTICE)
         << " *** Generating event............ " << ievent;
 
@@ -330,6 +365,9 @@ void GenerateEventsAtFixedInitState(void)
 
   // Save the generated MC events
   ntpw.Save();
+
+  // Report the number of events generated by this worker (workers exit here)
+  workers.Finish(vector<double>(1, nev), vector<string>(1, ntpw.Filename()));
 }
 //____________________________________________________________________________
 
@@ -359,6 +397,31 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if (!gOptOutFileName.empty()){
     ntpw.CustomizeFilename(gOptOutFileName);
   }
+  string ntpsuffix = Form(".%s.root", NtpMCFormat::FilenameTag(kDefOptNtpFormat));
+
+  // Fork the worker processes, if requested
+  ForkedWorkers workers(gOptNWorkers);
+  if(workers.Fork() < 0) {
+    bool ok = workers.Wait();
+    LOG("gevgen", pNOTICE)
+      << "\n >> N of worker processes:                   " << workers.NWorkers()
+      << "\n >> N of flux v thrown to event gen drivers: " << workers.Sum(1)
+      << "\n >> N of generated v interactions:           " << workers.Sum(0);
+    vector<string> names;
+    names.push_back("events");
+    names.push_back("flux_neutrinos_thrown");
+    ok = workers.WriteSummary(
+       ForkedWorkers::SummaryFilename(ntpw.Filename(), ntpsuffix), names) && ok;
+    delete flux_driver;
+    delete geom_driver;
+    delete mcj_driver;
+    if(!ok) exit(1);
+    return;
+  }
+  int iev0 = workers.First(gOptNevents);
+  int nev  = workers.Share(gOptNevents);
+
+  ntpw.CustomizeFilename(workers.TagFilename(ntpw.Filename(), ntpsuffix));
   ntpw.Initialize();
 
   // Create an MC Job Monitor
@@ -369,11 +432,12 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if (!gOptStatFileName.empty()){
     mcjmonitor.CustomizeFilename(gOptStatFileName);
   }
+  mcjmonitor.CustomizeFilename(workers.TagFilename(mcjmonitor.Filename()));
 
 
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while ( ievent < gOptNevents) {
+  int ievent = iev0;
+  while ( ievent < iev0 + nev) {
 
      LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
 
@@ -392,6 +456,12 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   // Save the generated MC events
   ntpw.Save();
 
+  // Report the normalization of this worker's sample (workers exit here)
+  vector<double> norm(2);
+  norm[0] = nev;
+  norm[1] = mcj_driver->NFluxNeutrinos();
+  workers.Finish(norm, vector<string>(1, ntpw.Filename()));
+
   delete flux_driver;
   delete geom_driver;
   delete mcj_driver;;
@@ -715,6 +785,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  } else {
+    gOptNWorkers = 1;
+  }
+
   //
   // print-out the command line options
   //
@@ -732,6 +810,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   }
   LOG("gevgen", pNOTICE)
        << "Number of events requested: " << gOptNevents;
+  LOG("gevgen", pNOTICE)
+       << "Number of worker processes: " << gOptNWorkers;
   if(gOptInpXSecFile.size() > 0) {
      LOG("gevgen", pNOTICE)
        << "Using cross-section splines read from: " << gOptInpXSecFile;
@@ -790,6 +870,7 @@ void PrintSyntax(void)
     << "\n              [--mc-job-status-refresh-rate  rate]"
     << "\n              [--cache-file root_file]"
     << "\n              [--xml-path config_xml_dir]"
+    << "\n              [--workers n_of_worker_processes]"
     << "\n";
 }
 //____________________________________________________________________________
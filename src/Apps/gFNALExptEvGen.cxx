@@ -46,6 +46,7 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--workers n_of_worker_processes]
 
          *** Options :
 
@@ -228,6 +229,23 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --workers
+              Splits the job between the specified number of worker processes,
+              forked once the job is initialized (cross-section splines, flux,
+              geometry and max path lengths, ...) so that they share its memory.
+              The requested exposure (-n events or -e POT) is split between the
+              workers, each one using its own random number seed and writing
+              its own output event file, tagged with the worker index (eg
+              gntp.[run_number].w3.ghep.root), whose event tree weight is the
+              POT of the worker's sample. The numbers of events and flux
+              neutrinos and the POT are summed over the workers and the
+              normalization of the whole sample is printed at the end. They
+              are also written, along with the values and the output file of
+              each worker, to a summary file (gntp.[run_number].workers.txt).
+              The workers start reading the flux ntuples at evenly spaced
+              entries, shifted from the start entry picked by the flux driver.
+              A SIGTERM sent to the job is forwarded to all workers.
+              [default: 1]
 
          *** Examples:
 
@@ -278,6 +296,7 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <utility>
 #include <map>
 #include <algorithm>  // for transform()
 #include <fstream>
@@ -311,6 +330,7 @@
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/SystemUtils.h"
+#include "Framework/Utils/ForkedWorkers.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #include "Tools/Flux/GFluxDriverFactory.h"
@@ -339,6 +359,7 @@
 
 using std::string;
 using std::vector;
+using std::pair;
 using std::map;
 using std::ostringstream;
 
@@ -391,6 +412,7 @@ string          gOptEvFilePrefix;              // event file prefix
 int             gOptDebug = 0;                 // debug flags
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+unsigned int    gOptNWorkers;                  // number of worker processes
 
 bool            gSigTERM = false;              // was TERM signal sent?
 
@@ -647,13 +669,64 @@ int main(int argc, char ** argv)
     }
   }
 
+  // Name the output event file (opened by each worker, see below)
+  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  string ntpsuffix = Form(".%s.root", NtpMCFormat::FilenameTag(kDefOptNtpFormat));
+
+  // *************************************************************************
+  // * Fork the worker processes, if requested, and split the exposure
+  // *************************************************************************
+
+  ForkedWorkers workers(gOptNWorkers);
+  if ( workers.Fork() < 0 ) {
+    workers.ForwardSignal(SIGTERM);
+    bool ok = workers.Wait();
+    LOG("gevgen_fnal", pNOTICE)
+        << "\n >> N of worker processes:                   " << workers.NWorkers()
+        << "\n >> N of flux v read-in by flux drivers:     " << workers.Sum(2)
+        << "\n >> N of flux v thrown to event gen drivers: " << workers.Sum(1)
+        << "\n >> N of generated v interactions:           " << workers.Sum(0);
+    vector<string> names;
+    names.push_back("events");
+    names.push_back("flux_neutrinos_thrown");
+    names.push_back("flux_neutrinos_read");
+    names.push_back("exposure");
+    vector< pair<string,double> > derived;
+    if ( ! gOptUsingHistFlux && gOptUsingRootGeom && fluxExposureI ) {
+      double fpot = workers.Sum(3);                // exposure used by all workers
+      double psc  = mcj_driver->GlobProbScale();  // interaction prob. scale
+      LOG("gevgen_fnal", pNOTICE)
+        << "\n ** Normalization for generated sample:      " << fpot/psc
+        << " " << fluxExposureI->GetExposureUnits() << " * detector";
+      derived.push_back(pair<string,double>("interaction_prob_scale", psc));
+      derived.push_back(pair<string,double>("normalization", fpot/psc));
+    }
+    ok = workers.WriteSummary(
+       ForkedWorkers::SummaryFilename(ntpw.Filename(), ntpsuffix),
+       names, derived) && ok;
+    delete geom_driver;
+    delete flux_driver;
+    delete mcj_driver;
+    return (ok) ? 0 : 1;
+  }
+  // this worker's share of the requested exposure
+  int    iev0 = (gOptNev > 0) ? workers.First(gOptNev) : 0;
+  int    nev  = (gOptNev > 0) ? workers.Share(gOptNev) : gOptNev;
+  double wpot = (gOptPOT > 0) ? gOptPOT / workers.NWorkers() : gOptPOT;
+
+  // the flux driver picked its start entry before the fork: move it so that
+  // the workers read the flux entries from evenly spaced starting points
+  if ( fluxFileConfigI && workers.NWorkers() > 1 ) {
+    fluxFileConfigI->ShiftStartEntry(double(workers.Worker()) / workers.NWorkers());
+  }
+
   // *************************************************************************
   // * Prepare for writing the output event tree & status file
   // *************************************************************************
 
   // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilename(workers.TagFilename(ntpw.Filename(), ntpsuffix));
   ntpw.Initialize();
 
 
@@ -701,6 +774,7 @@ int main(int argc, char ** argv)
 
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
+  mcjmonitor.CustomizeFilename(workers.TagFilename(mcjmonitor.Filename()));
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
 
   // *************************************************************************
@@ -710,7 +784,7 @@ int main(int argc, char ** argv)
   // define handler to allow signal to end job gracefully
   signal(SIGTERM,gsSIGTERMhandler);
 
-  int ievent = 0;
+  int ievent = iev0;
   while ( ! gSigTERM )
   {
      LOG("gevgen_fnal", pINFO)
@@ -718,15 +792,15 @@ int main(int argc, char ** argv)
 
      // In case the required statistics was expressed as 'number of events'
      // then quit if that number has been generated
-     if ( ievent == gOptNev ) break;
+     if ( ievent == iev0 + nev ) break;
 
      // In case the required statistics was expressed as 'number of POT'
      // then exit the event loop if the requested POT has been generated.
-     if ( gOptPOT > 0 && fluxExposureI ) {
+     if ( wpot > 0 && fluxExposureI ) {
         double fpot = fluxExposureI->GetTotalExposure(); // current POTs used
         double psc  = mcj_driver->GlobProbScale();  // interaction prob. scale
         double pot  = fpot / psc;                   // POTs for generated sample
-        if ( pot >= gOptPOT ) break;
+        if ( pot >= wpot ) break;
      }
 
      // Generate a single event using neutrinos coming from the specified flux
@@ -781,6 +855,9 @@ int main(int argc, char ** argv)
   // * Print job statistics &
   // * calculate normalization factor for the generated sample
   // *************************************************************************
+  vector<double> norm(4, 0.);
+  norm[0] = ievent - iev0;
+  norm[1] = mcj_driver->NFluxNeutrinos();
   if ( ! gOptUsingHistFlux && gOptUsingRootGeom ) {
     // POT normalization will only be calculated if event generation was based
     // on beam simulation ntuples (not just histograms) & a detailed detector
@@ -807,19 +884,22 @@ int main(int argc, char ** argv)
        LOG("gevgen_fnal", pFATAL) << "MCJobDriver GlobalProbScale was " << psc;
     }
     double pot   = fpot / psc;                       // POT for generated sample
-    long int nev = ievent;
+    long int nevt = ievent - iev0;
 
     LOG("gevgen_fnal", pNOTICE)
         << "\n >> Interaction probability scaling factor:  " << psc
         << "\n >> using: " << gOptFluxDriver
         << "\n >> N of flux v read-in by flux driver:      " << nflx
         << "\n >> N of flux v thrown to event gen driver:  " << nflx_evg
-        << "\n >> N of generated v interactions:           " << nev
+        << "\n >> N of generated v interactions:           " << nevt
         << "\n ** Normalization for generated sample:      " << pot
         << " " << exposureUnits << " * detector";
 
     ntpw.EventTree()->SetWeight(pot); // store POT
 
+    norm[2] = nflx;
+    norm[3] = fpot;
+
   }
 
   // *************************************************************************
@@ -829,6 +909,9 @@ int main(int argc, char ** argv)
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // Report the normalization of this worker's sample (workers exit here)
+  workers.Finish(norm, vector<string>(1, ntpw.Filename()));
+
   // Clean-up
   delete geom_driver;
   delete flux_driver;
@@ -1150,6 +1233,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  } else {
+    gOptNWorkers = 1;
+  }
+
 
   //
   // >>> perform 'sanity' checks on command line arguments
@@ -1261,6 +1352,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_fnal", pNOTICE)
      << "\n - Run number: " << gOptRunNu
      << "\n - Random number seed: " << gOptRanSeed
+     << "\n - Worker processes: " << gOptNWorkers
      << "\n - Using cross-section file: " << gOptInpXSecFile
      << "\n - Flux     @ " << fluxinfo.str()
      << "\n - Geometry @ " << gminfo.str()
@@ -1289,6 +1381,7 @@ void PrintSyntax(void)
    << "\n            [--event-record-print-level level]"
    << "\n            [--mc-job-status-refresh-rate  rate]"
    << "\n            [--cache-file root_file]"
+   << "\n            [--workers n_of_worker_processes]"
    << "\n"
    << " Please also read the detailed documentation at "
    << "$GENIE/src/Apps/gFNALExptEvGen.cxx"
@@ -17,6 +17,8 @@
                   [-n nknots]
                   [-e max_energy]
                   [--no-copy]
+                  [--max-xsec-tables]
+                  [--knot-tolerance tolerance]
                   [--seed random_number_seed]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
@@ -50,6 +52,21 @@
                generating thread.
            --no-copy
                Does not write out the input cross-sections in the output file
+           --max-xsec-tables
+               Also tabulates, vs energy, the maximum differential cross
+               sections used by the kinematics generators in their
+               accept/reject loops, and writes them in the output file.
+               When loaded, they are used from the first generated event
+               instead of being computed (and cached) on the fly.
+           --knot-tolerance
+               Places the spline knots adaptively: starting from a coarse
+               grid, intervals are bisected until the spline misses the
+               cross section computed at their midpoint by less than the
+               input relative tolerance (eg. 0.002). The number of knots
+               set with -n becomes an upper limit. Fewer cross section
+               integrals are needed for smooth splines, and knots gather
+               near thresholds and resonant structures.
+               Default: off (evenly spaced knots)
            --seed
               Random number seed.
            --input-cross-sections
@@ -134,6 +151,8 @@ string   gOptGeomFilename   = "";
 int      gOptNKnots         = -1;
 double   gOptMaxE           = -1.;
 bool     gOptNoCopy         = false;
+bool     gOptMaxXSecTables  = false;
+double   gOptKnotTolerance  = 0.;   // adaptive knot placement tolerance
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
@@ -160,6 +179,8 @@ int main(int argc, char ** argv)
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
+  XSecSplineList::Instance()->SetKnotTolerance(gOptKnotTolerance);
+
   // Get list of neutrinos and nuclear targets
 
   PDGCodeList * neutrinos = GetNeutrinoCodes();
@@ -193,7 +214,7 @@ int main(int argc, char ** argv)
       GEVGDriver driver;
       driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
       driver.Configure(init_state);
-      driver.CreateSplines(gOptNKnots, gOptMaxE);
+      driver.CreateSplines(gOptNKnots, gOptMaxE, true, gOptMaxXSecTables);
     }
   }
 
@@ -262,6 +283,20 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNoCopy = true;
   }
 
+  // tabulate max differential cross sections too?
+  if( parser.OptionExists("max-xsec-tables") ) {
+    LOG("gmkspl", pINFO) << "Tabulating max differential cross sections";
+    gOptMaxXSecTables = true;
+  }
+
+  // adaptive knot placement?
+  if( parser.OptionExists("knot-tolerance") ) {
+    LOG("gmkspl", pINFO) << "Reading knot tolerance";
+    gOptKnotTolerance = parser.ArgAsDouble("knot-tolerance");
+  } else {
+    gOptKnotTolerance = 0.;
+  }
+
   // comma-separated neutrino PDG code list
   if( parser.OptionExists('p') ) {
     LOG("gmkspl", pINFO) << "Reading neutrino PDG codes";
@@ -338,6 +373,8 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
      << "\n Random number seed : " << gOptRanSeed
+     << "\n Max xsec tables : " << ((gOptMaxXSecTables) ? "yes" : "no")
+     << "\n Knot tolerance : " << gOptKnotTolerance
      << "\n";
 
   LOG("gmkspl", pNOTICE) << *RunOpt::Instance();
@@ -350,6 +387,8 @@ void PrintSyntax(void)
     << "   gmkspl -p nupdg <-t tgtpdg, -f geomfile> "
     << " <-o | --output-cross-section> xsec_xml_file_name"
     << " [-n nknots] [-e max_energy] "
+    << " [--no-copy] [--max-xsec-tables]"
+    << " [--knot-tolerance tolerance]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
@@ -40,6 +40,7 @@
                       [--event-record-print-level level]
                       [--mc-job-status-refresh-rate  rate]
                       [--cache-file root_file]
+                      [--workers n_of_worker_processes]
 
          *** Options :
 
@@ -319,6 +320,23 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --workers
+              Splits the job between the specified number of worker processes,
+              forked once the job is initialized (cross-section splines, flux
+              ntuple, geometry and max path lengths, flux interaction
+              probabilities, ...) so that they share its memory.
+              The requested exposure (-n events, -c flux cycles or -e, -E POT)
+              is split between the workers, each one using its own random
+              number seed and writing its own output event file, tagged with
+              the worker index (eg gntp.[run_number].w3.ghep.root), whose event
+              tree weight is the POT of the worker's sample. The numbers of
+              events and flux neutrinos and the POT are summed over the workers
+              and the normalization of the whole sample is printed at the end.
+              They are also written, along with the values and the output file
+              of each worker, to a summary file (gntp.[run_number].workers.txt).
+              The workers start reading the flux ntuple at evenly spaced
+              entries, shifted from the (-R random or first) start entry.
+              [default: 1]
 
          *** Examples:
 
@@ -416,6 +434,7 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <utility>
 #include <map>
 
 #include <TSystem.h>
@@ -449,6 +468,7 @@
 #include "Framework/Utils/T2KEvGenMetaData.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/ForkedWorkers.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #include "Tools/Flux/GJPARCNuFlux.h"
@@ -463,6 +483,7 @@
 
 using std::string;
 using std::vector;
+using std::pair;
 using std::map;
 using std::ostringstream;
 
@@ -507,6 +528,7 @@ string          gOptSaveFluxProbsFileName;     // output filename for pre-genera
 bool            gOptRandomFluxOffset = false;  // start looping over flux file from random start entry
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+unsigned int    gOptNWorkers;                  // number of worker processes
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -735,6 +757,60 @@ int main(int argc, char ** argv)
     }
   } // Pre-calculated flux interaction probabilities
 
+  // Name the output event file (opened by each worker, see below)
+  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  string ntpsuffix = Form(".%s.root", NtpMCFormat::FilenameTag(kDefOptNtpFormat));
+
+  // *************************************************************************
+  // * Fork the worker processes, if requested, and split the exposure
+  // *************************************************************************
+
+  ForkedWorkers workers(gOptNWorkers);
+  if(workers.Fork() < 0) {
+    bool ok = workers.Wait();
+    LOG("gevgen_t2k", pNOTICE)
+        << "\n >> N of worker processes:                   " << workers.NWorkers()
+        << "\n >> N of flux v read-in by flux drivers:     " << workers.Sum(2)
+        << "\n >> N of flux v thrown to event gen drivers: " << workers.Sum(1)
+        << "\n >> N of generated v interactions:           " << workers.Sum(0);
+    vector<string> names;
+    names.push_back("events");
+    names.push_back("flux_neutrinos_thrown");
+    names.push_back("flux_neutrinos_read");
+    names.push_back("flux_pot");
+    vector< pair<string,double> > derived;
+    if(!gOptUsingHistFlux && gOptUsingRootGeom) {
+      double fpot = workers.Sum(3);                // flux POT used by all workers
+      double psc  = mcj_driver->GlobProbScale();  // interaction prob. scale
+      LOG("gevgen_t2k", pNOTICE)
+        << "\n >> Actual JNUBEAM flux file normalization:  " << fpot
+            << " POT * " << ((gOptDetectorLocation == "sk") ? "cm^2" : "det")
+        << "\n ** Normalization for generated sample:      " << fpot/psc
+            << " POT * " << ((gOptDetectorLocation == "sk") ? "cm^2" : "det");
+      derived.push_back(pair<string,double>("interaction_prob_scale", psc));
+      derived.push_back(pair<string,double>("pot", fpot/psc));
+    }
+    ok = workers.WriteSummary(
+       ForkedWorkers::SummaryFilename(ntpw.Filename(), ntpsuffix),
+       names, derived) && ok;
+    delete geom_driver;
+    delete flux_driver;
+    delete mcj_driver;
+    return (ok) ? 0 : 1;
+  }
+  // this worker's share of the requested exposure
+  int    iev0 = (gOptNev > 0) ? workers.First(gOptNev) : 0;
+  int    nev  = (gOptNev > 0) ? workers.Share(gOptNev) : gOptNev;
+  double wpot = (gOptPOT > 0) ? gOptPOT / workers.NWorkers() : gOptPOT;
+  int    nfc  = (gOptFluxNCycles > 0) ? workers.Share(gOptFluxNCycles) : gOptFluxNCycles;
+
+  // the flux driver set its start entry (offset) before the fork: move it so
+  // that the workers read the flux ntuple from evenly spaced entries
+  if(jparc_flux_driver && workers.NWorkers() > 1) {
+    jparc_flux_driver->ShiftStartEntry(double(workers.Worker()) / workers.NWorkers());
+  }
+
   // *************************************************************************
   // * Work out number of cycles for current exposure settings
   // *************************************************************************
@@ -742,11 +818,11 @@ int main(int argc, char ** argv)
   if(!gOptUsingHistFlux) {
     // If a number of POT was requested, then work out how many flux ntuple
     // cycles are required for accumulating those statistics
-    if(gOptPOT>0) {
+    if(wpot>0) {
       double fpot_1c = jparc_flux_driver->POT_1cycle(); // flux POT / cycle
       double psc     = mcj_driver->GlobProbScale();     // interaction prob. scale
       double pot_1c  = fpot_1c / psc;                   // actual POT / cycle
-      int    ncycles = (int) TMath::Max(1., TMath::Ceil(gOptPOT/pot_1c));
+      int    ncycles = (int) TMath::Max(1., TMath::Ceil(wpot/pot_1c));
 
       LOG("gevgen_t2k", pNOTICE)
          << " *** POT/cycle:  " << pot_1c;
@@ -758,12 +834,12 @@ int main(int argc, char ** argv)
     }
     // If a number of events was requested, then set the number of flux
     // ntuple cycles to 'infinite'
-    else if(gOptNev>0) {
+    else if(nev>0) {
        jparc_flux_driver->SetNumOfCycles(0);
     }
     // Just set the number of cycles to the requested value
     else {
-       jparc_flux_driver->SetNumOfCycles(gOptFluxNCycles);
+       jparc_flux_driver->SetNumOfCycles(nfc);
     }
   }
 
@@ -772,8 +848,7 @@ int main(int argc, char ** argv)
   // *************************************************************************
 
   // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilename(workers.TagFilename(ntpw.Filename(), ntpsuffix));
   ntpw.Initialize();
 
   // Add a custom-branch at the standard GENIE event tree so that
@@ -788,13 +863,14 @@ int main(int argc, char ** argv)
 
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
+  mcjmonitor.CustomizeFilename(workers.TagFilename(mcjmonitor.Filename()));
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
 
   // *************************************************************************
   // * Event generation loop
   // *************************************************************************
 
-  int ievent = 0;
+  int ievent = iev0;
   while (1)
   {
      LOG("gevgen_t2k", pNOTICE)
@@ -802,18 +878,18 @@ int main(int argc, char ** argv)
 
      // In case the required statistics was expressed as 'number of events'
      // then quit if that number has been generated
-     if(ievent == gOptNev) break;
+     if(ievent == iev0 + nev) break;
 
      // In case the required statistics was expressed as 'number of POT' and
      // the user does not want to wait till the end of the flux cycle to exit
      // the event loop, then quit if the requested POT has been generated.
      // In this case the computed POT may not be as accurate as if the program
      // was waiting for the current flux cycle to be completed.
-     if(!gOptExitAtEndOfFullFluxCycles && gOptPOT>0) {
+     if(!gOptExitAtEndOfFullFluxCycles && wpot>0) {
         double fpot = jparc_flux_driver->POT_curravg(); // current POT in flux file
         double psc  = mcj_driver->GlobProbScale();      // interaction prob. scale
         double pot  = fpot / psc;                       // POT for generated sample
-        if(pot >= gOptPOT) break;
+        if(pot >= wpot) break;
      }
 
      // Generate a single event using neutrinos coming from the specified flux
@@ -863,6 +939,9 @@ int main(int argc, char ** argv)
   // * Print job statistics &
   // * calculate normalization factor for the generated sample
   // *************************************************************************
+  vector<double> norm(4, 0.);
+  norm[0] = ievent - iev0;
+  norm[1] = mcj_driver->NFluxNeutrinos();
   if(!gOptUsingHistFlux && gOptUsingRootGeom)
   {
     // POT normalization will only be calculated if event generation was based
@@ -876,7 +955,7 @@ int main(int argc, char ** argv)
     // of neutrino interactions actually generated
     long int nflx_evg = mcj_driver        -> NFluxNeutrinos();
     long int nflx     = jparc_flux_driver -> NFluxNeutrinos();
-    long int nev      = ievent;
+    long int nevt     = ievent - iev0;
 
     LOG("gevgen_t2k", pNOTICE)
         << "\n >> Actual JNUBEAM flux file normalization:  " << fpot
@@ -884,11 +963,14 @@ int main(int argc, char ** argv)
         << "\n >> Interaction probability scaling factor:  " << psc
         << "\n >> N of flux v read-in by flux driver:      " << nflx
         << "\n >> N of flux v thrown to event gen driver:  " << nflx_evg
-        << "\n >> N of generated v interactions:           " << nev
+        << "\n >> N of generated v interactions:           " << nevt
         << "\n ** Normalization for generated sample:      " << pot
             << " POT * " << ((gOptDetectorLocation == "sk") ? "cm^2" : "det");
 
     ntpw.EventTree()->SetWeight(pot); // POT
+
+    norm[2] = nflx;
+    norm[3] = fpot;
   }
 
   // *************************************************************************
@@ -917,6 +999,9 @@ int main(int argc, char ** argv)
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // Report the normalization of this worker's sample (workers exit here)
+  workers.Finish(norm, vector<string>(1, ntpw.Filename()));
+
   // Clean-up
   delete geom_driver;
   delete flux_driver;
@@ -1328,6 +1413,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen_t2k", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  } else {
+    gOptNWorkers = 1;
+  }
+
   //
   // >>> perform 'sanity' checks on command line arguments
   //
@@ -1358,6 +1451,13 @@ void GetCommandLineArgs(int argc, char ** argv)
        exit(1);
     }
   }
+  // The flux ntuple cycles are split between workers: at least one each
+  if(gOptFluxNCycles > 0 && gOptNWorkers > (unsigned int) gOptFluxNCycles) {
+     LOG("gevgen_t2k", pWARN)
+       << "** Only " << gOptFluxNCycles << " flux ntuple cycles requested: "
+       << "using " << gOptFluxNCycles << " worker processes";
+     gOptNWorkers = gOptFluxNCycles;
+  }
   // If we use a flux histograms (not JNUBEAM flux ntuples) then -currently- the
   // only way to control exposure is via a number of events
   if(gOptUsingHistFlux) {
@@ -1452,6 +1552,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_t2k", pNOTICE)
      << "\n -  Run number: " << gOptRunNu
      << "\n -  Random number seed: " << gOptRanSeed
+     << "\n -  Worker processes: " << gOptNWorkers
      << "\n - Using cross-section file: " << gOptInpXSecFile
      << "\n - Flux     @ " << fluxinfo.str()
      << "\n - Geometry @ " << gminfo.str()
@@ -1488,6 +1589,7 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--workers n_of_worker_processes]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << " or look at the source code: $GENIE/src/Apps/gT2KEvGen.cxx"
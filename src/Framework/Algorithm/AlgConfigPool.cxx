@@ -22,6 +22,8 @@
    Use the GetXMLFilePath() to search the potential XML config file locations
    and return the first actual file that can be found. Adapt code to use the
    utils::xml namespace.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Instance() is thread-safe. The pool is only read once loaded.
 */
 //____________________________________________________________________________
 
@@ -29,6 +31,8 @@
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
+#include <mutex>
+#include <atomic>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -62,6 +66,11 @@ namespace genie {
   }
 }
 //____________________________________________________________________________
+namespace {
+  std::mutex                    gConfigPoolMutex;  ///< serializes loading
+  std::atomic<AlgConfigPool *>  gInstance(0);      ///< for lock-free reads
+}
+//____________________________________________________________________________
 AlgConfigPool * AlgConfigPool::fInstance = 0;
 //____________________________________________________________________________
 AlgConfigPool::AlgConfigPool()
@@ -94,16 +103,23 @@ AlgConfigPool::~AlgConfigPool()
   fRegistryPool.clear();
   fConfigFiles.clear();
   fConfigKeyList.clear();
+  gInstance.store(0);
   fInstance = 0;
 }
 //____________________________________________________________________________
 AlgConfigPool * AlgConfigPool::Instance()
 {
+  AlgConfigPool * instance = gInstance.load(std::memory_order_acquire);
+  if(instance) return instance;
+
+  std::lock_guard<std::mutex> lock(gConfigPoolMutex);
+
   if(fInstance == 0) {
     static AlgConfigPool::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
     fInstance = new AlgConfigPool;
   }
+  gInstance.store(fInstance, std::memory_order_release);
   return fInstance;
 }
 //____________________________________________________________________________
@@ -16,11 +16,19 @@
  @ Oct 20, 2009 - CA
    Added argument in ForceReconfiguration() to ignore algorithm opt-outs.
    Default is to respect opt-outs.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Made GetAlgorithm(), AdoptAlgorithm() and Instance() thread-safe. Lookups
+   go through an immutable snapshot of the pool without locking.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Replaced the pool snapshots (a full copy of the pool per added algorithm)
+   by a per-thread map of the algorithms already looked up.
 */
 //____________________________________________________________________________
 
 #include <iostream>
 #include <cstdlib>
+#include <mutex>
+#include <atomic>
 
 #include <TROOT.h>
 #include <TClass.h>
@@ -34,6 +42,28 @@ using std::endl;
 
 using namespace genie;
 
+//____________________________________________________________________________
+namespace {
+
+  // Serializes the instantiation of the singleton and of algorithms.
+  // Recursive, as configuring an algorithm fetches its sub-algorithms.
+  std::recursive_mutex gAlgFactoryMutex;
+
+  // The singleton, for lock-free reads
+  std::atomic<AlgFactory *> gInstance(0);
+
+  // Algorithms looked up by the calling thread, for lock-free lookups.
+  // Algorithms stay in the pool as long as the factory exists; the maps are
+  // emptied when they were filled from a factory since deleted.
+  std::atomic<unsigned long> gPoolGeneration(0); ///< incremented by ~AlgFactory
+  struct ThreadAlgs_t {
+    ThreadAlgs_t() : Generation(0) {}
+    unsigned long            Generation;
+    map<string, Algorithm *> Algs;
+  };
+  thread_local ThreadAlgs_t gThreadAlgs;
+}
+
 //____________________________________________________________________________
 namespace genie {
   ostream & operator<<(ostream & stream, const AlgFactory & algf)
@@ -69,17 +99,27 @@ AlgFactory::~AlgFactory()
     }
   }
   fAlgPool.clear();
+
+  gPoolGeneration.fetch_add(1, std::memory_order_release);
+
+  gInstance.store(0);
   fInstance = 0;
 }
 //____________________________________________________________________________
 AlgFactory * AlgFactory::Instance()
 {
+  AlgFactory * instance = gInstance.load(std::memory_order_acquire);
+  if(instance) return instance;
+
+  std::lock_guard<std::recursive_mutex> lock(gAlgFactoryMutex);
+
   if(fInstance == 0) {
     static AlgFactory::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
 
     fInstance = new AlgFactory;
   }
+  gInstance.store(fInstance, std::memory_order_release);
   return fInstance;
 }
 //____________________________________________________________________________
@@ -100,11 +140,29 @@ const Algorithm * AlgFactory::GetAlgorithm(string name, string config)
   SLOG("AlgFactory", pDEBUG)
       << "Algorithm: " << key << " requested from AlgFactory";
 
+  // look-up the algorithms already requested by this thread (no locking)
+  unsigned long generation = gPoolGeneration.load(std::memory_order_acquire);
+  if(gThreadAlgs.Generation != generation) {
+     gThreadAlgs.Algs.clear();
+     gThreadAlgs.Generation = generation;
+  }
+  map<string, Algorithm *>::const_iterator thread_iter =
+                                               gThreadAlgs.Algs.find(key);
+  if(thread_iter != gThreadAlgs.Algs.end()) {
+     LOG("AlgFactory", pDEBUG) << key << " algorithm found in memory";
+     return thread_iter->second;
+  }
+
+  // not found: look in the pool & instantiate the algorithm if needed,
+  // holding the lock
+  std::lock_guard<std::recursive_mutex> lock(gAlgFactoryMutex);
+
   map<string, Algorithm *>::const_iterator alg_iter = fAlgPool.find(key);
   bool found = (alg_iter != fAlgPool.end());
 
   if(found) {
      LOG("AlgFactory", pDEBUG) << key << " algorithm found in memory";
+     gThreadAlgs.Algs.insert(*alg_iter);
      return alg_iter->second;
   } else {
      //-- instantiate the factory
@@ -114,6 +172,7 @@ const Algorithm * AlgFactory::GetAlgorithm(string name, string config)
      if(alg_base) {
         pair<string, Algorithm *> key_alg_pair(key, alg_base);
         fAlgPool.insert(key_alg_pair);
+        gThreadAlgs.Algs.insert(key_alg_pair);
      } else {
         LOG("AlgFactory", pFATAL)
             << "Algorithm: " << key << " could not be instantiated";
@@ -135,6 +194,8 @@ Algorithm * AlgFactory::AdoptAlgorithm(const AlgId & algid) const
 //____________________________________________________________________________
 Algorithm * AlgFactory::AdoptAlgorithm(string name, string config) const
 {
+   std::lock_guard<std::recursive_mutex> lock(gAlgFactoryMutex);
+
    Algorithm * alg_base = InstantiateAlgorithm(name, config);
    return alg_base;
 }
@@ -144,6 +205,8 @@ void AlgFactory::ForceReconfiguration(bool ignore_alg_opt_out)
   LOG("AlgFactory", pNOTICE)
        << " ** Forcing algorithm re-configuration";
 
+  std::lock_guard<std::recursive_mutex> lock(gAlgFactoryMutex);
+
   map<string, Algorithm *>::iterator alg_iter = fAlgPool.begin();
   for( ; alg_iter != fAlgPool.end(); ++alg_iter) {
     Algorithm * alg = alg_iter->second;
@@ -5,6 +5,13 @@
 
 \brief    The GENIE Algorithm Factory.
 
+          GetAlgorithm() can be called concurrently from several threads.
+          Each thread keeps the algorithms it has already looked up in its
+          own map, so that repeated lookups take no lock. Other lookups, and
+          the instantiation & configuration of new algorithms, are
+          serialized. An algorithm is added to the pool, and becomes
+          visible to other threads, only once it is configured.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -13,6 +20,10 @@
 \cpright  Copyright (c) 2003-2018, The GENIE Collaboration
           For the full text of the license visit http://copyright.genie-mc.org
           or see $GENIE/LICENSE
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   GetAlgorithm() and Instance() are thread-safe; lookups are lock-free.
 */
 //____________________________________________________________________________
 
@@ -56,6 +67,7 @@ public:
   //! Forces a reconfiguration of all algorithms kept at the factory pool.
   //! The algorithms look up their nominal configuration from the config pool.
   //! Use that to propagate modifications made directly at the config pool.
+  //! Not to be called while other threads are using the algorithms.
   void ForceReconfiguration(bool ignore_alg_opt_out=false);
 
   //! print algorithm factory
@@ -10,13 +10,15 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added KeyHash(), computed once with the key.
 */
 //____________________________________________________________________________
 
 #include <sstream>
 
 #include "Framework/Algorithm/AlgId.h"
+#include "Framework/Utils/HashUtils.h"
 
 using std::ostringstream;
 
@@ -103,13 +105,15 @@ void AlgId::UpdateKey(void)
   key << this->Name();
   if(this->Config().size() > 0) key << "/" << this->Config();
 
-  fKey = key.str();
+  fKey     = key.str();
+  fKeyHash = utils::hash::String(fKey);
 }
 //____________________________________________________________________________
 void AlgId::Init(void)
 {
-  this->fName   = "";
-  this->fConfig = "";
-  this->fKey    = "";
+  this->fName    = "";
+  this->fConfig  = "";
+  this->fKey     = "";
+  this->fKeyHash = utils::hash::String(fKey);
 }
 //____________________________________________________________________________
@@ -22,6 +22,8 @@
 #include <string>
 #include <iostream>
 
+#include <Rtypes.h>
+
 #include "Framework/Registry/RegistryItemTypeDef.h"
 
 using std::string;
@@ -42,9 +44,10 @@ public:
   AlgId(const RgAlg & registry_item);
  ~AlgId();
 
-  string Name   (void) const { return fName;   }
-  string Config (void) const { return fConfig; }
-  string Key    (void) const { return fKey;    }
+  const string & Name    (void) const { return fName;    }
+  const string & Config  (void) const { return fConfig;  }
+  const string & Key     (void) const { return fKey;     }
+  ULong64_t      KeyHash (void) const { return fKeyHash; } ///< hash of Key()
 
   void   SetId     (string name, string config="");
   void   SetName   (string name);
@@ -63,6 +66,7 @@ private:
   string fName;   ///< Algorithm name (including namespaces)
   string fConfig; ///< Configuration set name
   string fKey;    ///< Unique key: namespace::alg_name/alg_config
+  ULong64_t fKeyHash; //! Hash of the key, see utils::hash::String()
 };
 
 }       // genie namespace
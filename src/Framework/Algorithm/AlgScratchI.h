@@ -0,0 +1,44 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AlgScratchI
+
+\brief    Base class for the per-thread scratch state of an Algorithm.
+
+          Algorithms handed out by the AlgFactory are shared: once configured
+          they are only read, and may be used by several threads at once.
+          Anything an algorithm needs to modify while processing an event
+          (phase space generators, the weight of the last generated system,
+          intermediate results passed between its methods...) belongs in a
+          subclass of AlgScratchI rather than in `mutable` data members.
+          The algorithm creates it in NewScratch() and retrieves it with
+          Algorithm::Scratch(), which returns a separate instance for each
+          calling thread. Instances are deleted when their thread exits.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _ALG_SCRATCH_I_H_
+#define _ALG_SCRATCH_I_H_
+
+namespace genie {
+
+class AlgScratchI {
+
+public:
+  virtual ~AlgScratchI() {}
+
+protected:
+  AlgScratchI() {}
+};
+
+}      // genie namespace
+
+#endif // _ALG_SCRATCH_I_H_
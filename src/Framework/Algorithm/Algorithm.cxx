@@ -14,11 +14,16 @@
    Added fAllowReconfig private data member and AllowReconfig() method.
    Algorithms can set this method to opt-out of reconfiguration. Speeds up 
    reweighting if algorithms (that don't need to be reconfigured) opt out.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added Scratch(). The summary registry built by GetConfig() is built
+   under a lock.
 */
 //____________________________________________________________________________
 
 #include <vector>
 #include <string>
+#include <mutex>
+#include <atomic>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/Algorithm.h"
@@ -33,6 +38,29 @@ using std::endl;
 using namespace genie;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+namespace {
+
+  // Serializes the lazy building of the summary configuration registries
+  // (recursive: the summary of an algorithm includes those of its sub-algs)
+  std::recursive_mutex gConfigSummaryMutex;
+
+  // Source of the Algorithm::fScratchKey values. Keys are never reused, so
+  // that a scratch instance left behind by a deleted algorithm can not be
+  // returned to a new algorithm allocated at the same address.
+  std::atomic<ULong64_t> gNextScratchKey(1);
+
+  // Scratch instances of the calling thread, by algorithm key
+  struct ThreadScratchPool {
+    map<ULong64_t, AlgScratchI *> scratch;
+    ~ThreadScratchPool() {
+      map<ULong64_t, AlgScratchI *>::iterator it = scratch.begin();
+      for( ; it != scratch.end(); ++it) delete it->second;
+    }
+  };
+  thread_local ThreadScratchPool gThreadScratch;
+}
+
 //____________________________________________________________________________
 namespace genie
 {
@@ -236,6 +264,8 @@ void Algorithm::FindConfig(void)
 
 const Registry & Algorithm::GetConfig(void) const {
 
+  std::lock_guard<std::recursive_mutex> lock(gConfigSummaryMutex);
+
   if ( fConfig ) return * fConfig ;
 
   const_cast<Algorithm*>( this ) -> fConfig = new Registry( fID.Key() + "_summary", false ) ;
@@ -331,6 +361,22 @@ void Algorithm::Initialize(void)
   fOwnsSubstruc   = false;
   fConfig         = 0;
   fOwnedSubAlgMp  = 0;
+  fScratchKey     = gNextScratchKey++;
+}
+//____________________________________________________________________________
+AlgScratchI * Algorithm::Scratch(void) const
+{
+// Returns the calling thread's scratch state for this algorithm, creating
+// it at the first call. No locking is needed: each thread has its own pool.
+
+  map<ULong64_t, AlgScratchI *> & pool = gThreadScratch.scratch;
+
+  map<ULong64_t, AlgScratchI *>::const_iterator it = pool.find(fScratchKey);
+  if(it != pool.end()) return it->second;
+
+  AlgScratchI * scratch = this->NewScratch();
+  pool.insert(map<ULong64_t, AlgScratchI *>::value_type(fScratchKey, scratch));
+  return scratch;
 }
 //____________________________________________________________________________
 const Algorithm * Algorithm::SubAlg(const RgKey & registry_key) const
@@ -16,6 +16,11 @@
 \cpright  Copyright (c) 2003-2018, The GENIE Collaboration
           For the full text of the license visit http://copyright.genie-mc.org
           or see $GENIE/LICENSE
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added Scratch() / NewScratch(): per-thread state for algorithms shared
+   by several threads. GetConfig() can be called concurrently.
 */
 //____________________________________________________________________________
 
@@ -27,10 +32,13 @@
 #include <cassert>
 #include <map>
 
+#include <Rtypes.h>
+
 #include "Framework/Algorithm/AlgStatus.h"
 #include "Framework/Algorithm/AlgCmp.h"
 #include "Framework/Algorithm/AlgId.h"
 #include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Algorithm/AlgScratchI.h"
 #include "Framework/Registry/Registry.h"
 #include "Framework/Registry/RegistryItemTypeDef.h"
 #include "Framework/Messenger/Messenger.h"
@@ -130,6 +138,11 @@ public:
   //! data fitting or reweighting
   void AdoptSubstructure (void);
 
+  //! Per-thread scratch state (see AlgScratchI): the calling thread's
+  //! instance, created by NewScratch() at the first call from each thread.
+  //! Returns 0 for algorithms without scratch state.
+  AlgScratchI * Scratch (void) const;
+
   //! Print algorithm info
   virtual void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const Algorithm & alg);
@@ -143,6 +156,10 @@ protected:
   void DeleteConfig       (void);
   void DeleteSubstructure (void);
 
+  //! Create the scratch state returned by Scratch() (owned by the caller).
+  //! Algorithms keeping per-event state override it.
+  virtual AlgScratchI * NewScratch (void) const { return 0; }
+
   //! Split an incoming configuration Registry into a block valid for this algorithm
   //! Ownership of the returned registry belongs to the algo
   Registry * ExtractLocalConfig( const Registry & in ) const ;
@@ -186,6 +203,7 @@ protected:
 private:
 
   Registry *   fConfig;        ///< Summary configuration derived from fConvVect, not necessarily allocated
+  ULong64_t    fScratchKey;    ///< unique key of this instance in the per-thread scratch pools
 
 };
 
@@ -214,6 +214,19 @@ const XSecAlgorithmI * EventGenerator::CrossSectionAlg(void) const
   return fXSecModel;
 }
 //___________________________________________________________________________
+void EventGenerator::CreateMaxXSecSpline(
+     const XSecAlgorithmI * xsec_alg, const Interaction * interaction,
+     int nknots, double e_min, double e_max) const
+{
+  vector<const EventRecordVisitorI *>::const_iterator miter;
+  for(miter = fEVGModuleVec->begin();
+      miter != fEVGModuleVec->end(); ++miter)
+  {
+    const EventRecordVisitorI * visitor = *miter;
+    visitor->CreateMaxXSecSpline(xsec_alg, interaction, nknots, e_min, e_max);
+  }
+}
+//___________________________________________________________________________
 void EventGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
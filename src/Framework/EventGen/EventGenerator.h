@@ -51,6 +51,11 @@ public :
   const InteractionListGeneratorI * IntListGenerator (void) const;
   const XSecAlgorithmI *            CrossSectionAlg  (void) const;
 
+  //-- forward the request for max xsec tabulation to all modules
+  void CreateMaxXSecSpline(
+          const XSecAlgorithmI * xsec_alg, const Interaction * interaction,
+          int nknots, double e_min, double e_max) const;
+
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
   void Configure (const Registry & config);
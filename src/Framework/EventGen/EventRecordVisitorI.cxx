@@ -42,3 +42,10 @@ EventRecordVisitorI::~EventRecordVisitorI()
 
 }
 //___________________________________________________________________________
+void EventRecordVisitorI::CreateMaxXSecSpline(
+     const XSecAlgorithmI * /*xsec_alg*/, const Interaction * /*interaction*/,
+     int /*nknots*/, double /*e_min*/, double /*e_max*/) const
+{
+
+}
+//___________________________________________________________________________
@@ -26,6 +26,8 @@
 namespace genie {
 
 class GHepRecord;
+class Interaction;
+class XSecAlgorithmI;
 
 class EventRecordVisitorI : public Algorithm {
 
@@ -37,6 +39,15 @@ public :
 
   virtual void ProcessEventRecord(GHepRecord * event_rec) const = 0;
 
+  //-- optionally, tabulate the maximum differential cross section used by
+  //   accept/reject methods as a function of energy, for the input interaction,
+  //   and store it in the XSecSplineList (it is then saved along with the
+  //   cross section splines). Does nothing by default.
+
+  virtual void CreateMaxXSecSpline(
+          const XSecAlgorithmI * xsec_alg, const Interaction * interaction,
+          int nknots, double e_min, double e_max) const;
+
 protected :
 
   EventRecordVisitorI();
@@ -87,11 +87,13 @@ void GEVGDriver::Init(void)
   // set of event generators to be loaded by this driver
   fEventGenList = "Default";
 
-  // 'depth' counter when entering a recursive mode to re-generate a failed/
-  // unphysical event - the driver is not allowed to go into arbitrarily large
-  // depths
+  // counter of attempts to re-generate a failed/unphysical event - the driver
+  // is not allowed to regenerate it more than kRecursiveModeMaxDepth times
   fNRecLevel = 0;
 
+  // event regeneration statistics for each selected interaction
+  fRetryStats.clear();
+
   // an "interaction" -> "generator" associative contained built for all
   // simulated interactions (from the loaded Event Generators and for the
   // input initial state)
@@ -104,6 +106,11 @@ void GEVGDriver::Init(void)
   // GMCJDriver for selecting an initial state.
   fXSecSumSpl = 0;
 
+  // The terms summed by XSecSum() (cross section algorithm and, if splines
+  // are used, spline for each interaction). Built at the first XSecSum() call
+  // and rebuilt whenever the interaction list or the use of splines changes.
+  fXSecSumTermsBuilt = false;
+
   // Default driver behaviour is to filter out unphysical events
   // If needed, set the fUnphysEventMask bitfield to get pre-selected types of
   // unphysical events (just set to 1 the bit you want ignored from the check).
@@ -121,12 +128,25 @@ void GEVGDriver::Init(void)
 //___________________________________________________________________________
 void GEVGDriver::CleanUp(void)
 {
+  bool regenerated = false;
+  map<ULong64_t, RetryStats_t>::const_iterator it = fRetryStats.begin();
+  for( ; it != fRetryStats.end(); ++it) {
+    regenerated = regenerated || (it->second.NRejected > 0);
+  }
+  if(regenerated) {
+    ostringstream stats;
+    this->PrintRetryStats(stats);
+    LOG("GEVGDriver", pNOTICE) << stats.str();
+  }
+
   if (fUnphysEventMask)  delete fUnphysEventMask;
   if (fInitState)        delete fInitState;
   if (fEvGenList)        delete fEvGenList;
   if (fIntSelector)      delete fIntSelector;
   if (fIntGenMap)        delete fIntGenMap;
   if (fXSecSumSpl)       delete fXSecSumSpl;
+
+  this->ClearXSecSumTerms();
 }
 //___________________________________________________________________________
 void GEVGDriver::Reset(void)
@@ -195,6 +215,8 @@ void GEVGDriver::BuildInteractionGeneratorMap(void)
   LOG("GEVGDriver", pINFO)
          << "Building the interaction -> generator associations...";
 
+  this->ClearXSecSumTerms();
+
   fIntGenMap = new InteractionGeneratorMap;
   fIntGenMap->UseGeneratorList(fEvGenList);
   fIntGenMap->BuildMap(*fInitState);
@@ -233,103 +255,176 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   InitialState init_state(*fInitState);
   init_state.SetProbeP4(nu4p);
 
-  //-- Select the interaction to be generated (amongst the entries of the
-  //   InteractionList assembled by the EventGenerators) and bootstrap the
-  //   event record
-  LOG("GEVGDriver", pINFO)
-     << "Selecting an Interaction & Bootstraping the EventRecord";
-  fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
-
-  if(!fCurrentRecord) {
-     LOG("GEVGDriver", pWARN)
-         << "No interaction could be selected for: "
-         << init_state.AsString() << " at E = " << nu4p.E() << " GeV";
-     return 0;
-  }
-
-  //-- Get a ptr to the interaction summary
-  LOG("GEVGDriver", pDEBUG) << "Getting the selected interaction";
-  Interaction * interaction = fCurrentRecord->Summary();
-
-  //-- Find the appropriate concrete EventGeneratorI implementation
-  //   for generating this event.
-  //
-  //   The right EventGeneratorI will be selecting by iterating over the
-  //   entries of the EventGeneratorList and compare the interaction
-  //   against the ValidityContext declared by each EventGeneratorI
-  //
-  //   (note: use of the 'Chain of Responsibility' Design Pattern)
+  // The selected interaction, as it was before being processed by the event
+  // generator, and its cross section. Kept so that the same interaction can
+  // be generated again (in the same event record) if the event was rejected
+  // only because its kinematics could not be generated.
+  Interaction *  selected      = 0;
+  double         selected_xsec = 0;
+  RetryStats_t * stats         = 0;
 
-  LOG("GEVGDriver", pINFO) << "Finding an appropriate EventGenerator";
-
-  const EventGeneratorI * evgen = fIntGenMap->FindGenerator(interaction);
-  assert(evgen);
+  fCurrentRecord = 0;
 
-  RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
-  rtinfo->UpdateRunningThread(evgen);
+  for(fNRecLevel = 0; fNRecLevel <= kRecursiveModeMaxDepth; fNRecLevel++) {
 
-  //-- Generate the selected event
-  //
-  //   The selected EventGeneratorI subclass will start processing the
-  //   event record (by sequentially asking each entry in its list of
-  //   EventRecordVisitorI subclasses to visit and process the record).
-  //   Most of the actual event generation takes place in this step.
-  //
-  //   (note: use of the 'Visitor' Design Pattern)
+    if(!selected) {
+      //-- Select the interaction to be generated (amongst the entries of the
+      //   InteractionList assembled by the EventGenerators) and bootstrap the
+      //   event record
+      LOG("GEVGDriver", pINFO)
+         << "Selecting an Interaction & Bootstraping the EventRecord";
+      fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
 
-  string mesg = "Requesting from event generation thread: " +
-         evgen->Id().Key() + " to generate the selected interaction";
+      if(!fCurrentRecord) {
+         LOG("GEVGDriver", pWARN)
+             << "No interaction could be selected for: "
+             << init_state.AsString() << " at E = " << nu4p.E() << " GeV";
+         fNRecLevel = 0;
+         return 0;
+      }
+      selected      = new Interaction(*fCurrentRecord->Summary());
+      selected_xsec = fCurrentRecord->XSec();
+      stats         = this->RetryStats(selected->Fingerprint(), *selected);
+    } else {
+      //-- Re-generate the previously selected interaction in the same record
+      LOG("GEVGDriver", pINFO)
+         << "Re-using the EventRecord for the selected interaction";
+      fCurrentRecord->ResetRecord();
+      fCurrentRecord->AttachSummary(new Interaction(*selected));
+      fCurrentRecord->SetXSec(selected_xsec);
+    }
+    stats->NAttempts++;
+
+    //-- Get a ptr to the interaction summary
+    LOG("GEVGDriver", pDEBUG) << "Getting the selected interaction";
+    Interaction * interaction = fCurrentRecord->Summary();
+
+    //-- Find the appropriate concrete EventGeneratorI implementation
+    //   for generating this event.
+    //
+    //   The right EventGeneratorI will be selecting by iterating over the
+    //   entries of the EventGeneratorList and compare the interaction
+    //   against the ValidityContext declared by each EventGeneratorI
+    //
+    //   (note: use of the 'Chain of Responsibility' Design Pattern)
+
+    LOG("GEVGDriver", pINFO) << "Finding an appropriate EventGenerator";
+
+    const EventGeneratorI * evgen = fIntGenMap->FindGenerator(interaction);
+    assert(evgen);
+
+    RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
+    rtinfo->UpdateRunningThread(evgen);
+
+    //-- Generate the selected event
+    //
+    //   The selected EventGeneratorI subclass will start processing the
+    //   event record (by sequentially asking each entry in its list of
+    //   EventRecordVisitorI subclasses to visit and process the record).
+    //   Most of the actual event generation takes place in this step.
+    //
+    //   (note: use of the 'Visitor' Design Pattern)
+
+    string mesg = "Requesting from event generation thread: " +
+           evgen->Id().Key() + " to generate the selected interaction";
+
+    LOG("GEVGDriver", pNOTICE)
+           << utils::print::PrintFramedMesg(mesg,1,'=');
+
+    fCurrentRecord->SetUnphysEventMask(*fUnphysEventMask);
+    evgen->ProcessEventRecord(fCurrentRecord);
+
+    //-- Check the generated event flags. The default behaviour is
+    //   to reject an unphysical event and try to regenerate it.
+    //   If an unphysical event mask has been set, error conditions may be
+    //   ignored so that the requested classes of unphysical events can be
+    //   passed-through.
+
+    bool unphys = fCurrentRecord->IsUnphysical();
+    if(!unphys) {
+       LOG("GEVGDriver", pINFO) << "Returning the current event!";
+       delete selected;
+       fNRecLevel = 0;
+       return fCurrentRecord; // The client 'adopts' the event record
+    }
 
-  LOG("GEVGDriver", pNOTICE)
-         << utils::print::PrintFramedMesg(mesg,1,'=');
-
-  fCurrentRecord->SetUnphysEventMask(*fUnphysEventMask);
-  evgen->ProcessEventRecord(fCurrentRecord);
-
-  //-- Check the generated event flags. The default behaviour is
-  //   to reject an unphysical event and enter in recursive mode
-  //   and try to regenerate it. If an unphysical event mask has
-  //   been set, error conditions may be ignored so that the
-  //   requested classes of unphysical events can be passed-through.
-
-  bool unphys = fCurrentRecord->IsUnphysical();
-  if(!unphys) {
-     LOG("GEVGDriver", pINFO) << "Returning the current event!";
-     fNRecLevel = 0;
-     return fCurrentRecord; // The client 'adopts' the event record
-  } else {
-     LOG("GEVGDriver", pWARN) << "An unphysical event was generated...";
-     // Check whether the user wants to ignore the err
-     bool accept = fCurrentRecord->Accept();
-     if(accept) {
+    LOG("GEVGDriver", pWARN) << "An unphysical event was generated...";
+    // Check whether the user wants to ignore the err
+    bool accept = fCurrentRecord->Accept();
+    if(accept) {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is accepted by the user";
+       delete selected;
        fNRecLevel = 0;
        return fCurrentRecord; // The client 'adopts' the event record
+    }
 
-     } else {
-       LOG("GEVGDriver", pWARN)
-          << "The generated unphysical event is rejected";
+    LOG("GEVGDriver", pWARN)
+       << "The generated unphysical event is rejected";
+    stats->NRejected++;
+
+    // If the kinematics generation was the only failure, the selected
+    // interaction is kept (the failure says nothing about which interaction
+    // should have been selected). Otherwise (eg Pauli blocking or the energy
+    // being below threshold), a new interaction is selected.
+    TBits * flags = fCurrentRecord->EventFlags();
+    bool kine_err = flags->TestBitNumber(kKineGenErr) && flags->CountBits() == 1;
+    if(kine_err) {
+       stats->NSameInteraction++;
+    } else {
        delete fCurrentRecord;
        fCurrentRecord = 0;
-       fNRecLevel++; // increase the nested level counter
+       delete selected;
+       selected = 0;
+    }
+    if(fNRecLevel < kRecursiveModeMaxDepth) {
+       LOG("GEVGDriver", pWARN)
+         << "Attempting to regenerate the event...";
+    }
+  }
 
-       if(fNRecLevel<=kRecursiveModeMaxDepth) {
-          LOG("GEVGDriver", pWARN)
-            << "Attempting to regenerate the event...";
-          return this->GenerateEvent(nu4p);
-       } else {
-          LOG("GEVGDriver", pERROR)
-               << "Could not produce a physical event after "
-                      << kRecursiveModeMaxDepth << " attempts!";
-          delete fCurrentRecord;
-          fCurrentRecord = 0;
-          fNRecLevel = 0;
-          return 0;
-//        exit(1);
-       }
-     }
+  LOG("GEVGDriver", pERROR)
+       << "Could not produce a physical event after "
+       << kRecursiveModeMaxDepth+1 << " attempts!";
+  if(stats) stats->NAbandoned++;
+
+  if(fCurrentRecord) delete fCurrentRecord;
+  fCurrentRecord = 0;
+  if(selected) delete selected;
+  fNRecLevel = 0;
+  return 0;
+}
+//___________________________________________________________________________
+GEVGDriver::RetryStats_t * GEVGDriver::RetryStats(
+                            ULong64_t fingerprint, const Interaction & in)
+{
+  map<ULong64_t, RetryStats_t>::iterator it = fRetryStats.find(fingerprint);
+  if(it != fRetryStats.end()) return &(it->second);
+
+  RetryStats_t stats;
+  stats.Code             = in.AsString();
+  stats.NAttempts        = 0;
+  stats.NRejected        = 0;
+  stats.NSameInteraction = 0;
+  stats.NAbandoned       = 0;
+  it = fRetryStats.insert(
+           map<ULong64_t, RetryStats_t>::value_type(fingerprint, stats)).first;
+  return &(it->second);
+}
+//___________________________________________________________________________
+void GEVGDriver::PrintRetryStats(ostream & stream) const
+{
+  stream << "\n [-] Event regeneration statistics"
+         << " (attempts / rejected / same interaction / abandoned):";
+  stream << "\n  |";
+  map<ULong64_t, RetryStats_t>::const_iterator it = fRetryStats.begin();
+  for( ; it != fRetryStats.end(); ++it) {
+    const RetryStats_t & stats = it->second;
+    stream << "\n  |--o  " << stats.Code << " : "
+           << stats.NAttempts << " / " << stats.NRejected << " / "
+           << stats.NSameInteraction << " / " << stats.NAbandoned;
   }
+  stream << "\n";
 }
 //___________________________________________________________________________
 const InteractionList * GEVGDriver::Interactions(void) const
@@ -378,66 +473,137 @@ double GEVGDriver::XSecSum(const TLorentzVector & nup4)
 //
   LOG("GEVGDriver", pDEBUG) << "Computing the cross section sum";
 
-  double xsec_sum = 0;
-
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xssl = XSecSplineList::Instance();
+  if(!fXSecSumTermsBuilt) this->BuildXSecSumTerms();
 
-  // Get the list of all interactions that can be generated by this driver
-  const InteractionList & ilst = fIntGenMap->GetInteractionList();
+  double E = nup4.Energy();
+  double xsec_sum = 0;
 
   // Loop over all interactions & compute cross sections
-  InteractionList::const_iterator intliter;
-  for(intliter = ilst.begin(); intliter != ilst.end(); ++intliter) {
-
-     // get current interaction
-     Interaction * interaction = new Interaction(**intliter);
-     interaction->InitStatePtr()->SetProbeP4(nup4);
-
-     string code = interaction->AsString();
-     SLOG("GEVGDriver", pDEBUG)
-             << "Compute cross section for interaction: \n" << code;
-
-     // get corresponding cross section algorithm
-     const XSecAlgorithmI * xsec_alg =
-               fIntGenMap->FindGenerator(interaction)->CrossSectionAlg();
-     assert(xsec_alg);
+  unsigned int nterms = fXSecSumAlgs.size();
+  for(unsigned int i = 0; i < nterms; i++) {
 
      // compute (or evaluate) the cross section
      double xsec = 0;
-     bool spline_exists = xssl->SplineExists(xsec_alg, interaction);
-     if (spline_exists && fUseSplines) {
-        double E = nup4.Energy();
-        xsec = xssl->GetSpline(xsec_alg,interaction)->Evaluate(E);
-     } else
-        xsec = xsec_alg->Integral(interaction);
-
+     const Spline * spl = fXSecSumSpls[i];
+     if (spl) {
+        xsec = spl->Evaluate(E);
+     } else {
+        Interaction * interaction = fXSecSumInts[i];
+        interaction->InitStatePtr()->SetProbeP4(nup4);
+        xsec = fXSecSumAlgs[i]->Integral(interaction);
+     }
      xsec = TMath::Max(0., xsec);
 
      // sum-up and report
      xsec_sum += xsec;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("GEVGDriver", pDEBUG)
-            << "\nInteraction   = " << code
+            << "\nInteraction   = " << fXSecSumInts[i]->AsString()
             << "\nCross Section "
-            << (fUseSplines ? "*interpolated*" : "*computed*")
+            << (spl ? "*interpolated*" : "*computed*")
             << " = " << (xsec/units::cm2) << " cm2";
-
-     delete interaction;
-  } // loop over event generators
+#endif
+  } // loop over interactions
 
   PDGLibrary * pdglib = PDGLibrary::Instance();
   LOG("GEVGDriver", pINFO)
     << "SumXSec("
     << pdglib->Find(fInitState->ProbePdg())->GetName() << "+"
     << pdglib->Find(fInitState->Tgt().Pdg())->GetName() << "->X, "
-    << "E = " << nup4.Energy() << " GeV)"
+    << "E = " << E << " GeV)"
     << (fUseSplines ? "*interpolated*" : "*computed*")
     << " = " << (xsec_sum/units::cm2) << " cm2";
 
   return xsec_sum;
 }
 //___________________________________________________________________________
+void GEVGDriver::XSecSum(int n, const double * E, double * xsec_sum)
+{
+// Computes the sum of the cross sections for all the interactions that can
+// be simulated for the given initial state at each of the n input energies.
+// The interactions are taken in the outer loop, so that each spline is
+// evaluated at all energies in turn.
+
+  if(!fXSecSumTermsBuilt) this->BuildXSecSumTerms();
+
+  for(int j = 0; j < n; j++) xsec_sum[j] = 0.;
+
+  TLorentzVector p4(0,0,0,0);
+
+  unsigned int nterms = fXSecSumAlgs.size();
+  for(unsigned int i = 0; i < nterms; i++) {
+     const Spline * spl = fXSecSumSpls[i];
+     if (spl) {
+        for(int j = 0; j < n; j++) {
+           xsec_sum[j] += TMath::Max(0., spl->Evaluate(E[j]));
+        }
+     } else {
+        Interaction * interaction = fXSecSumInts[i];
+        const XSecAlgorithmI * xsec_alg = fXSecSumAlgs[i];
+        for(int j = 0; j < n; j++) {
+           p4.SetPxPyPzE(0.,0.,E[j],E[j]);
+           interaction->InitStatePtr()->SetProbeP4(p4);
+           xsec_sum[j] += TMath::Max(0., xsec_alg->Integral(interaction));
+        }
+     }
+  } // loop over interactions
+
+  LOG("GEVGDriver", pINFO)
+    << "Computed SumXSec for " << fInitState->AsString() << " at "
+    << n << " energies " << (fUseSplines ? "*interpolated*" : "*computed*");
+}
+//___________________________________________________________________________
+void GEVGDriver::BuildXSecSumTerms(void)
+{
+// Builds the list of terms summed by XSecSum(): for each interaction that
+// can be generated, the corresponding cross section algorithm, its spline
+// (if splines are used and the spline is loaded) and a copy of the
+// interaction on which the cross section is computed if there is no spline.
+// The spline pointers are owned by the XSecSplineList: the terms are rebuilt
+// by Configure(), UseSplines() and CreateSplines(), but not if splines are
+// reloaded in the XSecSplineList afterwards.
+
+  this->ClearXSecSumTerms();
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  const InteractionList & ilst = fIntGenMap->GetInteractionList();
+
+  InteractionList::const_iterator intliter;
+  for(intliter = ilst.begin(); intliter != ilst.end(); ++intliter) {
+
+     Interaction * interaction = new Interaction(**intliter);
+
+     const XSecAlgorithmI * xsec_alg =
+               fIntGenMap->FindGenerator(interaction)->CrossSectionAlg();
+     assert(xsec_alg);
+
+     const Spline * spl = 0;
+     if (fUseSplines && xssl->SplineExists(xsec_alg, interaction)) {
+        spl = xssl->GetSpline(xsec_alg, interaction);
+     }
+
+     fXSecSumAlgs.push_back(xsec_alg);
+     fXSecSumSpls.push_back(spl);
+     fXSecSumInts.push_back(interaction);
+  }
+  fXSecSumTermsBuilt = true;
+
+  LOG("GEVGDriver", pDEBUG)
+     << "Built " << fXSecSumAlgs.size() << " cross section sum terms";
+}
+//___________________________________________________________________________
+void GEVGDriver::ClearXSecSumTerms(void)
+{
+  for(unsigned int i = 0; i < fXSecSumInts.size(); i++) {
+     delete fXSecSumInts[i];
+  }
+  fXSecSumAlgs.clear();
+  fXSecSumSpls.clear();
+  fXSecSumInts.clear();
+  fXSecSumTermsBuilt = false;
+}
+//___________________________________________________________________________
 void GEVGDriver::CreateXSecSumSpline(
                                int nk, double Emin, double Emax, bool inlogE)
 {
@@ -470,16 +636,11 @@ void GEVGDriver::CreateXSecSumSpline(
     dE = (Emax-Emin)/(nk-1);
   }
 
-  TLorentzVector p4(0,0,0,0);
-
   for(int i=0; i<nk; i++) {
-    double e = (inlogE) ? TMath::Exp(logEmin + i*dE) : Emin + i*dE;
-    p4.SetPxPyPzE(0.,0.,e,e);
-    double xs = this->XSecSum(p4);
-
-    E[i]    = e;
-    xsec[i] = xs;
+    E[i] = (inlogE) ? TMath::Exp(logEmin + i*dE) : Emin + i*dE;
   }
+  this->XSecSum(nk, E, xsec);
+
   if (fXSecSumSpl) delete fXSecSumSpl;
   fXSecSumSpl = new Spline(nk, E, xsec);
   delete [] E;
@@ -524,6 +685,8 @@ void GEVGDriver::UseSplines(void)
 
   fUseSplines = true;
 
+  this->ClearXSecSumTerms();
+
   // Get the list of spline objects
   // Should have been constructed at the job initialization
   XSecSplineList * xsl = XSecSplineList::Instance();
@@ -575,11 +738,15 @@ void GEVGDriver::UseSplines(void)
   }//use-splines?
 }
 //___________________________________________________________________________
-void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
+void GEVGDriver::CreateSplines(
+                   int nknots, double emax, bool useLogE, bool maxxsec)
 {
 // Creates all the cross section splines that are needed by this driver.
 // It will check for pre-loaded splines and it will skip the creation of the
 // splines it already finds loaded.
+// If maxxsec is set, the event generation modules are also asked to tabulate
+// the max differential cross section they use in accept/reject methods, so
+// that it can be saved and reloaded along with the cross section splines.
 
   LOG("GEVGDriver", pINFO)
        << "Creating (missing) splines with [UseLogE: "
@@ -656,6 +823,9 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
          } else {
              SLOG("GEVGDriver", pDEBUG) << "Spline was found";
          }
+         if(maxxsec) {
+             evgen->CreateMaxXSecSpline(alg, interaction, nknots, Emin, emax);
+         }
      } // loop over interaction that can be generated by this generator
      delete ilst;
      ilst = 0;
@@ -664,6 +834,8 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
   LOG("GEVGDriver", pINFO) << *xsl; // print list of splines
 
   fUseSplines = true;
+
+  this->ClearXSecSumTerms();
 }
 //___________________________________________________________________________
 Range1D_t GEVGDriver::ValidEnergyRange(void) const
@@ -720,6 +892,8 @@ void GEVGDriver::Print(ostream & stream) const
   stream << "\n  |---o Unphysical event filter mask ("
          << GHepFlags::NFlags() << "->0) = " << *fUnphysEventMask;
 
+  if(!fRetryStats.empty()) this->PrintRetryStats(stream);
+
   stream << "\n *********************************************************\n";
 }
 //___________________________________________________________________________
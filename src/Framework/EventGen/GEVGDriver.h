@@ -19,6 +19,17 @@
 \cpright  Copyright (c) 2003-2018, The GENIE Collaboration
           For the full text of the license visit http://copyright.genie-mc.org
           or see $GENIE/LICENSE
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   XSecSum() runs over a list of (spline, xsec algorithm) terms built once
+   per driver, without any allocation or map lookup per call. Added a
+   version computing the sum at many energies, used by CreateXSecSumSpline().
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Unphysical events are regenerated in a bounded loop rather than by
+   recursion. Events failing at the kinematics generation step are
+   regenerated for the same interaction, reusing the event record, and
+   regeneration statistics are kept for each interaction.
 */
 //____________________________________________________________________________
 
@@ -27,7 +38,10 @@
 
 #include <ostream>
 #include <string>
+#include <vector>
+#include <map>
 
+#include <Rtypes.h>
 #include <TLorentzVector.h>
 #include <TBits.h>
 
@@ -35,6 +49,8 @@
 
 using std::ostream;
 using std::string;
+using std::vector;
+using std::map;
 
 namespace genie {
 
@@ -42,6 +58,7 @@ class GEVGDriver;
 class EventRecord;
 class EventGeneratorList;
 class EventGeneratorI;
+class XSecAlgorithmI;
 class InteractionSelectorI;
 class InteractionGeneratorMap;
 class InteractionList;
@@ -88,16 +105,26 @@ public :
   const Spline * XSecSumSpline       (void) const { return fXSecSumSpl; }
   const Spline * XSecSpline          (const Interaction * interaction) const;
 
-  // Instruct the driver to create all the splines it needs
-  void CreateSplines (int nknots=-1, double emax=-1, bool inLogE=true);
+  // Instruct the driver to create all the splines it needs (optionally,
+  // also the max differential xsec tables used by the kinematics generators)
+  void CreateSplines (int nknots=-1, double emax=-1, bool inLogE=true,
+                      bool maxxsec=false);
 
   // Methods used for building the 'total' cross section spline
+  // (the second XSecSum() stores the sum at each of the n energies E[i],
+  // for a probe along +z, in xsec_sum[i])
   double XSecSum             (const TLorentzVector & nup4);
+  void   XSecSum             (int n, const double * E, double * xsec_sum);
   void   CreateXSecSumSpline (int nk, double Emin, double Emax, bool inlogE=true);
 
   // Get validity range (combined validity range of loaded evg threads)
   Range1D_t ValidEnergyRange (void) const;
 
+  // Event regeneration statistics: for each selected interaction, the number
+  // of generation attempts, of rejected unphysical events, of regenerations
+  // of the same interaction and of events abandoned after the max attempts
+  void PrintRetryStats (ostream & stream) const;
+
   // Reset, Print etc
   void Reset (void);
   void Print (ostream & stream) const;
@@ -114,6 +141,18 @@ private:
   void BuildInteractionGeneratorMap (void);
   void BuildInteractionSelector     (void);
   void AssertIsValidInitState       (void) const;
+  void BuildXSecSumTerms            (void);
+  void ClearXSecSumTerms            (void);
+
+  // Event regeneration statistics for a single interaction
+  struct RetryStats_t {
+    string       Code;         ///< interaction code
+    unsigned int NAttempts;    ///< generation attempts
+    unsigned int NRejected;    ///< unphysical events rejected
+    unsigned int NSameInteraction; ///< rejected events regenerated for the same interaction
+    unsigned int NAbandoned;   ///< events abandoned after kRecursiveModeMaxDepth regenerations
+  };
+  RetryStats_t * RetryStats (ULong64_t fingerprint, const Interaction & in);
 
   // Private data members
   InitialState *            fInitState;       ///< initial state information for driver instance
@@ -124,8 +163,16 @@ private:
   TBits *                   fUnphysEventMask; ///< controls whether unphysical events are returned
   bool                      fUseSplines;      ///< controls whether xsecs are computed or interpolated
   Spline *                  fXSecSumSpl;      ///< sum{xsec(all interactions | this init state)}
-  unsigned int              fNRecLevel;       ///< recursive mode depth counter
+  unsigned int              fNRecLevel;       ///< regeneration attempt counter
   string                    fEventGenList;    ///< list of event generators loaded by this driver (what used to be the $GEVGL setting)
+
+  // Terms of XSecSum(), one for each entry of the interaction list
+  vector<const XSecAlgorithmI *> fXSecSumAlgs; ///< cross section algorithm
+  vector<const Spline *>         fXSecSumSpls; ///< its spline (0 to compute the xsec)
+  vector<Interaction *>          fXSecSumInts; ///< owned copy of the interaction (probe set at each call)
+  bool                           fXSecSumTermsBuilt;
+
+  map<ULong64_t, RetryStats_t>   fRetryStats;  ///< regeneration statistics, by interaction fingerprint
 };
 
 }      // genie namespace
@@ -14,6 +14,8 @@
    fCpuTime wasn't initialized.
  @ Jan 30, 2013 - CA
    Added SetRefreshRate(int rate)
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added Filename() (see ForkedWorkers).
 
 */
 //____________________________________________________________________________
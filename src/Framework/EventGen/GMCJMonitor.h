@@ -36,6 +36,7 @@ public :
   void SetRefreshRate (int rate);
   void Update (int iev, const EventRecord * event);
   void CustomizeFilename(string filename);
+  string Filename (void) const { return fStatusFile; }
 
 private:
 
@@ -10,10 +10,16 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   FindGenerator() looks up the interaction by its 64-bit Fingerprint()
+   instead of formatting its AsString() code for every query. The string
+   codes are kept for printing. Fingerprint collisions are checked for as
+   the map is built.
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
 #include <iomanip>
 
 #include <TMath.h>
@@ -78,6 +84,7 @@ void InteractionGeneratorMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+  fGeneratorIndex.clear();
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
@@ -97,6 +104,8 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
 
     this->insert(map<string, const EventGeneratorI *>::value_type(code,evg));
   }
+
+  fGeneratorIndex = xsmap.fGeneratorIndex;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::UseGeneratorList(const EventGeneratorList * l)
@@ -148,12 +157,22 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
      {
         // current interaction
         Interaction * interaction = *intliter;
-        string code = interaction->AsString();
+        string    code = interaction->AsString();
+        ULong64_t fp   = interaction->Fingerprint();
+
+        // a known fingerprint must come with a known code
+        if(fGeneratorIndex.count(fp) == 1 && this->count(code) == 0) {
+          LOG("IntGenMap", pFATAL)
+             << "Interaction fingerprint collision for: " << code;
+          exit(1);
+        }
 
         SLOG("IntGenMap", pDEBUG)
               << "\nLinking: " << code << " --> to: " << evgen->Id().Key();
         this->insert(
              map<string, const EventGeneratorI *>::value_type(code,evgen));
+        fGeneratorIndex.insert(
+             map<ULong64_t, const EventGeneratorI *>::value_type(fp,evgen));
      } // loop over interactions
      delete ilst;
      ilst = 0;
@@ -167,11 +186,12 @@ const EventGeneratorI * InteractionGeneratorMap::FindGenerator(
     LOG("IntGenMap", pWARN) << "Null interaction!!";
     return 0;
   }
-  string code = interaction->AsString();
-  InteractionGeneratorMap::const_iterator evgiter = this->find(code);
-  if(evgiter == this->end()) {
+  map<ULong64_t, const EventGeneratorI *>::const_iterator evgiter =
+                          fGeneratorIndex.find(interaction->Fingerprint());
+  if(evgiter == fGeneratorIndex.end()) {
     LOG("IntGenMap", pWARN)
-             << "No EventGeneratorI was found for interaction: \n" << code;
+             << "No EventGeneratorI was found for interaction: \n"
+             << interaction->AsString();
     return 0;
   }
   const EventGeneratorI * evg = evgiter->second;
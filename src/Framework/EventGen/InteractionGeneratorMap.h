@@ -71,6 +71,8 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<ULong64_t, const EventGeneratorI *> fGeneratorIndex; ///< Interaction::Fingerprint() -> generator
 };
 
 }      // genie namespace
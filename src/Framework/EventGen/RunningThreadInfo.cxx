@@ -10,16 +10,28 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The running event generation thread is kept per OS thread.
 */
 //____________________________________________________________________________
 
+#include <mutex>
+#include <atomic>
+
 #include "Framework/EventGen//RunningThreadInfo.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/Messenger/Messenger.h"
 
 using namespace genie;
 
+//____________________________________________________________________________
+namespace {
+  thread_local const EventGeneratorI * gRunningThread = 0;
+
+  std::mutex                        gInstanceMutex;
+  std::atomic<RunningThreadInfo *>  gInstance(0);
+}
+
 //____________________________________________________________________________
 RunningThreadInfo * RunningThreadInfo::fInstance = 0;
 //____________________________________________________________________________
@@ -30,16 +42,33 @@ RunningThreadInfo::RunningThreadInfo()
 //____________________________________________________________________________
 RunningThreadInfo::~RunningThreadInfo()
 {
+  gInstance.store(0);
   fInstance = 0;
 }
 //____________________________________________________________________________
 RunningThreadInfo * RunningThreadInfo::Instance()
 {
+  RunningThreadInfo * instance = gInstance.load(std::memory_order_acquire);
+  if(instance) return instance;
+
+  std::lock_guard<std::mutex> lock(gInstanceMutex);
+
   if(fInstance == 0) {
     static RunningThreadInfo::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
     fInstance = new RunningThreadInfo;
   }
+  gInstance.store(fInstance, std::memory_order_release);
   return fInstance;
 }
 //____________________________________________________________________________
+const EventGeneratorI * RunningThreadInfo::RunningThread(void)
+{
+  return gRunningThread;
+}
+//____________________________________________________________________________
+void RunningThreadInfo::UpdateRunningThread(const EventGeneratorI * evg)
+{
+  gRunningThread = evg;
+}
+//____________________________________________________________________________
@@ -8,6 +8,9 @@
 	  can see the "bigger picture" and access the cross section model for
 	  the thread, look-up info for modules that run before or are scheduled
           to run after etc.
+          The running event generation thread is kept separately for each
+          OS thread, so that several event generation drivers can run
+          concurrently.
 	  
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -32,14 +35,9 @@ class RunningThreadInfo
 public:
   static RunningThreadInfo * Instance(void);
 
-  const EventGeneratorI * RunningThread(void) 
-  {   
-    return fRunningThread; 
-  }
-  void UpdateRunningThread(const EventGeneratorI * evg) 
-  { 
-     fRunningThread = evg; 
-  }
+  //! Event generation thread running on the calling OS thread
+  const EventGeneratorI * RunningThread       (void);
+  void                    UpdateRunningThread (const EventGeneratorI * evg);
 
 private:
   RunningThreadInfo();
@@ -49,9 +47,6 @@ private:
   //! self
   static RunningThreadInfo * fInstance;
 
-  //! current thread
-  const EventGeneratorI * fRunningThread;
-
   //! clean
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -41,6 +41,23 @@ Algorithm(name, config)
 XSecAlgorithmI::~XSecAlgorithmI()
 {
 
+}
+//___________________________________________________________________________
+void XSecAlgorithmI::BatchXSec(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    unsigned int npoints, unsigned int nkv, const KineVar_t * kv,
+    const double * kine, double * xsec) const
+{
+  Interaction in(*interaction);
+  in.CopyFlags(*interaction);
+  Kinematics * kinematics = in.KinePtr();
+
+  for(unsigned int i = 0; i < npoints; i++) {
+    for(unsigned int j = 0; j < nkv; j++) {
+      kinematics->SetKV(kv[j], kine[i*nkv + j]);
+    }
+    xsec[i] = this->XSec(&in, kps);
+  }
 }
 //___________________________________________________________________________
 bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
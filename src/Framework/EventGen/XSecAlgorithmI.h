@@ -21,6 +21,7 @@
 
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Conventions/KineVar.h"
 #include "Framework/Interaction/Interaction.h"
 
 namespace genie {
@@ -33,6 +34,17 @@ public:
   //! Compute the cross section for the input interaction
   virtual double XSec (const Interaction* i, KinePhaseSpace_t k=kPSfE) const = 0;
 
+  //! Compute the cross section at npoints kinematical points, for the
+  //! initial state & process of the input interaction. The values of the nkv
+  //! kinematic variables kv[] at point i are read from kine[i*nkv+j], and
+  //! the cross sections are written in xsec[i]. The default implementation
+  //! calls XSec() for each point; models can override it to compute the
+  //! kinematics-independent factors only once per batch.
+  virtual void BatchXSec (const Interaction* i, KinePhaseSpace_t k,
+                          unsigned int npoints, unsigned int nkv,
+                          const KineVar_t * kv, const double * kine,
+                          double * xsec) const;
+
   //! Integrate the model over the kinematic phase space available to the
   //! input interaction (kinematical cuts can be included)
   virtual double Integral (const Interaction* i) const = 0;
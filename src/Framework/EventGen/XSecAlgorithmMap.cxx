@@ -10,10 +10,17 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   FindXSecAlgorithm() looks up the interaction by its 64-bit Fingerprint()
+   instead of formatting its AsString() code for every query. The string
+   codes are kept for printing. Fingerprint collisions are checked for as
+   the map is built.
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/EventGeneratorList.h"
@@ -72,6 +79,7 @@ void XSecAlgorithmMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+  fXSecAlgIndex.clear();
 }
 //___________________________________________________________________________
 void XSecAlgorithmMap::Copy(const XSecAlgorithmMap & xsmap)
@@ -91,6 +99,8 @@ void XSecAlgorithmMap::Copy(const XSecAlgorithmMap & xsmap)
 
     this->insert(map<string, const XSecAlgorithmI *>::value_type(code,alg));
   }
+
+  fXSecAlgIndex = xsmap.fXSecAlgIndex;
 }
 //___________________________________________________________________________
 void XSecAlgorithmMap::UseGeneratorList(const EventGeneratorList * list)
@@ -146,7 +156,15 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
      {
         // current interaction
         Interaction * interaction = *intliter;
-        string code = interaction->AsString();
+        string    code = interaction->AsString();
+        ULong64_t fp   = interaction->Fingerprint();
+
+         // a known fingerprint must come with a known code
+         if(fXSecAlgIndex.count(fp) == 1 && this->count(code) == 0) {
+           LOG("XSecAlgMap", pFATAL)
+              << "Interaction fingerprint collision for: " << code;
+           exit(1);
+         }
 
          // link with the xsec algorithm
          SLOG("XSecAlgMap", pINFO)
@@ -154,6 +172,8 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
               << "\n     --> with xsec algorithm: " << xsec_alg->Id().Key();
          this->insert(
             map<string, const XSecAlgorithmI *>::value_type(code,xsec_alg));
+         fXSecAlgIndex.insert(
+            map<ULong64_t, const XSecAlgorithmI *>::value_type(fp,xsec_alg));
 
      } // loop over interactions
      delete ilst;
@@ -169,12 +189,12 @@ const XSecAlgorithmI * XSecAlgorithmMap::FindXSecAlgorithm(
     return 0;
   }
 
-  string code = interaction->AsString();
-
-  XSecAlgorithmMap::const_iterator xsec_alg_iter = this->find(code);
-  if(xsec_alg_iter == this->end()) {
+  map<ULong64_t, const XSecAlgorithmI *>::const_iterator xsec_alg_iter =
+                          fXSecAlgIndex.find(interaction->Fingerprint());
+  if(xsec_alg_iter == fXSecAlgIndex.end()) {
     LOG("XSecAlgMap", pWARN)
-         << "No XSecAlgorithmI was found for interaction: \n" << code;
+         << "No XSecAlgorithmI was found for interaction: \n"
+         << interaction->AsString();
     return 0;
   }
 
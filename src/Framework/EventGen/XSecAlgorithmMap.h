@@ -25,6 +25,8 @@
 #include <string>
 #include <ostream>
 
+#include <Rtypes.h>
+
 using std::map;
 using std::string;
 using std::ostream;
@@ -70,6 +72,8 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<ULong64_t, const XSecAlgorithmI *> fXSecAlgIndex; ///< Interaction::Fingerprint() -> xsec algorithm
 };
 
 }      // genie namespace
@@ -160,18 +160,20 @@ string GHepParticle::Name(void) const
 //___________________________________________________________________________
 double GHepParticle::Mass(void) const
 {
-  this->AssertIsKnownParticle();
+  const PDGProperties * p = PDGLibrary::Instance()->Properties(fPdgCode);
+  if(p) return p->mass;
 
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Mass();
+  this->AssertIsKnownParticle();
+  return PDGLibrary::Instance()->Find(fPdgCode)->Mass();
 }
 //___________________________________________________________________________
 double GHepParticle::Charge(void) const
 {
-  this->AssertIsKnownParticle();
+  const PDGProperties * p = PDGLibrary::Instance()->Properties(fPdgCode);
+  if(p) return p->charge;
 
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Charge();
+  this->AssertIsKnownParticle();
+  return PDGLibrary::Instance()->Find(fPdgCode)->Charge();
 }
 //___________________________________________________________________________
 double GHepParticle::KinE(bool mass_from_pdg) const
@@ -306,11 +308,7 @@ void GHepParticle::SetPz(double pz)
 //___________________________________________________________________________
 bool GHepParticle::IsOnMassShell(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-
-  double Mpdg = p->Mass();
+  double Mpdg = this->Mass();
   double M4p  = (fP4) ? fP4->M() : 0.;
 
 //  return utils::math::AreEqual(Mpdg, M4p);
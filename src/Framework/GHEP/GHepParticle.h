@@ -26,6 +26,7 @@
 #include <TLorentzVector.h>
 
 #include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Numerical/FourVector.h"
 
 class TRootIOCtor;
 
@@ -85,6 +86,11 @@ public :
   TLorentzVector * GetP4 (void) const;
   TLorentzVector * GetX4 (void) const;
 
+  // Copies of the momentum & position 4-vectors as (non-persistent) value
+  // types, for kinematics code (see FourVector.h)
+  FourVector P4Value (void) const { return FourVector(this->Px(), this->Py(), this->Pz(), this->E());  }
+  FourVector X4Value (void) const { return FourVector(this->Vx(), this->Vy(), this->Vz(), this->Vt()); }
+
   // Returns the momentum & position 4-vectors components
   double Px     (void) const { return (fP4) ? fP4->Px()     : 0; } ///< Get Px
   double Py     (void) const { return (fP4) ? fP4->Py()     : 0; } ///< Get Py
@@ -138,6 +144,8 @@ public :
   // Set the momentum & position 4-vectors
   void SetMomentum (const TLorentzVector & p4);
   void SetPosition (const TLorentzVector & v4);
+  void SetMomentum (const FourVector & p4) { this->SetMomentum(p4.Px(), p4.Py(), p4.Pz(), p4.E()); }
+  void SetPosition (const FourVector & v4) { this->SetPosition(v4.X(),  v4.Y(),  v4.Z(),  v4.T()); }
   void SetMomentum (double px, double py, double pz, double E);
   void SetPosition (double x,  double y,  double z,  double t);
   void SetEnergy   (double E );
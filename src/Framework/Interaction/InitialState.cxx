@@ -45,33 +45,38 @@ namespace genie {
 }
 //___________________________________________________________________________
 InitialState::InitialState() :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init();
 }
 //___________________________________________________________________________
 InitialState::InitialState(int target_pdgc, int probe_pdgc) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init(target_pdgc, probe_pdgc);
 }
 //___________________________________________________________________________
 InitialState::InitialState(int Z, int A, int probe_pdgc) :
-TObject()
+TObject(),
+fStamp(0)
 {
   int target_pdgc = pdg::IonPdgCode(A,Z);
   this->Init(target_pdgc, probe_pdgc);
 }
 //___________________________________________________________________________
 InitialState::InitialState(const Target & tgt, int probe_pdgc) :
-TObject()
+TObject(),
+fStamp(0)
 {
   int target_pdgc = tgt.Pdg();
   this->Init(target_pdgc, probe_pdgc);
 }
 //___________________________________________________________________________
 InitialState::InitialState(const InitialState & init_state) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init();
   this->Copy(init_state);
@@ -82,7 +87,8 @@ TObject(),
 fProbePdg(0),
 fTgt(0), 
 fProbeP4(0), 
-fTgtP4(0)
+fTgtP4(0),
+fStamp(0)
 {
 
 }
@@ -94,6 +100,7 @@ InitialState::~InitialState()
 //___________________________________________________________________________
 void InitialState::Init(void)
 {
+  fStamp++;
   fProbePdg  = 0;
   fTgt       = new Target();
   fProbeP4   = new TLorentzVector(0, 0, 0, 0);
@@ -102,6 +109,7 @@ void InitialState::Init(void)
 //___________________________________________________________________________
 void InitialState::Init(int target_pdgc, int probe_pdgc)
 {
+  fStamp++;
   TParticlePDG * t = PDGLibrary::Instance()->Find(target_pdgc);
   TParticlePDG * p = PDGLibrary::Instance()->Find(probe_pdgc );
 
@@ -131,6 +139,7 @@ void InitialState::Reset(void)
 //___________________________________________________________________________
 void InitialState::Copy(const InitialState & init_state)
 {
+  fStamp++;
   fProbePdg = init_state.fProbePdg;
 
   fTgt->Copy(*init_state.fTgt);
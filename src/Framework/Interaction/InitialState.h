@@ -70,6 +70,7 @@ public:
   TLorentzVector * GetProbeP4 (RefFrame_t rf = kRfHitNucRest) const;
   double           ProbeE     (RefFrame_t rf) const;
   double           CMEnergy   () const; ///< centre-of-mass energy (sqrt s)
+  UInt_t           Stamp      (void) const { return fStamp; } ///< changed when the probe or the Target object change
 
   void SetPdgs     (int tgt_pdgc, int probe_pdgc);
   void SetProbePdg (int pdg_code);
@@ -109,6 +110,7 @@ private:
   Target *         fTgt;      ///< nuclear target
   TLorentzVector * fProbeP4;  ///< probe 4-momentum in LAB-frame
   TLorentzVector * fTgtP4;    ///< nuclear target 4-momentum in LAB-frame
+  UInt_t           fStamp;    //! modification stamp, see Stamp()
 
 ClassDef(InitialState,1)
 };
@@ -9,10 +9,23 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module 
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added Fingerprint(), a 64-bit hash of the AsString() identity used as
+   the lookup key of the interaction -> generator / xsec algorithm / spline
+   / cache branch maps, and Codes(), the integer codes it is built from.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Codes() and Fingerprint() are cached until the initial state, target,
+   process info or exclusive tag change.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added CopyFlags(), for the copies of an interaction made by the batch
+   cross section evaluations.
 */
 //____________________________________________________________________________
 
 #include <sstream>
+#include <cstring>
 
 #include <TRootIOCtor.h>
 
@@ -22,6 +35,7 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/HashUtils.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -68,7 +82,9 @@ fInitialState(0),
 fProcInfo(0),
 fKinematics(0), 
 fExclusiveTag(0), 
-fKinePhSp(0)
+fKinePhSp(0),
+fFingerprint(0),
+fCodesSet(false)
 {
 
 }
@@ -91,6 +107,9 @@ void Interaction::Init(void)
   fKinematics   = new Kinematics   ();
   fExclusiveTag = new XclsTag      ();
   fKinePhSp     = new KPhaseSpace  (this);
+
+  fFingerprint  = 0;
+  fCodesSet     = false;
 }
 //___________________________________________________________________________
 void Interaction::CleanUp(void)
@@ -121,6 +140,15 @@ void Interaction::Copy(const Interaction & interaction)
   fExclusiveTag -> Copy (xcls);
 }
 //___________________________________________________________________________
+void Interaction::CopyFlags(const Interaction & interaction)
+{
+  const UInt_t flags[] = { kISkipProcessChk, kISkipKinematicChk,
+                           kIAssumeFreeNucleon, kINoNuclearCorrection };
+  for(unsigned int i = 0; i < sizeof(flags)/sizeof(flags[0]); i++) {
+    this->SetBit(flags[i], interaction.TestBit(flags[i]));
+  }
+}
+//___________________________________________________________________________
 TParticlePDG * Interaction::FSPrimLepton(void) const
 {
   int pdgc = this->FSPrimLeptonPdg();
@@ -273,6 +301,72 @@ string Interaction::AsString(void) const
   return interaction.str();
 }
 //___________________________________________________________________________
+ULong64_t Interaction::Fingerprint(void) const
+{
+// 64-bit hash of everything coded by AsString(), folded from the integer
+// Codes() without formatting any string. Interactions with the same
+// AsString() have the same fingerprint.
+
+  this->UpdateCodes();
+  return fFingerprint;
+}
+//___________________________________________________________________________
+void Interaction::Codes(Long64_t codes[kNInteractionCodes]) const
+{
+// The integer codes identifying the interaction (probe, target, hit nucleon,
+// hit quark, process and exclusive tag), as coded by AsString(). Unlike the
+// fingerprint, they can be compared to tell interactions apart exactly.
+
+  this->UpdateCodes();
+  memcpy(codes, fCodes, sizeof(fCodes));
+}
+//___________________________________________________________________________
+void Interaction::UpdateCodes(void) const
+{
+// The initial state, target, process info and exclusive tag may be modified
+// through the pointer accessors, so the cached codes are checked against the
+// Stamp() that their setters change, rather than cleared by the setters of
+// this class only.
+
+  const Target & tgt = fInitialState->Tgt();
+
+  UInt_t stamps[4] = { fInitialState->Stamp(), tgt.Stamp(),
+                       fProcInfo->Stamp(), fExclusiveTag->Stamp() };
+  if(fCodesSet && memcmp(stamps, fCodesStamps, sizeof(stamps)) == 0) return;
+
+  Long64_t * codes = fCodes;
+
+  codes[0] = fInitialState->ProbePdg();
+  codes[1] = tgt.Pdg();
+  codes[2] = tgt.HitNucIsSet() ? tgt.HitNucPdg() : 0;
+  codes[3] = tgt.HitQrkIsSet() ? tgt.HitQrkPdg() : 0;
+  codes[4] = tgt.HitQrkIsSet() ? (tgt.HitSeaQrk() ? 1 : 0) : -1;
+
+  codes[5] = fProcInfo->InteractionTypeId();
+  codes[6] = fProcInfo->ScatteringTypeId();
+
+  const XclsTag & xcls = *fExclusiveTag;
+  codes[7] = xcls.IsCharmEvent()   ? xcls.CharmHadronPdg()   : -1;
+  codes[8] = xcls.IsStrangeEvent() ? xcls.StrangeHadronPdg() : -1;
+  bool multset = xcls.NProtons() > 0 || xcls.NNeutrons() > 0 ||
+           xcls.NPiPlus() > 0 || xcls.NPiMinus() > 0 || xcls.NPi0() > 0;
+  codes[ 9] = multset ? xcls.NProtons () : -1;
+  codes[10] = multset ? xcls.NNeutrons() : -1;
+  codes[11] = multset ? xcls.NPiPlus  () : -1;
+  codes[12] = multset ? xcls.NPiMinus () : -1;
+  codes[13] = multset ? xcls.NPi0     () : -1;
+  codes[14] = xcls.Resonance();
+  codes[15] = xcls.DecayMode();
+
+  ULong64_t h = utils::hash::kSeed;
+  for(unsigned int i = 0; i < kNInteractionCodes; i++) {
+    h = utils::hash::Combine(h, codes[i]);
+  }
+  fFingerprint = h;
+  memcpy(fCodesStamps, stamps, sizeof(stamps));
+  fCodesSet = true;
+}
+//___________________________________________________________________________
 void Interaction::Print(ostream & stream) const
 {
   const string line(110, '-');
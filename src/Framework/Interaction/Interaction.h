@@ -50,6 +50,8 @@ const UInt_t kIAssumeFreeNucleon   = 1<<15; ///<
 const UInt_t kIAssumeFreeElectron  = 1<<15; ///<
 const UInt_t kINoNuclearCorrection = 1<<14; ///< if set, inhibit nuclear corrections 
 
+const unsigned int kNInteractionCodes = 16; ///< number of Interaction::Codes()
+
 class Interaction;
 ostream & operator << (ostream & stream, const Interaction & i); 
 
@@ -93,7 +95,13 @@ public:
   // Copy, reset, print itself and build string code
   void   Reset    (void);
   void   Copy     (const Interaction & i);
+  void   CopyFlags(const Interaction & i); ///< copy the kI* flags, which Copy() & the copy constructor leave unset
   string AsString (void) const;
+  ULong64_t Fingerprint (void) const; ///< 64-bit hash of the AsString() identity
+  void   Codes    (Long64_t codes[kNInteractionCodes]) const; ///< integer codes behind AsString() & Fingerprint()
+  // Codes() & Fingerprint() are cached until the initial state, target,
+  // process info or exclusive tag change (see their Stamp()), so they are
+  // not safe to call concurrently on the same Interaction object
   void   Print    (ostream & stream) const;
 
   // Overloaded operators
@@ -169,12 +177,21 @@ private:
   // Utility method for "named ctor"
   static Interaction * Create(int tgt, int probe, ScatteringType_t st, InteractionType_t it);
 
+  // Recompute the cached Codes() & Fingerprint() if out of date
+  void UpdateCodes (void) const;
+
   // Private data members
   InitialState * fInitialState;  ///< Initial State info
   ProcessInfo *  fProcInfo;      ///< Process info (scattering, weak current,...)
   Kinematics *   fKinematics;    ///< kinematical variables
   XclsTag *      fExclusiveTag;  ///< Additional info for exclusive channels
   KPhaseSpace *  fKinePhSp;      ///< Kinematic phase space
+
+  // Cached Codes() & Fingerprint() (transient, reset when read from a file)
+  mutable Long64_t  fCodes[kNInteractionCodes]; //! cached Codes()
+  mutable ULong64_t fFingerprint;               //! cached Fingerprint()
+  mutable UInt_t    fCodesStamps[4];            //! Stamp() of the initial state, target, process info & exclusive tag for the cached codes
+  mutable bool      fCodesSet;                  //! are the cached codes set?
   
 ClassDef(Interaction,2)
 };
@@ -91,8 +91,8 @@ double KPhaseSpace::Threshold(void) const
     double Mi   = tgt.HitNucP4Ptr()->M(); // initial nucleon mass
     // Final nucleon can be different for K0 interaction
     double Mf = (xcls.NProtons()==1) ? kProtonMass : kNeutronMass;  
-    double mk   = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass();
-  //double ml   = PDGLibrary::Instance()->Find(fInteraction->FSPrimLeptonPdg())->Mass();
+    double mk   = PDGLibrary::Instance()->Mass(kaon_pdgc);
+  //double ml   = PDGLibrary::Instance()->Mass(fInteraction->FSPrimLeptonPdg());
     double mtot = ml + mk + Mf; // total mass of FS particles
     double Ethresh = (mtot*mtot - Mi*Mi)/(2. * Mf);
     return Ethresh;
@@ -101,7 +101,7 @@ double KPhaseSpace::Threshold(void) const
   if (pi.IsCoherent()) {
     int tgtpdgc = tgt.Pdg(); // nuclear target PDG code (10LZZZAAAI)
     double mpi  = pi.IsWeakCC() ? kPionMass : kPi0Mass;
-    double MA   = PDGLibrary::Instance()->Find(tgtpdgc)->Mass();
+    double MA   = PDGLibrary::Instance()->Mass(tgtpdgc);
     double m    = ml + mpi;
     double m2   = TMath::Power(m,2);
     double Ethr = m + 0.5*m2/MA;
@@ -130,7 +130,7 @@ double KPhaseSpace::Threshold(void) const
           Wmin = kNucleonMass+kLightestChmHad;
        } else {
           int cpdg = xcls.CharmHadronPdg();
-          double mchm = PDGLibrary::Instance()->Find(cpdg)->Mass();
+          double mchm = PDGLibrary::Instance()->Mass(cpdg);
           if(pi.IsQuasiElastic() || pi.IsInverseBetaDecay()) { 
             Wmin = mchm + controls::kASmallNum; 
           } 
@@ -521,10 +521,10 @@ Range1D_t KPhaseSpace::Q2Lim(void) const
     double W = fInteraction->RecoilNucleon()->Mass();
     if(xcls.IsCharmEvent()) { 
       int charm_pdgc = xcls.CharmHadronPdg();           
-      W = PDGLibrary::Instance()->Find(charm_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(charm_pdgc);
     }  else if(xcls.IsStrangeEvent()) { 
       int strange_pdgc = xcls.StrangeHadronPdg();           
-      W = PDGLibrary::Instance()->Find(strange_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(strange_pdgc);
     }
     if (pi.IsInverseBetaDecay()) {
       Q2l = kinematics::InelQ2Lim_W(Ev,M,ml,W,controls::kMinQ2Limit_VLE);
@@ -540,10 +540,10 @@ Range1D_t KPhaseSpace::Q2Lim(void) const
     double W = fInteraction->RecoilNucleon()->Mass();
     if(xcls.IsCharmEvent()) { 
       int charm_pdgc = xcls.CharmHadronPdg();           
-      W = PDGLibrary::Instance()->Find(charm_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(charm_pdgc);
     }  else if(xcls.IsStrangeEvent()) { 
       int strange_pdgc = xcls.StrangeHadronPdg();           
-      W = PDGLibrary::Instance()->Find(strange_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(strange_pdgc);
     }
     if (pi.IsInverseBetaDecay()) {
       Q2l = kinematics::DarkQ2Lim_W(Ev,M,ml,W,controls::kMinQ2Limit_VLE);
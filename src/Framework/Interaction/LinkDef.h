@@ -8,6 +8,7 @@
 
 #pragma link C++ class genie::InitialState;
 #pragma link C++ class genie::Interaction;
+#pragma read sourceClass="genie::Interaction" version="[1-]" targetClass="genie::Interaction" source="" target="fCodesSet" code="{ fCodesSet = false; }"
 #pragma link C++ class genie::Target;
 #pragma link C++ class genie::ProcessInfo;
 #pragma link C++ class genie::Kinematics+;
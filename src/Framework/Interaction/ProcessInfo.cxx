@@ -33,7 +33,8 @@ namespace genie {
 }
 //____________________________________________________________________________
 ProcessInfo::ProcessInfo() :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Reset();
 }
@@ -42,13 +43,15 @@ ProcessInfo::ProcessInfo(
               ScatteringType_t sc_type, InteractionType_t  int_type) :
 TObject(),
 fScatteringType(sc_type),
-fInteractionType(int_type)
+fInteractionType(int_type),
+fStamp(0)
 {
 
 }
 //____________________________________________________________________________
 ProcessInfo::ProcessInfo(const ProcessInfo & proc) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Copy(proc);
 }
@@ -60,6 +63,7 @@ ProcessInfo::~ProcessInfo()
 //____________________________________________________________________________
 void ProcessInfo::Reset(void)
 {
+  fStamp++;
   fScatteringType  = kScNull;
   fInteractionType = kIntNull;
 }
@@ -218,6 +222,7 @@ string ProcessInfo::InteractionTypeAsString(void) const
 //____________________________________________________________________________
 void ProcessInfo::Set(ScatteringType_t sc_type, InteractionType_t  int_type)
 {
+  fStamp++;
   fScatteringType  = sc_type;
   fInteractionType = int_type;
 }
@@ -232,6 +237,7 @@ bool ProcessInfo::Compare(const ProcessInfo & proc) const
 //____________________________________________________________________________
 void ProcessInfo::Copy(const ProcessInfo & proc)
 {
+  fStamp++;
   fScatteringType  = proc.fScatteringType;
   fInteractionType = proc.fInteractionType;
 }
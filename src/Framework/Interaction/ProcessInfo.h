@@ -89,6 +89,9 @@ public:
   string ScatteringTypeAsString  (void) const;
   string InteractionTypeAsString (void) const;
 
+  // Stamp changed by every setter, see Interaction::Codes()
+  UInt_t Stamp (void) const { return fStamp; }
+
   // Copy, reset, compare, print itself and build string code
   void   Reset    (void);
   void   Copy     (const ProcessInfo & proc);
@@ -104,6 +107,7 @@ private:
 
   ScatteringType_t  fScatteringType;  ///< scattering type  (QEL, RES, DIS, ...)
   InteractionType_t fInteractionType; ///< interaction type (Weak CC/NC, E/M, ...)
+  UInt_t            fStamp;           //! modification stamp, see Stamp()
 
 ClassDef(ProcessInfo,1)
 };
@@ -56,27 +56,31 @@ namespace genie {
 }
 //___________________________________________________________________________
 Target::Target() :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init();
 }
 //___________________________________________________________________________
 Target::Target(int pdgc) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init();
   this->SetId(pdgc);
 }
 //___________________________________________________________________________
 Target::Target(int ZZ, int AA) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init();
   this->SetId(ZZ,AA);
 }
 //___________________________________________________________________________
 Target::Target(int ZZ, int AA, int hit_nucleon_pdgc) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init();
   this->SetId(ZZ,AA);
@@ -84,7 +88,8 @@ TObject()
 }
 //___________________________________________________________________________
 Target::Target(const Target & tgt) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Init();
   this->Copy(tgt);
@@ -97,7 +102,8 @@ fA(0),
 fTgtPDG(0),
 fHitNucPDG(0),
 fHitSeaQrk(false),
-fHitNucP4(0)
+fHitNucP4(0),
+fStamp(0)
 {
 
 }
@@ -109,6 +115,7 @@ Target::~Target()
 //___________________________________________________________________________
 void Target::Reset(void)
 {
+  fStamp++;
   this->CleanUp();
   this->Init();
 }
@@ -132,6 +139,7 @@ void Target::CleanUp(void)
 //___________________________________________________________________________
 void Target::Copy(const Target & tgt)
 {
+  fStamp++;
   fTgtPDG = tgt.fTgtPDG;
 
   if( pdg::IsIon(fTgtPDG) ) {
@@ -165,6 +173,7 @@ void Target::Copy(const Target & tgt)
 //___________________________________________________________________________
 void Target::SetId(int pdgc)
 {
+  fStamp++;
   fTgtPDG = pdgc;
   if( pdg::IsIon(pdgc) ) {
      fZ = pdg::IonPdgCodeToZ(pdgc);
@@ -177,6 +186,7 @@ void Target::SetId(int pdgc)
 //___________________________________________________________________________
 void Target::SetId(int ZZ, int AA)
 {
+  fStamp++;
   fTgtPDG = pdg::IonPdgCode(AA,ZZ);
   fZ = ZZ;
   fA = AA;
@@ -187,6 +197,7 @@ void Target::SetId(int ZZ, int AA)
 //___________________________________________________________________________
 void Target::SetHitNucPdg(int nucl_pdgc)
 {
+  fStamp++;
   fHitNucPDG = nucl_pdgc;
   bool is_valid = this->ForceHitNucValidity();  // p, n or a di-nucleon
 
@@ -200,6 +211,7 @@ void Target::SetHitNucPdg(int nucl_pdgc)
 //___________________________________________________________________________
 void Target::SetHitQrkPdg(int pdgc)
 {
+  fStamp++;
   if(pdg::IsQuark(pdgc) || pdg::IsAntiQuark(pdgc)) fHitQrkPDG = pdgc;
 }
 //___________________________________________________________________________
@@ -211,6 +223,7 @@ void Target::SetHitNucP4(const TLorentzVector & p4)
 //___________________________________________________________________________
 void Target::SetHitSeaQrk(bool tf)
 {
+  fStamp++;
   fHitSeaQrk = tf;
 }
 //___________________________________________________________________________
@@ -91,6 +91,9 @@ public:
 
   const TLorentzVector & HitNucP4    (void) const { return *this->HitNucP4Ptr(); }
   TLorentzVector *       HitNucP4Ptr (void) const;
+
+  //-- Stamp changed by every setter of the fields coded in Interaction::Codes()
+  UInt_t Stamp (void) const { return fStamp; }
   
   //-- Copy, reset, compare, print itself and build string code
   void   Reset    (void);
@@ -123,6 +126,7 @@ private:
   bool fHitSeaQrk;            ///< hit quark from sea?
   TLorentzVector * fHitNucP4; ///< hit nucleon 4p
   double fHitNucRad;          ///< hit nucleon position
+  UInt_t fStamp;              //! modification stamp, see Stamp()
 
 ClassDef(Target,2)
 };
@@ -43,13 +43,15 @@ namespace genie {
 }
 //___________________________________________________________________________
 XclsTag::XclsTag() :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Reset();
 }
 //___________________________________________________________________________
 XclsTag::XclsTag(const XclsTag & xcls) :
-TObject()
+TObject(),
+fStamp(0)
 {
   this->Reset();
   this->Copy(xcls);
@@ -67,12 +69,14 @@ bool XclsTag::IsInclusiveCharm(void) const
 //___________________________________________________________________________
 void XclsTag::SetCharm(int charm_pdgc)
 {
+  fStamp++;
   fIsCharmEvent     = true;
   fCharmedHadronPdg = charm_pdgc; // leave as 0 (default) for inclusive charm
 }
 //___________________________________________________________________________
 void XclsTag::UnsetCharm(void)
 {
+  fStamp++;
   fIsCharmEvent     = false;
   fCharmedHadronPdg = 0;
 }
@@ -84,18 +88,21 @@ bool XclsTag::IsInclusiveStrange(void) const
 //___________________________________________________________________________
 void XclsTag::SetStrange(int strange_pdgc)
 {
+  fStamp++;
   fIsStrangeEvent     = true;
   fStrangeHadronPdg   = strange_pdgc; // leave as 0 (default) for inclusive strange
 }
 //___________________________________________________________________________
 void XclsTag::UnsetStrange(void)
 {
+  fStamp++;
   fIsStrangeEvent     = false;
   fStrangeHadronPdg   = 0;
 }
 //___________________________________________________________________________
 void XclsTag::SetNPions(int npi_plus, int npi_0, int npi_minus)
 {
+  fStamp++;
   fNPiPlus  = npi_plus;
   fNPi0     = npi_0;
   fNPiMinus = npi_minus;
@@ -103,12 +110,14 @@ void XclsTag::SetNPions(int npi_plus, int npi_0, int npi_minus)
 //___________________________________________________________________________
 void XclsTag::SetNNucleons(int np, int nn)
 {
+  fStamp++;
   fNProtons  = np;
   fNNeutrons = nn;
 }
 //___________________________________________________________________________
 void XclsTag::ResetNPions(void)
 {
+  fStamp++;
   fNPi0     = 0;
   fNPiPlus  = 0;
   fNPiMinus = 0;
@@ -116,22 +125,26 @@ void XclsTag::ResetNPions(void)
 //___________________________________________________________________________
 void XclsTag::ResetNNucleons(void)
 {
+  fStamp++;
   fNProtons  = 0;
   fNNeutrons = 0;
 }
 //___________________________________________________________________________
 void XclsTag::SetResonance(Resonance_t res)
 {
+  fStamp++;
   fResonance = res;
 }
 //___________________________________________________________________________
 void XclsTag::SetDecayMode(int decay_mode)
 {
+  fStamp++;
   fDecayMode = decay_mode;
 }
 //___________________________________________________________________________
 void XclsTag::Reset(void)
 {
+  fStamp++;
   fIsCharmEvent     = false;
   fCharmedHadronPdg = 0;
   fIsStrangeEvent   = false; 
@@ -147,6 +160,7 @@ void XclsTag::Reset(void)
 //___________________________________________________________________________
 void XclsTag::Copy(const XclsTag & xcls)
 {
+  fStamp++;
   fIsCharmEvent     = xcls.fIsCharmEvent;
   fCharmedHadronPdg = xcls.fCharmedHadronPdg;
   fIsStrangeEvent   = xcls.fIsStrangeEvent;
@@ -62,13 +62,16 @@ public:
   Resonance_t Resonance   (void) const { return fResonance; }
   int  DecayMode          (void) const { return fDecayMode; }
 
+  // Stamp changed by every setter, see Interaction::Codes()
+  UInt_t Stamp            (void) const { return fStamp; }
+
   // Ssetting exclusive final state information
   void SetCharm       (int charm_pdgc = 0);
   void SetStrange     (int strange_pdgc = 0);
   void SetNPions      (int npi_plus, int npi_0, int npi_minus);
   void SetNNucleons   (int np, int nn);
-  void SetNProtons    (int np) { fNProtons  = np; }
-  void SetNNeutrons   (int nn) { fNNeutrons = nn; }
+  void SetNProtons    (int np) { fNProtons  = np; fStamp++; }
+  void SetNNeutrons   (int nn) { fNNeutrons = nn; fStamp++; }
   void UnsetCharm     (void);
   void UnsetStrange   (void);
   void ResetNPions    (void);
@@ -99,6 +102,7 @@ private:
   int         fNPiMinus;         ///< # of pi^-'s in the hadronic system after this Xcls reaction (before FSI)
   Resonance_t fResonance;        ///< baryon resonance excited by probe
   int         fDecayMode;
+  UInt_t      fStamp;            //! modification stamp, see Stamp()
 
 ClassDef(XclsTag,3)
 };
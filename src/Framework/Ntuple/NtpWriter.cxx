@@ -18,6 +18,9 @@
    Added CustomizeFilename() and CustomizeFilenamePrefix() to allow the use
    to customize either the entire output name or just the prefix before the
    run number.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added Filename(), so that apps running several worker processes can tag
+   the default filename with the worker index.
 
 */
 //____________________________________________________________________________
@@ -60,6 +60,9 @@ public :
   void CustomizeFilename       (string filename);   
   void CustomizeFilenamePrefix (string prefix);
 
+  ///< get the output filename (default or customized)
+  string Filename (void) const { return fOutFilename; }
+
 private:
 
   void SetDefaultFilename    (string filename_prefix="gntp");
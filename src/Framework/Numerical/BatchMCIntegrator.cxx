@@ -0,0 +1,361 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BatchMCIntegrator.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/ThreadPool.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  const unsigned int kVegasNBins      = 50;   // as in GSL's vegas
+  const double       kVegasAlpha      = 1.5;  // grid stiffness, as in GSL's vegas
+  const unsigned int kChunkSize       = 256;  // points per work item
+  const unsigned int kMinPointsPerIt  = 1000;
+  const unsigned int kMaxNIterations  = 20;
+  const UInt_t       kSeed            = 4357; // GSL's default seed
+
+  // Evaluation of a batch of points, split in chunks handed out to workers
+  class BatchEvalTask : public ParallelTask {
+  public:
+    BatchEvalTask(const BatchFunctionMultiDimI & f, unsigned int nworkers,
+       unsigned int npoints, unsigned int chunk,
+       const vector<double> & x, vector<double> & fval, UInt_t seed0) :
+      fFunc(f), fNPoints(npoints), fChunk(chunk), fX(x), fF(fval), fSeed0(seed0)
+    {
+      for(unsigned int iw = 0; iw < nworkers; iw++) {
+        fRnd.push_back(new TRandom3(1));
+      }
+    }
+   ~BatchEvalTask()
+    {
+      for(unsigned int iw = 0; iw < fRnd.size(); iw++) {
+        delete fRnd[iw];
+      }
+    }
+    unsigned int NItems(void) const
+    {
+      return (fNPoints + fChunk - 1) / fChunk;
+    }
+    void Run(unsigned int worker, unsigned int item)
+    {
+      unsigned int first = item * fChunk;
+      unsigned int n     = TMath::Min(fChunk, fNPoints - first);
+      unsigned int ndim  = fFunc.NDim();
+
+      UInt_t seed = fSeed0 + item;
+      fRnd[worker]->SetSeed( (seed==0) ? 1 : seed );
+      RandomGen::SetThreadStream(fRnd[worker]);
+      try {
+        fFunc.EvalBatch(worker, n, &fX[first*ndim], &fF[first]);
+      }
+      catch(...) {
+        RandomGen::SetThreadStream(0);
+        throw;
+      }
+      RandomGen::SetThreadStream(0);
+    }
+
+  private:
+    const BatchFunctionMultiDimI & fFunc;
+    unsigned int                   fNPoints;
+    unsigned int                   fChunk;
+    const vector<double> &         fX;
+    vector<double> &               fF;
+    UInt_t                         fSeed0;
+    vector<TRandom3 *>             fRnd;
+  };
+
+}
+//____________________________________________________________________________
+BatchMCIntegrator::BatchMCIntegrator(string type, double abstol,
+   double reltol, unsigned int maxeval, unsigned int mineval, unsigned int nworkers) :
+fAbsTol      (abstol),
+fRelTol      (reltol),
+fMaxEval     (maxeval),
+fMinEval     (mineval),
+fNBins       (kVegasNBins),
+fChunkSize   (kChunkSize),
+fNDim        (0),
+fNCalls      (0),
+fNIterations (0),
+fError       (0.),
+fStatus      (kNotRun)
+{
+  this->Init(type);
+
+  fThreadPool    = new ThreadPool(nworkers);
+  fOwnThreadPool = true;
+}
+//____________________________________________________________________________
+BatchMCIntegrator::BatchMCIntegrator(string type, double abstol,
+   double reltol, unsigned int maxeval, unsigned int mineval, ThreadPool * pool) :
+fAbsTol      (abstol),
+fRelTol      (reltol),
+fMaxEval     (maxeval),
+fMinEval     (mineval),
+fNBins       (kVegasNBins),
+fChunkSize   (kChunkSize),
+fNDim        (0),
+fNCalls      (0),
+fNIterations (0),
+fError       (0.),
+fStatus      (kNotRun)
+{
+  assert(pool);
+  this->Init(type);
+
+  fThreadPool    = pool;
+  fOwnThreadPool = false;
+}
+//____________________________________________________________________________
+BatchMCIntegrator::~BatchMCIntegrator()
+{
+  if(fOwnThreadPool) delete fThreadPool;
+  delete fRnd;
+}
+//____________________________________________________________________________
+void BatchMCIntegrator::Init(string type)
+{
+  string t = utils::str::ToLower(type);
+  if(t != "batch-vegas" && t != "batch-plain") {
+    LOG("BatchMC", pWARN)
+       << "Unknown batch integration type = " << type
+       << ". Setting it to default [batch-vegas].";
+  }
+  fVegas = (t != "batch-plain");
+
+  fRnd = new TRandom3(kSeed);
+}
+//____________________________________________________________________________
+unsigned int BatchMCIntegrator::NWorkers(void) const
+{
+  return fThreadPool->NWorkers();
+}
+//____________________________________________________________________________
+bool BatchMCIntegrator::IsBatchType(string type)
+{
+  return (utils::str::ToLower(type).find("batch-") == 0);
+}
+//____________________________________________________________________________
+void BatchMCIntegrator::WarmStart(const vector<double> & grid)
+{
+  fWarmGrid = grid;
+}
+//____________________________________________________________________________
+double BatchMCIntegrator::Integral(
+      const BatchFunctionMultiDimI & f, const double * a, const double * b)
+{
+  fNDim        = f.NDim();
+  fNCalls      = 0;
+  fNIterations = 0;
+  fError       = 0.;
+  fStatus      = kNotRun;
+
+  assert(fNDim > 0);
+
+  double vol = 1.;
+  for(unsigned int id = 0; id < fNDim; id++) {
+    vol *= (b[id] - a[id]);
+  }
+  if(vol == 0.) {
+    fStatus = kConverged;
+    return 0.;
+  }
+
+  // start with a uniform grid, unless warm started
+  bool warm = fVegas && (fWarmGrid.size() == fNDim * (fNBins+1));
+  if(warm) {
+    fGrid = fWarmGrid;
+  } else {
+    fGrid.assign(fNDim * (fNBins+1), 0.);
+    for(unsigned int id = 0; id < fNDim; id++) {
+      for(unsigned int ib = 0; ib <= fNBins; ib++) {
+        fGrid[id*(fNBins+1) + ib] = (double)ib / fNBins;
+      }
+    }
+  }
+  fGridD.assign(fNDim * fNBins, 0.);
+  fWarmGrid.clear();
+
+  unsigned int npoints = TMath::Max(fMaxEval/kMaxNIterations, kMinPointsPerIt);
+  npoints = TMath::Max(1u, TMath::Min(npoints, fMaxEval));
+
+  double sumw  = 0.; // sum of iteration weights 1/sigma^2
+  double sumwI = 0.; // sum of weighted iteration estimates
+  double result = 0.;
+
+  while(1) {
+    double var = 0.;
+    double I = this->Iterate(f, a, b, npoints, var);
+    fNIterations++;
+    fNCalls += npoints;
+
+    LOG("BatchMC", pDEBUG)
+       << "Iteration " << fNIterations << ": I = " << I
+       << " +/- " << TMath::Sqrt(var);
+
+    if(var <= 0.) {
+      // constant integrand (eg. vanishing everywhere): the estimate is exact
+      result = I;
+      fError = 0.;
+      fStatus = kConverged;
+      break;
+    }
+    sumw  += 1./var;
+    sumwI += I/var;
+    result = sumwI / sumw;
+    fError = TMath::Sqrt(1./sumw);
+
+    // a cold vegas grid needs at least one refinement
+    bool enough_calls = (fNCalls >= fMinEval) &&
+                        (!fVegas || warm || fNIterations > 1);
+    bool accurate = (fError <= fAbsTol) || (fError <= fRelTol*TMath::Abs(result));
+    if(enough_calls && accurate) {
+      fStatus = kConverged;
+      break;
+    }
+    if(fNCalls + npoints > fMaxEval) {
+      fStatus = kMaxEvalExhausted;
+      break;
+    }
+    if(fVegas) this->RefineGrid();
+  }
+
+  if(fStatus != kConverged) {
+    LOG("BatchMC", pWARN)
+      << "Requested accuracy not reached after " << fNCalls
+      << " function calls: I = " << result << " +/- " << fError;
+  }
+
+  return result * vol;
+}
+//____________________________________________________________________________
+double BatchMCIntegrator::Iterate(const BatchFunctionMultiDimI & f,
+   const double * a, const double * b, unsigned int npoints, double & var)
+{
+// Evaluates the integral over the unit hypercube mapped onto [a,b] (without
+// the volume factor) with npoints points and updates the vegas grid data
+
+  vector<double>       x   (npoints * fNDim);
+  vector<double>       fval(npoints, 0.);
+  vector<double>       jac (npoints, 1.);
+  vector<unsigned int> bins(fVegas ? npoints * fNDim : 0);
+
+  // throw all points on the calling thread
+  for(unsigned int ip = 0; ip < npoints; ip++) {
+    for(unsigned int id = 0; id < fNDim; id++) {
+      double u = fRnd->Rndm();
+      double z = u;
+      if(fVegas) {
+        double y = u * fNBins;
+        unsigned int ib = TMath::Min((unsigned int) y, fNBins-1);
+        const double * edges = &fGrid[id*(fNBins+1)];
+        double width = edges[ib+1] - edges[ib];
+        z = edges[ib] + (y - ib) * width;
+        jac [ip] *= fNBins * width;
+        bins[ip*fNDim + id] = ib;
+      }
+      x[ip*fNDim + id] = a[id] + z * (b[id] - a[id]);
+    }
+  }
+
+  // evaluate the integrand on the workers. The first chunk is evaluated on
+  // the calling thread, so that anything the integrand initializes lazily
+  // is set up before the workers start.
+  UInt_t seed0 = fRnd->Integer(kMaxUInt);
+  BatchEvalTask task(f, fThreadPool->NWorkers(), npoints, fChunkSize, x, fval, seed0);
+  task.Run(0, 0);
+  fThreadPool->Execute(task, task.NItems(), 1);
+
+  double sum = 0., sum2 = 0.;
+  for(unsigned int ip = 0; ip < npoints; ip++) {
+    double w = fval[ip] * jac[ip];
+    sum  += w;
+    sum2 += w*w;
+    if(fVegas) {
+      for(unsigned int id = 0; id < fNDim; id++) {
+        fGridD[id*fNBins + bins[ip*fNDim + id]] += w*w;
+      }
+    }
+  }
+  double mean = sum  / npoints;
+  double msq  = sum2 / npoints;
+  var = (npoints > 1) ? TMath::Max(0., (msq - mean*mean) / (npoints-1)) : 0.;
+
+  return mean;
+}
+//____________________________________________________________________________
+void BatchMCIntegrator::RefineGrid(void)
+{
+// Lepage's grid refinement: the bins are resized so that each holds an
+// equal share of the (smoothed, damped) sum of squared weights
+
+  vector<double> d(fNBins), r(fNBins), edges(fNBins+1);
+
+  for(unsigned int id = 0; id < fNDim; id++) {
+
+    double * grid  = &fGrid [id*(fNBins+1)];
+    double * gridd = &fGridD[id*fNBins];
+
+    // smooth
+    double dsum = 0.;
+    for(unsigned int ib = 0; ib < fNBins; ib++) {
+      double s = gridd[ib];
+      int    n = 1;
+      if(ib > 0)        { s += gridd[ib-1]; n++; }
+      if(ib < fNBins-1) { s += gridd[ib+1]; n++; }
+      d[ib] = s/n;
+      dsum += d[ib];
+    }
+    for(unsigned int ib = 0; ib < fNBins; ib++) gridd[ib] = 0.;
+    if(dsum <= 0.) continue;
+
+    // damp
+    double rsum = 0.;
+    for(unsigned int ib = 0; ib < fNBins; ib++) {
+      double xi = d[ib]/dsum;
+      if      (xi <= 0.) r[ib] = 0.;
+      else if (xi >= 1.) r[ib] = 1.;
+      else               r[ib] = TMath::Power((xi-1.)/TMath::Log(xi), kVegasAlpha);
+      rsum += r[ib];
+    }
+    if(rsum <= 0.) continue;
+
+    // rebin
+    double step = rsum / fNBins;
+    double acc  = 0.;
+    int    k    = -1;
+    edges[0]      = 0.;
+    edges[fNBins] = 1.;
+    for(unsigned int ib = 1; ib < fNBins; ib++) {
+      double target = ib * step;
+      while(acc < target && k < (int)fNBins-1) {
+        k++;
+        acc += r[k];
+      }
+      double frac = (r[k] > 0.) ? (acc - target) / r[k] : 0.;
+      edges[ib] = grid[k+1] - frac * (grid[k+1] - grid[k]);
+    }
+    for(unsigned int ib = 0; ib <= fNBins; ib++) grid[ib] = edges[ib];
+  }
+}
+//____________________________________________________________________________
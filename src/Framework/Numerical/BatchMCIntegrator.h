@@ -0,0 +1,146 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::BatchMCIntegrator
+
+\brief    Monte Carlo integration of a multi-dimensional function over a box,
+          with the integrand evaluated in batches of points spread over a
+          pool of worker threads.
+
+          Two methods are available:
+          - "batch-plain": uniform sampling,
+          - "batch-vegas": Lepage's VEGAS algorithm. An adaptive, separable
+            importance sampling grid (fNBins bins per dimension) is refined
+            after every iteration and the estimates of all iterations are
+            combined with weights 1/sigma^2.
+
+          Points are thrown in iterations of fixed size on the calling thread
+          with the integrator's own random number generator (fixed seed), and
+          handed out to the workers in chunks. The results are therefore
+          independent of the number of threads. Before evaluating a chunk
+          each worker switches its RandomGen stream to a generator seeded from
+          the chunk index, so that integrands throwing random numbers are
+          reproducible too.
+
+          Iterations stop when the relative (or absolute) error falls below
+          the requested tolerance and at least MinEval points have been used,
+          or when MaxEval points have been used.
+
+          The vegas grid can be saved after an integration and used to warm
+          start the integration of a similar function (eg. the same cross
+          section at a neighbouring energy), in which case a single
+          iteration may suffice.
+
+\class    genie::BatchFunctionMultiDimI
+
+\brief    Interface for a multi-dimensional function evaluated in batches of
+          points by a BatchMCIntegrator. EvalBatch() is called concurrently by
+          different workers, each with its own worker index, so that
+          implementations can keep per-worker state without any locking.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _BATCH_MC_INTEGRATOR_H_
+#define _BATCH_MC_INTEGRATOR_H_
+
+#include <string>
+#include <vector>
+
+class TRandom3;
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class ThreadPool;
+
+class BatchFunctionMultiDimI {
+
+public:
+  virtual ~BatchFunctionMultiDimI() {}
+
+  //! Number of dimensions
+  virtual unsigned int NDim (void) const = 0;
+
+  //! Evaluate the function at npoints points: point i has coordinates
+  //! x[i*NDim()], ..., x[i*NDim()+NDim()-1] and its value is stored in f[i]
+  virtual void EvalBatch (unsigned int worker, unsigned int npoints,
+                          const double * x, double * f) const = 0;
+};
+
+class BatchMCIntegrator {
+
+public:
+  //! Status codes
+  enum EStatus {
+    kConverged        = 0,
+    kMaxEvalExhausted = 1,
+    kNotRun           = 2
+  };
+
+  BatchMCIntegrator(string type, double abstol, double reltol,
+              unsigned int maxeval, unsigned int mineval, unsigned int nworkers = 0);
+  //! Use the input pool of workers (not owned, kept across integrations)
+  BatchMCIntegrator(string type, double abstol, double reltol,
+              unsigned int maxeval, unsigned int mineval, ThreadPool * pool);
+ ~BatchMCIntegrator();
+
+  //! Integral of f over the box [a,b]
+  double Integral (const BatchFunctionMultiDimI & f, const double * a, const double * b);
+
+  //! Results of the last integration
+  double        Error       (void) const { return fError;       }
+  unsigned long NCalls      (void) const { return fNCalls;      }
+  unsigned int  NIterations (void) const { return fNIterations; }
+  int           Status      (void) const { return fStatus;      }
+
+  //! Vegas grid (bin edges in the unit hypercube, [idim][ibin]) adapted
+  //! during the last integration, and grid to start the next one from
+  const vector<double> & Grid      (void) const { return fGrid; }
+  void                   WarmStart (const vector<double> & grid);
+
+  //! Number of workers the integrand must be prepared for
+  unsigned int NWorkers (void) const;
+
+  //! Does the input (integration type) string name a batch integrator?
+  static bool IsBatchType (string type);
+
+private:
+  BatchMCIntegrator(const BatchMCIntegrator & ig);
+
+  void   Init       (string type);
+  double Iterate    (const BatchFunctionMultiDimI & f, const double * a,
+                     const double * b, unsigned int npoints, double & var);
+  void   RefineGrid (void);
+
+  bool           fVegas;         ///< vegas (true) or plain (false) sampling
+  double         fAbsTol;        ///< required absolute error
+  double         fRelTol;        ///< required relative error
+  unsigned int   fMaxEval;       ///< max number of function evaluations
+  unsigned int   fMinEval;       ///< min number of function evaluations
+  unsigned int   fNBins;         ///< vegas grid bins per dimension
+  unsigned int   fChunkSize;     ///< points per item handed out to a worker
+  ThreadPool *   fThreadPool;    ///< workers evaluating the integrand
+  bool           fOwnThreadPool; ///< was fThreadPool created by (and to be deleted with) this integrator?
+  TRandom3 *     fRnd;           ///< random number generator for the points
+  unsigned int   fNDim;          ///< dimensions of the current integrand
+  vector<double> fGrid;          ///< vegas bin edges [idim][ibin], in [0,1]
+  vector<double> fGridD;         ///< sum of squared weights [idim][ibin]
+  vector<double> fWarmGrid;      ///< grid to start the next integration from
+  unsigned long  fNCalls;        ///< function evaluations used
+  unsigned int   fNIterations;   ///< iterations used
+  double         fError;         ///< error estimate
+  int            fStatus;        ///< status code
+};
+
+}      // genie namespace
+#endif // _BATCH_MC_INTEGRATOR_H_
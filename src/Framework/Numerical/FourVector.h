@@ -0,0 +1,233 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ThreeVector, genie::FourVector, genie::LorentzBoost
+
+\brief    Lightweight value-type 3-vector, Lorentz 4-vector and Lorentz boost
+          for GENIE-internal kinematics code.
+
+          Unlike TVector3 / TLorentzVector they are not TObjects (no virtual
+          table, no streamer, no heap allocation when held by value) and all
+          operations are inlined, so temporaries in tight kinematics loops
+          stay in registers. The conventions follow TVector3 / TLorentzVector
+          (metric +,-,-,-; Boost() with the same sign convention) and explicit
+          conversions are provided at the boundary with ROOT classes and the
+          event record (see GHepParticle::P4Value(), X4Value()).
+
+          A LorentzBoost computes gamma (and the other factors depending only
+          on the boost vector) once, so that boosting several vectors into
+          the same frame does not repeat the square root and normalization
+          done by every TLorentzVector::Boost() call.
+
+          These classes are not persistent and should not be stored in
+          the event record or in any other ROOT I/O object.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _FOUR_VECTOR_H_
+#define _FOUR_VECTOR_H_
+
+#include <cmath>
+
+#include <TVector3.h>
+#include <TLorentzVector.h>
+
+namespace genie {
+
+//____________________________________________________________________________
+class ThreeVector {
+
+public:
+  ThreeVector() : fX(0.), fY(0.), fZ(0.) {}
+  ThreeVector(double x, double y, double z) : fX(x), fY(y), fZ(z) {}
+  explicit ThreeVector(const TVector3 & v) : fX(v.X()), fY(v.Y()), fZ(v.Z()) {}
+
+  TVector3 ToTVector3 (void) const { return TVector3(fX,fY,fZ); }
+
+  double X (void) const { return fX; }
+  double Y (void) const { return fY; }
+  double Z (void) const { return fZ; }
+
+  void SetXYZ (double x, double y, double z) { fX = x; fY = y; fZ = z; }
+
+  double Mag2 (void) const { return fX*fX + fY*fY + fZ*fZ; }
+  double Mag  (void) const { return std::sqrt(this->Mag2()); }
+
+  double Dot (const ThreeVector & v) const {
+    return fX*v.fX + fY*v.fY + fZ*v.fZ;
+  }
+  ThreeVector Cross (const ThreeVector & v) const {
+    return ThreeVector(fY*v.fZ - fZ*v.fY, fZ*v.fX - fX*v.fZ, fX*v.fY - fY*v.fX);
+  }
+  //! Unit vector along this one (the null vector is returned unchanged)
+  ThreeVector Unit (void) const {
+    double m2 = this->Mag2();
+    if(m2 <= 0.) return *this;
+    double im = 1. / std::sqrt(m2);
+    return ThreeVector(fX*im, fY*im, fZ*im);
+  }
+
+  ThreeVector & operator += (const ThreeVector & v) {
+    fX += v.fX; fY += v.fY; fZ += v.fZ; return *this;
+  }
+  ThreeVector & operator -= (const ThreeVector & v) {
+    fX -= v.fX; fY -= v.fY; fZ -= v.fZ; return *this;
+  }
+  ThreeVector & operator *= (double a) {
+    fX *= a; fY *= a; fZ *= a; return *this;
+  }
+  ThreeVector operator + (const ThreeVector & v) const {
+    return ThreeVector(fX+v.fX, fY+v.fY, fZ+v.fZ);
+  }
+  ThreeVector operator - (const ThreeVector & v) const {
+    return ThreeVector(fX-v.fX, fY-v.fY, fZ-v.fZ);
+  }
+  ThreeVector operator - (void) const { return ThreeVector(-fX,-fY,-fZ); }
+  ThreeVector operator * (double a) const { return ThreeVector(a*fX, a*fY, a*fZ); }
+
+private:
+  double fX, fY, fZ;
+};
+
+inline ThreeVector operator * (double a, const ThreeVector & v) { return v*a; }
+
+//____________________________________________________________________________
+class FourVector {
+
+public:
+  FourVector() : fP(), fE(0.) {}
+  FourVector(double px, double py, double pz, double e) : fP(px,py,pz), fE(e) {}
+  FourVector(const ThreeVector & p, double e) : fP(p), fE(e) {}
+  explicit FourVector(const TLorentzVector & v) :
+     fP(v.Px(),v.Py(),v.Pz()), fE(v.E()) {}
+
+  TLorentzVector ToTLorentzVector (void) const {
+    return TLorentzVector(fP.X(),fP.Y(),fP.Z(),fE);
+  }
+
+  double Px (void) const { return fP.X(); }
+  double Py (void) const { return fP.Y(); }
+  double Pz (void) const { return fP.Z(); }
+  double E  (void) const { return fE;     }
+  double X  (void) const { return fP.X(); }
+  double Y  (void) const { return fP.Y(); }
+  double Z  (void) const { return fP.Z(); }
+  double T  (void) const { return fE;     }
+
+  const ThreeVector & Vect (void) const { return fP; }
+
+  void SetPxPyPzE (double px, double py, double pz, double e) {
+    fP.SetXYZ(px,py,pz); fE = e;
+  }
+  void SetVect (const ThreeVector & p) { fP = p; }
+  void SetE    (double e)              { fE = e; }
+
+  double P    (void) const { return fP.Mag(); }
+  double Mag2 (void) const { return fE*fE - fP.Mag2(); }
+  //! Invariant mass (negative sqrt(-Mag2()) if space-like, as TLorentzVector)
+  double Mag  (void) const {
+    double m2 = this->Mag2();
+    return (m2 < 0.) ? -std::sqrt(-m2) : std::sqrt(m2);
+  }
+  double M2   (void) const { return this->Mag2(); }
+  double M    (void) const { return this->Mag();  }
+
+  double Dot (const FourVector & v) const { return fE*v.fE - fP.Dot(v.fP); }
+
+  //! Velocity of the frame in which this 4-vector is at rest
+  ThreeVector BoostVector (void) const { return fP * (1./fE); }
+
+  //! Boost by the velocity (bx,by,bz), as TLorentzVector::Boost()
+  inline void Boost (double bx, double by, double bz);
+  inline void Boost (const ThreeVector & b) { this->Boost(b.X(),b.Y(),b.Z()); }
+
+  FourVector & operator += (const FourVector & v) {
+    fP += v.fP; fE += v.fE; return *this;
+  }
+  FourVector & operator -= (const FourVector & v) {
+    fP -= v.fP; fE -= v.fE; return *this;
+  }
+  FourVector & operator *= (double a) {
+    fP *= a; fE *= a; return *this;
+  }
+  FourVector operator + (const FourVector & v) const {
+    return FourVector(fP+v.fP, fE+v.fE);
+  }
+  FourVector operator - (const FourVector & v) const {
+    return FourVector(fP-v.fP, fE-v.fE);
+  }
+  FourVector operator - (void) const { return FourVector(-fP,-fE); }
+  FourVector operator * (double a) const { return FourVector(fP*a, fE*a); }
+
+private:
+  ThreeVector fP;
+  double      fE;
+};
+
+inline FourVector operator * (double a, const FourVector & v) { return v*a; }
+
+//____________________________________________________________________________
+class LorentzBoost {
+
+public:
+  //! Boost by the velocity (bx,by,bz), |b| < 1
+  LorentzBoost(double bx, double by, double bz) { this->Set(bx,by,bz); }
+  explicit LorentzBoost(const ThreeVector & b) { this->Set(b.X(),b.Y(),b.Z()); }
+
+  //! Boost to the rest frame of the input 4-vector
+  static LorentzBoost ToRestFrame (const FourVector & p) {
+    return LorentzBoost(-p.BoostVector());
+  }
+
+  const ThreeVector & Beta  (void) const { return fBeta;  }
+  double              Gamma (void) const { return fGamma; }
+
+  //! The inverse boost
+  LorentzBoost Inverse (void) const { return LorentzBoost(-fBeta, fGamma, fGamma2); }
+
+  //! Boosted copy of the input 4-vector
+  FourVector operator () (const FourVector & v) const {
+    double bp = fBeta.Dot(v.Vect());
+    return FourVector(v.Vect() + fBeta * (fGamma2*bp + fGamma*v.E()),
+                      fGamma * (v.E() + bp));
+  }
+
+  //! Boost n 4-vectors in place
+  void Apply (unsigned int n, FourVector * v) const {
+    for(unsigned int i = 0; i < n; i++) v[i] = (*this)(v[i]);
+  }
+
+private:
+  LorentzBoost(const ThreeVector & b, double gamma, double gamma2) :
+     fBeta(b), fGamma(gamma), fGamma2(gamma2) {}
+
+  void Set (double bx, double by, double bz) {
+    fBeta.SetXYZ(bx,by,bz);
+    double b2 = fBeta.Mag2();
+    fGamma  = 1.0 / std::sqrt(1.0 - b2);
+    fGamma2 = (b2 > 0) ? (fGamma - 1.0)/b2 : 0.0;
+  }
+
+  ThreeVector fBeta;
+  double      fGamma;
+  double      fGamma2;  ///< (gamma-1)/beta^2
+};
+
+//____________________________________________________________________________
+inline void FourVector::Boost(double bx, double by, double bz)
+{
+  *this = LorentzBoost(bx,by,bz)(*this);
+}
+//____________________________________________________________________________
+
+}      // genie namespace
+
+#endif // _FOUR_VECTOR_H_
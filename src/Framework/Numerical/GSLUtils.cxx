@@ -70,6 +70,15 @@ ROOT::Math::IntegrationMultiDim::Type
 
   string t = genie::utils::str::ToLower(type);
 
+  // batch (multi-threaded) integrators are not available to all algorithms:
+  // fall back to the corresponding single-threaded GSL integrator
+  if(t=="batch-vegas" || t=="batch-plain") {
+    LOG("GSL", pWARN)
+       << "Batch integration type = " << type << " is not supported here"
+       << ". Using the GSL [" << t.substr(6) << "] integrator instead.";
+    t = t.substr(6);
+  }
+
 #ifdef _OLD_GSL_INTEGRATION_ENUM_TYPES_
 
   if      (t=="adaptive") return ROOT::Math::IntegrationMultiDim::ADAPTIVE;
@@ -291,4 +291,16 @@ double genie::utils::math::NonNegative(float x)
   return TMath::Max( (float)0., x);
 }
 //____________________________________________________________________________
-
+double genie::utils::math::RadicalInverse(unsigned int i, unsigned int base)
+{
+  double inv_base = 1. / base;
+  double f = inv_base;
+  double x = 0.;
+  while(i > 0) {
+    x += f * (i % base);
+    i /= base;
+    f *= inv_base;
+  }
+  return x;
+}
+//____________________________________________________________________________
@@ -53,6 +53,11 @@ namespace math
   double NonNegative    (double x);
   double NonNegative    (float  x);
 
+  // Van der Corput radical inverse of i in the input (prime) base.
+  // Taking successive i and one prime base per dimension gives the
+  // Halton low-discrepancy sequence in the unit hypercube.
+  double RadicalInverse (unsigned int i, unsigned int base);
+
 } // math  namespace
 } // utils namespace
 } // genie namespace
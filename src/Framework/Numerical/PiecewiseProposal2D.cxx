@@ -0,0 +1,232 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/PiecewiseProposal2D.h"
+
+using namespace genie;
+
+namespace {
+  // Guards the bounds, cumulative bounds and statistics of all proposals.
+  // The critical sections are short (a binary search at most) next to the
+  // function evaluations of the callers, so a single lock is sufficient.
+  std::mutex gProposalMutex;
+}
+
+//____________________________________________________________________________
+PiecewiseProposal2D::PiecewiseProposal2D(unsigned int nx, unsigned int ny) :
+fNX(nx),
+fNY(ny),
+fBound(nx*ny, 0.),
+fCDF(nx*ny, 0.),
+fNEval(0),
+fNGenerated(0),
+fNAccepted(0),
+fNViolations(0)
+{
+  assert(fNX > 0 && fNY > 0);
+}
+//____________________________________________________________________________
+PiecewiseProposal2D::~PiecewiseProposal2D()
+{
+
+}
+//____________________________________________________________________________
+void PiecewiseProposal2D::Build(
+  const ROOT::Math::IBaseFunctionMultiDim & f, double safety,
+  unsigned int nsub, double ratio)
+{
+  assert(f.NDim() == 2);
+  if(nsub < 1) nsub = 1;
+
+  unsigned int ncells = fNX*fNY;
+  unsigned long neval = 0;
+  vector<double> cmax(ncells, 0.);
+  vector<double> cmin(ncells, 1E+99);
+
+  // evaluate f on a lattice with nsub divisions per cell (the lattice points
+  // on the cell edges are shared by the neighbouring cells)
+  unsigned int nu = fNX*nsub + 1;
+  unsigned int nv = fNY*nsub + 1;
+  vector<double> lattice(nu*nv);
+  double x[2];
+  for(unsigned int iu = 0; iu < nu; iu++) {
+    x[0] = double(iu) / (nu-1);
+    for(unsigned int iv = 0; iv < nv; iv++) {
+      x[1] = double(iv) / (nv-1);
+      lattice[iu*nv + iv] = TMath::Max(0., f(x));
+      neval++;
+    }
+  }
+  for(unsigned int ix = 0; ix < fNX; ix++) {
+    for(unsigned int iy = 0; iy < fNY; iy++) {
+      unsigned int icell = ix*fNY + iy;
+      for(unsigned int a = 0; a <= nsub; a++) {
+        for(unsigned int b = 0; b <= nsub; b++) {
+          double val = lattice[(ix*nsub + a)*nv + iy*nsub + b];
+          cmax[icell] = TMath::Max(cmax[icell], val);
+          cmin[icell] = TMath::Min(cmin[icell], val);
+        }
+      }
+    }
+  }
+
+  // refine cells where f varies strongly (incl. cells crossed by the
+  // boundary of the region where f is non-zero)
+  unsigned int nfine = 2*nsub;
+  for(unsigned int ix = 0; ix < fNX; ix++) {
+    for(unsigned int iy = 0; iy < fNY; iy++) {
+      unsigned int icell = ix*fNY + iy;
+      if(cmax[icell] <= 0 || cmax[icell] <= ratio*cmin[icell]) continue;
+      for(unsigned int a = 0; a < nfine; a++) {
+        x[0] = (ix + (a+0.5)/nfine) / fNX;
+        for(unsigned int b = 0; b < nfine; b++) {
+          x[1] = (iy + (b+0.5)/nfine) / fNY;
+          cmax[icell] = TMath::Max(cmax[icell], f(x));
+          neval++;
+        }
+      }
+    }
+  }
+
+  // set the bounds; cells where f vanished everywhere get the largest
+  // bound of their neighbours, in case f is non-zero in between samples
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  fNEval += neval;
+  for(unsigned int ix = 0; ix < fNX; ix++) {
+    for(unsigned int iy = 0; iy < fNY; iy++) {
+      unsigned int icell = ix*fNY + iy;
+      double bound = cmax[icell];
+      if(bound <= 0) {
+        for(int dx = -1; dx <= 1; dx++) {
+          for(int dy = -1; dy <= 1; dy++) {
+            int jx = ix + dx;
+            int jy = iy + dy;
+            if(jx < 0 || jy < 0 || jx >= (int)fNX || jy >= (int)fNY) continue;
+            bound = TMath::Max(bound, cmax[jx*fNY + jy]);
+          }
+        }
+      }
+      fBound[icell] = TMath::Max(fBound[icell], safety*bound);
+    }
+  }
+
+  this->UpdateCDF();
+
+  LOG("Proposal2D", pINFO)
+    << "Built " << fNX << "x" << fNY << " proposal with "
+    << fNEval << " function evaluations; integral = "
+    << fCDF.back() / (fNX*fNY);
+}
+//____________________________________________________________________________
+double PiecewiseProposal2D::Generate(
+                            TRandom3 & rnd, double & u, double & v) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+
+  fNGenerated++;
+
+  double r = rnd.Rndm() * fCDF.back();
+  unsigned int icell =
+      std::upper_bound(fCDF.begin(), fCDF.end(), r) - fCDF.begin();
+  if(icell >= fCDF.size()) icell = fCDF.size() - 1;
+
+  unsigned int ix = icell / fNY;
+  unsigned int iy = icell % fNY;
+  u = (ix + rnd.Rndm()) / fNX;
+  v = (iy + rnd.Rndm()) / fNY;
+
+  return fBound[icell];
+}
+//____________________________________________________________________________
+double PiecewiseProposal2D::Bound(double u, double v) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  return fBound[this->Cell(u,v)];
+}
+//____________________________________________________________________________
+void PiecewiseProposal2D::RaiseBound(double u, double v, double bound)
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+
+  unsigned int icell = this->Cell(u,v);
+  if(bound <= fBound[icell]) return;
+
+  fNViolations++;
+  LOG("Proposal2D", pNOTICE)
+    << "Raising bound at (u,v) = (" << u << ", " << v << ") from "
+    << fBound[icell] << " to " << bound
+    << " (violation " << fNViolations << ")";
+
+  fBound[icell] = bound;
+  this->UpdateCDF();
+}
+//____________________________________________________________________________
+double PiecewiseProposal2D::Integral(void) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  return fCDF.back() / (fNX*fNY);
+}
+//____________________________________________________________________________
+unsigned long PiecewiseProposal2D::NEvaluations(void) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  return fNEval;
+}
+//____________________________________________________________________________
+unsigned long PiecewiseProposal2D::NGenerated(void) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  return fNGenerated;
+}
+//____________________________________________________________________________
+unsigned long PiecewiseProposal2D::NAccepted(void) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  return fNAccepted;
+}
+//____________________________________________________________________________
+unsigned long PiecewiseProposal2D::NViolations(void) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  return fNViolations;
+}
+//____________________________________________________________________________
+void PiecewiseProposal2D::Accepted(void) const
+{
+  std::lock_guard<std::mutex> lock(gProposalMutex);
+  fNAccepted++;
+}
+//____________________________________________________________________________
+unsigned int PiecewiseProposal2D::Cell(double u, double v) const
+{
+  int ix = TMath::Min( TMath::Max(0, int(u*fNX)), int(fNX)-1 );
+  int iy = TMath::Min( TMath::Max(0, int(v*fNY)), int(fNY)-1 );
+  return ix*fNY + iy;
+}
+//____________________________________________________________________________
+void PiecewiseProposal2D::UpdateCDF(void)
+{
+  double sum = 0;
+  for(unsigned int icell = 0; icell < fBound.size(); icell++) {
+    sum += fBound[icell];
+    fCDF[icell] = sum;
+  }
+}
+//____________________________________________________________________________
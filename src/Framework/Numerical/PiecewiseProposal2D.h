@@ -0,0 +1,98 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::PiecewiseProposal2D
+
+\brief    A piecewise-constant upper bound of a non-negative function over
+          the unit square, used as the proposal (envelope) distribution in
+          accept/reject methods.
+          The unit square is divided into NX x NY cells, each with its own
+          bound. Points are generated with a probability proportional to the
+          bound of their cell, and uniformly within the cell, so that
+          accepting a point (u,v) with probability f(u,v)/bound(u,v) yields
+          unweighted points distributed as f.
+          The bounds are built by evaluating f on a lattice within each cell.
+          Cells where f varies strongly are sampled more finely, and cells
+          where f vanishes at all sampled points inherit the bounds of their
+          neighbours. If f is later found to exceed the bound of a cell, the
+          bound can be raised; such violations are counted, as the points
+          generated before the bound was raised are biased.
+          A proposal can be shared by several event generation threads:
+          generating points, raising bounds and updating the statistics are
+          serialized.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PIECEWISE_PROPOSAL_2D_H_
+#define _PIECEWISE_PROPOSAL_2D_H_
+
+#include <vector>
+
+#include <Math/IFunction.h>
+
+class TRandom3;
+
+using std::vector;
+
+namespace genie {
+
+class PiecewiseProposal2D {
+
+public:
+  PiecewiseProposal2D(unsigned int nx, unsigned int ny);
+ ~PiecewiseProposal2D();
+
+  unsigned int NX (void) const { return fNX; }
+  unsigned int NY (void) const { return fNY; }
+
+  //! Build (or, if already built, enlarge) the cell bounds from evaluations
+  //! of the 2-D function f over the unit square. f is evaluated on a lattice
+  //! with nsub divisions per cell and per dimension, refined by a factor of 2
+  //! in cells where it varies by more than a factor 'ratio'. Bounds are set
+  //! to 'safety' times the largest value found.
+  void   Build (const ROOT::Math::IBaseFunctionMultiDim & f, double safety,
+                unsigned int nsub = 2, double ratio = 2.);
+
+  //! Generate a point (u,v) distributed as the proposal; returns its bound
+  double Generate   (TRandom3 & rnd, double & u, double & v) const;
+
+  //! Bound at the input point & raise it (eg. after a bound violation)
+  double Bound      (double u, double v) const;
+  void   RaiseBound (double u, double v, double bound);
+
+  //! Integral of the proposal over the unit square
+  double Integral   (void) const;
+
+  //! Statistics: function evaluations made while building the proposal,
+  //! points generated, points accepted by the caller and bound violations
+  unsigned long NEvaluations (void) const;
+  unsigned long NGenerated   (void) const;
+  unsigned long NAccepted    (void) const;
+  unsigned long NViolations  (void) const;
+  void          Accepted     (void) const;
+
+private:
+  unsigned int Cell      (double u, double v) const;
+  void         UpdateCDF (void);
+
+  unsigned int          fNX;         ///< number of cells in u
+  unsigned int          fNY;         ///< number of cells in v
+  vector<double>        fBound;      ///< bound for each cell (cell index: ix*fNY+iy)
+  vector<double>        fCDF;        ///< cumulative sum of the cell bounds
+
+  unsigned long         fNEval;      ///< function evaluations while building
+  mutable unsigned long fNGenerated; ///< points generated
+  mutable unsigned long fNAccepted;  ///< points accepted
+  unsigned long         fNViolations; ///< bounds raised after building
+};
+
+}      // genie namespace
+#endif // _PIECEWISE_PROPOSAL_2D_H_
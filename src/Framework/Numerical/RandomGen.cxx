@@ -12,6 +12,12 @@
  Important revisions after version 2.0.0 :
  @ Jan 24, 2013 - CA
    No longer uses the $GSEED variable for setting the random number seed.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   SetSeed() updates the seed returned by GetSeed(), which ForkedWorkers
+   uses to derive the seeds of the worker processes.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   ROOT's gRandom and PYTHIA6 draw from the random number generator
+   attached to the calling thread, if any (see SetThreadStream()).
 
 */
 //____________________________________________________________________________
@@ -20,10 +26,12 @@
 
 #include <TSystem.h>
 #include <TPythia6.h>
+#include <TRandom.h>
 
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/Pythia6Lock.h"
 
 using namespace genie::controls;
 
@@ -32,6 +40,37 @@ namespace genie {
 //____________________________________________________________________________
 RandomGen * RandomGen::fInstance = 0;
 //____________________________________________________________________________
+static thread_local TRandom3 * gThreadRandom3 = 0;
+//____________________________________________________________________________
+namespace {
+
+  // Replaces ROOT's gRandom: draws from the generator attached to the
+  // calling thread, if any, and from the original gRandom otherwise.
+  // Both the ROOT 5 and ROOT 6 signatures of Rndm() and SetSeed() are
+  // declared, whichever is virtual in TRandom is overridden.
+  class ThreadRandom : public TRandom {
+  public:
+    ThreadRandom(TRandom * shared) : TRandom(), fShared(shared) {}
+
+    Double_t  Rndm      (void)                  { return Current()->Rndm(); }
+    Double_t  Rndm      (Int_t)                 { return Current()->Rndm(); }
+    void      RndmArray (Int_t n, Float_t  * a) { Current()->RndmArray(n, a); }
+    void      RndmArray (Int_t n, Double_t * a) { Current()->RndmArray(n, a); }
+    void      SetSeed   (UInt_t  seed)          { Current()->SetSeed(seed); }
+    void      SetSeed   (ULong_t seed)          { Current()->SetSeed(seed); }
+    UInt_t    GetSeed   (void) const            { return Current()->GetSeed(); }
+    TRandom * Shared    (void) const            { return fShared; }
+
+  private:
+    TRandom * Current (void) const {
+      return (gThreadRandom3) ? gThreadRandom3 : fShared;
+    }
+    TRandom * fShared;
+  };
+
+  ThreadRandom * gThreadRandom = 0; ///< installed as gRandom
+}
+//____________________________________________________________________________
 RandomGen::RandomGen()
 {
   LOG("Rndm", pINFO) << "RandomGen late initialization";
@@ -74,6 +113,11 @@ RandomGen::~RandomGen()
 {
   fInstance = 0;
   if(fRandom3) delete fRandom3;
+  if(gThreadRandom && gRandom == gThreadRandom) {
+    gRandom = gThreadRandom->Shared();
+    delete gThreadRandom;
+  }
+  gThreadRandom = 0;
 }
 //____________________________________________________________________________
 RandomGen * RandomGen::Instance()
@@ -96,6 +140,8 @@ void RandomGen::SetSeed(long int seed)
      << ((fInitalized) ? ": " : " at random number generator initialization: ")
      << seed;
 
+  fCurrSeed = seed;
+
   // Set the seed number for all internal GENIE random number generators
   this->RndKine ().SetSeed(seed);
   this->RndHadro().SetSeed(seed);
@@ -112,9 +158,17 @@ void RandomGen::SetSeed(long int seed)
   // Set the seed number for ROOT's gRandom
   gRandom ->SetSeed (seed);
 
-  // Set the PYTHIA6 seed number
-  TPythia6 * pythia6 = TPythia6::Instance();
-  pythia6->SetMRPY(1, seed);
+  // Set the PYTHIA6 seed number. MRPY(2) = 0 makes PYR re-initialize its
+  // state from MRPY(1) even if it was already used, e.g. by the parent of a
+  // forked worker.
+  int pythia6_seed = 0;
+  {
+    Pythia6Lock lock;
+    TPythia6 * pythia6 = TPythia6::Instance();
+    pythia6->SetMRPY(1, seed);
+    pythia6->SetMRPY(2, 0);
+    pythia6_seed = pythia6->GetMRPY(1);
+  }
 
   LOG("Rndm", pINFO) << "RndKine  seed = " << this->RndKine ().GetSeed();
   LOG("Rndm", pINFO) << "RndHadro seed = " << this->RndHadro().GetSeed();
@@ -128,12 +182,31 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "RndNum   seed = " << this->RndNum  ().GetSeed();
   LOG("Rndm", pINFO) << "RndGen   seed = " << this->RndGen  ().GetSeed();
   LOG("Rndm", pINFO) << "gRandom  seed = " << gRandom->GetSeed();
-  LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
+  LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6_seed;
+}
+//____________________________________________________________________________
+void RandomGen::SetThreadStream(TRandom3 * rnd)
+{
+  gThreadRandom3 = rnd;
+  Pythia6Lock::SetThreadRandomSource(rnd);
+}
+//____________________________________________________________________________
+TRandom3 & RandomGen::Stream(void) const
+{
+  return (gThreadRandom3) ? *gThreadRandom3 : *fRandom3;
 }
 //____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
   fRandom3 = new TRandom3();
+
+  // route gRandom to the generators attached to threads
+  if(!gThreadRandom) {
+    TRandom * shared = (gRandom) ? gRandom : new TRandom3();
+    gThreadRandom = new ThreadRandom(shared);
+    gRandom = gThreadRandom;
+  }
+
   this->SetSeed(seed);
 }
 //____________________________________________________________________________
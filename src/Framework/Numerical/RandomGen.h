@@ -48,41 +48,51 @@ public:
   //! See: http://root.cern.ch/root/html/TRandom3.html
 
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; } 
+  TRandom3 & RndKine (void) const { return this->Stream(); } 
 
   //! rnd number generator used by hadronization models 
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom3 & RndHadro (void) const { return this->Stream(); }
 
   //! rnd number generator used by decay models 
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom3 & RndDec (void) const { return this->Stream(); }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom3 & RndFsi (void) const { return this->Stream(); }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; } 
+  TRandom3 & RndLep (void) const { return this->Stream(); } 
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom3 & RndISel (void) const { return this->Stream(); }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom3 & RndGeom (void) const { return this->Stream(); }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom3 & RndFlux (void) const { return this->Stream(); }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom3 & RndEvg (void) const { return this->Stream(); }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom3 & RndNum (void) const { return this->Stream(); }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom3 & RndGen  (void) const { return this->Stream(); }
 
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
 
+  //! Attach a private random number generator to the calling thread
+  //! (or detach it, if the input is null). While attached, all the
+  //! accessors above, as well as ROOT's gRandom (used by TGenPhaseSpace,
+  //! TF1::GetRandom() etc), return numbers from it rather than from the
+  //! shared generators when called from that thread, and PYTHIA6 draws
+  //! from a sequence seeded from it (see Pythia6Lock). Used by the worker
+  //! threads of parallel algorithms and of event generation, so that their
+  //! random sequences do not interfere.
+  static void SetThreadStream (TRandom3 * rnd);
+
 private:
 
   RandomGen();
@@ -97,6 +107,8 @@ private:
 
   void InitRandomGenerators(long int seed);
 
+  TRandom3 & Stream (void) const; ///< thread-attached or shared generator
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
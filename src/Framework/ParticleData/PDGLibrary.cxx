@@ -9,28 +9,74 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added the dense property table, rebuilt whenever the database changes.
 */
 //____________________________________________________________________________
 
 #include <iostream>
 #include <string>
 
+#include <TMath.h>
 #include <TSystem.h>
+#include <THashList.h>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
 
 using std::string;
 
 using namespace genie;
 
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  // Fibonacci hashing of the PDG code onto 2^(32-shift) slots
+  inline unsigned int PropSlot(int pdgc, unsigned int shift)
+  {
+    return ((unsigned int) pdgc * 2654435761u) >> shift;
+  }
+
+  // Baryon number & hadron type from the PDG numbering scheme
+  void HadronProperties(int pdgc, int & baryon_number, unsigned int & flags)
+  {
+    baryon_number = 0;
+    if(pdg::IsIon(pdgc)) {
+      baryon_number = pdg::IonPdgCodeToA(pdgc);
+      flags |= kPDGPropIon;
+      return;
+    }
+    if(pdg::IsLepton(pdgc)) {
+      flags |= kPDGPropLepton;
+      return;
+    }
+    int apdg = TMath::Abs(pdgc);
+    if(apdg < 100 || apdg >= 1000000000) return; // quarks, bosons, pseudo-particles
+
+    int nq3 = (apdg /   10) % 10;
+    int nq2 = (apdg /  100) % 10;
+    int nq1 = (apdg / 1000) % 10;
+    if(nq3 == 0 || nq2 == 0) return; // diquarks
+    if(nq1 == 0) {
+      flags |= kPDGPropMeson;
+    } else {
+      flags |= kPDGPropBaryon;
+      baryon_number = (pdgc > 0) ? 1 : -1;
+    }
+  }
+}
 //____________________________________________________________________________
 PDGLibrary * PDGLibrary::fInstance = 0;
 //____________________________________________________________________________
-PDGLibrary::PDGLibrary()
+PDGLibrary::PDGLibrary() :
+fPropShift(32)
 {
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
+  this->BuildPropertyTable();
 
   fInstance =  0;
 }
@@ -62,8 +108,90 @@ TParticlePDG * PDGLibrary::Find(int pdgc)
 {
 // save some typing in the most frequently typed TDatabasePDG method
 
+  const PDGProperties * prop = this->Properties(pdgc);
+  if(prop) return prop->particle;
+
   return fDatabasePDG->GetParticle(pdgc);
 }
+//____________________________________________________________________________
+const PDGProperties * PDGLibrary::Properties(int pdgc) const
+{
+  if(fPropIndex.empty()) return 0;
+
+  unsigned int mask = fPropIndex.size() - 1;
+  unsigned int slot = PropSlot(pdgc, fPropShift);
+  while(1) {
+    int idx = fPropIndex[slot];
+    if(idx < 0) return 0;
+    if(fProperties[idx].pdg == pdgc) return &fProperties[idx];
+    slot = (slot + 1) & mask;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+double PDGLibrary::Mass(int pdgc) const
+{
+  const PDGProperties * prop = this->Properties(pdgc);
+  if(prop) return prop->mass;
+
+  // particles added to the TDatabasePDG directly
+  TParticlePDG * particle = fDatabasePDG->GetParticle(pdgc);
+  return (particle) ? particle->Mass() : 0.;
+}
+//____________________________________________________________________________
+double PDGLibrary::Charge(int pdgc) const
+{
+  const PDGProperties * prop = this->Properties(pdgc);
+  if(prop) return prop->charge;
+
+  TParticlePDG * particle = fDatabasePDG->GetParticle(pdgc);
+  return (particle) ? particle->Charge() : 0.;
+}
+//____________________________________________________________________________
+void PDGLibrary::BuildPropertyTable(void)
+{
+  fProperties.clear();
+  fPropIndex.clear();
+  fPropShift = 32;
+
+  const THashList * particles = (fDatabasePDG) ? fDatabasePDG->ParticleList() : 0;
+  if(!particles) return;
+
+  TIter next(particles);
+  TParticlePDG * particle = 0;
+  while( (particle = (TParticlePDG *) next()) ) {
+    PDGProperties prop;
+    prop.pdg      = particle->PdgCode();
+    prop.mass     = particle->Mass();
+    prop.width    = particle->Width();
+    prop.charge   = particle->Charge();
+    prop.flags    = (particle->Stable()) ? kPDGPropStable : 0;
+    prop.particle = particle;
+    HadronProperties(prop.pdg, prop.baryon_number, prop.flags);
+    fProperties.push_back(prop);
+  }
+  if(fProperties.empty()) return;
+
+  // at most 1/4 of the slots are used, so lookups rarely probe twice
+  unsigned int nslots = 1;
+  fPropShift = 32;
+  while(nslots < 4*fProperties.size()) { nslots *= 2; fPropShift--; }
+  fPropIndex.assign(nslots, -1);
+
+  unsigned int mask = nslots - 1;
+  for(unsigned int i = 0; i < fProperties.size(); i++) {
+    unsigned int slot = PropSlot(fProperties[i].pdg, fPropShift);
+    while(fPropIndex[slot] >= 0) {
+      // keep the first entry if a code appears twice (as TDatabasePDG)
+      if(fProperties[fPropIndex[slot]].pdg == fProperties[i].pdg) break;
+      slot = (slot + 1) & mask;
+    }
+    if(fPropIndex[slot] < 0) fPropIndex[slot] = i;
+  }
+
+  LOG("PDG", pINFO)
+    << "Tabulated the properties of " << fProperties.size() << " particles";
+}
 
 //____________________________________________________________________________
 bool PDGLibrary::LoadDBase(void)
@@ -131,6 +259,7 @@ void PDGLibrary::AddDarkMatter(double mass, double med_ratio)
   else {
     assert(med_particle->Mass() == med_mass);
   }
+  this->BuildPropertyTable();
 }
 //____________________________________________________________________________
 // EDIT: need a way to clear and then reload the PDG database
@@ -141,4 +270,5 @@ void PDGLibrary::ReloadDBase(void)
   }
 
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
+  this->BuildPropertyTable();
 }
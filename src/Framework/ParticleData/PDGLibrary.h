@@ -5,6 +5,12 @@
 
 \brief    Singleton class to load & serve a TDatabasePDG.
 
+          The properties most often needed during event generation (mass,
+          charge, width, baryon number, a few flags) are also copied into a
+          dense table, indexed by a small open-addressing hash of the PDG
+          code, so that Mass(), Charge() and Properties() avoid the
+          TDatabasePDG lookup. Find() goes through the same index.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -13,6 +19,10 @@
 
 \created  May 06, 2004
 
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added the dense property table: Properties(), Mass(), Charge().
+
 \cpright  Copyright (c) 2003-2018, The GENIE Collaboration
           For the full text of the license visit http://copyright.genie-mc.org
           or see $GENIE/LICENSE
@@ -22,11 +32,36 @@
 #ifndef _PDG_LIBRARY_H_
 #define _PDG_LIBRARY_H_
 
+#include <vector>
+
 #include <TDatabasePDG.h>
 #include <TParticlePDG.h>
 
+using std::vector;
+
 namespace genie {
 
+typedef enum EPDGPropertyFlag {
+  kPDGPropStable = 0x01,
+  kPDGPropLepton = 0x02,
+  kPDGPropMeson  = 0x04,
+  kPDGPropBaryon = 0x08,
+  kPDGPropIon    = 0x10
+} PDGPropertyFlag_t;
+
+//! Particle properties copied from the TDatabasePDG
+struct PDGProperties {
+  int            pdg;
+  double         mass;           ///< GeV
+  double         width;          ///< GeV
+  double         charge;         ///< in units of |e|/3, as TParticlePDG::Charge()
+  int            baryon_number;  ///< A for ions
+  unsigned int   flags;          ///< PDGPropertyFlag_t bits
+  TParticlePDG * particle;
+
+  bool Is (PDGPropertyFlag_t f) const { return (flags & f) != 0; }
+};
+
 class PDGLibrary 
 {
 public:
@@ -37,6 +72,13 @@ public:
   TParticlePDG * Find  (int pdgc);
   void           ReloadDBase (void);
 
+  //! Properties of the input particle, or NULL if it is not in the database
+  const PDGProperties * Properties (int pdgc) const;
+
+  //! Mass (GeV) & charge (|e|/3) of the input particle, 0 if unknown
+  double Mass   (int pdgc) const;
+  double Charge (int pdgc) const;
+
   // Add dark matter and mediator with parameters from Boosted Dark Matter app configuration
   // Ideally, this code should be in the Dark Matter app, not here.
   // But presently there is no way to edit the PDGLibrary after it has been created.
@@ -49,9 +91,14 @@ private:
   virtual ~PDGLibrary();
 
   bool LoadDBase(void);
+  void BuildPropertyTable(void);
 
   static PDGLibrary * fInstance;
   TDatabasePDG      * fDatabasePDG;
+
+  vector<PDGProperties> fProperties;  ///< one entry per particle in the database
+  vector<int>           fPropIndex;   ///< hash slots: index into fProperties or -1
+  unsigned int          fPropShift;   ///< 32 - log2(number of slots)
   
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
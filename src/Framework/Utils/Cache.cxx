@@ -14,11 +14,26 @@
    Cache is not autoloaded and use of variables $GCACHEFILE is no longer
    supported. Instead, call Cache::OpenCacheFile(string filename) explicitly.
    Now cached data are stored in the top-level 'directory'.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added an index of the cache branches by algorithm key & interaction, see
+   IndexCacheBranch().
+   The branch maps can be accessed concurrently (the branches themselves are
+   not protected).
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added CacheLock, serializing the creation and filling of cache branches.
+   Instance() is lock-free once the singleton is created.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The index of the cache branches is kept per thread, keyed on the hash of
+   the algorithm key, so FindCacheBranch() for an algorithm & interaction
+   takes no lock. The thread indices are invalidated when branches are
+   deleted.
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <iostream>
+#include <mutex>
+#include <atomic>
 
 #include <TSystem.h>
 #include <TDirectory.h>
@@ -28,10 +43,37 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchI.h"
+#include "Framework/Utils/InteractionIndex.h"
 
 using std::ostringstream;
 using std::endl;
 
+namespace {
+  std::recursive_mutex        gCacheMutex;  ///< guards the singleton & branch maps
+  std::atomic<genie::Cache *> gInstance(0); ///< for lock-free Instance()
+
+  //! Branches in the Cache map, by algorithm & interaction, indexed by each
+  //! thread as it finds them. Rebuilt when the generation changes, ie when
+  //! branches are deleted.
+  std::atomic<unsigned long> gCacheIndexGeneration(0);
+  struct ThreadCacheIndex_t {
+    ThreadCacheIndex_t() : Generation(0) {}
+    unsigned long Generation;
+    genie::InteractionIndex<genie::CacheBranchI *> Index;
+  };
+  thread_local ThreadCacheIndex_t gThreadCacheIndex;
+
+  genie::InteractionIndex<genie::CacheBranchI *> & ThreadCacheIndex(void)
+  {
+    unsigned long generation = gCacheIndexGeneration.load();
+    if(gThreadCacheIndex.Generation != generation) {
+      gThreadCacheIndex.Index.Clear();
+      gThreadCacheIndex.Generation = generation;
+    }
+    return gThreadCacheIndex.Index;
+  }
+}
+
 namespace genie {
 
 //____________________________________________________________________________
@@ -66,15 +108,22 @@ Cache::~Cache()
     fCacheMap->clear();
     delete fCacheMap;
   }
+  gCacheIndexGeneration++;
   if(fCacheFile) {
     fCacheFile->Close();
     delete fCacheFile;
   }
+  gInstance.store(0);
   fInstance = 0;
 }
 //____________________________________________________________________________
 Cache * Cache::Instance()
 {
+  Cache * instance = gInstance.load(std::memory_order_acquire);
+  if(instance) return instance;
+
+  std::lock_guard<std::recursive_mutex> lock(gCacheMutex);
+
   if(fInstance == 0) {
     static Cache::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
@@ -83,11 +132,14 @@ Cache * Cache::Instance()
 
     fInstance->fCacheMap = new map<string, CacheBranchI * >;
   }
+  gInstance.store(fInstance, std::memory_order_release);
   return fInstance;
 }
 //____________________________________________________________________________
 CacheBranchI * Cache::FindCacheBranch(string key)
 {
+  std::lock_guard<std::recursive_mutex> lock(gCacheMutex);
+
   map<string, CacheBranchI *>::const_iterator map_iter = fCacheMap->find(key);
 
   if (map_iter == fCacheMap->end()) return 0;
@@ -96,9 +148,25 @@ CacheBranchI * Cache::FindCacheBranch(string key)
 //____________________________________________________________________________
 void Cache::AddCacheBranch(string key, CacheBranchI * branch)
 {
+  std::lock_guard<std::recursive_mutex> lock(gCacheMutex);
+
   fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
 }
 //____________________________________________________________________________
+CacheBranchI * Cache::FindCacheBranch(
+  const AlgId & alg, const Interaction * in, const char * tag) const
+{
+  CacheBranchI * branch = 0;
+  if(!ThreadCacheIndex().Find(alg, in, branch, tag)) return 0;
+  return branch;
+}
+//____________________________________________________________________________
+void Cache::IndexCacheBranch(const AlgId & alg, const Interaction * in,
+                             CacheBranchI * branch, const char * tag)
+{
+  ThreadCacheIndex().Insert(alg, in, branch, tag);
+}
+//____________________________________________________________________________
 string Cache::CacheBranchKey(string k0, string k1, string k2) const
 {
   ostringstream key;
@@ -120,6 +188,8 @@ void Cache::RmAllCacheBranches(void)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches";
 
+  std::lock_guard<std::recursive_mutex> lock(gCacheMutex);
+
   if(fCacheMap) {
     map<string, CacheBranchI * >::iterator citer;
     for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
@@ -131,6 +201,7 @@ void Cache::RmAllCacheBranches(void)
     }
     fCacheMap->clear();
   }
+  gCacheIndexGeneration++;
 }
 //____________________________________________________________________________
 void Cache::RmMatchedCacheBranches(string key_substring)
@@ -228,6 +299,16 @@ void Cache::Print(ostream & stream) const
   stream << "\n";
 }
 //___________________________________________________________________________
+CacheLock::CacheLock()
+{
+  gCacheMutex.lock();
+}
+//___________________________________________________________________________
+CacheLock::~CacheLock()
+{
+  gCacheMutex.unlock();
+}
+//___________________________________________________________________________
 
 } // genie namespace
 
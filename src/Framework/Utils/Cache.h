@@ -24,6 +24,7 @@
 #include <ostream>
 
 #include <TFile.h>
+#include <Rtypes.h>
 
 using std::map;
 using std::string;
@@ -33,6 +34,8 @@ namespace genie {
 
 class Cache;
 class CacheBranchI;
+class Interaction;
+class AlgId;
 
 ostream & operator << (ostream & stream, const Cache & cache);
 
@@ -50,6 +53,16 @@ public:
   void           AddCacheBranch  (string key, CacheBranchI * branch);
   string         CacheBranchKey  (string k0, string k1="", string k2="") const;
 
+  //! branches indexed by algorithm, interaction & tag (see InteractionIndex),
+  //! to skip building the string key on every lookup: index a branch once
+  //! found / added by its string key. Returns 0 if the branch is not indexed,
+  //! in which case the string key must be used. The index is kept per thread
+  //! and the lookups take no lock
+  CacheBranchI * FindCacheBranch  (const AlgId & alg, const Interaction * in,
+                                   const char * tag = "") const;
+  void           IndexCacheBranch (const AlgId & alg, const Interaction * in,
+                                   CacheBranchI * branch, const char * tag = "");
+
   //! removing cache branches
   void RmCacheBranch         (string key);
   void RmAllCacheBranches    (void);
@@ -90,5 +103,33 @@ private:
   friend struct Cleaner;
 };
 
+//____________________________________________________________________________
+/*!
+
+\class    genie::CacheLock
+
+\brief    Scoped lock serializing the creation and filling of cache branches.
+
+          The Cache maps can be accessed concurrently but the branches are
+          not protected. Code that finds a cache branch missing must hold a
+          CacheLock while it looks the branch up again, then creates, fills
+          and adds it, so that no two threads build the same branch. A branch
+          that is only complete after it was added, or that is filled at
+          event generation time (AddValues(), CreateSpline(), AddProposal()),
+          must be read under a CacheLock too. The lock is recursive.
+*/
+//____________________________________________________________________________
+
+class CacheLock {
+
+public:
+  CacheLock();
+ ~CacheLock();
+
+private:
+  CacheLock(const CacheLock & lock);
+  CacheLock & operator = (const CacheLock & lock);
+};
+
 }      // genie namespace
 #endif // _CACHE_H_
@@ -13,6 +13,9 @@
  @ Jun 25, 2008 - CA
    Partial re-write to fix a serious memory leak. Holding x,y values in a map
    rather than a circular ntuple.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   CreateSpline() keeps the spline it replaces until Reset(), so that it can
+   still be read by other threads.
 
 */
 //____________________________________________________________________________
@@ -60,6 +63,10 @@ void CacheBranchFx::Init(void)
 void CacheBranchFx::CleanUp(void)
 {
   if(fSpline) delete fSpline;
+  for(unsigned int i = 0; i < fOldSplines.size(); i++) {
+    delete fOldSplines[i];
+  }
+  fOldSplines.clear();
   fFx.clear();
 }
 //____________________________________________________________________________
@@ -88,7 +95,7 @@ void CacheBranchFx::CreateSpline(void)
     i++;
   }
 
-  if(fSpline) delete fSpline;
+  if(fSpline) fOldSplines.push_back(fSpline);
   fSpline = new Spline(n,x,y);
 
   delete [] x;
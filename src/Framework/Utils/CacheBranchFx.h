@@ -4,6 +4,11 @@
 \class    genie::CacheBranchFx
 
 \brief    A simple cache branch storing the cached data in a TNtuple
+          The branch is not locked: fill it, or read it while other threads
+          may fill it, under a CacheLock. The splines returned by Spl() are
+          not modified and stay valid until Reset() or the branch deletion
+          (CreateSpline() keeps the spline it replaces), so they may be read
+          without the lock once obtained.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -22,6 +27,7 @@
 #include <iostream>
 #include <string>
 #include <map>
+#include <vector>
 
 #include "Framework/Numerical/Spline.h"
 #include "Framework/Utils/CacheBranchI.h"
@@ -29,6 +35,7 @@
 using std::string;
 using std::ostream;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -60,9 +67,10 @@ private:
   void Init    (void);
   void CleanUp (void);
 
-  string             fName;   ///< cache branch name
-  map<double,double> fFx;     ///< x->y map 
-  Spline *           fSpline; ///< spline y = f(x)
+  string             fName;       ///< cache branch name
+  map<double,double> fFx;         ///< x->y map 
+  Spline *           fSpline;     ///< spline y = f(x)
+  vector<Spline *>   fOldSplines; //! splines replaced by CreateSpline()
 
 ClassDef(CacheBranchFx,1)
 };
@@ -0,0 +1,106 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/PiecewiseProposal2D.h"
+#include "Framework/Utils/CacheBranchProposal.h"
+
+using namespace genie;
+
+ClassImp(CacheBranchProposal);
+
+//____________________________________________________________________________
+namespace genie
+{
+  ostream & operator << (ostream & stream, const CacheBranchProposal & cbp)
+  {
+     cbp.Print(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+CacheBranchProposal::CacheBranchProposal(void) :
+CacheBranchI()
+{
+  this->Init();
+}
+//____________________________________________________________________________
+CacheBranchProposal::CacheBranchProposal(string name) :
+CacheBranchI()
+{
+  this->Init();
+  fName = name;
+}
+//____________________________________________________________________________
+CacheBranchProposal::~CacheBranchProposal()
+{
+  this->CleanUp();
+}
+//____________________________________________________________________________
+void CacheBranchProposal::Init(void)
+{
+  fName = "";
+}
+//____________________________________________________________________________
+void CacheBranchProposal::CleanUp(void)
+{
+  map<int, PiecewiseProposal2D *>::iterator it = fProposals.begin();
+  for( ; it != fProposals.end(); ++it) {
+    delete it->second;
+  }
+  fProposals.clear();
+}
+//____________________________________________________________________________
+void CacheBranchProposal::Reset(void)
+{
+  this->CleanUp();
+  this->Init();
+}
+//____________________________________________________________________________
+PiecewiseProposal2D * CacheBranchProposal::Proposal(int ebin) const
+{
+  map<int, PiecewiseProposal2D *>::const_iterator it = fProposals.find(ebin);
+  if(it == fProposals.end()) return 0;
+  return it->second;
+}
+//____________________________________________________________________________
+void CacheBranchProposal::AddProposal(int ebin, PiecewiseProposal2D * proposal)
+{
+  map<int, PiecewiseProposal2D *>::iterator it = fProposals.find(ebin);
+  if(it != fProposals.end()) {
+    if(it->second != proposal) delete it->second;
+    it->second = proposal;
+    return;
+  }
+  fProposals.insert(map<int, PiecewiseProposal2D *>::value_type(ebin, proposal));
+}
+//____________________________________________________________________________
+void CacheBranchProposal::Print(ostream & stream) const
+{
+  stream << "type: [CacheBranchProposal] - nentries: " << fProposals.size()
+         << " / name: " << fName << "\n";
+
+  map<int, PiecewiseProposal2D *>::const_iterator it = fProposals.begin();
+  for( ; it != fProposals.end(); ++it) {
+    const PiecewiseProposal2D * p = it->second;
+    double ncalls = p->NEvaluations() + p->NGenerated();
+    stream << "  energy bin: " << it->first
+           << ", xsec evaluations (build + trials): "
+           << p->NEvaluations() << " + " << p->NGenerated()
+           << ", accepted: " << p->NAccepted()
+           << ", bound violations: " << p->NViolations();
+    if(p->NAccepted() > 0) {
+      stream << ", xsec evaluations / accepted: " << ncalls / p->NAccepted();
+    }
+    stream << "\n";
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,70 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::CacheBranchProposal
+
+\brief    A cache branch storing the piecewise-constant proposals used for
+          importance sampling the kinematics of an interaction, one per
+          energy bin. The proposals are not persistent.
+          Proposals are added under a CacheLock.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _CACHE_BRANCH_PROPOSAL_H_
+#define _CACHE_BRANCH_PROPOSAL_H_
+
+#include <iostream>
+#include <string>
+#include <map>
+
+#include "Framework/Utils/CacheBranchI.h"
+
+using std::string;
+using std::ostream;
+using std::map;
+
+namespace genie {
+
+class PiecewiseProposal2D;
+class CacheBranchProposal;
+ostream & operator << (ostream & stream, const CacheBranchProposal & cbp);
+
+class CacheBranchProposal : public CacheBranchI
+{
+public:
+  using TObject::Print; // suppress clang 'hides overloaded virtual function [-Woverloaded-virtual]' warnings
+
+  CacheBranchProposal();
+  CacheBranchProposal(string name);
+  ~CacheBranchProposal();
+
+  //! Proposal for the input energy bin (null if not built yet)
+  PiecewiseProposal2D * Proposal    (int ebin) const;
+  //! Add the proposal for the input energy bin (the branch adopts it)
+  void                  AddProposal (int ebin, PiecewiseProposal2D * proposal);
+
+  void Reset (void);
+  void Print (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const CacheBranchProposal & cbp);
+
+private:
+  void Init    (void);
+  void CleanUp (void);
+
+  string                             fName;      ///< cache branch name
+  map<int, PiecewiseProposal2D *>    fProposals; //! energy bin -> proposal
+
+ClassDef(CacheBranchProposal,1)
+};
+
+}      // genie namespace
+#endif // _CACHE_BRANCH_PROPOSAL_H_
@@ -0,0 +1,435 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/ForkedWorkers.h"
+#include "Framework/Utils/HashUtils.h"
+
+using std::ostringstream;
+using std::ofstream;
+using std::setw;
+using std::endl;
+
+using namespace genie;
+
+namespace {
+  //! write / read the whole buffer, retrying after interrupts & partial I/O
+  bool WriteAll(int fd, const char * buf, size_t n)
+  {
+    while(n > 0) {
+      ssize_t nw = write(fd, buf, n);
+      if(nw < 0) {
+        if(errno == EINTR) continue;
+        return false;
+      }
+      buf += nw;
+      n   -= nw;
+    }
+    return true;
+  }
+  string ReadAll(int fd)
+  {
+    string data;
+    char buf[4096];
+    while(1) {
+      ssize_t nr = read(fd, buf, sizeof(buf));
+      if(nr < 0 && errno == EINTR) continue;
+      if(nr <= 0) break;
+      data.append(buf, nr);
+    }
+    return data;
+  }
+  //! copy n bytes of a worker report from position pos, advancing pos
+  bool Unpack(const string & report, size_t & pos, void * buf, size_t n)
+  {
+    if(report.size() < pos + n) return false;
+    report.copy((char *) buf, n, pos);
+    pos += n;
+    return true;
+  }
+  //! workers receiving the signals forwarded by the parent
+  vector<int> gForwardPids;
+  void ForwardSignalHandler(int sig)
+  {
+    for(unsigned int i = 0; i < gForwardPids.size(); i++) {
+      kill(gForwardPids[i], sig);
+    }
+  }
+}
+
+//____________________________________________________________________________
+ForkedWorkers::ForkedWorkers(unsigned int nworkers) :
+fNWorkers(TMath::Max(nworkers, 1U)),
+fWorker(-1)
+{
+
+}
+//____________________________________________________________________________
+ForkedWorkers::~ForkedWorkers()
+{
+  if(fWorker < 0 && fPid.size() > 0) this->Wait();
+}
+//____________________________________________________________________________
+int ForkedWorkers::Fork(void)
+{
+  if(fNWorkers == 1) {
+    fWorker = 0;
+    return fWorker;
+  }
+
+  long int seed = RandomGen::Instance()->GetSeed();
+
+  LOG("Workers", pNOTICE)
+    << "Forking " << fNWorkers << " worker processes (job seed: " << seed << ")";
+
+  // don't let the workers inherit (and print again) buffered output
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(0);
+
+  for(unsigned int iw = 0; iw < fNWorkers; iw++) {
+    int fd[2];
+    pid_t pid = -1;
+    if(pipe(fd) == 0) pid = fork();
+    if(pid < 0) {
+      LOG("Workers", pFATAL)
+        << "Could not fork worker " << iw << ": " << strerror(errno);
+      for(unsigned int j = 0; j < fPid.size(); j++) kill(fPid[j], SIGKILL);
+      exit(1);
+    }
+    if(pid == 0) {
+      // worker: keep the write end of its own pipe only
+      close(fd[0]);
+      for(unsigned int j = 0; j < fPipe.size(); j++) close(fPipe[j]);
+      fPipe.assign(1, fd[1]);
+      fPid.clear();
+      fWorker = iw;
+
+      this->ReopenFiles();
+      if(iw > 0) {
+        RandomGen::Instance()->SetSeed(ForkedWorkers::Seed(seed, iw));
+      }
+      LOG("Workers", pNOTICE)
+        << "Worker " << iw << " started (pid: " << getpid() << ")";
+      return fWorker;
+    }
+    close(fd[1]);
+    fPid.push_back(pid);
+    fPipe.push_back(fd[0]);
+  }
+  return fWorker;
+}
+//____________________________________________________________________________
+Long64_t ForkedWorkers::Share(Long64_t n) const
+{
+  if(fWorker < 0) return n;
+  Long64_t w = fWorker;
+  return n / fNWorkers + ((w < n % fNWorkers) ? 1 : 0);
+}
+//____________________________________________________________________________
+Long64_t ForkedWorkers::First(Long64_t n) const
+{
+  if(fWorker < 0) return 0;
+  Long64_t w = fWorker;
+  return w * (n / fNWorkers) + TMath::Min(w, n % fNWorkers);
+}
+//____________________________________________________________________________
+long int ForkedWorkers::Seed(long int seed, unsigned int iworker)
+{
+// Worker 0 keeps the job seed. The others get a hash of the job seed and of
+// the worker index, so that jobs run with consecutive seeds (eg the run
+// number) do not end up with identical workers. Seeds are kept within the
+// range accepted by PYTHIA6 (1 - 900000000).
+
+  if(iworker == 0) return seed;
+
+  ULong64_t h = utils::hash::Combine(utils::hash::kSeed, seed);
+  h = utils::hash::Combine(h, iworker);
+  return 1 + (long int) (h % 900000000ULL);
+}
+//____________________________________________________________________________
+string ForkedWorkers::TagFilename(string filename, string suffix) const
+{
+  if(fNWorkers == 1 || fWorker < 0) return filename;
+
+  ostringstream tag;
+  tag << ".w" << fWorker;
+
+  string::size_type pos = string::npos;
+  if(suffix.size() > 0 && filename.size() > suffix.size() &&
+     filename.compare(filename.size()-suffix.size(), suffix.size(), suffix) == 0)
+  {
+    pos = filename.size() - suffix.size();
+  } else {
+    string::size_type dot   = filename.find_last_of(".");
+    string::size_type slash = filename.find_last_of("/");
+    if(dot != string::npos && (slash == string::npos || dot > slash)) pos = dot;
+  }
+  if(pos == string::npos) return filename + tag.str();
+  return filename.substr(0,pos) + tag.str() + filename.substr(pos);
+}
+//____________________________________________________________________________
+string ForkedWorkers::SummaryFilename(string filename, string suffix)
+{
+  string::size_type pos = string::npos;
+  if(suffix.size() > 0 && filename.size() > suffix.size() &&
+     filename.compare(filename.size()-suffix.size(), suffix.size(), suffix) == 0)
+  {
+    pos = filename.size() - suffix.size();
+  } else {
+    string::size_type dot   = filename.find_last_of(".");
+    string::size_type slash = filename.find_last_of("/");
+    if(dot != string::npos && (slash == string::npos || dot > slash)) pos = dot;
+  }
+  return filename.substr(0,pos) + ".workers.txt";
+}
+//____________________________________________________________________________
+void ForkedWorkers::Finish(
+  const vector<double> & norm, const vector<string> & files)
+{
+  if(fNWorkers == 1) {
+    fSum = norm;
+    return;
+  }
+  if(fWorker < 0) return;
+
+  // report: n, n values, number of files, (length, name) for each file
+  unsigned int n = norm.size();
+  bool ok = WriteAll(fPipe[0], (const char *) &n, sizeof(n));
+  if(ok && n > 0) {
+    ok = WriteAll(fPipe[0], (const char *) &norm[0], n*sizeof(double));
+  }
+  unsigned int nf = files.size();
+  if(ok) ok = WriteAll(fPipe[0], (const char *) &nf, sizeof(nf));
+  for(unsigned int i = 0; ok && i < nf; i++) {
+    unsigned int len = files[i].size();
+    ok = WriteAll(fPipe[0], (const char *) &len, sizeof(len)) &&
+         WriteAll(fPipe[0], files[i].data(), len);
+  }
+  close(fPipe[0]);
+
+  LOG("Workers", pNOTICE) << "Worker " << fWorker << " done";
+
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(0);
+  _exit(ok ? 0 : 1);
+}
+//____________________________________________________________________________
+bool ForkedWorkers::Wait(void)
+{
+  if(fWorker >= 0) return true;
+
+  bool ok = true;
+  fSum.clear();
+  fOk   .assign(fPid.size(), false);
+  fNorm .assign(fPid.size(), vector<double>());
+  fFiles.assign(fPid.size(), vector<string>());
+  for(unsigned int iw = 0; iw < fPid.size(); iw++) {
+    string report = ReadAll(fPipe[iw]);
+    close(fPipe[iw]);
+
+    int status = 0;
+    while(waitpid(fPid[iw], &status, 0) < 0 && errno == EINTR) {}
+    bool exited = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+
+    size_t pos = 0;
+    unsigned int n = 0, nf = 0;
+    bool reported = Unpack(report, pos, &n, sizeof(n));
+    vector<double> norm(n, 0.);
+    vector<string> files;
+    for(unsigned int i = 0; reported && i < n; i++) {
+      reported = Unpack(report, pos, &norm[i], sizeof(double));
+    }
+    if(reported) reported = Unpack(report, pos, &nf, sizeof(nf));
+    for(unsigned int i = 0; reported && i < nf; i++) {
+      unsigned int len = 0;
+      reported = Unpack(report, pos, &len, sizeof(len)) &&
+                 report.size() >= pos + len;
+      if(reported) {
+        files.push_back(report.substr(pos, len));
+        pos += len;
+      }
+    }
+    reported = reported && (pos == report.size());
+    if(!exited || !reported) {
+      LOG("Workers", pERROR)
+        << "Worker " << iw << " (pid: " << fPid[iw] << ") failed: "
+        << (WIFSIGNALED(status) ? "killed by signal " : "exit status ")
+        << (WIFSIGNALED(status) ? WTERMSIG(status) : WEXITSTATUS(status))
+        << ((reported) ? "" : ", no normalization reported");
+      ok = false;
+      continue;
+    }
+    if(fSum.size() < n) fSum.resize(n, 0.);
+    for(unsigned int i = 0; i < n; i++) fSum[i] += norm[i];
+    fOk   [iw] = true;
+    fNorm [iw] = norm;
+    fFiles[iw] = files;
+  }
+  gForwardPids.clear();
+  fPid.clear();
+  fPipe.clear();
+
+  LOG("Workers", pNOTICE)
+    << "All " << fNWorkers << " workers finished"
+    << ((ok) ? "" : " - some of them with errors");
+  return ok;
+}
+//____________________________________________________________________________
+double ForkedWorkers::Sum(unsigned int i) const
+{
+  return (i < fSum.size()) ? fSum[i] : 0.;
+}
+//____________________________________________________________________________
+bool ForkedWorkers::WriteSummary(string filename,
+  const vector<string> & names,
+  const vector< pair<string,double> > & derived) const
+{
+// Plain "name = value" lines, followed by one line per worker:
+//   worker <index> ok|failed <values...> <output files...>
+// The values of failed workers are not included in the sums.
+
+  if(fWorker >= 0) return true;
+
+  ofstream out(filename.c_str());
+  if(!out.is_open()) {
+    LOG("Workers", pERROR)
+      << "Could not write the worker summary file: " << filename;
+    return false;
+  }
+  unsigned int nfailed = 0;
+  for(unsigned int iw = 0; iw < fOk.size(); iw++) {
+    if(!fOk[iw]) nfailed++;
+  }
+  out << std::setprecision(15);
+  out << "# GENIE job split between " << fNWorkers
+      << " forked worker processes" << endl;
+  out << std::left;
+  out << setw(26) << "workers"        << " = " << fNWorkers << endl;
+  out << setw(26) << "failed_workers" << " = " << nfailed   << endl;
+  for(unsigned int i = 0; i < names.size(); i++) {
+    out << setw(26) << names[i] << " = " << this->Sum(i) << endl;
+  }
+  for(unsigned int i = 0; i < derived.size(); i++) {
+    out << setw(26) << derived[i].first << " = " << derived[i].second << endl;
+  }
+  out << "# worker <index> <status>";
+  for(unsigned int i = 0; i < names.size(); i++) out << " <" << names[i] << ">";
+  out << " <output files>" << endl;
+  for(unsigned int iw = 0; iw < fOk.size(); iw++) {
+    out << "worker " << iw << " " << ((fOk[iw]) ? "ok" : "failed");
+    for(unsigned int i = 0; i < fNorm[iw].size(); i++) out << " " << fNorm[iw][i];
+    for(unsigned int i = 0; i < fFiles[iw].size(); i++) out << " " << fFiles[iw][i];
+    out << endl;
+  }
+  out.close();
+
+  LOG("Workers", pNOTICE)
+    << "Wrote the merged normalization of the workers to " << filename;
+  return !out.fail();
+}
+//____________________________________________________________________________
+void ForkedWorkers::ForwardSignal(int sig)
+{
+  if(fWorker >= 0) return;
+
+  gForwardPids = fPid;
+  signal(sig, ForwardSignalHandler);
+}
+//____________________________________________________________________________
+void ForkedWorkers::ReopenFiles(void) const
+{
+// A forked process shares the offsets of the files opened by its parent:
+// ROOT seeks then reads, so workers reading the same flux ntuple would move
+// each other's offsets. Give each worker its own descriptions of the regular
+// files opened read-only, at the same descriptor numbers and offsets.
+
+#ifdef __linux__
+  vector<int> fds;
+  DIR * dir = opendir("/proc/self/fd");
+  if(!dir) {
+    LOG("Workers", pWARN)
+      << "Can not list the open files: workers share the input file offsets";
+    return;
+  }
+  struct dirent * entry = 0;
+  while( (entry = readdir(dir)) != 0 ) {
+    if(entry->d_name[0] == '.') continue;
+    int fd = atoi(entry->d_name);
+    if(fd > 2 && fd != dirfd(dir)) fds.push_back(fd);
+  }
+  closedir(dir);
+
+  unsigned int nreopened = 0;
+  for(unsigned int i = 0; i < fds.size(); i++) {
+    int fd = fds[i];
+    if(fd == fPipe[0]) continue;
+    int flags = fcntl(fd, F_GETFL);
+    if(flags < 0 || (flags & O_ACCMODE) != O_RDONLY) continue;
+    struct stat st;
+    if(fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) continue;
+
+    ostringstream link;
+    link << "/proc/self/fd/" << fd;
+    char path[PATH_MAX];
+    ssize_t len = readlink(link.str().c_str(), path, sizeof(path)-1);
+    if(len <= 0) continue;
+    path[len] = 0;
+
+    int nfd = open(path, flags);
+    struct stat nst;
+    if(nfd < 0 || fstat(nfd, &nst) != 0 ||
+       nst.st_dev != st.st_dev || nst.st_ino != st.st_ino) {
+      LOG("Workers", pWARN)
+        << "Worker " << fWorker << " could not re-open " << path
+        << ": sharing its file offset with the other workers";
+      if(nfd >= 0) close(nfd);
+      continue;
+    }
+    lseek(nfd, lseek(fd, 0, SEEK_CUR), SEEK_SET);
+    int fdflags = fcntl(fd, F_GETFD);
+    dup2(nfd, fd);
+    fcntl(fd, F_SETFD, fdflags);
+    close(nfd);
+    nreopened++;
+  }
+  LOG("Workers", pINFO)
+    << "Worker " << fWorker << " re-opened " << nreopened << " input files";
+#else
+  LOG("Workers", pWARN)
+    << "Can not re-open the input files on this platform: "
+    << "workers share the input file offsets";
+#endif
+}
+//____________________________________________________________________________
@@ -0,0 +1,135 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ForkedWorkers
+
+\brief    Splits an event generation job between N forked worker processes.
+
+          An application loads its configuration, splines, hadron transport
+          tables, geometry and flux, configures its drivers, and then calls
+          Fork(). The workers inherit everything built so far copy-on-write,
+          so the initialization is done once and its memory is shared until
+          a worker modifies it. Each worker:
+           - gets its own random number seed (worker 0 keeps the job seed,
+             so that a single-worker job is identical to the serial one),
+           - generates its share of the job (Share(), First()) into its own
+             output files (TagFilename()),
+           - reports its normalization bookkeeping (number of events,
+             number of flux neutrinos, POT...) and its output files with
+             Finish() and exits.
+          The parent waits for the workers in Wait() and merges (sums) the
+          reported values, available through Sum(). WriteSummary() saves
+          the merged values, the values of each worker and the worker output
+          files in a text file next to the outputs (SummaryFilename()), to be
+          used when normalizing the merged sample.
+
+          With a single worker nothing is forked: Fork() returns 0 and the
+          job runs in the calling process as usual.
+
+          After the fork, the read-only files opened by the parent (flux
+          ntuples, geometry, splines) are re-opened in each worker, so that
+          workers do not share (and move) each other's file offsets.
+          Workers exit with _exit(): they do not run the exit handlers of
+          the parent and, in particular, do not write to the cache file.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _FORKED_WORKERS_H_
+#define _FORKED_WORKERS_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include <Rtypes.h>
+
+using std::string;
+using std::vector;
+using std::pair;
+
+namespace genie {
+
+class ForkedWorkers {
+
+public:
+  ForkedWorkers(unsigned int nworkers = 1);
+ ~ForkedWorkers();
+
+  unsigned int NWorkers (void) const { return fNWorkers; }
+
+  //! Index of this worker (0 <= Worker() < NWorkers()), -1 in the parent
+  int Worker (void) const { return fWorker; }
+
+  //! Fork the workers; returns Worker() (-1 in the parent)
+  int Fork (void);
+
+  //! Share of a job of n items (events, flux cycles...) given to this
+  //! worker, and index of its first item: worker i handles the items
+  //! [First(n), First(n)+Share(n)); shares differ by at most one item
+  Long64_t Share (Long64_t n) const;
+  Long64_t First (Long64_t n) const;
+
+  //! Random number seed of worker iworker for a job with the input seed
+  static long int Seed (long int seed, unsigned int iworker);
+
+  //! Tag the input filename with the worker index: the tag (eg ".w3") is
+  //! inserted before the input suffix if the filename ends with it (eg
+  //! "gntp.0.ghep.root" -> "gntp.0.w3.ghep.root" for ".ghep.root"), else
+  //! before the extension. The filename is unchanged with a single worker.
+  string TagFilename (string filename, string suffix = "") const;
+
+  //! Name of the summary file of a job whose untagged output file is
+  //! filename: the input suffix (or else the extension) is replaced by
+  //! ".workers.txt" (eg "gntp.0.ghep.root" -> "gntp.0.workers.txt")
+  static string SummaryFilename (string filename, string suffix = "");
+
+  //! In a worker: report the normalization bookkeeping of its sample and
+  //! the output files it wrote to the parent and exit. With a single worker
+  //! the values are kept for Sum() and the function returns.
+  void Finish (const vector<double> & norm,
+               const vector<string> & files = vector<string>());
+
+  //! In the parent: wait for all workers. Returns false if any of them
+  //! failed or exited without reporting its normalization.
+  bool Wait (void);
+
+  //! Sum over workers of the i-th value reported with Finish()
+  double Sum (unsigned int i) const;
+
+  //! In the parent, after Wait(): write the number of workers, the sums of
+  //! the reported values (named after names), the derived quantities (eg
+  //! the normalization of the merged sample), and the values and output
+  //! files of each worker to a text file. Returns false on failure.
+  bool WriteSummary (string filename, const vector<string> & names,
+       const vector< pair<string,double> > & derived =
+             vector< pair<string,double> >()) const;
+
+  //! In the parent: forward the input signal (eg SIGTERM sent by a batch
+  //! system to the parent only) to the workers until they are all done
+  void ForwardSignal (int sig);
+
+private:
+  ForkedWorkers(const ForkedWorkers & workers);
+
+  void ReopenFiles (void) const;
+
+  unsigned int       fNWorkers;  ///< number of workers
+  int                fWorker;    ///< index of this worker, -1 in the parent
+  vector<int>        fPid;       ///< worker process ids (parent)
+  vector<int>        fPipe;      ///< read end of each worker's report pipe (parent), write end (worker)
+  vector<double>     fSum;       ///< merged normalization
+  vector<bool>       fOk;        ///< worker finished and reported (parent)
+  vector< vector<double> > fNorm;  ///< normalization reported by each worker (parent)
+  vector< vector<string> > fFiles; ///< output files reported by each worker (parent)
+};
+
+}      // genie namespace
+#endif // _FORKED_WORKERS_H_
@@ -0,0 +1,71 @@
+//____________________________________________________________________________
+/*!
+
+\namespace  genie::utils::hash
+
+\brief      Building blocks for 64-bit hash keys (see Interaction::Fingerprint())
+
+            Fields are folded into a running hash one at a time with
+            Combine(), which mixes the running value and the new field with
+            the splitmix64 finalizer so that every input bit affects every
+            output bit and the order of the fields matters.
+            String() hashes a string (eg an algorithm key) with 64-bit FNV-1a.
+            These hashes are stable across jobs and platforms.
+
+\author     The GENIE Collaboration
+
+\created    October 17, 2026
+
+\cpright    Copyright (c) 2003-2018, The GENIE Collaboration
+            For the full text of the license visit http://copyright.genie-mc.org
+            or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _HASH_UTILS_H_
+#define _HASH_UTILS_H_
+
+#include <cstring>
+#include <string>
+
+#include <Rtypes.h>
+
+namespace genie {
+namespace utils {
+
+namespace hash
+{
+  const ULong64_t kSeed = 0xcbf29ce484222325ULL; ///< initial value (FNV-1a offset basis)
+
+  //! Fold the input field into the running hash h
+  inline ULong64_t Combine(ULong64_t h, Long64_t v)
+  {
+    ULong64_t x = h + 0x9e3779b97f4a7c15ULL + (ULong64_t) v;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  //! Fold the bit pattern of the input double into the running hash h
+  inline ULong64_t Double(ULong64_t h, double v)
+  {
+    Long64_t bits = 0;
+    memcpy(&bits, &v, sizeof(bits));
+    return Combine(h, bits);
+  }
+
+  //! Hash of the input string (FNV-1a), starting from h
+  inline ULong64_t String(const std::string & s, ULong64_t h = kSeed)
+  {
+    for(std::string::size_type i = 0; i < s.size(); i++) {
+      h ^= (unsigned char) s[i];
+      h *= 0x100000001b3ULL;
+    }
+    return h;
+  }
+
+}      // hash namespace
+}      // utils namespace
+}      // genie namespace
+
+#endif // _HASH_UTILS_H_
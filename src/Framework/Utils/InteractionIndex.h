@@ -0,0 +1,124 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InteractionIndex
+
+\brief    An index of values (splines, cache branches...) keyed by algorithm
+          and interaction, looked up without building their string keys.
+
+          Entries are stored in a hash map under a 64-bit hash of the
+          algorithm key (AlgId::KeyHash(), computed once per algorithm), of
+          the interaction Fingerprint() (cached by the Interaction) and of an
+          optional tag, next to the key hash, tag hash and interaction codes
+          they were inserted for. Lookups and insertions compare those, so a
+          collision of the combined hash is never resolved to another
+          interaction's value: Find() reports the value as not indexed and
+          Insert() keeps the entry already there. Callers then use their
+          string-keyed maps instead.
+          Not thread-safe: callers serialize the accesses or keep an index
+          per thread.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _INTERACTION_INDEX_H_
+#define _INTERACTION_INDEX_H_
+
+#include <cstring>
+#include <unordered_map>
+
+#include "Framework/Algorithm/AlgId.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/HashUtils.h"
+
+namespace genie {
+
+template<class T> class InteractionIndex {
+
+public:
+  InteractionIndex() : fNCollisions(0) {}
+
+  //! Find the value indexed for the input algorithm, interaction & tag.
+  //! Returns false if there is none (or if the slot holds another key)
+  bool Find (const AlgId & alg, const Interaction * in,
+             T & value, const char * tag = "") const
+  {
+    ULong64_t tag_hash = utils::hash::String(tag);
+    typename Map_t::const_iterator it =
+                 fIndex.find(Hash(alg.KeyHash(), tag_hash, in));
+    if(it == fIndex.end()) return false;
+    if(!it->second.Matches(alg.KeyHash(), tag_hash, in)) return false;
+    value = it->second.fValue;
+    return true;
+  }
+
+  //! Index the input value. Returns false, leaving the index unchanged, if
+  //! the slot is taken by another key
+  bool Insert (const AlgId & alg, const Interaction * in,
+               T value, const char * tag = "")
+  {
+    ULong64_t tag_hash = utils::hash::String(tag);
+    ULong64_t h = Hash(alg.KeyHash(), tag_hash, in);
+    typename Map_t::iterator it = fIndex.find(h);
+    if(it != fIndex.end() && !it->second.Matches(alg.KeyHash(), tag_hash, in)) {
+      fNCollisions++;
+      LOG("InteractionIndex", pWARN)
+        << "64-bit key collision for " << alg.Key() << "/" << tag
+        << " and " << in->AsString() << ": using the string key";
+      return false;
+    }
+    Entry & entry = fIndex[h];
+    entry.fAlgKeyHash = alg.KeyHash();
+    entry.fTagHash    = tag_hash;
+    in->Codes(entry.fCodes);
+    entry.fValue      = value;
+    return true;
+  }
+
+  void          Clear       (void)       { fIndex.clear(); }
+  unsigned long NCollisions (void) const { return fNCollisions; }
+
+private:
+  struct Entry {
+    ULong64_t fAlgKeyHash;
+    ULong64_t fTagHash;
+    Long64_t  fCodes[kNInteractionCodes];
+    T         fValue;
+
+    bool Matches(ULong64_t alg_key_hash, ULong64_t tag_hash,
+                 const Interaction * in) const {
+      if(fAlgKeyHash != alg_key_hash || fTagHash != tag_hash) return false;
+      Long64_t codes[kNInteractionCodes];
+      in->Codes(codes);
+      return memcmp(fCodes, codes, sizeof(fCodes)) == 0;
+    }
+  };
+
+  //! the keys are already well mixed hashes
+  struct IdentityHash {
+    size_t operator() (ULong64_t h) const { return (size_t) h; }
+  };
+
+  typedef std::unordered_map<ULong64_t, Entry, IdentityHash> Map_t;
+
+  static ULong64_t Hash(ULong64_t alg_key_hash, ULong64_t tag_hash,
+                        const Interaction * in) {
+    ULong64_t h = utils::hash::Combine(alg_key_hash, (Long64_t) tag_hash);
+    return utils::hash::Combine(h, (Long64_t) in->Fingerprint());
+  }
+
+  Map_t         fIndex;       ///< hash -> key hashes, codes & value
+  unsigned long fNCollisions; ///< rejected insertions
+};
+
+}      // genie namespace
+
+#endif // _INTERACTION_INDEX_H_
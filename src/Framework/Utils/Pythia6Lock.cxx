@@ -0,0 +1,90 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Threads with their own random number stream get their own PYTHIA6
+   random number generator state, swapped in by the outermost lock.
+*/
+//____________________________________________________________________________
+
+#include <mutex>
+
+#include <TPythia6.h>
+#include <TRandom3.h>
+
+#include "Framework/Utils/Pythia6Lock.h"
+
+using namespace genie;
+
+namespace {
+  std::recursive_mutex & Pythia6Mutex(void)
+  {
+    static std::recursive_mutex mtx;
+    return mtx;
+  }
+
+  // PYTHIA6 random number generator state (PYDATR common block)
+  struct Pythia6RndmState {
+    int    MRPY[6];
+    double RRPY[100];
+  };
+
+  void SaveRndmState(TPythia6 * pythia6, Pythia6RndmState & state)
+  {
+    for(int i = 0; i <   6; i++) state.MRPY[i] = pythia6->GetMRPY(i+1);
+    for(int i = 0; i < 100; i++) state.RRPY[i] = pythia6->GetRRPY(i+1);
+  }
+  void LoadRndmState(TPythia6 * pythia6, const Pythia6RndmState & state)
+  {
+    for(int i = 0; i <   6; i++) pythia6->SetMRPY(i+1, state.MRPY[i]);
+    for(int i = 0; i < 100; i++) pythia6->SetRRPY(i+1, state.RRPY[i]);
+  }
+
+  thread_local unsigned int     gDepth      = 0; ///< lock nesting depth
+  thread_local TRandom3 *       gSource     = 0; ///< seeds the thread sequence
+  thread_local bool             gSeeded     = false;
+  thread_local Pythia6RndmState gThreadState;    ///< the thread sequence
+  thread_local Pythia6RndmState gSharedState;    ///< saved while swapped out
+}
+//____________________________________________________________________________
+Pythia6Lock::Pythia6Lock()
+{
+  Pythia6Mutex().lock();
+  if(gDepth++ > 0 || !gSource) return;
+
+  TPythia6 * pythia6 = TPythia6::Instance();
+  SaveRndmState(pythia6, gSharedState);
+  if(gSeeded) {
+    LoadRndmState(pythia6, gThreadState);
+  } else {
+    // MRPY(2) = 0 makes PYR initialize its state from MRPY(1)
+    pythia6->SetMRPY(1, gSource->Integer(900000000));
+    pythia6->SetMRPY(2, 0);
+    gSeeded = true;
+  }
+}
+//____________________________________________________________________________
+Pythia6Lock::~Pythia6Lock()
+{
+  if(--gDepth == 0 && gSource) {
+    TPythia6 * pythia6 = TPythia6::Instance();
+    SaveRndmState(pythia6, gThreadState);
+    LoadRndmState(pythia6, gSharedState);
+  }
+  Pythia6Mutex().unlock();
+}
+//____________________________________________________________________________
+void Pythia6Lock::SetThreadRandomSource(TRandom3 * rnd)
+{
+  gSource = rnd;
+  gSeeded = false;
+}
+//____________________________________________________________________________
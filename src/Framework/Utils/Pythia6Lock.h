@@ -0,0 +1,57 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::Pythia6Lock
+
+\brief    Scoped lock serializing access to PYTHIA6 / JETSET.
+
+          PYTHIA6 keeps all of its state (event record, decay tables, PARJ /
+          MSTJ switches, random number generator) in Fortran COMMON blocks
+          shared by the whole process, behind the TPythia6 singleton.
+          Any code driving PYTHIA6 (setting switches, calling PY1ENT, PY2ENT,
+          PYEVNT and importing the LUJETS record) must hold a Pythia6Lock for
+          the whole sequence, so that threads generating events concurrently
+          do not interleave their calls. The lock is recursive: a holder can
+          call other code taking it again.
+          A thread with its own random number stream (see
+          RandomGen::SetThreadStream()) also gets its own PYTHIA6 random
+          number sequence, seeded from that stream: its generator state
+          (PYDATR) is swapped in while the thread holds the lock, so that
+          its events do not depend on what other threads generate.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PYTHIA6_LOCK_H_
+#define _PYTHIA6_LOCK_H_
+
+class TRandom3;
+
+namespace genie {
+
+class Pythia6Lock {
+
+public:
+  Pythia6Lock();
+ ~Pythia6Lock();
+
+  //! Give the calling thread its own PYTHIA6 random number sequence, seeded
+  //! from the input generator at its next PYTHIA6 call (or return it to the
+  //! shared sequence, if the input is null). Not to be called while holding
+  //! a Pythia6Lock
+  static void SetThreadRandomSource(TRandom3 * rnd);
+
+private:
+  Pythia6Lock(const Pythia6Lock & lock);
+  Pythia6Lock & operator = (const Pythia6Lock & lock);
+};
+
+}      // genie namespace
+#endif // _PYTHIA6_LOCK_H_
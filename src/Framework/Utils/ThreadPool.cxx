@@ -0,0 +1,163 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+#include <unistd.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/ThreadPool.h"
+
+using std::vector;
+
+namespace genie {
+
+//____________________________________________________________________________
+struct ThreadPoolImpl
+{
+  vector<std::thread>       threads;
+  std::mutex                mutex;
+  std::condition_variable   start;      ///< signals a new task (or shutdown)
+  std::condition_variable   done;       ///< signals that all workers are idle
+  ParallelTask *            task;
+  unsigned int              nitems;
+  std::atomic<unsigned int> next;       ///< next item to hand out
+  unsigned long             generation; ///< incremented for every Execute()
+  unsigned int              nbusy;
+  bool                      stop;
+  std::exception_ptr        error;
+  pid_t                     owner;      ///< process running the threads
+
+  void WorkerLoop(unsigned int worker);
+};
+//____________________________________________________________________________
+void ThreadPoolImpl::WorkerLoop(unsigned int worker)
+{
+  unsigned long seen = 0;
+  while(1) {
+    ParallelTask * curr_task = 0;
+    unsigned int   curr_nitems = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while(!stop && generation == seen) start.wait(lock);
+      if(stop) return;
+      seen        = generation;
+      curr_task   = task;
+      curr_nitems = nitems;
+    }
+    try {
+      unsigned int item = 0;
+      while( (item = next++) < curr_nitems ) {
+        curr_task->Run(worker, item);
+      }
+    }
+    catch(...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if(!error) error = std::current_exception();
+      next = curr_nitems; // stop handing out items
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if(--nbusy == 0) done.notify_all();
+    }
+  }
+}
+//____________________________________________________________________________
+ThreadPool::ThreadPool(unsigned int nworkers) :
+fNWorkers(nworkers),
+fImpl(0)
+{
+  if(fNWorkers == 0) fNWorkers = ThreadPool::MaxNWorkers();
+  if(fNWorkers == 1) return;
+
+  LOG("ThreadPool", pNOTICE) << "Starting " << fNWorkers << " worker threads";
+
+  fImpl = new ThreadPoolImpl;
+  fImpl->task       = 0;
+  fImpl->nitems     = 0;
+  fImpl->next       = 0;
+  fImpl->generation = 0;
+  fImpl->nbusy      = 0;
+  fImpl->stop       = false;
+  fImpl->owner      = getpid();
+  for(unsigned int iw = 0; iw < fNWorkers; iw++) {
+    fImpl->threads.push_back(
+       std::thread(&ThreadPoolImpl::WorkerLoop, fImpl, iw));
+  }
+}
+//____________________________________________________________________________
+ThreadPool::~ThreadPool()
+{
+  if(!fImpl) return;
+
+  // in a process forked from the one that started the pool (see
+  // ForkedWorkers) the threads do not exist: there is nothing to join
+  if(fImpl->owner != getpid()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(fImpl->mutex);
+    fImpl->stop = true;
+  }
+  fImpl->start.notify_all();
+  for(unsigned int iw = 0; iw < fImpl->threads.size(); iw++) {
+    fImpl->threads[iw].join();
+  }
+  delete fImpl;
+}
+//____________________________________________________________________________
+void ThreadPool::Execute(
+    ParallelTask & task, unsigned int nitems, unsigned int first)
+{
+  if(first >= nitems) return;
+
+  // run the items on the calling thread if there are no workers, including
+  // in a process forked after the pool was started (threads are not copied)
+  if(!fImpl || fImpl->owner != getpid()) {
+    for(unsigned int item = first; item < nitems; item++) {
+      task.Run(0, item);
+    }
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(fImpl->mutex);
+  fImpl->task   = &task;
+  fImpl->nitems = nitems;
+  fImpl->next   = first;
+  fImpl->nbusy  = fImpl->threads.size();
+  fImpl->error  = std::exception_ptr();
+  fImpl->generation++;
+  fImpl->start.notify_all();
+
+  while(fImpl->nbusy > 0) fImpl->done.wait(lock);
+
+  fImpl->task = 0;
+  if(fImpl->error) {
+    std::exception_ptr error = fImpl->error;
+    fImpl->error = std::exception_ptr();
+    lock.unlock();
+    std::rethrow_exception(error);
+  }
+}
+//____________________________________________________________________________
+unsigned int ThreadPool::MaxNWorkers(void)
+{
+  unsigned int n = std::thread::hardware_concurrency();
+  return (n > 0) ? n : 1;
+}
+//____________________________________________________________________________
+
+} // genie namespace
@@ -0,0 +1,72 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ThreadPool
+
+\brief    A fixed-size pool of worker threads executing the items of a
+          ParallelTask. Items are handed out dynamically so that workers
+          finishing early pick up the remaining work. The calling thread
+          blocks until all items have been processed.
+          A pool with a single worker runs all items on the calling thread,
+          and so does a pool inherited by a forked process (ForkedWorkers).
+
+\class    genie::ParallelTask
+
+\brief    Interface for a unit of work executed by a ThreadPool.
+          Run() is called once per item, with the index of the worker thread
+          executing it, so that implementations can keep per-worker state
+          (cloned algorithms, scratch Interaction objects, random number
+          streams...) without any locking.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _THREAD_POOL_H_
+#define _THREAD_POOL_H_
+
+namespace genie {
+
+class ParallelTask {
+
+public:
+  virtual ~ParallelTask() {}
+
+  //! Process item 'item' on worker 'worker' (0 <= worker < NWorkers())
+  virtual void Run (unsigned int worker, unsigned int item) = 0;
+};
+
+struct ThreadPoolImpl;
+
+class ThreadPool {
+
+public:
+  //! Start a pool with the input number of workers (0: one per core)
+  ThreadPool(unsigned int nworkers = 0);
+ ~ThreadPool();
+
+  //! Number of workers (and of per-worker states a ParallelTask must keep)
+  unsigned int NWorkers (void) const { return fNWorkers; }
+
+  //! Run items [first, nitems) of the input task and wait for completion.
+  //! The first exception thrown by a worker is re-thrown here.
+  void Execute (ParallelTask & task, unsigned int nitems, unsigned int first = 0);
+
+  //! Number of concurrent threads supported by the host (at least 1)
+  static unsigned int MaxNWorkers (void);
+
+private:
+  ThreadPool(const ThreadPool & pool);
+
+  unsigned int     fNWorkers; ///< number of workers
+  ThreadPoolImpl * fImpl;     ///< threads & synchronization (null if single worker)
+};
+
+}      // genie namespace
+#endif // _THREAD_POOL_H_
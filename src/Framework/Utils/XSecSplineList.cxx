@@ -6,6 +6,18 @@
 
  Author: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   SplineExists() and GetSpline() for an algorithm and an interaction go
+   through an index keyed on the algorithm key and the interaction (see
+   InteractionIndex), so the string spline key is built only the first time
+   a pair is looked up. The index is cleared whenever splines are added or
+   the current tune changes.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The spline index is kept per thread, keyed on the hash of the algorithm
+   key, so FindSpline() takes no lock. Clearing it invalidates the indices
+   of all threads.
 */
 //____________________________________________________________________________
 
@@ -14,6 +26,8 @@
 
 #include <fstream>
 #include <cstdlib>
+#include <algorithm>
+#include <atomic>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -26,7 +40,9 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Interaction/Interaction.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/InteractionIndex.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
@@ -35,6 +51,29 @@
 using std::ofstream;
 using std::endl;
 
+namespace {
+  //! (algorithm, interaction) -> spline in the current tune, 0 if none,
+  //! indexed by each thread as it looks them up. Rebuilt when the generation
+  //! changes, ie when the index is cleared.
+  std::atomic<unsigned long> gSplineIndexGeneration(0);
+  struct ThreadSplineIndex_t {
+    ThreadSplineIndex_t() : Generation(0) {}
+    unsigned long Generation;
+    genie::InteractionIndex<const genie::Spline *> Index;
+  };
+  thread_local ThreadSplineIndex_t gThreadSplineIndex;
+
+  genie::InteractionIndex<const genie::Spline *> & ThreadSplineIndex(void)
+  {
+    unsigned long generation = gSplineIndexGeneration.load();
+    if(gThreadSplineIndex.Generation != generation) {
+      gThreadSplineIndex.Index.Clear();
+      gThreadSplineIndex.Generation = generation;
+    }
+    return gThreadSplineIndex.Index;
+  }
+}
+
 namespace genie {
 
 //____________________________________________________________________________
@@ -54,6 +93,7 @@ XSecSplineList::XSecSplineList()
   fNKnots      = 100;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
+  fKnotTolerance = 0.;
 }
 //____________________________________________________________________________
 XSecSplineList::~XSecSplineList()
@@ -73,6 +113,7 @@ XSecSplineList::~XSecSplineList()
     spl_map_curr_tune.clear();
   }
   fSplineMap.clear();
+  this->ClearSplineIndex();
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -89,6 +130,9 @@ XSecSplineList * XSecSplineList::Instance()
 bool XSecSplineList::SplineExists(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+  if(fCurrentTune.size() > 0 && alg && interaction) {
+    return (this->FindSpline(alg->Id(),interaction) != 0);
+  }
   string key = this->BuildSplineKey(alg,interaction);
   return this->SplineExists(key);
 }
@@ -121,10 +165,54 @@ bool XSecSplineList::SplineExists(string key) const
 const Spline * XSecSplineList::GetSpline(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+  const Spline * spline = (alg) ? this->FindSpline(alg->Id(),interaction) : 0;
+  if(spline) return spline;
+
   string key = this->BuildSplineKey(alg,interaction);
   return this->GetSpline(key);
 }
 //____________________________________________________________________________
+const Spline * XSecSplineList::FindSpline(
+            const AlgId & alg, const Interaction * interaction) const
+{
+// Spline for the input algorithm and interaction in the current tune,
+// or 0: the spline of a cross section algorithm, or a table stored with
+// AdoptSpline() under algorithm_key/interaction_code (eg the max xsec table
+// of a kinematics generator). The result for each (algorithm, interaction)
+// pair is kept in a per-thread index, so that the string spline key is only
+// built and looked up the first time a thread sees the pair (or every time,
+// for the rare pairs whose index key collides with another pair's).
+
+  if(!interaction || fCurrentTune.size() == 0) return 0;
+
+  InteractionIndex<const Spline *> & index = ThreadSplineIndex();
+
+  const Spline * spline = 0;
+  if(index.Find(alg, interaction, spline)) return spline;
+
+  map<string,  map<string, Spline *> >::const_iterator //\/
+  mm_iter = fSplineMap.find(fCurrentTune);
+  if(mm_iter != fSplineMap.end()) {
+    map<string, Spline *>::const_iterator m_iter =
+       mm_iter->second.find(alg.Key() + "/" + interaction->AsString());
+    if(m_iter != mm_iter->second.end()) spline = m_iter->second;
+  }
+
+  index.Insert(alg, interaction, spline);
+  return spline;
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearSplineIndex(void) const
+{
+  gSplineIndexGeneration++;
+}
+//____________________________________________________________________________
+void XSecSplineList::SetCurrentTune(const string & tune)
+{
+  if(tune != fCurrentTune) this->ClearSplineIndex();
+  fCurrentTune = tune;
+}
+//____________________________________________________________________________
 const Spline * XSecSplineList::GetSpline(string key) const
 {
 
@@ -167,9 +255,6 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // rwh -- uncomment to catch NaN
   // feenableexcept(FE_DIVBYZERO|FE_INVALID|FE_OVERFLOW);
 
-  double xsec[nknots];
-  double E   [nknots];
-
   SLOG("XSecSplLst", pNOTICE)
      << "Creating cross section spline using the algorithm: " << *alg;
 
@@ -188,7 +273,8 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   //   spline behaves correctly in (e_min,Ethr)
   // - Place 1 knot exactly on the input interaction threshold
   // - Place the remaining n-6 knots spaced either linearly or logarithmically
-  //   above the input interaction threshold
+  //   above the input interaction threshold, or adaptively if a knot
+  //   tolerance was set (see below)
   // The above scheme schanges appropriately if Ethr<e_min (i.e. no knots
   // are computed below threshold)
   //
@@ -199,54 +285,55 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   int nkb = (Ethr>e_min) ? 5 : 0; // number of knots <  threshold
   int nka = nknots-nkb;           // number of knots >= threshold
 
+  vector<double> E;
+  vector<double> xsec;
+
   // knots < energy threshold
   double dEb =  (Ethr>e_min) ? (Ethr - e_min) / nkb : 0;
   for(int i=0; i<nkb; i++) {
-     E[i] = e_min + i*dEb;
+     E.push_back(e_min + i*dEb);
+     xsec.push_back(this->XSecAt(alg, interaction, E.back()));
   }
+
   // knots >= energy threshold
-  double E0  = TMath::Max(Ethr,e_min);
+  double E0 = TMath::Max(Ethr,e_min);
+  bool adaptive = (fKnotTolerance > 0.);
+  int  nka0     = (adaptive) ? TMath::Min(nka, TMath::Max(8, nka/4)) : nka;
   double dEa = 0;
   if(this->UseLogE())
-    dEa = (TMath::Log10(e_max) - TMath::Log10(E0)) /(nka-1);
+    dEa = (TMath::Log10(e_max) - TMath::Log10(E0)) /(nka0-1);
   else
-    dEa = (e_max-E0) /(nka-1);
+    dEa = (e_max-E0) /(nka0-1);
 
-  for(int i=0; i<nka; i++) {
+  for(int i=0; i<nka0; i++) {
+     double Ei = 0;
      if(this->UseLogE())
-       E[i+nkb] = TMath::Power(10., TMath::Log10(E0) + i * dEa);
+       Ei = TMath::Power(10., TMath::Log10(E0) + i * dEa);
      else
-       E[i+nkb] = E0 + i * dEa;
+       Ei = E0 + i * dEa;
+     // force last point to avoid floating point cumulative slew
+     if(i == nka0-1) Ei = e_max;
+     E.push_back(Ei);
+     xsec.push_back(this->XSecAt(alg, interaction, Ei));
   }
-  // force last point to avoid floating point cumulative slew
-  E[nknots-1] = e_max;
 
-  // Compute cross sections for the input interaction at the selected
-  // set of energies
+  // Adaptive knot placement: starting from a coarse grid, bisect (in E or
+  // logE) every interval where the spline through the current knots misses
+  // the computed cross section at the midpoint by more than the tolerance
+  // (relative to the cross section there, or to 1% of the max cross section
+  // for points where it is tiny). The knots end up concentrated near the
+  // threshold and wherever the cross section has structure, and smooth
+  // regions are not computed more often than needed. The number of knots
+  // never exceeds nknots.
   //
-  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    if (pr_mass > 0.) {
-      double pz = TMath::Max(0.,E[i]*E[i] - pr_mass*pr_mass);
-      pz = TMath::Sqrt(pz);
-      p4.SetPz(pz);
-    }
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    xsec[i] = alg->Integral(interaction);
-    SLOG("XSecSplLst", pNOTICE)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
-    if ( std::isnan(xsec[i]) ) {
-      // this sometimes happens near threshold, warn and move on
-      SLOG("XSecSplLst", pWARN)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2"
-                       << " : converting NaN to 0.0";
-      xsec[i] = 0.0;
-    }
-
+  if(adaptive) {
+    this->RefineKnots(alg, interaction, nkb, nknots, E, xsec);
   }
+  nknots = E.size();
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Computed the cross section at " << nknots << " energies"
+    << (adaptive ? " (adaptive knot placement)" : "");
 
   // Warn about odd case of decreasing cross section
   //    but allow for small variation due to integration errors
@@ -261,7 +348,7 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
 
   // Build
   //
-  Spline * spline = new Spline(nknots, E, xsec);
+  Spline * spline = new Spline(nknots, &E[0], &xsec[0]);
 
   // Save
   //
@@ -275,6 +362,134 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   }
   map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
   spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+
+  this->ClearSplineIndex();
+}
+//____________________________________________________________________________
+double XSecSplineList::XSecAt(const XSecAlgorithmI * alg,
+                       const Interaction * interaction, double E) const
+{
+// Compute the cross section for the input interaction at the input energy
+
+  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
+  TLorentzVector p4(0,0,E,E);
+  if (pr_mass > 0.) {
+    double pz = TMath::Max(0.,E*E - pr_mass*pr_mass);
+    pz = TMath::Sqrt(pz);
+    p4.SetPz(pz);
+  }
+  interaction->InitStatePtr()->SetProbeP4(p4);
+  double xsec = alg->Integral(interaction);
+  SLOG("XSecSplLst", pNOTICE)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+  if ( std::isnan(xsec) ) {
+    // this sometimes happens near threshold, warn and move on
+    SLOG("XSecSplLst", pWARN)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2"
+                     << " : converting NaN to 0.0";
+    xsec = 0.0;
+  }
+  return xsec;
+}
+//____________________________________________________________________________
+void XSecSplineList::RefineKnots(const XSecAlgorithmI * alg,
+    const Interaction * interaction, int nkb, int nknots,
+    vector<double> & E, vector<double> & xsec) const
+{
+// Bisect the intervals between the knots above threshold (from index nkb on)
+// until the spline interpolation error at the midpoints is within the knot
+// tolerance, or until nknots knots have been used
+
+  const double min_width = 1E-3; // in log10(E), or relative to the E range
+
+  bool   uselog = this->UseLogE();
+  double range  = E.back() - E[nkb];
+
+  // unconverged[i] refers to the interval (E[i],E[i+1])
+  vector<bool> unconverged(E.size(), false);
+  for(unsigned int i = nkb; i+1 < E.size(); i++) unconverged[i] = true;
+
+  while((int)E.size() < nknots) {
+
+    // intervals to bisect in this pass, the widest first
+    vector< pair<double, unsigned int> > todo;
+    for(unsigned int i = nkb; i+1 < E.size(); i++) {
+      if(!unconverged[i]) continue;
+      double width = (uselog) ?
+         TMath::Log10(E[i+1]/E[i]) : (E[i+1]-E[i])/range;
+      if(width < 2*min_width) { unconverged[i] = false; continue; }
+      todo.push_back(pair<double, unsigned int>(-width, i));
+    }
+    if(todo.empty()) break;
+    std::sort(todo.begin(), todo.end());
+    unsigned int nbudget = nknots - E.size();
+    if(todo.size() > nbudget) todo.resize(nbudget);
+
+    Spline spline(E.size(), &E[0], &xsec[0]);
+    double xsec_max = *std::max_element(xsec.begin(), xsec.end());
+
+    vector<unsigned int> bisect;
+    for(unsigned int k = 0; k < todo.size(); k++) bisect.push_back(todo[k].second);
+    std::sort(bisect.begin(), bisect.end());
+
+    vector<double> E_new, xsec_new;
+    vector<bool>   unconv_new;
+    unsigned int it = 0;
+    for(unsigned int i = 0; i < E.size(); i++) {
+      E_new.push_back(E[i]);
+      xsec_new.push_back(xsec[i]);
+      unconv_new.push_back(unconverged[i]);
+      if(it >= bisect.size() || bisect[it] != i) continue;
+      it++;
+      double Emid = (uselog) ?
+         TMath::Sqrt(E[i]*E[i+1]) : 0.5*(E[i]+E[i+1]);
+      double xmid = this->XSecAt(alg, interaction, Emid);
+      double xref = TMath::Max(TMath::Abs(xmid), 0.01*xsec_max);
+      double err  = (xref > 0.) ?
+         TMath::Abs(spline.Evaluate(Emid) - xmid) / xref : 0.;
+      bool ok = (err < fKnotTolerance);
+      SLOG("XSecSplLst", pINFO)
+         << "Interpolation error at E = " << Emid << " GeV: " << err;
+      unconv_new.back() = !ok;
+      E_new.push_back(Emid);
+      xsec_new.push_back(xmid);
+      unconv_new.push_back(!ok);
+    }
+    E           = E_new;
+    xsec        = xsec_new;
+    unconverged = unconv_new;
+  }
+
+  int nleft = 0;
+  for(unsigned int i = 0; i < unconverged.size(); i++) {
+    if(unconverged[i]) nleft++;
+  }
+  if(nleft > 0) {
+    SLOG("XSecSplLst", pWARN)
+      << nleft << " interval(s) did not reach the knot tolerance ("
+      << fKnotTolerance << ") with " << nknots << " knots";
+  }
+}
+//____________________________________________________________________________
+void XSecSplineList::AdoptSpline(string key, Spline * spline)
+{
+// Store a spline built elsewhere (eg. a max differential cross section vs
+// energy table built by a kinematics generator) under the input key.
+// The list takes ownership of the spline and replaces any existing entry.
+
+  if(!spline) return;
+
+  map<string, Spline *> & spl_map_curr_tune = fSplineMap[fCurrentTune];
+  map<string, Spline *>::iterator m_iter = spl_map_curr_tune.find(key);
+  if(m_iter != spl_map_curr_tune.end()) {
+    if(m_iter->second != spline) delete m_iter->second;
+    m_iter->second = spline;
+  } else {
+    spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+  }
+  this->ClearSplineIndex();
 }
 //____________________________________________________________________________
 int XSecSplineList::NSplines(void) const
@@ -317,6 +532,11 @@ void XSecSplineList::SetMaxE(double Ev)
   if(Ev>0) fEmax = Ev;
 }
 //____________________________________________________________________________
+void XSecSplineList::SetKnotTolerance(double tol)
+{
+  fKnotTolerance = TMath::Max(0., tol);
+}
+//____________________________________________________________________________
 void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
 {
 //! Save XSecSplineList to XML file
@@ -393,6 +613,7 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
     << ( (keep) ? "ON" : "OFF" );
 
   if(!keep) fSplineMap.clear();
+  this->ClearSplineIndex();
 
   const int kNodeTypeStartElement = 1;
   const int kNodeTypeEndElement   = 15;
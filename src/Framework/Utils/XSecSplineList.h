@@ -25,6 +25,8 @@
 #include <vector>
 #include <string>
 
+#include <Rtypes.h>
+
 #include "Framework/Conventions/XmlParserStatus.h"
 
 using std::map;
@@ -37,6 +39,7 @@ using std::ostream;
 namespace genie {
 
 class XSecAlgorithmI;
+class AlgId;
 class Interaction;
 class Spline;
 
@@ -60,7 +63,7 @@ public:
   // Set and query current tune.
   // An XSecSplineList can keep splines for numerous tunes and pick the appropriate
   // one for each process, as instructed. 
-  void   SetCurrentTune (const string & tune) { fCurrentTune = tune; }
+  void   SetCurrentTune (const string & tune);
   string CurrentTune    (void) const  { return fCurrentTune; }
   bool   HasSplineFromTune( const string & tune ) const { return fSplineMap.count(tune) > 0 ; }
 
@@ -70,8 +73,10 @@ public:
   bool           SplineExists (string spline_key) const;
   const Spline * GetSpline    (const XSecAlgorithmI * alg, const Interaction * i) const;
   const Spline * GetSpline    (string spline_key) const;
+  const Spline * FindSpline   (const AlgId & alg, const Interaction * i) const;
   void           CreateSpline (const XSecAlgorithmI * alg, const Interaction * i,
                                int nknots = -1, double e_min = -1, double e_max = -1);
+  void           AdoptSpline  (string spline_key, Spline * spline);
   int  NSplines (void) const;
   bool IsEmpty  (void) const;
 
@@ -86,10 +91,12 @@ public:
   void   SetNKnots (int    nk); ///< set default number of knots for building the spline
   void   SetMinE   (double Ev); ///< set default minimum energy for xsec splines
   void   SetMaxE   (double Ev); ///< set default maximum energy for xsec splines
+  void   SetKnotTolerance (double tol); ///< set interpolation tolerance for adaptive knot placement (0: off)
   bool   UseLogE   (void) const { return fUseLogE;  }
   int    NKnots    (void) const { return fNKnots;   }
   double Emin      (void) const { return fEmin;     }
   double Emax      (void) const { return fEmax;     }
+  double KnotTolerance    (void) const { return fKnotTolerance; }
 
 private:
 
@@ -99,10 +106,17 @@ private:
 
   static XSecSplineList * fInstance;
 
+  void           ClearSplineIndex (void) const;
+
+  double XSecAt      (const XSecAlgorithmI * alg, const Interaction * i, double E) const;
+  void   RefineKnots (const XSecAlgorithmI * alg, const Interaction * i, int nkb,
+                      int nknots, vector<double> & E, vector<double> & xsec) const;
+
   bool   fUseLogE;
   int    fNKnots;
   double fEmin;
   double fEmax;
+  double fKnotTolerance; ///< max relative spline interpolation error at knot midpoints (0: evenly spaced knots)
 
   string fCurrentTune; ///< The `active' tune, out the many that can co-exist
 
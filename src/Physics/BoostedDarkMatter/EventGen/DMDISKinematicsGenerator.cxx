@@ -68,7 +68,7 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- Get the interaction 
   Interaction * interaction = evrec->Summary();
@@ -140,7 +140,7 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
 
      //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxyfE);
+     xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -299,7 +299,7 @@ double DMDISKinematicsGenerator::ComputeMaxXSec(
         interaction->KinePtr()->Setx(gx);
         kinematics::UpdateWQ2FromXY(interaction);
 
-        double xsec = fXSecModel->XSec(interaction, kPSxyfE);
+        double xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DMDISKinematics", pINFO) 
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -325,7 +325,7 @@ double DMDISKinematicsGenerator::ComputeMaxXSec(
    	     gx = gx - dxn;
              interaction->KinePtr()->Setx(gx);
              kinematics::UpdateWQ2FromXY(interaction);
-             xsec = fXSecModel->XSec(interaction, kPSxyfE);
+             xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
              LOG("DMDISKinematics", pINFO) 
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -354,7 +354,7 @@ double DMDISKinematicsGenerator::ComputeMaxXSec(
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("DMDISKinematics", pDEBUG) << interaction->AsString();
   SLOG("DMDISKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("DMDISKinematics", pDEBUG) << "Computed using alg = " << *fXSecModel;
+  SLOG("DMDISKinematics", pDEBUG) << "Computed using alg = " << *this->XSecModel();
 #endif
 
   return max_xsec;
@@ -45,6 +45,17 @@ using namespace genie::controls;
 using namespace genie::constants;
 using namespace genie::utils;
 
+//___________________________________________________________________________
+namespace {
+
+  // Per-thread state of DMELEventGenerator
+  class DMELScratch : public KineGeneratorScratch {
+  public:
+    DMELScratch() : Eb(0) {}
+    double Eb; ///< binding energy of the current event
+  };
+}
+
 //___________________________________________________________________________
 DMELEventGenerator::DMELEventGenerator() :
     KineGeneratorWithCache("genie::DMELEventGenerator")
@@ -61,6 +72,16 @@ DMELEventGenerator::DMELEventGenerator(string config) :
 DMELEventGenerator::~DMELEventGenerator()
 {
 
+}
+//___________________________________________________________________________
+double & DMELEventGenerator::Eb(void) const
+{
+  return static_cast<DMELScratch *>(this->Scratch())->Eb;
+}
+//___________________________________________________________________________
+AlgScratchI * DMELEventGenerator::NewScratch(void) const
+{
+  return new DMELScratch;
 }
 //___________________________________________________________________________
 void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -73,7 +94,7 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     // Access cross section algorithm for running thread
     RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
     const EventGeneratorI * evg = rtinfo->RunningThread();
-    fXSecModel = evg->CrossSectionAlg();
+    this->SetXSecModel(evg->CrossSectionAlg());
 
     // Get the interaction and check we are working with a nuclear target
     Interaction * interaction = evrec->Summary();
@@ -366,7 +387,7 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
             TLorentzVector p4ptr = interaction->InitStatePtr()->TgtPtr()->HitNucP4();
             LOG("DMELEvent",pNOTICE) << "pn: " << p4ptr.X() << ", " <<p4ptr.Y() << ", " <<p4ptr.Z() << ", " <<p4ptr.E();
             nucleon->SetMomentum(p4ptr);
-            nucleon->SetRemovalEnergy(fEb);
+            nucleon->SetRemovalEnergy(this->Eb());
 
             // add a recoiled nucleus remnant
             this->AddTargetNucleusRemnant(evrec);
@@ -625,7 +646,7 @@ double DMELEventGenerator::ComputeMaxXSec(const Interaction * in) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     SLOG("DMELEvent", pDEBUG) << interaction->AsString();
     SLOG("DMELEvent", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-    SLOG("DMELEvent", pDEBUG) << "Computed using alg = " << *fXSecModel;
+    SLOG("DMELEvent", pDEBUG) << "Computed using alg = " << *this->XSecModel();
 #endif
   
     LOG("DMELEvent", pINFO) << "Computed maximum cross section to throw against - value is " << xsec_max;
@@ -701,7 +722,7 @@ double DMELEventGenerator::ComputeXSec( Interaction * interaction, double costhe
     p4->SetPz( p3.Pz()    );
     p4->SetE ( EN_offshell );
     
-    fEb = EN_onshell - EN_offshell;
+    this->Eb() = EN_onshell - EN_offshell;
     
     double s = interaction->InitState().CMEnergy(); // actually sqrt(s)
     s *= s; // now s actually = s
@@ -780,7 +801,7 @@ double DMELEventGenerator::ComputeXSec( Interaction * interaction, double costhe
 
     // Compute the QE cross section for the current kinematics ("~" variables)
     interaction->InitStatePtr()->TgtPtr()->HitNucP4Ptr()->SetE(EN_onshell);
-    xsec = fXSecModel->XSec(interaction, kPSTnctnBnctl); // 
+    xsec = this->XSecModel()->XSec(interaction, kPSTnctnBnctl); // 
     
     interaction->InitStatePtr()->TgtPtr()->HitNucP4Ptr()->SetE(EN_offshell);
 
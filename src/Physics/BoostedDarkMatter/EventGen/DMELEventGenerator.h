@@ -52,7 +52,9 @@ private:
   double COMJacobian(TLorentzVector lepton, TLorentzVector leptonCOM, TLorentzVector outNucleon, TVector3 beta) const;
   
   // unused // double fQ2min;
-  mutable double fEb; // Binding energy
+  // binding energy of the current event, kept per thread (see AlgScratchI)
+  double &      Eb         (void) const;
+  AlgScratchI * NewScratch (void) const;
 
   void   LoadConfig     (void);
   double  ComputeMaxXSec(const Interaction * in) const;
@@ -68,7 +68,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- Get the interaction and set the 'trust' bits
   Interaction * interaction = evrec->Summary();
@@ -151,7 +151,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      LOG("DMELKinematics", pINFO) << "Trying: Q^2 = " << gQ2;
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     xsec = this->XSecModel()->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -246,7 +246,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- Get the interaction and set the 'trust' bits
   Interaction * interaction = new Interaction(*evrec->Summary());
@@ -374,7 +374,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
      interaction->KinePtr()->SetQ2(gQ2tilde);
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     xsec = this->XSecModel()->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
 //     if(!fGenerateUniformly) {
@@ -501,7 +501,7 @@ double DMELKinematicsGenerator::ComputeMaxXSec(
   for(int i=0; i<N; i++) {
      double Q2 = TMath::Exp(logQ2min + i * dlogQ2);
      interaction->KinePtr()->SetQ2(Q2);
-     double xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     double xsec = this->XSecModel()->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("DMELKinematics", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
@@ -518,7 +518,7 @@ double DMELKinematicsGenerator::ComputeMaxXSec(
 	 Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
          if(Q2 < rQ2.min) continue;
          interaction->KinePtr()->SetQ2(Q2);
-         xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+         xsec = this->XSecModel()->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
          LOG("DMELKinematics", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
@@ -535,7 +535,7 @@ double DMELKinematicsGenerator::ComputeMaxXSec(
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("DMELKinematics", pDEBUG) << interaction->AsString();
   SLOG("DMELKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("DMELKinematics", pDEBUG) << "Computed using alg = " << *fXSecModel;
+  SLOG("DMELKinematics", pDEBUG) << "Computed using alg = " << *this->XSecModel();
 #endif
 
   return max_xsec;
@@ -138,7 +138,7 @@ double AhrensDMELPXSec::XSec(
 
   //-- compute nuclear suppression factor
   //   (R(Q2) is adapted from NeuGEN - see comments therein)
-  double R = nuclear::NuclQELXSecSuppression("Default", 0.5, interaction);
+  double R = nuclear::NuclQELXSecSuppression(fPauliBlocking, interaction);
 
   //-- number of scattering centers in the target
   int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N();
@@ -178,6 +178,9 @@ void AhrensDMELPXSec::Configure(string config)
 //____________________________________________________________________________
 void AhrensDMELPXSec::LoadConfig(void)
 {
+  // Fermi momenta used for the nuclear suppression factor
+  fPauliBlocking = nuclear::LoadPauliBlockingContext("Default", 0.5);
+
   // alpha and gamma
   double thw ;
   this->GetParam( "WeinbergAngle", thw ) ;
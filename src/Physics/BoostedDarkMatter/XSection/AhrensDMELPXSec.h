@@ -27,6 +27,7 @@
 #define _AHRENS_DMEL_CROSS_SECTION_H_
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Physics/NuclearState/NuclearUtils.h"
 
 namespace genie {
 
@@ -65,6 +66,7 @@ private:
   int    fVelMode;
   double fMedMass;
   double fgZp;
+  utils::nuclear::PauliBlockingContext fPauliBlocking; ///< settings of the nuclear suppression factor
 };
 
 }       // genie namespace
@@ -116,7 +116,12 @@ double DMDISXSec::Integrate(
      CacheBranchFx * cache_branch =
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
      if(!cache_branch) {
-         this->CacheFreeNucleonXSec(model,interaction);
+         // compute the free nucleon xsecs with the cache locked, unless
+         // another thread has done so meanwhile
+         CacheLock lock;
+         if(!cache->FindCacheBranch(key)) {
+           this->CacheFreeNucleonXSec(model,interaction);
+         }
          cache_branch =
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
          assert(cache_branch);
@@ -160,17 +165,22 @@ double DMDISXSec::Integrate(
      double xsec = 0.;
 
      if(phsp_ok) {
-       ROOT::Math::IBaseFunctionMultiDim * func = 
-          new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-       ROOT::Math::IntegrationMultiDim::Type ig_type = 
-           utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-           
        double abstol = 1; //We mostly care about relative tolerance.
-       ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
        double kine_min[2] = { Wl.min, Q2l.min };
        double kine_max[2] = { Wl.max, Q2l.max };
-       xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-       delete func;
+       if(this->UseBatchIntegrator()) {
+         xsec = this->IntegrateBatch<utils::gsl::d2XSec_dWdQ2_E>(
+            model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+       } else {
+         ROOT::Math::IBaseFunctionMultiDim * func = 
+            new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
+         ROOT::Math::IntegrationMultiDim::Type ig_type = 
+             utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+           
+         ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
+         xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+         delete func;
+       }
      }//phase space ok?
 
      LOG("DMDISXSec", pINFO)  << "XSec[DIS] (E = " << Ed << " GeV) = " << xsec;
@@ -206,6 +216,8 @@ void DMDISXSec::LoadConfig(void)
 
   fGSLMaxEval  = (unsigned int) max_eval ;
   fGSLMinEval  = (unsigned int) min_eval ;
+  GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0 ) ;
+  GetParamDef( "batch-warm-start", fBatchWarmStart, true ) ;
 
   // Energy range for cached splines
   GetParam( "GVLD-Emin", fVldEmin) ;
@@ -226,7 +238,6 @@ void DMDISXSec::CacheFreeNucleonXSec(
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   assert(!cache_branch);
   cache_branch = new CacheBranchFx("DMDIS XSec");
-  cache->AddCacheBranch(key, cache_branch);
 
   // Tweak interaction to be on a free nucleon target
   Target * target = interaction->InitStatePtr()->TgtPtr();
@@ -290,7 +301,14 @@ void DMDISXSec::CacheFreeNucleonXSec(
           (Q2l.min >= 0. && Q2l.max >= 0. && Q2l.max >= Q2l.min &&
             Wl.min >= 0. &&  Wl.max >= 0. &&  Wl.max >=  Wl.min);
 
-       if(phsp_ok) {
+       if(phsp_ok && this->UseBatchIntegrator()) {
+         double abstol = 1; //We mostly care about relative tolerance.
+         double kine_min[2] = { Wl.min, Q2l.min };
+         double kine_max[2] = { Wl.max, Q2l.max };
+         xsec = this->IntegrateBatch<utils::gsl::d2XSec_dWdQ2_E>(
+            model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+       }
+       else if(phsp_ok) {
          ROOT::Math::IntegrationMultiDim::Type ig_type = 
              utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
          double abstol = 1; //We mostly care about relative tolerance.
@@ -317,6 +335,9 @@ void DMDISXSec::CacheFreeNucleonXSec(
   // Create the spline
   cache_branch->CreateSpline();
 
+  // Add the branch to the cache once complete: it is read without locking
+  cache->AddCacheBranch(key, cache_branch);
+
   delete [] E;
   delete func;
 }
@@ -79,12 +79,20 @@ double DMELXSec::Integrate(
   interaction->SetBit(kISkipProcessChk);
   interaction->SetBit(kISkipKinematicChk);
 
+  double abstol = 1; //We mostly care about relative tolerance
+
+  if(this->UseBatchIntegrator()) {
+    double xsec = this->IntegrateBatch<utils::gsl::dXSec_dQ2_E>(
+        model, interaction, &rQ2.min, &rQ2.max, abstol) * (1E-38 * units::cm2);
+    delete interaction;
+    return xsec;
+  }
+
   ROOT::Math::IBaseFunctionOneDim * func = new 
       utils::gsl::dXSec_dQ2_E(model, interaction);
   ROOT::Math::IntegrationOneDim::Type ig_type = 
       utils::gsl::Integration1DimTypeFromString(fGSLIntgType);
   
-  double abstol = 1; //We mostly care about relative tolerance
   ROOT::Math::Integrator ig(*func,ig_type,abstol,fGSLRelTol,fGSLMaxEval);
   double xsec = ig.Integral(rQ2.min, rQ2.max) * (1E-38 * units::cm2);
      
@@ -116,5 +124,7 @@ void DMELXSec::LoadConfig(void)
 	int max;
 	GetParamDef( "gsl-max-eval", max, 100000) ;
 	fGSLMaxEval  = (unsigned int) max ;
+	GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0);
+	GetParamDef( "batch-warm-start", fBatchWarmStart, true);
 }
 //____________________________________________________________________________
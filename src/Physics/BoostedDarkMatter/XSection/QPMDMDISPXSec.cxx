@@ -100,10 +100,12 @@ double QPMDMDISPXSec::XSec(
   // int sign = (is_nubar_cc) ? -1 : 1; // comment-out unused variable to eliminate warnings
 
   // Calculate the DMDIS structure functions
-  fDISSF.Calculate(interaction); 
+  DISStructureFunc dis_sf;
+  dis_sf.SetModel(fDISSFModel);
+  dis_sf.Calculate(interaction);
 
   #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DMDISPXSec", pDEBUG) << fDISSF;
+  LOG("DMDISPXSec", pDEBUG) << dis_sf;
   #endif
 
   //
@@ -168,11 +170,11 @@ double QPMDMDISPXSec::XSec(
                   << term3 << ")*F3+(" << term4 << ")*F4+(" << term5 << ")*F5";
 #endif
 
-  term1 *= fDISSF.F1();
-  term2 *= fDISSF.F2();
-  term3 *= fDISSF.F3();
-  term4 *= fDISSF.F4();
-  term5 *= fDISSF.F5();
+  term1 *= dis_sf.F1();
+  term2 *= dis_sf.F2();
+  term3 *= dis_sf.F3();
+  term4 *= dis_sf.F4();
+  term5 *= dis_sf.F5();
 
   LOG("DMDISPXSec", pDEBUG)  
     << "\nd2xsec/dxdy ~ (" << term1 << ")+(" << term2 << ")+(" 
@@ -312,44 +314,50 @@ double QPMDMDISPXSec::DMDISRESJoinSuppressionFactor(
     // and cache DMDIS xsec suppression factors
     bool non_zero=false;
     if(!cbr) {
-      LOG("DMDISXSec", pNOTICE) 
-                        << "\n ** Creating cache branch - key = " << key;
-
-      cbr = new CacheBranchFx("DMDIS Suppr. Factors in DMDIS/RES Join Scheme");
-      Interaction interaction(*in);
-
-      const int kN   = 300;
-      double WminSpl = Wmin;
-      double WmaxSpl = fWcut + 0.1; // well into the area where scaling factor = 1
-      double dW      = (WmaxSpl-WminSpl)/(kN-1);
-
-      for(int i=0; i<kN; i++) {
-        double W = WminSpl+i*dW;
-        interaction.KinePtr()->SetW(W);
-        mprob = fHadronizationModel->MultiplicityProb(&interaction,"+LowMultSuppr");
-        R = 1;
-        if(mprob) {
-           R = mprob->Integral("width");
-           delete mprob;
-        }
-        // make sure that it takes enough samples where it is non-zero:
-        // modify the step and the sample counter once I've hit the first
-        // non-zero value
-        if(!non_zero && R>0) {
-	  non_zero=true;
-          WminSpl=W;
-          i = 0;
-          dW = (WmaxSpl-WminSpl)/(kN-1);
-        }
+      // look up again and create it with the cache locked, so that no two
+      // threads create it
+      CacheLock lock;
+      cbr = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+      if(!cbr) {
         LOG("DMDISXSec", pNOTICE) 
-	    << "Cached DMDIS XSec Suppr. factor (@ W=" << W << ") = " << R;
+                          << "\n ** Creating cache branch - key = " << key;
+
+        cbr = new CacheBranchFx("DMDIS Suppr. Factors in DMDIS/RES Join Scheme");
+        Interaction interaction(*in);
+
+        const int kN   = 300;
+        double WminSpl = Wmin;
+        double WmaxSpl = fWcut + 0.1; // well into the area where scaling factor = 1
+        double dW      = (WmaxSpl-WminSpl)/(kN-1);
+
+        for(int i=0; i<kN; i++) {
+          double W = WminSpl+i*dW;
+          interaction.KinePtr()->SetW(W);
+          mprob = fHadronizationModel->MultiplicityProb(&interaction,"+LowMultSuppr");
+          R = 1;
+          if(mprob) {
+             R = mprob->Integral("width");
+             delete mprob;
+          }
+          // make sure that it takes enough samples where it is non-zero:
+          // modify the step and the sample counter once I've hit the first
+          // non-zero value
+          if(!non_zero && R>0) {
+            non_zero=true;
+            WminSpl=W;
+            i = 0;
+            dW = (WmaxSpl-WminSpl)/(kN-1);
+          }
+          LOG("DMDISXSec", pNOTICE) 
+              << "Cached DMDIS XSec Suppr. factor (@ W=" << W << ") = " << R;
+
+          cbr->AddValues(W,R);
+        }
+        cbr->CreateSpline();
 
-        cbr->AddValues(W,R);
+        cache->AddCacheBranch(key, cbr);
+        assert(cbr);
       }
-      cbr->CreateSpline();
-
-      cache->AddCacheBranch(key, cbr);
-      assert(cbr);
     } // cache data
 
     // get the reduction factor from the cache branch
@@ -400,8 +408,6 @@ void QPMDMDISPXSec::LoadConfig(void)
      dynamic_cast<const DISStructureFuncModelI *> (this->SubAlg("SFAlg"));
   assert(fDISSFModel);
 
-  fDISSF.SetModel(fDISSFModel); // <-- attach algorithm
-
   this->GetParam( "UseDRJoinScheme", fUsingDisResJoin ) ;
 
   fHadronizationModel = 0;
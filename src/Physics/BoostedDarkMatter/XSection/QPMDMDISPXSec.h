@@ -55,7 +55,6 @@ private:
   void   LoadConfig                  (void);
   double DMDISRESJoinSuppressionFactor (const Interaction * in) const;
 
-  mutable DISStructureFunc fDISSF;
   bool                     fInInitPhase;
 
   const DISStructureFuncModelI * fDISSFModel;         ///< SF model
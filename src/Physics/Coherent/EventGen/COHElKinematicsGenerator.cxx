@@ -73,7 +73,7 @@ void COHElKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- For the subsequent kinematic selection with the rejection method:
   //   Calculate the max differential cross section or retrieve it from the
@@ -114,7 +114,7 @@ void COHElKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      interaction->KinePtr()->Sety(gy);
 
      // computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSyfE);
+     xsec = this->XSecModel()->XSec(interaction, kPSyfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -193,7 +193,7 @@ double COHElKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
      double y = TMath::Power(10, logymin+i*dlogy);
      in->KinePtr()->Sety(y);
 
-     double xsec = fXSecModel->XSec(in, kPSyfE);
+     double xsec = this->XSecModel()->XSec(in, kPSyfE);
      LOG("COHElKinematics", pDEBUG)  << "xsec(y= " << y << ") = " << xsec;
      max_xsec = TMath::Max(max_xsec, xsec);
   }//y
@@ -204,7 +204,7 @@ double COHElKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
 
   SLOG("COHElKinematics", pDEBUG) << in->AsString();
   SLOG("COHElKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("COHElKinematics", pDEBUG) << "Computed using alg = " << fXSecModel->Id();
+  SLOG("COHElKinematics", pDEBUG) << "Computed using alg = " << this->XSecModel()->Id();
 
   return max_xsec;
 }
@@ -24,11 +24,15 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The importance sampling envelope is kept in per-thread scratch state, so
+   that one instance can generate kinematics on several threads.
 
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <mutex>
 
 #include <TROOT.h>
 #include <TMath.h>
@@ -58,22 +62,55 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+//___________________________________________________________________________
+namespace {
+
+  // serializes the creation of the envelopes (in ROOT's list of functions)
+  std::mutex gEnvelopeMutex;
+
+  // Per-thread state of COHKinematicsGenerator
+  class COHKineScratch : public KineGeneratorScratch {
+  public:
+    COHKineScratch(TF2 * envelope) : Envelope(envelope) {}
+   ~COHKineScratch() { delete Envelope; }
+    TF2 * Envelope; ///< 2-D envelope used for importance sampling
+  };
+}
+
 //___________________________________________________________________________
 COHKinematicsGenerator::COHKinematicsGenerator() :
   KineGeneratorWithCache("genie::COHKinematicsGenerator")
 {
-  fEnvelope = 0;
+
 }
 //___________________________________________________________________________
 COHKinematicsGenerator::COHKinematicsGenerator(string config) :
   KineGeneratorWithCache("genie::COHKinematicsGenerator", config)
 {
-  fEnvelope = 0;
+
 }
 //___________________________________________________________________________
 COHKinematicsGenerator::~COHKinematicsGenerator()
 {
-  if(fEnvelope) delete fEnvelope;
+
+}
+//___________________________________________________________________________
+AlgScratchI * COHKinematicsGenerator::NewScratch(void) const
+{
+  //-- Envelope employed when importance sampling is used 
+  //   (initialize with dummy range)
+  std::lock_guard<std::mutex> lock(gEnvelopeMutex);
+  TF2 * envelope = new TF2("CohKinEnvelope",
+                      kinematics::COHImportanceSamplingEnvelope,0.,1,0.,1,2);
+  // stop ROOT from deleting this object of its own volition
+  gROOT->GetListOfFunctions()->Remove(envelope);
+
+  return new COHKineScratch(envelope);
+}
+//___________________________________________________________________________
+TF2 * COHKinematicsGenerator::Envelope(void) const
+{
+  return static_cast<COHKineScratch *>(this->Scratch())->Envelope;
 }
 //___________________________________________________________________________
 void COHKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -86,20 +123,20 @@ void COHKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
-  if (fXSecModel->Id().Name() == "genie::ReinSehgalCOHPiPXSec") {
+  this->SetXSecModel(evg->CrossSectionAlg());
+  if (this->XSecModel()->Id().Name() == "genie::ReinSehgalCOHPiPXSec") {
     CalculateKin_ReinSehgal(evrec);
-  } else if (fXSecModel->Id().Name() == "genie::BergerSehgalCOHPiPXSec2015") {
+  } else if (this->XSecModel()->Id().Name() == "genie::BergerSehgalCOHPiPXSec2015") {
     CalculateKin_BergerSehgal(evrec);
-  } else if (fXSecModel->Id().Name() == "genie::BergerSehgalFMCOHPiPXSec2015") {
+  } else if (this->XSecModel()->Id().Name() == "genie::BergerSehgalFMCOHPiPXSec2015") {
     CalculateKin_BergerSehgalFM(evrec);
-  } else if ((fXSecModel->Id().Name() == "genie::AlvarezRusoCOHPiPXSec")) {
+  } else if ((this->XSecModel()->Id().Name() == "genie::AlvarezRusoCOHPiPXSec")) {
     CalculateKin_AlvarezRuso(evrec);
   }
   else {
     LOG("COHKinematicsGenerator",pFATAL) <<
       "ProcessEventRecord >> Cannot calculate kinematics for " <<
-      fXSecModel->Id().Name();
+      this->XSecModel()->Id().Name();
   }
 }
 //___________________________________________________________________________
@@ -157,7 +194,7 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
     kinematics::UpdateXFromQ2Y(interaction);
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction, kPSQ2yfE);
+    xsec = this->XSecModel()->XSec(interaction, kPSQ2yfE);
 
     //-- decide whether to accept the current kinematics
     accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
@@ -277,7 +314,7 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
     interaction->KinePtr()->SetQ2(gQ2);
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction, kPSxyfE);
+    xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 
     //-- decide whether to accept the current kinematics
     accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
@@ -344,6 +381,7 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
   unsigned int iter = 0;
   bool accept=false;
   double xsec=-1, gx=-1, gy=-1;
+  TF2 * envelope = this->Envelope();
 
   while(1) {
     iter++;
@@ -360,13 +398,13 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
       if(iter==1) {
         LOG("COHKinematics", pNOTICE) << "Initializing the sampling envelope";
         double Ev = interaction->InitState().ProbeE(kRfLab);
-        fEnvelope->SetRange(xmin,ymin,xmax,ymax);
-        fEnvelope->SetParameter(0, xsec_max);  
-        fEnvelope->SetParameter(1, Ev);        
+        envelope->SetRange(xmin,ymin,xmax,ymax);
+        envelope->SetParameter(0, xsec_max);  
+        envelope->SetParameter(1, Ev);        
       }
 
       // Generate W,QD2 using the 2-D envelope as PDF
-      fEnvelope->GetRandom2(gx,gy);
+      envelope->GetRandom2(gx,gy);
     }
 
     LOG("COHKinematics", pINFO) << "Trying: x = " << gx << ", y = " << gy;
@@ -375,11 +413,11 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
     interaction->KinePtr()->Sety(gy);
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction, kPSxyfE);
+    xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 
     //-- decide whether to accept the current kinematics
     if(!fGenerateUniformly) {
-      double max = fEnvelope->Eval(gx, gy);
+      double max = envelope->Eval(gx, gy);
       double t   = max * rnd->RndKine().Rndm();
 
       this->AssertXSecLimits(interaction, xsec, max);
@@ -526,7 +564,7 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
                         interaction, interaction->KinePtr());
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction,kPSElOlOpifE) / (1E-38 * units::cm2);
+    xsec = this->XSecModel()->XSec(interaction,kPSElOlOpifE) / (1E-38 * units::cm2);
 
     if (!fGenerateUniformly) {
       //-- decide whether to accept the current kinematics
@@ -697,19 +735,19 @@ double COHKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
     << "Scanning the allowed phase space {K} for the max(dxsec/d{K})";
 #endif
   double max_xsec = 0.;
-  if (fXSecModel->Id().Name() == "genie::ReinSehgalCOHPiPXSec") {
+  if (this->XSecModel()->Id().Name() == "genie::ReinSehgalCOHPiPXSec") {
     max_xsec = MaxXSec_ReinSehgal(in);
-  } else if ((fXSecModel->Id().Name() == "genie::BergerSehgalCOHPiPXSec2015")) {
+  } else if ((this->XSecModel()->Id().Name() == "genie::BergerSehgalCOHPiPXSec2015")) {
     max_xsec = MaxXSec_BergerSehgal(in);
-  } else if ((fXSecModel->Id().Name() == "genie::BergerSehgalFMCOHPiPXSec2015")) {
+  } else if ((this->XSecModel()->Id().Name() == "genie::BergerSehgalFMCOHPiPXSec2015")) {
     max_xsec = MaxXSec_BergerSehgalFM(in);
-  } else if ((fXSecModel->Id().Name() == "genie::AlvarezRusoCOHPiPXSec")) {
+  } else if ((this->XSecModel()->Id().Name() == "genie::AlvarezRusoCOHPiPXSec")) {
     max_xsec = MaxXSec_AlvarezRuso(in);
   }
   else {
     LOG("COHKinematicsGenerator",pFATAL) <<
       "ComputeMaxXSec >> Cannot calculate max cross-section for " <<
-      fXSecModel->Id().Name();
+      this->XSecModel()->Id().Name();
   }
 
   // Apply safety factor, since value retrieved from the cache might
@@ -719,7 +757,7 @@ double COHKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("COHKinematics", pDEBUG) << in->AsString();
   SLOG("COHKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("COHKinematics", pDEBUG) << "Computed using alg = " << fXSecModel->Id();
+  SLOG("COHKinematics", pDEBUG) << "Computed using alg = " << this->XSecModel()->Id();
 #endif
 
   return max_xsec;
@@ -760,7 +798,7 @@ double COHKinematicsGenerator::MaxXSec_BergerSehgal(const Interaction * in) cons
       kinematics::UpdateXFromQ2Y(in);
 
       // Note: We're not stepping through log Q^2, log y - we "unpacked"
-      double xsec = fXSecModel->XSec(in, kPSQ2yfE);
+      double xsec = this->XSecModel()->XSec(in, kPSQ2yfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("COHKinematics", pDEBUG)  
         << "xsec(Q2= " << Q2 << ", y= " << gy << ", t = " << gt << ") = " << xsec;
@@ -813,7 +851,7 @@ double COHKinematicsGenerator::MaxXSec_BergerSehgalFM(const Interaction * in) co
         in->KinePtr()->Sety(gy);
         in->KinePtr()->Sett(gt);
 
-        double xsec = fXSecModel->XSec(in, kPSxyfE);
+        double xsec = this->XSecModel()->XSec(in, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("COHKinematics", pDEBUG)  
           << "xsec(Q2= " << Q2 << ", y= " << gy << ", t = " << gt << ") = " << xsec;
@@ -856,7 +894,7 @@ double COHKinematicsGenerator::MaxXSec_ReinSehgal(const Interaction * in) const
       in->KinePtr()->Setx(gx);
       in->KinePtr()->Sety(gy);
 
-      double xsec = fXSecModel->XSec(in, kPSxyfE);
+      double xsec = this->XSecModel()->XSec(in, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("COHKinematics", pDEBUG)  
         << "xsec(x= " << gx << ", y= " << gy << ") = " << xsec;
@@ -886,7 +924,7 @@ double COHKinematicsGenerator::MaxXSec_AlvarezRuso(const Interaction * in) const
   Range1D_t y = kps.YLim();
 
   ROOT::Math::Minimizer * min = ROOT::Math::Factory::CreateMinimizer("Minuit2");
-  gsl::d4Xsec_dEldThetaldOmegapi f(fXSecModel,in);
+  gsl::d4Xsec_dEldThetaldOmegapi f(this->XSecModel(),in);
   f.SetFactor(-1.); // Make it return negative of cross-section so we can minimize
 
   min->SetFunction( f );
@@ -930,7 +968,7 @@ double COHKinematicsGenerator::MaxXSec_AlvarezRuso(const Interaction * in) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("COHKinematics", pDEBUG) << in->AsString();
   SLOG("COHKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("COHKinematics", pDEBUG) << "Computed using alg = " << fXSecModel->Id();
+  SLOG("COHKinematics", pDEBUG) << "Computed using alg = " << this->XSecModel()->Id();
 #endif
 
   delete min;
@@ -1006,14 +1044,6 @@ void COHKinematicsGenerator::LoadConfig(void)
   //   section used in rejection method
   GetParamDef( "MaxXSec-DiffTolerance", fMaxXSecDiffTolerance, 999999. ) ;
     assert(fMaxXSecDiffTolerance>=0);
-
-  //-- Envelope employed when importance sampling is used 
-  //   (initialize with dummy range)
-  if(fEnvelope) delete fEnvelope;
-  fEnvelope = new TF2("CohKinEnvelope",
-                      kinematics::COHImportanceSamplingEnvelope,0.,1,0.,1,2);
-  // stop ROOT from deleting this object of its own volition
-  gROOT->GetListOfFunctions()->Remove(fEnvelope);
 }
 //____________________________________________________________________________
 
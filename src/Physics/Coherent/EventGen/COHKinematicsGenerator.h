@@ -68,11 +68,15 @@ namespace genie {
     // overload KineGeneratorWithCache method to get energy
     double Energy         (const Interaction * in) const;
 
-    // TODO: should fEnvelope and fRo be public? They look like they should be private
-    mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
+    // TODO: should fRo be public? It looks like it should be private
     double fRo;              ///< nuclear scale parameter
 
   private:
+    AlgScratchI * NewScratch (void) const;
+
+    // the 2-D envelope used for importance sampling, kept per thread
+    TF2 * Envelope (void) const;
+
     double pionMass(const Interaction* in) const;
     void   throwOnTooManyIterations(unsigned int iters, GHepRecord* evrec) const;
 
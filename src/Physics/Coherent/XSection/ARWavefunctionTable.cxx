@@ -0,0 +1,119 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
+
+typedef std::complex<double> cdouble;
+
+namespace {
+  const char kMagic[8] = { 'A','R','W','F','T','B','L','2' };
+}
+
+namespace genie {
+namespace alvarezruso {
+
+ARWavefunctionTable::ARWavefunctionTable(unsigned int ncomp, unsigned int n,
+                                         unsigned int np, double pmin, double pmax)
+  : fNComp(ncomp),
+  fN(n),
+  fNP(np),
+  fPMin(pmin),
+  fPMax(pmax),
+  fModelHash(0),
+  fValues(ncomp*n*n*np, cdouble(0.0,0.0))
+{
+  assert(np > 1 && pmax > pmin);
+  fDP = (fPMax - fPMin) / (fNP - 1);
+}
+
+ARWavefunctionTable::~ARWavefunctionTable()
+{
+}
+
+double ARWavefunctionTable::P(unsigned int ip) const
+{
+  return fPMin + ip*fDP;
+}
+
+bool ARWavefunctionTable::Locate(double p, unsigned int & ip, double & w) const
+{
+  if( p < fPMin || p > fPMax ) return false;
+
+  double u = (p - fPMin) / fDP;
+  ip = (unsigned int) u;
+  if( ip > fNP-2 ) ip = fNP-2;
+  w = u - ip;
+  return true;
+}
+
+bool ARWavefunctionTable::Write(const std::string & filename) const
+{
+  std::ofstream out(filename.c_str(), std::ios::binary);
+  if( !out.good() )
+  {
+    LOG("AlvarezRusoCOHPiPDXSec",pWARN) << "Can not write table to " << filename;
+    return false;
+  }
+  out.write(kMagic, sizeof(kMagic));
+  out.write((const char*) &fNComp, sizeof(fNComp));
+  out.write((const char*) &fN,     sizeof(fN));
+  out.write((const char*) &fNP,    sizeof(fNP));
+  out.write((const char*) &fPMin,  sizeof(fPMin));
+  out.write((const char*) &fPMax,  sizeof(fPMax));
+  out.write((const char*) &fModelHash, sizeof(fModelHash));
+  out.write((const char*) &fValues[0], fValues.size()*sizeof(cdouble));
+
+  return out.good();
+}
+
+ARWavefunctionTable * ARWavefunctionTable::Read(const std::string & filename)
+{
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  if( !in.good() ) return NULL;
+
+  char magic[sizeof(kMagic)];
+  unsigned int ncomp = 0, n = 0, np = 0;
+  double pmin = 0, pmax = 0;
+  ULong64_t hash = 0;
+  in.read(magic, sizeof(magic));
+  in.read((char*) &ncomp, sizeof(ncomp));
+  in.read((char*) &n,     sizeof(n));
+  in.read((char*) &np,    sizeof(np));
+  in.read((char*) &pmin,  sizeof(pmin));
+  in.read((char*) &pmax,  sizeof(pmax));
+  in.read((char*) &hash,  sizeof(hash));
+  if( !in.good() || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      np < 2 || !(pmax > pmin) )
+  {
+    LOG("AlvarezRusoCOHPiPDXSec",pWARN) << "Invalid table file " << filename;
+    return NULL;
+  }
+
+  ARWavefunctionTable * table = new ARWavefunctionTable(ncomp, n, np, pmin, pmax);
+  table->fModelHash = hash;
+  in.read((char*) &table->fValues[0], table->fValues.size()*sizeof(cdouble));
+  if( !in.good() )
+  {
+    LOG("AlvarezRusoCOHPiPDXSec",pWARN) << "Truncated table file " << filename;
+    delete table;
+    return NULL;
+  }
+  return table;
+}
+
+} //namespace alvarezruso
+} //namespace genie
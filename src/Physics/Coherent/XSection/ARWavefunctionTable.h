@@ -0,0 +1,99 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::alvarezruso::ARWavefunctionTable
+
+\brief    Tabulation, on a regular grid of pion momenta, of complex valued
+          quantities sampled on the (2*sampling x 2*sampling) grid of points
+          of an ARSampledNucleus (pion wavefunctions, their derivatives, the
+          in-medium Delta self-energy, ...) for the Alvarez-Ruso coherent
+          pion production xsec.
+
+          The table only stores the node values. Locate() finds the pair of
+          nodes bracketing a pion momentum and the linear interpolation
+          weight, so that the caller can interpolate all the quantities it
+          needs in a single pass. Tables can be written to and read back
+          from a binary file.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _AR_WAVEFUNCTION_TABLE_H_
+#define _AR_WAVEFUNCTION_TABLE_H_
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <Rtypes.h>
+
+namespace genie
+{
+namespace alvarezruso
+{
+
+class ARWavefunctionTable
+{
+  public:
+
+    // ncomp quantities on an n x n grid, at np momenta in [pmin, pmax]
+    ARWavefunctionTable(unsigned int ncomp, unsigned int n,
+                        unsigned int np, double pmin, double pmax);
+    ~ARWavefunctionTable();
+
+    unsigned int NComp(void) const  {  return fNComp;  }
+    unsigned int N    (void) const  {  return fN;      }
+    unsigned int NP   (void) const  {  return fNP;     }
+    double       PMin (void) const  {  return fPMin;   }
+    double       PMax (void) const  {  return fPMax;   }
+
+    // Hash of the model parameters & nucleus sampling the table was built
+    // with (saved with the table, and checked before a saved table is used)
+    ULong64_t ModelHash   (void) const    {  return fModelHash;  }
+    void      SetModelHash(ULong64_t h)   {  fModelHash = h;     }
+
+    // Pion momentum at node ip
+    double P(unsigned int ip) const;
+
+    // Find the nodes ip, ip+1 bracketing p and the weight w of node ip+1.
+    // Returns false if p is outside the tabulated range
+    bool Locate(double p, unsigned int & ip, double & w) const;
+
+    const std::complex<double> & Value(unsigned int ip, unsigned int icomp,
+                                       unsigned int i, unsigned int j) const
+    {
+      return fValues[((ip*fNComp + icomp)*fN + i)*fN + j];
+    }
+    void Set(unsigned int ip, unsigned int icomp, unsigned int i, unsigned int j,
+             const std::complex<double> & value)
+    {
+      fValues[((ip*fNComp + icomp)*fN + i)*fN + j] = value;
+    }
+
+    // Persistency. Read() returns NULL if the file can not be read
+    bool Write(const std::string & filename) const;
+    static ARWavefunctionTable * Read(const std::string & filename);
+
+  private:
+
+    unsigned int fNComp;
+    unsigned int fN;
+    unsigned int fNP;
+    double fPMin;
+    double fPMax;
+    double fDP;
+    ULong64_t fModelHash;
+    std::vector<std::complex<double> > fValues;  // [ip][icomp][i][j]
+};
+
+} //namespace alvarezruso
+} //namespace genie
+
+#endif
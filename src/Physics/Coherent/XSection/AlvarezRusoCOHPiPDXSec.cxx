@@ -36,6 +36,7 @@
 #include "Physics/Coherent/XSection/AREikonalSolution.h"
 #include "Framework/Numerical/IntegrationTools.h"
 #include "Physics/Coherent/XSection/ARWavefunction.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
 
 using namespace genie::constants;
 
@@ -63,7 +64,9 @@ AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_,
   fLastE_pi  (-9999999.),
   fUwave      ( new ARWavefunction(fSampling, debug_) ),
   fUwaveDr    ( new ARWavefunction(fSampling, debug_) ),
-  fUwaveDtheta( new ARWavefunction(fSampling, debug_) )
+  fUwaveDtheta( new ARWavefunction(fSampling, debug_) ),
+  fDeltaSelfEnergy( new ARWavefunction(fSampling, debug_) ),
+  fWfTable   ( NULL )
 {
   SetCurrent();
   SetFlavour();
@@ -76,6 +79,7 @@ AlvarezRusoCOHPiPDXSec::~AlvarezRusoCOHPiPDXSec()
   delete this->fUwave;
   delete this->fUwaveDr;
   delete this->fUwaveDtheta;
+  delete this->fDeltaSelfEnergy;
   delete this->fNucleus;
   delete this->fConstants;
 }
@@ -122,7 +126,7 @@ double AlvarezRusoCOHPiPDXSec::DXSec( const double E_nu_, const double E_l_, con
   
   // Only need to resolve wave funtions if Epi changes
   if ( TMath::Abs(fLastE_pi-fP_pi.E()) > 1E-10 ){
-    SolveWavefunctions();
+    if ( ! InterpolateWavefunctions() ) SolveWavefunctions();
   }
 
   LorentzVector pni = fP_pi - fQ;
@@ -296,7 +300,8 @@ void AlvarezRusoCOHPiPDXSec::SetCurrent()
 /// This is only a function of the nucleus and pion momentum/energy
 /// so if neither of those have changed there is no need to re-calculate
 /// the wavefunction values.
-/// Such a caching has not been implemented here yet!
+/// Values tabulated in pion momentum can be used instead, see
+/// BuildWavefunctionTable() and InterpolateWavefunctions().
 
 void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
 {
@@ -350,11 +355,107 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
                                         fP_pi.E());
       fUwaveDtheta->set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
       
+      // In-medium Delta self-energy (depends on the pion energy too)
+      double dens_cent = fNucleus->DensityOfCentres(i,j);
+      fDeltaSelfEnergy->set( i, j, cdouble(DeltaSelfEnergyRe(dens_cent), DeltaSelfEnergyIm(dens_cent)) );
     }
   }
   
 }
 
+double AlvarezRusoCOHPiPDXSec::EikonalMomentum(double E_pi)
+{
+  // as in AREikonalSolution::Element()
+  double mpi = fConstants->PiPMass();
+  double omepi = E_pi - fM_pi + mpi;
+  return TMath::Sqrt( TMath::Max(0.0, omepi*omepi - mpi*mpi) );
+}
+
+/*
+ * The eikonal wavefunctions are plane waves exp(i*k*x2) (x2 being the
+ * coordinate along the pion momentum) distorted by a factor that varies
+ * slowly with the pion momentum. The plane wave is divided out of the
+ * tabulated values (and of their derivatives, which at a given point
+ * carry the same factor) so that they can be interpolated linearly.
+ */
+ARWavefunctionTable * AlvarezRusoCOHPiPDXSec::BuildWavefunctionTable(
+                                     unsigned int np, double pmin, double pmax)
+{
+  unsigned int n = fNucleus->GetNDensities();
+  double hbar = fConstants->HBar();
+  
+  ARWavefunctionTable * table = new ARWavefunctionTable(4, n, np, pmin/hbar, pmax/hbar);
+  
+  LorentzVector p_pi_saved = fP_pi;
+  
+  for(unsigned int ip = 0; ip != np; ++ip)
+  {
+    double p = table->P(ip);
+    double E_pi = TMath::Sqrt( p*p + fM_pi*fM_pi );
+    fP_pi = LorentzVector(0, 0, p, E_pi);
+    
+    SolveWavefunctions();
+    
+    double k = EikonalMomentum(E_pi);
+    for(unsigned int j = 0; j != n; ++j)
+    {
+      cdouble phase = exp( cdouble(0, -k * fNucleus->SamplePoint2(j)) );
+      for(unsigned int i = 0; i != n; ++i)
+      {
+        table->Set(ip, 0, i, j, (*fUwave)      [i][j] * phase);
+        table->Set(ip, 1, i, j, (*fUwaveDr)    [i][j] * phase);
+        table->Set(ip, 2, i, j, (*fUwaveDtheta)[i][j] * phase);
+        table->Set(ip, 3, i, j, (*fDeltaSelfEnergy)[i][j]);
+      }
+    }
+  }
+  
+  // the wavefunctions no longer match the last pion energy
+  fP_pi = p_pi_saved;
+  fLastE_pi = -9999999.;
+  
+  return table;
+}
+
+void AlvarezRusoCOHPiPDXSec::SetWavefunctionTable(const ARWavefunctionTable * table)
+{
+  if( table && (table->NComp() != 4 || table->N() != fNucleus->GetNDensities()) )
+  {
+    LOG("AlvarezRusoCOHPiPDXSec",pERROR) << "Incompatible wavefunction table - Ignoring it";
+    table = NULL;
+  }
+  fWfTable = table;
+  fLastE_pi = -9999999.;
+}
+
+bool AlvarezRusoCOHPiPDXSec::InterpolateWavefunctions()
+{
+  if( ! fWfTable ) return false;
+  
+  double E_pi = fP_pi.E();
+  double p = TMath::Sqrt( TMath::Max(0.0, E_pi*E_pi - fM_pi*fM_pi) );
+  
+  unsigned int ip;
+  double w;
+  if( ! fWfTable->Locate(p, ip, w) ) return false;
+  
+  unsigned int n = fNucleus->GetNDensities();
+  double k = EikonalMomentum(E_pi);
+  
+  for(unsigned int j = 0; j != n; ++j)
+  {
+    cdouble phase = exp( cdouble(0, k * fNucleus->SamplePoint2(j)) );
+    for(unsigned int i = 0; i != n; ++i)
+    {
+      fUwave      ->set(i, j, phase * ((1.0-w)*fWfTable->Value(ip,0,i,j) + w*fWfTable->Value(ip+1,0,i,j)) );
+      fUwaveDr    ->set(i, j, phase * ((1.0-w)*fWfTable->Value(ip,1,i,j) + w*fWfTable->Value(ip+1,1,i,j)) );
+      fUwaveDtheta->set(i, j, phase * ((1.0-w)*fWfTable->Value(ip,2,i,j) + w*fWfTable->Value(ip+1,2,i,j)) );
+      fDeltaSelfEnergy->set(i, j, (1.0-w)*fWfTable->Value(ip,3,i,j) + w*fWfTable->Value(ip+1,3,i,j) );
+    }
+  }
+  return true;
+}
+
 cdouble AlvarezRusoCOHPiPDXSec::DeltaPropagatorInMed(LorentzVector delta_momentum)
 {
   //Energy dependent in-medium Delta propagator
@@ -918,12 +1019,12 @@ void AlvarezRusoCOHPiPDXSec::NuclearCurrent(LorentzVector q, LorentzVector pdir,
       cdouble pre_factor_1 = mod * I * (fs/mpi) / constants::kSqrt3 *
         exp_i_qpar_za *
         (alp*dens_p_cent+dens_n_cent) *
-        DeltaCouplingInMed(pdir,ppi,dens_cent) *
+        DeltaCouplingInMed(pdir,ppi,dens_cent,(*fDeltaSelfEnergy)[i][l]) *
         pi/(3.0*mn2*mdel2)*fF_direct_delta;
 
       cdouble pre_factor_2 = mod * I * (fs/mpi) / constants::kSqrt3 *exp_i_qpar_za *
         (dens_p_cent+ alp*dens_n_cent)*pi/(3.*mn2*mdel2)*fF_cross_delta *
-        DeltaCouplingInMed(pcrs,ppi,dens_cent);
+        DeltaCouplingInMed(pcrs,ppi,dens_cent,(*fDeltaSelfEnergy)[i][l]);
 
       double PreFacMult = (fConstants->GAxial()/constants::kSqrt2/fConstants->PiDecayConst());
       cdouble pre_factor_3 = 1./mod*(-I)*PreFacMult*exp_i_qpar_za*
@@ -970,8 +1071,11 @@ void AlvarezRusoCOHPiPDXSec::NuclearCurrent(LorentzVector q, LorentzVector pdir,
 }
 
 
-cdouble AlvarezRusoCOHPiPDXSec::DeltaCouplingInMed(LorentzVector delta_momentum, LorentzVector pion_momentum, double density) 
+cdouble AlvarezRusoCOHPiPDXSec::DeltaCouplingInMed(LorentzVector delta_momentum, LorentzVector pion_momentum, double density,
+                                                  const cdouble & self_energy) 
 {
+  // self_energy: DeltaSelfEnergyRe(density) + i*DeltaSelfEnergyIm(density),
+  // computed once per sampling point & pion energy in SolveWavefunctions()
   cdouble gdmed;
   cdouble s_delta (delta_momentum.mag2(),0);
   cdouble I(0,1);
@@ -987,11 +1091,9 @@ cdouble AlvarezRusoCOHPiPDXSec::DeltaCouplingInMed(LorentzVector delta_momentum,
   {
     cdouble sqrt_delta = sqrt(s_delta);
     double gamdpb = DeltaWidthPauliBlocked(delta_momentum, density);
-    double real = DeltaSelfEnergyRe(density);
-    double imaginary = DeltaSelfEnergyIm(density);
     double ofshel = PiDecayVertex(pion_momentum, fConstants->DeltaPMass());
 
-    cdouble part_1 = sqrt_delta - fConstants->DeltaPMass() + (ofshel*ofshel*(I*gamdpb)/2.0) - real - I*imaginary;
+    cdouble part_1 = sqrt_delta - fConstants->DeltaPMass() + (ofshel*ofshel*(I*gamdpb)/2.0) - self_energy;
     cdouble part_2 = sqrt_delta + fConstants->DeltaPMass();
     
     gdmed = 1.0 / (part_1 * part_2);
@@ -38,6 +38,7 @@ namespace alvarezruso
 {
 
 class ARWFSolution;
+class ARWavefunctionTable;
 
 enum current_t{kCC, kNC};
 enum flavour_t{kE, kMu, kTau};
@@ -73,6 +74,16 @@ class AlvarezRusoCOHPiPDXSec
       return fM_l;
     }
     
+    // Tabulate the pion wavefunctions (and derivatives) and the in-medium
+    // Delta self-energy at np pion momenta in [pmin, pmax] (in GeV).
+    // They depend only on the nucleus, the pion mass and the pion energy.
+    ARWavefunctionTable * BuildWavefunctionTable(unsigned int np, double pmin, double pmax);
+    
+    // Interpolate the wavefunctions from the input table, rather than
+    // solving for them, at pion momenta within the tabulated range.
+    // The table is not owned and must be compatible with this nucleus & pion
+    void SetWavefunctionTable(const ARWavefunctionTable * table);
+    
     private:
         // Fill the ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> >s based on the values from the kinematics
         void SetKinematics();
@@ -84,7 +95,8 @@ class AlvarezRusoCOHPiPDXSec
         void SetCurrent();
 
         std::complex<double> DeltaCouplingInMed(ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > delta_momentum, 
-             ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > pion_momentum, double density_cent);
+             ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > pion_momentum, double density_cent,
+             const std::complex<double> & self_energy);
         double PiDecayVertex(ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > pion_momentum, double mass);
         std::complex<double>  DeltaPropagatorInMed(ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > delta_momentum);
         double DeltaWidthPauliBlocked(ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > delta_momentum, double density);
@@ -102,6 +114,10 @@ class AlvarezRusoCOHPiPDXSec
 
         // Fill the wavefunctions
         void SolveWavefunctions();
+        // Fill the wavefunctions from the table. Returns false if out of range
+        bool InterpolateWavefunctions();
+        // Pion momentum used for the plane wave in the eikonal solution
+        double EikonalMomentum(double E_pi);
         
         //______________________________________________________________
         // Properties
@@ -161,6 +177,10 @@ class AlvarezRusoCOHPiPDXSec
         ARWavefunction* fUwave;
         ARWavefunction* fUwaveDr;
         ARWavefunction* fUwaveDtheta;
+        // In-medium Delta self-energy at each sampling point
+        ARWavefunction* fDeltaSelfEnergy;
+        // Tabulated values of the above (not owned)
+        const ARWavefunctionTable * fWfTable;
         
         std::complex<double>  fJ_hadronic[4];
 };
@@ -14,8 +14,12 @@
 //____________________________________________________________________________
 
 #include <iostream>
+#include <sstream>
+#include <map>
+#include <mutex>
 
 #include <TMath.h>
+#include <TSystem.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
@@ -28,12 +32,14 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPXSec.h"
 #include "Framework/Utils/HadXSUtils.h"
+#include "Framework/Utils/HashUtils.h"
 #include "Framework/Utils/KineUtils.h"
 
 #include "Physics/Coherent/XSection/ARConstants.h"
 #include "Physics/Coherent/XSection/ARSampledNucleus.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 #include "Physics/Coherent/XSection/AREikonalSolution.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
 
 
 using namespace genie;
@@ -42,12 +48,55 @@ using namespace genie::utils;
 
 using namespace alvarezruso;
 
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  // Wavefunction tables, shared by all instances and kept for the whole job.
+  // Keyed by nucleus, current, table binning and model parameters.
+  std::map<string, ARWavefunctionTable *> gWfTables;
+  std::mutex                              gWfTablesMutex;
+
+  // Hash of everything the tabulated wavefunctions depend on besides the
+  // nucleus, current and binning: the model constants and the sampled
+  // nuclear densities
+  ULong64_t WavefunctionModelHash(AlvarezRusoCOHPiPDXSec & dxsec)
+  {
+    ARConstants & c = dxsec.GetConstants();
+    const double constants[] = {
+      c.HBar(), c.Ma_Nucleon(), c.Mv_Nucleon(), c.Ma_Delta(), c.Mv_Delta(),
+      c.GAxial(), c.Rho0(), c.CA4_A(), c.CA5_A(), c.CA4_B(), c.CA5_B(),
+      c.PiDecayConst(), c.DeltaNCoupling(), c.NucleonMass(),
+      c.DeltaPMass(), c.Delta0Mass(), c.PiPMass(), c.Pi0Mass()
+    };
+    ULong64_t h = hash::kSeed;
+    for (unsigned int i = 0; i < sizeof(constants)/sizeof(double); i++) {
+      h = hash::Double(h, constants[i]);
+    }
+
+    const ARSampledNucleus & nucleus = dxsec.GetNucleus();
+    unsigned int n = nucleus.GetNDensities();
+    h = hash::Combine(h, n);
+    h = hash::Double (h, nucleus.RadiusMax());
+    for (unsigned int i = 0; i < n; i++) {
+      h = hash::Double(h, nucleus.SamplePoint1(i));
+      h = hash::Double(h, nucleus.SamplePoint2(i));
+      for (unsigned int j = 0; j < n; j++) {
+        h = hash::Double(h, nucleus.Density(i,j));
+        h = hash::Double(h, nucleus.DensityOfCentres(i,j));
+      }
+    }
+    return h;
+  }
+
+}
+
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec() :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec")
 {
   fMultidiff = NULL;
   fLastInteraction = NULL;
+  fUseLookupTable = false;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec(string config) :
@@ -55,6 +104,7 @@ XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config)
 {
   fMultidiff = NULL;
   fLastInteraction = NULL;
+  fUseLookupTable = false;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::~AlvarezRusoCOHPiPXSec()
@@ -80,46 +130,59 @@ double AlvarezRusoCOHPiPXSec::XSec(
   double E_lep = p4_lep.E();
  
   if (fLastInteraction!=interaction) {
-    if (fMultidiff != NULL) {
-      delete fMultidiff;
-      fMultidiff = NULL;
-    }
+    // the wavefunctions & nuclear densities depend only on the nucleus and
+    // the current: keep the same calculator if neither has changed
+    std::ostringstream init_state_key;
+    init_state_key << Z << "/" << A << "/" << interaction->ProcInfo().InteractionTypeId()
+                   << "/" << init_state.ProbePdg();
 
-    current_t current;
-    if ( interaction->ProcInfo().IsWeakCC() ) {
-      current = kCC;
-    }
-    else if ( interaction->ProcInfo().IsWeakNC() ) {
-      current = kNC;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
-      return 0.;
-    }
+    if (fMultidiff == NULL || fLastInitState != init_state_key.str()) {
+      if (fMultidiff != NULL) {
+        delete fMultidiff;
+        fMultidiff = NULL;
+      }
+
+      current_t current;
+      if ( interaction->ProcInfo().IsWeakCC() ) {
+        current = kCC;
+      }
+      else if ( interaction->ProcInfo().IsWeakNC() ) {
+        current = kNC;
+      }
+      else {
+        LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
+        return 0.;
+      }
     
-    flavour_t flavour;
-    if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
-      flavour=kE;
-    }
-    else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
-      flavour=kMu;
-    }
-    else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
-      flavour=kTau;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
-      return 0.;
-    }
+      flavour_t flavour;
+      if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
+        flavour=kE;
+      }
+      else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
+        flavour=kMu;
+      }
+      else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
+        flavour=kTau;
+      }
+      else {
+        LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
+        return 0.;
+      }
 
-    nutype_t nutype;
-    if ( init_state.ProbePdg() > 0) {
-      nutype = kNu;
-    } else {
-      nutype = kAntiNu;
-    }
+      nutype_t nutype;
+      if ( init_state.ProbePdg() > 0) {
+        nutype = kNu;
+      } else {
+        nutype = kAntiNu;
+      }
  
-    fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
+      fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
+      if (fUseLookupTable) {
+        fMultidiff->SetWavefunctionTable(
+           this->WavefunctionTable(*fMultidiff, Z, A, current));
+      }
+      fLastInitState = init_state_key.str();
+    }
     fLastInteraction = interaction;
   }
 
@@ -185,6 +248,21 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
   ffStar   = fConfig->GetDoubleDef("fStar",         gc->GetDouble("COHAR-fStar"));*/
 
 
+  //-- tabulated pion wavefunctions
+  GetParamDef("UseLookupTable", fUseLookupTable, false);
+  int np = 0;
+  GetParamDef("LookupTable-NP",   np,               200);
+  GetParamDef("LookupTable-PMin", fLookupTablePMin, 0.01);
+  GetParamDef("LookupTable-PMax", fLookupTablePMax, 2.0);
+  GetParamDef("LookupTable-Dir",  fLookupTableDir,  string(""));
+  fLookupTableNP = (unsigned int) TMath::Max(np, 2);
+  assert(fLookupTablePMax > fLookupTablePMin && fLookupTablePMin > 0.);
+
+  // the calculator may have been built with the old configuration
+  if (fMultidiff) delete fMultidiff;
+  fMultidiff = NULL;
+  fLastInteraction = NULL;
+
   //-- load the differential cross section integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
@@ -192,4 +270,67 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
 
 }
 //____________________________________________________________________________
+const ARWavefunctionTable * AlvarezRusoCOHPiPXSec::WavefunctionTable(
+     AlvarezRusoCOHPiPDXSec & dxsec, int Z, int A, current_t current) const
+{
+  ULong64_t model_hash = WavefunctionModelHash(dxsec);
+
+  std::ostringstream key;
+  key << "Z" << Z << "_A" << A << "_" << ((current == kCC) ? "CC" : "NC")
+      << "_NP" << fLookupTableNP << "_P" << fLookupTablePMin << "-" << fLookupTablePMax
+      << "_M" << std::hex << model_hash << std::dec;
+
+  std::lock_guard<std::mutex> lock(gWfTablesMutex);
+
+  std::map<string, ARWavefunctionTable *>::const_iterator it = gWfTables.find(key.str());
+  if (it != gWfTables.end()) return it->second;
+
+  string filename = "";
+  if (fLookupTableDir.size() > 0) {
+    filename = string(gSystem->ExpandPathName(fLookupTableDir.c_str()))
+             + "/ARWavefunctions_" + key.str() + ".dat";
+  }
+
+  // try the table saved by an earlier job with the same binning
+  ARWavefunctionTable * table = NULL;
+  if (filename.size() > 0) {
+    table = ARWavefunctionTable::Read(filename);
+    double hbar = dxsec.GetConstants().HBar();
+    bool compatible = table &&
+       table->ModelHash() == model_hash &&
+       table->NComp() == 4 &&
+       table->N()     == dxsec.GetNucleus().GetNDensities() &&
+       table->NP()    == fLookupTableNP &&
+       TMath::Abs(table->PMin()*hbar - fLookupTablePMin) < 1E-9 &&
+       TMath::Abs(table->PMax()*hbar - fLookupTablePMax) < 1E-9;
+    if (table && !compatible) {
+      LOG("AlvarezRusoCohPi", pWARN)
+         << "Table in " << filename << " does not match the configuration";
+      delete table;
+      table = NULL;
+    }
+    if (table) {
+      LOG("AlvarezRusoCohPi", pNOTICE)
+         << "Read pion wavefunction table from " << filename;
+    }
+  }
+
+  if (!table) {
+    LOG("AlvarezRusoCohPi", pNOTICE)
+       << "Tabulating pion wavefunctions for Z = " << Z << ", A = " << A
+       << " at " << fLookupTableNP << " pion momenta in ["
+       << fLookupTablePMin << ", " << fLookupTablePMax << "] GeV";
+    table = dxsec.BuildWavefunctionTable(
+                       fLookupTableNP, fLookupTablePMin, fLookupTablePMax);
+    table->SetModelHash(model_hash);
+    if (filename.size() > 0 && table->Write(filename)) {
+      LOG("AlvarezRusoCohPi", pNOTICE)
+         << "Saved pion wavefunction table to " << filename;
+    }
+  }
+
+  gWfTables[key.str()] = table;
+  return table;
+}
+//____________________________________________________________________________
 
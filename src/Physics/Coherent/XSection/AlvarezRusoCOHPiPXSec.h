@@ -7,6 +7,13 @@
 
           Is a concrete implementation of the XSecAlgorithmI interface.
 
+          The pion wavefunctions and in-medium Delta self-energies, which
+          depend only on the nucleus, the pion mass and the pion momentum,
+          can optionally be tabulated in pion momentum (UseLookupTable).
+          Tables are built when a nucleus is first seen, are shared by all
+          instances of the algorithm with the same table configuration and
+          can be saved to / read from a directory (LookupTable-Dir).
+
 \ref      
 
 \author   Steve Dennis
@@ -28,6 +35,8 @@
 
 namespace genie {
 
+namespace alvarezruso { class ARWavefunctionTable; }
+
 class XSecIntegratorI; 
 class Interaction;
 
@@ -51,14 +60,27 @@ public:
 private:
   void LoadConfig(void);
 
+  //-- get (or build, with the input dxsec) the wavefunction table for the
+  //   given nucleus and current
+  const alvarezruso::ARWavefunctionTable * WavefunctionTable(
+          alvarezruso::AlvarezRusoCOHPiPDXSec & dxsec,
+          int Z, int A, alvarezruso::current_t current) const;
+
   //-- private data members loaded from config Registry or set to defaults
 
   const XSecIntegratorI * fXSecIntegrator;
   
   mutable alvarezruso::AlvarezRusoCOHPiPDXSec * fMultidiff;
   mutable const Interaction * fLastInteraction;
+  mutable string fLastInitState;   ///< nucleus, current & probe fMultidiff was built for
+
+  bool         fUseLookupTable;    ///< interpolate pion wavefunctions from tables?
+  unsigned int fLookupTableNP;     ///< number of pion momentum nodes
+  double       fLookupTablePMin;   ///< min pion momentum in table (GeV)
+  double       fLookupTablePMax;   ///< max pion momentum in table (GeV)
+  string       fLookupTableDir;    ///< directory tables are saved to / read from
+
   //Parameters
-  //bool fUseLookupTable;
   //double fa4;
   //double fa5;
   //double fb4;
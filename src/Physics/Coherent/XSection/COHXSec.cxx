@@ -87,44 +87,57 @@ double COHXSec::Integrate(
     LOG("COHXSec", pINFO)
       << "y integration range = [" << yl.min << ", " << yl.max << "]";
 
-    ROOT::Math::IBaseFunctionMultiDim * func = 
-      new utils::gsl::d2XSec_dxdy_E(model, interaction);
-    ROOT::Math::IntegrationMultiDim::Type ig_type = 
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-      
     double abstol = 1; //We mostly care about relative tolerance.
-    ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-    if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-      ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-        dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-      assert(cast);
-      cast->SetMinPts(fGSLMinEval);
-    }
-  
     double kine_min[2] = { xl.min, yl.min };
     double kine_max[2] = { xl.max, yl.max };
-    xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-    delete func;
+
+    if (this->UseBatchIntegrator()) {
+      xsec = this->IntegrateBatch<utils::gsl::d2XSec_dxdy_E>(
+          model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+    } else {
+      ROOT::Math::IBaseFunctionMultiDim * func = 
+        new utils::gsl::d2XSec_dxdy_E(model, interaction);
+      ROOT::Math::IntegrationMultiDim::Type ig_type = 
+        utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+      
+      ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
+      if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
+        ROOT::Math::AdaptiveIntegratorMultiDim * cast =
+          dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
+        assert(cast);
+        cast->SetMinPts(fGSLMinEval);
+      }
+  
+      xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+      delete func;
+    }
   } 
   else if (model->Id().Name() == "genie::BergerSehgalCOHPiPXSec2015")
   {
-    ROOT::Math::IBaseFunctionMultiDim * func = 
-      new utils::gsl::d2XSec_dQ2dy_E(model, interaction);
-    ROOT::Math::IntegrationMultiDim::Type ig_type = 
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-    ROOT::Math::IntegratorMultiDim ig(ig_type);
-    ig.SetRelTolerance(fGSLRelTol);
-    ig.SetFunction(*func);
-    if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-    ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-      dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-      assert(cast);
-      cast->SetMinPts(fGSLMinEval);
-    }
     double kine_min[2] = { Q2l.min, yl.min };
     double kine_max[2] = { Q2l.max, yl.max };
-    xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-    delete func;
+
+    if (this->UseBatchIntegrator()) {
+      double abstol = ROOT::Math::IntegratorMultiDimOptions::DefaultAbsTolerance();
+      xsec = this->IntegrateBatch<utils::gsl::d2XSec_dQ2dy_E>(
+          model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+    } else {
+      ROOT::Math::IBaseFunctionMultiDim * func = 
+        new utils::gsl::d2XSec_dQ2dy_E(model, interaction);
+      ROOT::Math::IntegrationMultiDim::Type ig_type = 
+        utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+      ROOT::Math::IntegratorMultiDim ig(ig_type);
+      ig.SetRelTolerance(fGSLRelTol);
+      ig.SetFunction(*func);
+      if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
+      ROOT::Math::AdaptiveIntegratorMultiDim * cast =
+        dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
+        assert(cast);
+        cast->SetMinPts(fGSLMinEval);
+      }
+      xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+      delete func;
+    }
   }
   else if (model->Id().Name() == "genie::BergerSehgalFMCOHPiPXSec2015") 
   {
@@ -132,23 +145,30 @@ double COHXSec::Integrate(
     tl.min = controls::kASmallNum;
     tl.max = fTMax;
 
-    ROOT::Math::IBaseFunctionMultiDim * func = 
-      new utils::gsl::d2XSec_dQ2dydt_E(model, interaction);
-    ROOT::Math::IntegrationMultiDim::Type ig_type = 
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-    ROOT::Math::IntegratorMultiDim ig(ig_type);
-    ig.SetRelTolerance(fGSLRelTol);
-    ig.SetFunction(*func);
-    if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-    ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-      dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-      assert(cast);
-      cast->SetMinPts(fGSLMinEval);
-    }
     double kine_min[3] = { Q2l.min, yl.min, tl.min };
     double kine_max[3] = { Q2l.max, yl.max, tl.max };
-    xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-    delete func;
+
+    if (this->UseBatchIntegrator()) {
+      double abstol = ROOT::Math::IntegratorMultiDimOptions::DefaultAbsTolerance();
+      xsec = this->IntegrateBatch<utils::gsl::d2XSec_dQ2dydt_E>(
+          model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+    } else {
+      ROOT::Math::IBaseFunctionMultiDim * func = 
+        new utils::gsl::d2XSec_dQ2dydt_E(model, interaction);
+      ROOT::Math::IntegrationMultiDim::Type ig_type = 
+        utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+      ROOT::Math::IntegratorMultiDim ig(ig_type);
+      ig.SetRelTolerance(fGSLRelTol);
+      ig.SetFunction(*func);
+      if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
+      ROOT::Math::AdaptiveIntegratorMultiDim * cast =
+        dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
+        assert(cast);
+        cast->SetMinPts(fGSLMinEval);
+      }
+      xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+      delete func;
+    }
   }
 
   const InitialState & init_state = in->InitState();
@@ -185,6 +205,8 @@ void COHXSec::LoadConfig(void)
 
   fGSLMaxEval  = (unsigned int) max_eval ;
   fGSLMinEval  = (unsigned int) min_eval ;
+  GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0 ) ;
+  GetParamDef( "batch-warm-start", fBatchWarmStart, true ) ;
 
   //-- COH model parameter t_max for t = (q - p_pi)^2
   GetParam("COH-t-max", fTMax ) ;
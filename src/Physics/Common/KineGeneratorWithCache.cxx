@@ -15,17 +15,34 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The cache branches are looked up by a 64-bit hash of the algorithm key and
+   the interaction fingerprint; the string key is built only at the first
+   lookup of each interaction.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The cross section model of the event being processed is kept in per-thread
+   scratch state (XSecModel() / SetXSecModel()), so that one instance can
+   generate kinematics on several threads.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The max xsec and proposal cache branches are created, filled and read
+   under a CacheLock.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   FindMaxXSec() reads the max xsec spline of a cache branch without the
+   lock once it is built: the spline is published to each thread reading the
+   branch under the lock. The lock is only taken to create or fill branches.
 
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <cstdlib>
+#include <cassert>
 #include <map>
 
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
@@ -35,27 +52,64 @@
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/PiecewiseProposal2D.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/CacheBranchProposal.h"
+#include "Framework/Utils/InteractionIndex.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/XSecSplineList.h"
 
 using std::ostringstream;
 using std::map;
 
 using namespace genie;
 
+//___________________________________________________________________________
+namespace {
+
+  // Max xsec splines of the cache branches this thread read under the lock
+  // (0 for branches whose spline is not built yet). They stay valid as long
+  // as the branch is in this thread's cache index, see CacheBranchFx.
+  thread_local InteractionIndex<const Spline *> gThreadMaxXSecSplines;
+
+  // KineGeneratorWithCache::UnitSquareXSec() as a 2-D function
+  class UnitSquareXSecFunc : public ROOT::Math::IBaseFunctionMultiDim
+  {
+  public:
+    UnitSquareXSecFunc(const KineGeneratorWithCache * kg, Interaction * in) :
+      fKineGen(kg), fInteraction(in) {}
+    unsigned int NDim (void) const { return 2; }
+    double DoEval (const double * x) const {
+      return fKineGen->UnitSquareXSec(fInteraction, x[0], x[1]);
+    }
+    ROOT::Math::IBaseFunctionMultiDim * Clone (void) const {
+      return new UnitSquareXSecFunc(fKineGen, fInteraction);
+    }
+  private:
+    const KineGeneratorWithCache * fKineGen;
+    Interaction *                  fInteraction;
+  };
+
+}
+
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fUseImportanceSampling(false)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fUseImportanceSampling(false)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fUseImportanceSampling(false)
 {
 
 }
@@ -63,6 +117,22 @@ EventRecordVisitorI(name, config)
 KineGeneratorWithCache::~KineGeneratorWithCache()
 {
 
+}
+//___________________________________________________________________________
+const XSecAlgorithmI * KineGeneratorWithCache::XSecModel(void) const
+{
+  return static_cast<KineGeneratorScratch *>(this->Scratch())->XSecModel;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::SetXSecModel(
+                                    const XSecAlgorithmI * xsec_model) const
+{
+  static_cast<KineGeneratorScratch *>(this->Scratch())->XSecModel = xsec_model;
+}
+//___________________________________________________________________________
+AlgScratchI * KineGeneratorWithCache::NewScratch(void) const
+{
+  return new KineGeneratorScratch;
 }
 //___________________________________________________________________________
 double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
@@ -121,8 +191,39 @@ double KineGeneratorWithCache::FindMaxXSec(
      return -1.;
   }
 
-  // access the the cache branch
+  // look for a max xsec table, built along with the cross section splines
+  // (stored under MaxXSecSplineKey(), found without building the key)
+  const Spline * spl =
+     XSecSplineList::Instance()->FindSpline(this->Id(), interaction);
+  if( spl ) {
+     if( E >= spl->XMin() && E <= spl->XMax() ) {
+       double tab_max_xsec = spl->Evaluate(E);
+       if(tab_max_xsec > 0) {
+         LOG("Kinematics", pINFO)
+            << "\nTabulated: max xsec (E=" << E << ") = " << tab_max_xsec;
+         return tab_max_xsec;
+       }
+     }
+  }
+
+  // interpolate the published spline of the cache branch, if any, without
+  // locking the cache
+  const Spline * cb_spl = 0;
+  if(Cache::Instance()->FindCacheBranch(this->Id(), interaction) &&
+     gThreadMaxXSecSplines.Find(this->Id(), interaction, cb_spl) && cb_spl) {
+     if( E >= cb_spl->XMin() && E <= cb_spl->XMax()) {
+       double spl_max_xsec = cb_spl->Evaluate(E);
+       LOG("Kinematics", pINFO)
+          << "\nInterpolated: max xsec (E=" << E << ") = " << spl_max_xsec;
+       return spl_max_xsec;
+     }
+  }
+
+  // otherwise access the cache branch (filled at event generation time, so
+  // it is read under the cache lock) and publish its spline to this thread
+  CacheLock lock;
   CacheBranchFx * cb = this->AccessCacheBranch(interaction);
+  gThreadMaxXSecSplines.Insert(this->Id(), interaction, cb->Spl());
 
   // if there are enough points stored in the cache buffer to build a
   // spline, then intepolate
@@ -195,6 +296,7 @@ void KineGeneratorWithCache::CacheMaxXSec(
 {
   LOG("Kinematics", pINFO)
                        << "Adding the computed max{dxsec/dK} value to cache";
+  CacheLock lock;
   CacheBranchFx * cb = this->AccessCacheBranch(interaction);
 
   double E = this->Energy(interaction);
@@ -209,6 +311,7 @@ void KineGeneratorWithCache::CacheMaxXSec(
         cb->CreateSpline();
      }
   }
+  gThreadMaxXSecSplines.Insert(this->Id(), interaction, cb->Spl());
 }
 //___________________________________________________________________________
 double KineGeneratorWithCache::Energy(const Interaction * interaction) const
@@ -230,13 +333,23 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
 
   Cache * cache = Cache::Instance();
 
+  CacheBranchFx * cache_branch = dynamic_cast<CacheBranchFx *> (
+                 cache->FindCacheBranch(this->Id(), interaction));
+  if(cache_branch) return cache_branch;
+
+  // look up again and create the branch with the cache locked, so that no
+  // two threads create it
+  CacheLock lock;
+  cache_branch = dynamic_cast<CacheBranchFx *> (
+                 cache->FindCacheBranch(this->Id(), interaction));
+  if(cache_branch) return cache_branch;
+
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
   string intkey = interaction->AsString();
   string key    = cache->CacheBranchKey(algkey, intkey);
 
-  CacheBranchFx * cache_branch =
-              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  cache_branch = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   if(!cache_branch) {
     //-- create the cache branch at the first pass
     LOG("Kinematics", pINFO) << "No Max d^nXSec/d{K}^n cache branch found";
@@ -246,10 +359,219 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
     cache->AddCacheBranch(key, cache_branch);
   }
   assert(cache_branch);
+  cache->IndexCacheBranch(this->Id(), interaction, cache_branch);
 
   return cache_branch;
 }
 //___________________________________________________________________________
+string KineGeneratorWithCache::MaxXSecSplineKey(
+                                      const Interaction * interaction) const
+{
+// Returns the key of the max xsec table in the XSecSplineList, built as
+// namespace::algorithm/config/interaction (the algorithm being the kinematics
+// generator, the key does not clash with the cross section spline keys)
+
+  return this->Id().Key() + "/" + interaction->AsString();
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::CreateMaxXSecSpline(
+            const XSecAlgorithmI * xsec_alg, const Interaction * interaction,
+            int nknots, double e_min, double e_max) const
+{
+// Computes the max differential xsec (as returned by ComputeMaxXSec()) for
+// the input interaction at a set of energies and stores the resulting table
+// in the XSecSplineList.
+// Knots are distributed logarithmically from the interaction threshold (or
+// the minimum energy for which the max xsec is cached, if higher) to e_max.
+// Each knot keeps the largest of its own and its neighbours' values so that
+// the interpolated table envelopes the max xsec between knots.
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+  string key = this->MaxXSecSplineKey(interaction);
+  if( xssl->SplineExists(key) ) {
+    LOG("Kinematics", pINFO) << "Max xsec table already exists: " << key;
+    return;
+  }
+
+  LOG("Kinematics", pNOTICE) << "Tabulating max xsec for: " << key;
+
+  this->SetXSecModel(xsec_alg);
+
+  Interaction in(*interaction);
+
+  double Ethr = interaction->PhaseSpace().Threshold();
+  double E0   = TMath::Max(e_min, TMath::Max(fEMin, 1.001*Ethr));
+  if(nknots < 2) nknots = 30;
+  if(E0 >= e_max) {
+    LOG("Kinematics", pWARN)
+      << "Empty energy range for max xsec table: [" << E0 << ", " << e_max << "]";
+    return;
+  }
+
+  double * E       = new double[nknots];
+  double * maxxsec = new double[nknots];
+  double * envelop = new double[nknots];
+
+  double dlogE = (TMath::Log10(e_max) - TMath::Log10(E0)) / (nknots-1);
+  double pr_mass = interaction->InitState().Probe()->Mass();
+  for(int i = 0; i < nknots; i++) {
+    E[i] = (i == nknots-1) ?
+       e_max : TMath::Power(10., TMath::Log10(E0) + i * dlogE);
+    double pz = TMath::Sqrt(TMath::Max(0., E[i]*E[i] - pr_mass*pr_mass));
+    TLorentzVector p4(0, 0, pz, E[i]);
+    in.InitStatePtr()->SetProbeP4(p4);
+    maxxsec[i] = 0;
+    try {
+      maxxsec[i] = TMath::Max(0., this->ComputeMaxXSec(&in));
+    }
+    catch (exceptions::EVGThreadException exception) {
+      LOG("Kinematics", pWARN)
+        << "Failed to compute max xsec at E = " << E[i] << ": " << exception;
+    }
+    // the table is indexed by the energy used in event generation
+    E[i] = this->Energy(&in);
+    LOG("Kinematics", pINFO)
+      << "max xsec (E = " << E[i] << ") = " << maxxsec[i];
+  }
+
+  for(int i = 0; i < nknots; i++) {
+    envelop[i] = maxxsec[i];
+    if(i > 0)        envelop[i] = TMath::Max(envelop[i], maxxsec[i-1]);
+    if(i < nknots-1) envelop[i] = TMath::Max(envelop[i], maxxsec[i+1]);
+  }
+
+  xssl->AdoptSpline(key, new Spline(nknots, E, envelop));
+
+  delete [] E;
+  delete [] maxxsec;
+  delete [] envelop;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::UnitSquareXSec(
+          Interaction * /*in*/, double /*u*/, double /*v*/, double * xsec) const
+{
+  if(xsec) *xsec = -1;
+  return -1;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LoadImportanceSamplingConfig(void)
+{
+  GetParamDef( "ImportanceSampling",         fUseImportanceSampling, false ) ;
+  GetParamDef( "IS-NCells",                  fISNCells,              10    ) ;
+  GetParamDef( "IS-SafetyFactor",            fISSafetyFactor,        1.2   ) ;
+  GetParamDef( "IS-NEnergyBinsPerDecade",    fISNEBinsPerDecade,     20    ) ;
+  assert(fISNCells > 0 && fISNEBinsPerDecade > 0 && fISSafetyFactor >= 1);
+}
+//___________________________________________________________________________
+PiecewiseProposal2D * KineGeneratorWithCache::Proposal(
+                                              Interaction * interaction) const
+{
+// Returns the importance sampling proposal for the input interaction and for
+// the energy bin containing its energy. The proposal is built at the first
+// call, from scans of UnitSquareXSec() at the current energy and at both
+// edges of the energy bin, and it is kept in the cache.
+
+  Cache * cache = Cache::Instance();
+
+  // the proposals are added at event generation time: look up, build & add
+  // them with the cache locked, so that each is built once
+  CacheLock lock;
+
+  CacheBranchProposal * cb = dynamic_cast<CacheBranchProposal *> (
+       cache->FindCacheBranch(this->Id(), interaction, "proposal"));
+  if(!cb) {
+    string algkey = this->Id().Key();
+    string intkey = interaction->AsString();
+    string key    = cache->CacheBranchKey(algkey, intkey) + "/proposal";
+
+    cb = dynamic_cast<CacheBranchProposal *> (cache->FindCacheBranch(key));
+    if(!cb) {
+      LOG("Kinematics", pINFO) << "Creating cache branch - key = " << key;
+      cb = new CacheBranchProposal("d^nXSec/d^n{K} proposal over phase space");
+      cache->AddCacheBranch(key, cb);
+    }
+    cache->IndexCacheBranch(this->Id(), interaction, cb, "proposal");
+  }
+
+  double E = this->Energy(interaction);
+  int ebin = TMath::FloorNint(fISNEBinsPerDecade * TMath::Log10(E));
+
+  PiecewiseProposal2D * proposal = cb->Proposal(ebin);
+  if(!proposal) {
+    double Ebin[3] = {
+      E,
+      TMath::Power(10., double(ebin)   / fISNEBinsPerDecade),
+      TMath::Power(10., double(ebin+1) / fISNEBinsPerDecade)
+    };
+    LOG("Kinematics", pNOTICE)
+      << "Building importance sampling proposal for E = [" << Ebin[1]
+      << ", " << Ebin[2] << "] for " << interaction->AsString();
+    proposal = new PiecewiseProposal2D(fISNCells, fISNCells);
+    for(int i = 0; i < 3; i++) {
+      Interaction in(*interaction);
+      if(i > 0) this->SetEnergy(&in, Ebin[i]);
+      UnitSquareXSecFunc func(this, &in);
+      proposal->Build(func, fISSafetyFactor);
+    }
+    cb->AddProposal(ebin, proposal);
+  }
+  return proposal;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::SetEnergy(Interaction * in, double E) const
+{
+// Rescales the probe momentum of the input interaction (keeping its
+// direction, mass and the hit nucleon) so that Energy() is ~E. Energy() is
+// linear in the probe momentum for massless probes; a few iterations take
+// care of massive ones
+
+  InitialState * init_state = in->InitStatePtr();
+  double m = init_state->Probe()->Mass();
+  for(int iter = 0; iter < 3; iter++) {
+    double Ecurr = this->Energy(in);
+    if(Ecurr <= 0) return;
+    TLorentzVector * p4 = init_state->GetProbeP4(kRfLab);
+    TVector3 p3 = p4->Vect() * (E / Ecurr);
+    delete p4;
+    init_state->SetProbeP4(
+        TLorentzVector(p3, TMath::Sqrt(p3.Mag2() + m*m)));
+    if(m <= 0) return;
+  }
+}
+//___________________________________________________________________________
+bool KineGeneratorWithCache::ImportanceSamplingTrial(Interaction * interaction,
+                     PiecewiseProposal2D * proposal, double & xsec) const
+{
+// Generates kinematics according to the input proposal, sets them to the
+// input interaction and accepts them with probability f/bound
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double u = 0, v = 0;
+  double bound = proposal->Generate(rnd->RndKine(), u, v);
+  double f     = this->UnitSquareXSec(interaction, u, v, &xsec);
+
+  if(f > bound) {
+    proposal->RaiseBound(u, v, fISSafetyFactor * f);
+    LOG("Kinematics", pWARN)
+       << "xsec: (curr) = " << f << " > (proposal) = " << bound
+       << " for " << *interaction << "\n"
+       << proposal->NViolations() << " proposal bound violation(s) in "
+       << proposal->NGenerated() << " trials so far";
+  }
+
+  bool accept = (bound * rnd->RndKine().Rndm() < f);
+  if(accept) {
+    proposal->Accepted();
+    LOG("Kinematics", pINFO)
+      << "Importance sampling: " << proposal->NEvaluations()
+      << " + " << proposal->NGenerated() << " xsec evaluations for "
+      << proposal->NAccepted() << " accepted events ("
+      << proposal->NViolations() << " bound violations)";
+  }
+  return accept;
+}
+//___________________________________________________________________________
 void KineGeneratorWithCache::AssertXSecLimits(
          const Interaction * interaction, double xsec, double xsec_max) const
 {
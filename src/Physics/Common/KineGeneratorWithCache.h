@@ -12,6 +12,14 @@
           The various super-classes should implement the ComputeMaxXSec(...)
           method for computing the maximum xsec in case it has not already
           being pushed into the cache at a previous iteration.
+          The max xsec can also be tabulated vs energy in advance (see
+          CreateMaxXSecSpline(), called by gmkspl) and saved / loaded along
+          with the cross section splines. If such a table is loaded, it is
+          used in preference to the cache.
+          Optionally, kinematics can be importance sampled using a
+          piecewise-constant proposal instead of a single max xsec (see
+          UnitSquareXSec()). The proposals are built adaptively for each
+          interaction & energy bin and kept in the cache.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -29,6 +37,7 @@
 
 #include <string>
 
+#include "Framework/Algorithm/AlgScratchI.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Utils/Range1.h"
@@ -38,10 +47,35 @@ using std::string;
 namespace genie {
 
 class CacheBranchFx;
+class CacheBranchProposal;
+class PiecewiseProposal2D;
 class XSecAlgorithmI;
 
+// Per-thread state of KineGeneratorWithCache (see AlgScratchI). Concrete
+// generators with per-event state of their own extend it in NewScratch().
+class KineGeneratorScratch : public AlgScratchI {
+public:
+  KineGeneratorScratch() : XSecModel(0) {}
+  const XSecAlgorithmI * XSecModel; ///< xsec model of the current event
+};
+
 class KineGeneratorWithCache : public EventRecordVisitorI {
 
+public:
+  // tabulate ComputeMaxXSec() vs energy and store it in the XSecSplineList
+  void CreateMaxXSecSpline (const XSecAlgorithmI * xsec_alg,
+                            const Interaction * in,
+                            int nknots, double e_min, double e_max) const;
+
+  // importance sampling: concrete generators supporting it map the unit
+  // square (u,v) onto their kinematic variables, over the kinematic limits
+  // of the input interaction, set these kinematics to the input interaction
+  // and return the differential xsec times the Jacobian of the mapping (the
+  // xsec in the generator's own phase space is returned in xsec, if not
+  // null). Returns a negative value if not supported.
+  virtual double UnitSquareXSec (Interaction * in, double u, double v,
+                                 double * xsec = 0) const;
+
 protected:
   KineGeneratorWithCache();
   KineGeneratorWithCache(string name);
@@ -55,15 +89,35 @@ protected:
   virtual double Energy         (const Interaction * in) const;
 
   virtual CacheBranchFx * AccessCacheBranch (const Interaction * in) const;
+  virtual string          MaxXSecSplineKey  (const Interaction * in) const;
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
-  mutable const XSecAlgorithmI * fXSecModel;
+  // importance sampling: the proposal for the energy bin of the input
+  // interaction (built at the first call) and a single accept/reject trial
+  void                  LoadImportanceSamplingConfig (void);
+  PiecewiseProposal2D * Proposal                     (Interaction * in) const;
+  void                  SetEnergy                    (Interaction * in, double E) const;
+  bool                  ImportanceSamplingTrial      (Interaction * in,
+                                                      PiecewiseProposal2D * proposal,
+                                                      double & xsec) const;
+
+  // the cross section model of the event being processed: kept per thread
+  // (see AlgScratchI), as a single instance is shared by all event generation
+  // threads
+  const XSecAlgorithmI * XSecModel    (void) const;
+  void                   SetXSecModel (const XSecAlgorithmI * xsec_model) const;
+  virtual AlgScratchI *  NewScratch   (void) const;
 
   double fSafetyFactor;         ///< maxxsec -> maxxsec * safety_factor
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                 ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;    ///< uniform over allowed phase space + event weight?
+
+  bool   fUseImportanceSampling; ///< importance sample kinematics with a piecewise-constant proposal?
+  int    fISNCells;              ///< number of proposal cells per dimension
+  double fISSafetyFactor;        ///< proposal bound = safety factor * max xsec in cell
+  int    fISNEBinsPerDecade;     ///< number of energy bins per decade (one proposal each)
 };
 
 }      // genie namespace
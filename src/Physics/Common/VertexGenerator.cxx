@@ -26,6 +26,9 @@
    can easily be reused by other classes. (Specifically LwlynSmithQELCCPXSec
    and NievesQELCCPXSec to generate a position before calculating the xsec
    when making splines).
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Select the vertex radius by inverting the tabulated radial distribution
+   (utils::nuclear::InverseRadialCDF()) rather than with rejection sampling.
 */
 //____________________________________________________________________________
 
@@ -33,8 +36,6 @@
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
-#include "Framework/Conventions/Controls.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/Common/VertexGenerator.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
@@ -163,52 +164,19 @@ TVector3 VertexGenerator::GenerateVertex(const Interaction * interaction,
       //
       LOG("Vtx", pINFO) 
 	<< "Generating vertex according to a realistic nuclear density profile";
-      // get inputs to the rejection method
-      double ymax = -1;
-      double rmax = 3*R;
-      double dr   = R/40.;
-      for(double r = 0; r < rmax; r+=dr) { 
-	ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,(int)A)); 
-      }
-      ymax *= 1.2;
-        
-      // select a vertex using the rejection method
-      unsigned int iter = 0;
-      while(1) {
-	iter++;
-	
-	// throw an exception if it hasn't find a solution after many attempts
-	if(iter > kRjMaxIterations) {
-	  LOG("Vtx", pWARN)
-	    << "Couldn't generate a vertex position after " << iter << " iterations";
-	  //evrec->EventFlags()->SetBitNumber(kGenericErr, true);
-	  genie::exceptions::EVGThreadException exception;
-	  exception.SetReason("Couldn't generate vertex");
-	  exception.SwitchOnFastForward();
-	  throw exception;
-	}
-	
-	double r = rmax * rnd->RndFsi().Rndm();
-	double t = ymax * rnd->RndFsi().Rndm();
-	double y = r*r * utils::nuclear::Density(r,(int)A);
-	if(y > ymax) {
-	  LOG("Vtx", pERROR)
-	    << "y = " << y << " > ymax = " << ymax 
-	    << " for r = " << r << ", A = " << A;
-	}
-	bool accept = (t < y);
-	if(accept) {
-	  double phi      = 2*kPi * rnd->RndFsi().Rndm();
-	  double cosphi   = TMath::Cos(phi);
-	  double sinphi   = TMath::Sin(phi);
-	  double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-	  double sintheta = TMath::Sqrt(1-costheta*costheta);
-	  vtx.SetX(r*sintheta*cosphi);
-	  vtx.SetY(r*sintheta*sinphi);
-	  vtx.SetZ(r*costheta);
-	  break;
-	}
-      }//w(1)
+      // select the radius by inverting the (tabulated) cumulative
+      // distribution of r^2*density over [0,3R]
+      double r = utils::nuclear::InverseRadialCDF(
+                                 (int)A, 3*R, rnd->RndFsi().Rndm());
+
+      double phi      = 2*kPi * rnd->RndFsi().Rndm();
+      double cosphi   = TMath::Cos(phi);
+      double sinphi   = TMath::Sin(phi);
+      double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+      double sintheta = TMath::Sqrt(1-costheta*costheta);
+      vtx.SetX(r*sintheta*cosphi);
+      vtx.SetY(r*sintheta*sinphi);
+      vtx.SetZ(r*costheta);
     } //use density?
     
     if(uniform) {
@@ -14,11 +14,21 @@
    Add dummy `UnInhibitDecay(int,TDecayChannel*) const' and `InhibitDecay(int,
    TDecayChannel*) const' methods to conform to the DecayModelI interface.
    To implement soon.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Compile the decay channels of all resonances at configuration and select
+   channels by binary search in the tabulated cumulative BRs.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Keep the decay weight in the per-thread scratch and use a phase space
+   generator local to each decay, so that threads can share the decayer.
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <cassert>
+
 #include <TClonesArray.h>
 #include <TDecayChannel.h>
+#include <THashList.h>
 #include <RVersion.h>
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
 #include <TMCParticle.h>
@@ -29,6 +39,7 @@
 
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/GBuild.h"
 #include "Physics/Decay/BaryonResonanceDecayer.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -39,6 +50,18 @@
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
+
+namespace {
+  // Delta0/Delta+ decay channels with W dependent BRs (Delta -> N gamma)
+  const unsigned int kMaxDeltaNGammaChannels = 8;
+
+  // Per-thread state of BaryonResonanceDecayer: the weight of the last decay
+  class BaryonResonanceDecayerScratch : public AlgScratchI {
+  public:
+    BaryonResonanceDecayerScratch() : Weight(1.) {}
+    double Weight;
+  };
+}
 //____________________________________________________________________________
 BaryonResonanceDecayer::BaryonResonanceDecayer() :
 DecayModelI("genie::BaryonResonanceDecayer")
@@ -153,97 +176,54 @@ TClonesArray* BaryonResonanceDecayer::Decay(const DecayerInputs_t & inp) const
 {  
   if ( ! this->IsHandled(inp.PdgCode) ) return 0;
 
-  //-- Find the particle in the PDG library & quit if it does not exist
-  TParticlePDG * mother = PDGLibrary::Instance()->Find(inp.PdgCode);
+  //-- Find the particle's decay table & quit if it does not exist
+  const DecayTable * table = this->FindDecayTable(inp.PdgCode);
 
-  if(!mother) {
+  if(!table) {
      LOG("Decay", pERROR)
           << "\n *** The particle with PDG-Code = " << inp.PdgCode
-                                         << " was not found in PDGLibrary";
+                       << " was not found in PDGLibrary or has no decay channels";
      return 0;                               
   }  
   LOG("Decay", pINFO)
-       << "Decaying a " << mother->GetName()
+       << "Decaying a " << inp.PdgCode
                         << " with P4 = " << utils::print::P4AsString(inp.P4);
   
   //-- Reset previous weight
-  fWeight = 1.;
+  static_cast<BaryonResonanceDecayerScratch *>(this->Scratch())->Weight = 1.;
 
   //-- Get the resonance mass W (generally different from the mass associated
   //   with the input pdg_code, since the it is produced off the mass shell)
   double W = inp.P4->M();
   LOG("Decay", pINFO) << "Available mass W = " << W;
   
-  //-- Get all decay channels
-  TObjArray * decay_list = mother->DecayList();
-  unsigned int nch = decay_list->GetEntries();
-  LOG("Decay", pINFO)
-               << mother->GetName() << " has: " << nch << " decay channels";
+  unsigned int nch = table->Channel.size();
 
-  //-- Loop over the decay channels (dc) and write down the branching
-  //   ratios to be used for selecting a decay channel.
-  //   Since a baryon resonance can be created at W < Mres, explicitly
-  //   check and inhibit decay channels for which W > final-state-mass
+  //-- Get the cumulative branching ratios to be used for selecting a decay
+  //   channel. Since a baryon resonance can be created at W < Mres, decay
+  //   channels for which W < final-state-mass are suppressed: the
+  //   cumulative BRs of the channels open at W were tabulated for each
+  //   interval between consecutive channel thresholds
   
-  double BR[nch], tot_BR = 0;    
- 
+  unsigned int iedge = std::lower_bound(
+       table->Edge.begin(), table->Edge.end(), W) - table->Edge.begin();
+  const double * BR = &(table->CumBR[iedge*nch]);
+
 //------------------ cusomizing ------------------------------
-  if(inp.PdgCode== 2114 || inp.PdgCode==-2114 || inp.PdgCode==2214||inp.PdgCode==-2214){
-	  for(unsigned int ich = 0; ich < nch; ich++) {
-
-     TDecayChannel * ch = (TDecayChannel *) decay_list->At(ich);
-     double fsmass = this->FinalStateMass(ch);
-
-     if(fsmass < W) {
-       SLOG("Decay", pDEBUG)
-               << "Using channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-       tot_BR += BaryonResonanceDecayer::DealsDeltaNGamma(inp.PdgCode, ich, W);
-     } else {       
-       SLOG("Decay", pINFO)
-               << "Suppresing channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-     }
-     BR[ich] = tot_BR;
-  }
-  }  else {
-  for(unsigned int ich = 0; ich < nch; ich++) {
-
-     TDecayChannel * ch = (TDecayChannel *) decay_list->At(ich);
-     double fsmass = this->FinalStateMass(ch);
-
-     if(fsmass < W) {
-       SLOG("Decay", pDEBUG)
-               << "Using channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-       tot_BR += ch->BranchingRatio();
-     } else {       
-       SLOG("Decay", pINFO)
-               << "Suppresing channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
+  double BRDeltaNGamma[kMaxDeltaNGammaChannels];
+  if(table->DeltaNGamma) {
+     double tot = 0.;
+     for(unsigned int ich = 0; ich < nch; ich++) {
+        if(table->Threshold[ich] < W) {
+          tot += BaryonResonanceDecayer::DealsDeltaNGamma(inp.PdgCode, ich, W);
+        }
+        BRDeltaNGamma[ich] = tot;
      }
-     BR[ich] = tot_BR;
-  }
+     BR = BRDeltaNGamma;
   }
 //--------------customizing ends --------------------------------------------------
-/*  for(unsigned int ich = 0; ich < nch; ich++) {
-
-     TDecayChannel * ch = (TDecayChannel *) decay_list->At(ich);
-     double fsmass = this->FinalStateMass(ch);
-
-     if(fsmass < W) {
-       SLOG("Decay", pDEBUG)
-               << "Using channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-       tot_BR += ch->BranchingRatio();
-     } else {       
-       SLOG("Decay", pINFO)
-               << "Suppresing channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-     }
-     BR[ich] = tot_BR;
-  }
-*/
+
+  double tot_BR = BR[nch-1];
   if(tot_BR==0) {
     SLOG("Decay", pWARN) 
       << "None of the " << nch << " decay chans is available @ W = " << W;
@@ -251,23 +231,19 @@ TClonesArray* BaryonResonanceDecayer::Decay(const DecayerInputs_t & inp) const
   }
 
   //-- Select a resonance based on the branching ratios
-  unsigned int ich = 0, sel_ich; // id of selected decay channel
   RandomGen * rnd = RandomGen::Instance();
   double x = tot_BR * rnd->RndDec().Rndm();
-  do { 
-    sel_ich = ich;
-    
-  } while (x > BR[ich++]);
-
-  TDecayChannel * ch = (TDecayChannel *) decay_list->At(sel_ich);
+  unsigned int sel_ich = std::lower_bound(BR, BR+nch, x) - BR;
+  if(sel_ich >= nch) sel_ich = nch-1;
 
   LOG("Decay", pINFO) 
-    << "Selected " << ch->NDaughters() << "-particle decay chan (" 
-    << sel_ich << ") has BR = " << ch->BranchingRatio();
+    << "Selected " << table->First[sel_ich+1]-table->First[sel_ich]
+    << "-particle decay chan (" << sel_ich << ") has BR = " 
+    << table->BR[sel_ich];
 
   //-- Decay the exclusive state and return the particle list
   TLorentzVector p4(*inp.P4);
-  return ( this->DecayExclusive(inp.PdgCode, p4, ch) );
+  return ( this->DecayExclusive(inp.PdgCode, p4, *table, sel_ich) );
 }
 //____________________________________________________________________________
 void BaryonResonanceDecayer::Initialize(void) const
@@ -276,13 +252,13 @@ void BaryonResonanceDecayer::Initialize(void) const
 }
 //____________________________________________________________________________
 TClonesArray * BaryonResonanceDecayer::DecayExclusive(
-     int pdg_code, TLorentzVector & p, TDecayChannel * ch) const
+     int pdg_code, TLorentzVector & p, const DecayTable & table, unsigned int ich) const
 {
   //-- Get the final state mass spectrum and the particle codes
-  unsigned int nd = ch->NDaughters();
+  unsigned int nd = table.First[ich+1] - table.First[ich];
 
-  int    pdgc[nd];
-  double mass[nd];
+  const int    * pdgc = &(table.DaughterPdg [table.First[ich]]);
+  const double * mass = &(table.DaughterMass[table.First[ich]]);
 
 // Customized part
   bool twobody=false;      // flag of expected channel Delta->pion+nucleon
@@ -292,13 +268,6 @@ TClonesArray * BaryonResonanceDecayer::DecayExclusive(
 
   for(unsigned int iparticle = 0; iparticle < nd; iparticle++) {
 
-     int daughter_code = ch->DaughterPdgCode(iparticle);
-     TParticlePDG * daughter = PDGLibrary::Instance()->Find(daughter_code);
-     assert(daughter);
-
-     pdgc[iparticle] = daughter_code;
-     mass[iparticle] = daughter->Mass();
-
 // Customized part--find out the expected channel Delta->pion+nucleon
 	 if(nd==2 && (pdg_code==2224 || pdg_code==2214 || pdg_code==2114) ){
 	    if(pdgc[iparticle]==211 || pdgc[iparticle]==111 ||pdgc[iparticle]==-211){ npi=npi+1;}
@@ -308,17 +277,19 @@ TClonesArray * BaryonResonanceDecayer::DecayExclusive(
 	 }
 //////////////////////////////////////
 
-     SLOG("Decay", pINFO)
-       << "+ daughter[" << iparticle << "]: "
-        << daughter->GetName() << " (pdg-code = "
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+     SLOG("Decay", pDEBUG)
+       << "+ daughter[" << iparticle << "]: (pdg-code = "
           << pdgc[iparticle] << ", mass = " << mass[iparticle] << ")";
+#endif
   }
 
   //-- Decay the resonance using an N-body phase space generator
   //   The particle will be decayed in its rest frame and then the daughters
   //   will be boosted back to the original frame.
 
-  bool is_permitted = fPhaseSpaceGenerator.SetDecay(p, nd, mass);
+  TGenPhaseSpace phase_space_generator;
+  bool is_permitted = phase_space_generator.SetDecay(p, nd, mass);
   assert(is_permitted);
 
 // Customized part--define variables for the Wtheta selection---------------
@@ -341,10 +312,10 @@ TClonesArray * BaryonResonanceDecayer::DecayExclusive(
 
 while(1){  //start a loop until break;
 
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
+  //double wmax = phase_space_generator.GetWtMax();
   double wmax = -1;
   for(int i=0; i<50; i++) {
-     double w = fPhaseSpaceGenerator.Generate();
+     double w = phase_space_generator.Generate();
      wmax = TMath::Max(wmax,w);
   }
   assert(wmax>0);
@@ -354,8 +325,9 @@ while(1){  //start a loop until break;
   if(fGenerateWeighted)
   {
      // *** generating weighted decays ***
-     double w = fPhaseSpaceGenerator.Generate();
-     fWeight *= TMath::Max(w/wmax, 1.);
+     double w = phase_space_generator.Generate();
+     static_cast<BaryonResonanceDecayerScratch *>(this->Scratch())->Weight
+        *= TMath::Max(w/wmax, 1.);
   }
   else
   {
@@ -370,7 +342,7 @@ while(1){  //start a loop until break;
        itry++;
        assert(itry<kMaxUnweightDecayIterations);
 
-       double w  = fPhaseSpaceGenerator.Generate();
+       double w  = phase_space_generator.Generate();
        double gw = wmax * rnd->RndDec().Rndm();
 
        if(w>wmax) {
@@ -390,13 +362,11 @@ while(1){  //start a loop until break;
 
 
   //-- Add the mother particle to the event record (KS=11 as in PYTHIA)
-  TParticlePDG * mother = PDGLibrary::Instance()->Find(pdg_code);
-
   double px   = p.Px();
   double py   = p.Py();
   double pz   = p.Pz();
   double E    = p.Energy();
-  double M    = mother->Mass();
+  double M    = table.Mass;
 
   if(twobody){vcheckdelta.SetPxPyPzE(px,py,pz,E);}  // restore mother particle's 4-momentum.
 
@@ -406,7 +376,7 @@ while(1){  //start a loop until break;
   //-- Add the daughter particles to the event record
   for(unsigned int id = 0; id < nd; id++) {
 
-       TLorentzVector * p4 = fPhaseSpaceGenerator.GetDecay(id);
+       TLorentzVector * p4 = phase_space_generator.GetDecay(id);
        LOG("Decay", pDEBUG)
                << "Adding final state particle PDGC = " << pdgc[id]
                                    << " with mass = " << mass[id] << " GeV";
@@ -451,7 +421,12 @@ while(1){  //start a loop until break;
 //____________________________________________________________________________
 double BaryonResonanceDecayer::Weight(void) const
 {
-  return fWeight;
+  return static_cast<BaryonResonanceDecayerScratch *>(this->Scratch())->Weight;
+}
+//____________________________________________________________________________
+AlgScratchI * BaryonResonanceDecayer::NewScratch(void) const
+{
+  return new BaryonResonanceDecayerScratch;
 }
 //____________________________________________________________________________
 void BaryonResonanceDecayer::InhibitDecay(int pdgc, TDecayChannel * dc) const
@@ -518,5 +493,84 @@ void BaryonResonanceDecayer::LoadConfig(void)
   // note that this variable is not present in any of the xml configuration files
   fGenerateWeighted = false ;
   //GetParam( "generate-weighted", fGenerateWeighted, false );  decomment this line if the variable needs to be taken from configurations
+
+  this->BuildDecayTables();
+}
+//____________________________________________________________________________
+void BaryonResonanceDecayer::BuildDecayTables(void)
+{
+// Compile the decay channels of all baryon resonances in the PDG library
+
+  fDecayTables.clear();
+
+  const THashList * particles = PDGLibrary::Instance()->DBase()->ParticleList();
+  if(!particles) return;
+
+  TIter next(particles);
+  TParticlePDG * particle = 0;
+  while( (particle = (TParticlePDG *) next()) ) {
+
+    int pdgc = particle->PdgCode();
+    if( ! utils::res::IsBaryonResonance(pdgc) ) continue;
+
+    TObjArray * decay_list = particle->DecayList();
+    if(!decay_list) continue;
+    unsigned int nch = decay_list->GetEntries();
+    if(nch == 0) continue;
+
+    DecayTable & table = fDecayTables[pdgc];
+    table.Mass        = particle->Mass();
+    table.DeltaNGamma = (pdgc == 2114 || pdgc == -2114 || 
+                         pdgc == 2214 || pdgc == -2214);
+    table.First.push_back(0);
+
+    for(unsigned int ich = 0; ich < nch; ich++) {
+      TDecayChannel * ch = (TDecayChannel *) decay_list->At(ich);
+      table.Channel  .push_back(ch);
+      table.BR       .push_back(ch->BranchingRatio());
+      table.Threshold.push_back(this->FinalStateMass(ch));
+      for(int id = 0; id < ch->NDaughters(); id++) {
+        int daughter_code = ch->DaughterPdgCode(id);
+        assert(PDGLibrary::Instance()->Find(daughter_code));
+        table.DaughterPdg .push_back(daughter_code);
+        table.DaughterMass.push_back(PDGLibrary::Instance()->Mass(daughter_code));
+      }
+      table.First.push_back(table.DaughterPdg.size());
+    }
+    assert(!table.DeltaNGamma || nch <= kMaxDeltaNGammaChannels);
+
+    table.Edge = table.Threshold;
+    std::sort(table.Edge.begin(), table.Edge.end());
+    table.Edge.erase(
+       std::unique(table.Edge.begin(), table.Edge.end()), table.Edge.end());
+
+    // W in the k-th interval: channels with threshold < W are the ones
+    // with threshold <= Edge[k-1]
+    unsigned int nedge = table.Edge.size();
+    table.CumBR.assign((nedge+1)*nch, 0.);
+    for(unsigned int k = 0; k <= nedge; k++) {
+      double tot_BR = 0;
+      for(unsigned int ich = 0; ich < nch; ich++) {
+        if(k > 0 && table.Threshold[ich] <= table.Edge[k-1]) {
+          tot_BR += table.BR[ich];
+        }
+        table.CumBR[k*nch + ich] = tot_BR;
+      }
+    }
+
+    LOG("Decay", pDEBUG)
+      << "Compiled " << nch << " decay channels for " << particle->GetName();
+  }
+
+  LOG("Decay", pINFO)
+    << "Compiled the decay tables of " << fDecayTables.size() 
+    << " baryon resonances";
+}
+//____________________________________________________________________________
+const BaryonResonanceDecayer::DecayTable * 
+  BaryonResonanceDecayer::FindDecayTable(int pdgc) const
+{
+  map<int, DecayTable>::const_iterator it = fDecayTables.find(pdgc);
+  return (it == fDecayTables.end()) ? 0 : &(it->second);
 }
 //____________________________________________________________________________
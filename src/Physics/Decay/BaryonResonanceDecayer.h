@@ -9,6 +9,13 @@
           an N-body phase space generator. Since the resonance can be produced
           off-shell, decay channels with total-mass > W are suppressed. \n
 
+          The decay channels of all baryon resonances are compiled at
+          configuration into flat tables (daughter codes & masses, channel
+          thresholds and the cumulative BRs of the channels open in each
+          interval between consecutive thresholds), so selecting a channel
+          is a binary search and the ROOT decay tables are not walked or
+          modified per decay. \n
+
           Is a concrete implementation of the DecayModelI interface.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -25,11 +32,17 @@
 #ifndef _BARYON_RESONANCE_DECAYER_H_
 #define _BARYON_RESONANCE_DECAYER_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 #include <TLorentzVector.h>
 
 #include "Physics/Decay/DecayModelI.h"
 
+using std::map;
+using std::vector;
+
 namespace genie {
 
 class BaryonResonanceDecayer : public DecayModelI {
@@ -58,12 +71,31 @@ public:
 
 private:
 
-  void           LoadConfig     (void);
-  TClonesArray * DecayExclusive (int pdgc, TLorentzVector & p, TDecayChannel * ch) const;
-  double         FinalStateMass (TDecayChannel * channel) const;
-
-  mutable TGenPhaseSpace fPhaseSpaceGenerator;
-  mutable double         fWeight;
+  //! Decay channels of one resonance, compiled from its TDecayChannel list
+  struct DecayTable {
+    double                  Mass;       ///< resonance mass from the PDG table
+    vector<TDecayChannel *> Channel;    ///< [nch]
+    vector<double>          BR;         ///< [nch] branching ratios
+    vector<double>          Threshold;  ///< [nch] final state masses
+    vector<unsigned int>    First;      ///< [nch+1] offsets into Daughter*
+    vector<int>             DaughterPdg;
+    vector<double>          DaughterMass;
+    vector<double>          Edge;       ///< distinct thresholds, ascending
+    vector<double>          CumBR;      ///< [(Edge.size()+1) * nch] cumulative
+                                        ///< BRs of the channels open at W, for
+                                        ///< W in each interval between edges
+    bool                    DeltaNGamma;///< BRs depend on W (see DealsDeltaNGamma)
+  };
+
+  void               LoadConfig       (void);
+  void               BuildDecayTables (void);
+  const DecayTable * FindDecayTable   (int pdgc) const;
+  TClonesArray *     DecayExclusive   (int pdgc, TLorentzVector & p,
+                                       const DecayTable & table, unsigned int ich) const;
+  double             FinalStateMass   (TDecayChannel * channel) const;
+  AlgScratchI *      NewScratch       (void) const;
+
+  map<int, DecayTable> fDecayTables;   ///< per resonance PDG code
 
   bool fGenerateWeighted;
 };
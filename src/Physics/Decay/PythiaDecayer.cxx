@@ -22,6 +22,14 @@
    channels, a weight is calculated as w = 1./sum{BR for enabled channels}.
  @ Feb 04, 2010 - CA
    Comment out (unused) code using the fForceDecay flag
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Cache the sum of enabled channel BRs per particle instead of summing the
+   PYTHIA decay table at every decay.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Hold a Pythia6Lock while driving PYTHIA6, which may be shared with
+   hadronization running on other threads.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The weight of the last decay is kept in per-thread scratch state.
 
 */
 //____________________________________________________________________________
@@ -45,6 +53,7 @@
 #include "Physics/Decay/PythiaDecayer.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/Pythia6Lock.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 
 using std::vector;
@@ -56,6 +65,17 @@ using namespace genie;
 extern "C" void py1ent_(int *,  int *, double *, double *, double *);
 extern "C" void pydecy_(int *);
 
+//____________________________________________________________________________
+namespace {
+
+  // Per-thread state of PythiaDecayer: the weight of the last decay
+  class PythiaDecayerScratch : public AlgScratchI {
+  public:
+    PythiaDecayerScratch() : Weight(1.) {}
+    double Weight;
+  };
+}
+
 //____________________________________________________________________________
 PythiaDecayer::PythiaDecayer() :
 DecayModelI("genie::PythiaDecayer")
@@ -88,7 +108,6 @@ bool PythiaDecayer::IsHandled(int code) const
 void PythiaDecayer::Initialize(void) const
 {
   fPythia = TPythia6::Instance();
-  fWeight = 1.;
 
   // sync GENIE/PYTHIA6 seeds
   RandomGen::Instance();
@@ -96,11 +115,14 @@ void PythiaDecayer::Initialize(void) const
 //____________________________________________________________________________
 TClonesArray * PythiaDecayer::Decay(const DecayerInputs_t & inp) const
 {
-  fWeight = 1.; // reset weight
+  double & weight = static_cast<PythiaDecayerScratch *>(this->Scratch())->Weight;
+  weight = 1.; // reset weight
 
   int pdgc = inp.PdgCode;
 
   if ( ! this->IsHandled(pdgc) ) return 0;
+
+  Pythia6Lock lock;
   
   int kc   = fPythia->Pycomp(pdgc);
   int mdcy = fPythia->GetMDCY(kc, 1);
@@ -111,7 +133,16 @@ TClonesArray * PythiaDecayer::Decay(const DecayerInputs_t & inp) const
     return 0;
   }
 
-  double sumbr = this->SumBR(kc);
+  // sum of enabled channel BRs, recomputed only after channels are
+  // switched on or off by InhibitDecay() / UnInhibitDecay()
+  double sumbr = 0;
+  map<int,double>::const_iterator sumbr_iter = fSumBR.find(kc);
+  if(sumbr_iter != fSumBR.end()) {
+    sumbr = sumbr_iter->second;
+  } else {
+    sumbr = this->SumBR(kc);
+    fSumBR[kc] = sumbr;
+  }
   if(sumbr <= 0) {
     LOG("PythiaDec", pNOTICE)
        << "The sum of enabled "
@@ -120,7 +151,7 @@ TClonesArray * PythiaDecayer::Decay(const DecayerInputs_t & inp) const
     return 0;
   }
 
-  fWeight = 1./sumbr; // update weight to account for inhibited channels
+  weight = 1./sumbr; // update weight to account for inhibited channels
 
   int    ip    = 0;
   double E     = inp.P4->Energy();
@@ -177,14 +208,22 @@ TClonesArray * PythiaDecayer::Decay(const DecayerInputs_t & inp) const
 //____________________________________________________________________________
 double PythiaDecayer::Weight(void) const 
 {
-  return fWeight; 
+  return static_cast<PythiaDecayerScratch *>(this->Scratch())->Weight;
+}
+//____________________________________________________________________________
+AlgScratchI * PythiaDecayer::NewScratch(void) const
+{
+  return new PythiaDecayerScratch;
 }
 //____________________________________________________________________________
 void PythiaDecayer::InhibitDecay(int pdgc, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdgc)) return; 
 
+  Pythia6Lock lock;
+
   int kc = fPythia->Pycomp(pdgc);
+  fSumBR.erase(kc);
 
   if(!dc) {
     LOG("PythiaDec", pINFO)
@@ -207,7 +246,10 @@ void PythiaDecayer::UnInhibitDecay(int pdgc, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdgc)) return; 
 
+  Pythia6Lock lock;
+
   int kc = fPythia->Pycomp(pdgc);
+  fSumBR.erase(kc);
 
   if(!dc) {
     LOG("PythiaDec", pINFO)
@@ -21,10 +21,14 @@
 #ifndef _PYTHIA_DECAYER_I_H_
 #define _PYTHIA_DECAYER_I_H_
 
+#include <map>
+
 #include <TPythia6.h>
 
 #include "Physics/Decay/DecayModelI.h"
 
+using std::map;
+
 namespace genie {
 
 class PythiaDecayer : public DecayModelI {
@@ -54,9 +58,10 @@ private:
   double SumBR                  (int kc) const;
   int    FindPythiaDecayChannel (int kc, TDecayChannel* dc) const;
   bool   MatchDecayChannels     (int ichannel, TDecayChannel * dc) const;
+  AlgScratchI * NewScratch      (void) const;
 
   mutable TPythia6 * fPythia;  ///< PYTHIA6 wrapper class
-  mutable double fWeight;
+  mutable map<int,double> fSumBR; ///< sum of enabled channel BRs per PYTHIA KC code
 //bool fForceDecay;
 };
 
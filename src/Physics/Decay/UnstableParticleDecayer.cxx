@@ -30,11 +30,18 @@
    Solved problem with, say, inhibiting pi0 decay at this module, but having 
    other pi0 decayed deep in pythia when it decays hadrons (eg rho0) having
    pi0 in their decay products.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Remember the decayer selected for each particle code.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The decayer selected for the current particle is a local variable and the
+   decayer per particle code is remembered under a lock, so that an instance
+   can be used by several event generation threads.
 
 */
 //____________________________________________________________________________
 
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 
 #include <RVersion.h>
@@ -67,6 +74,11 @@ using std::ostringstream;
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // guards the lazily filled decayer per particle code map
+  std::mutex gDecayerByPdgMutex;
+}
+
 //___________________________________________________________________________
 UnstableParticleDecayer::UnstableParticleDecayer() :
 EventRecordVisitorI("genie::UnstableParticleDecayer")
@@ -96,8 +108,6 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
   GHepParticle * p = 0;
   unsigned int ipos = 0;
 
-  vector<const DecayModelI *>::const_iterator dec_iter;
-
   //-- Check whether the interaction is off a nuclear target or free nucleon
   //   Depending on whether this module is run before or after the hadron
   //   transport module it would affect the daughters status code
@@ -113,19 +123,9 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
            << "Decaying unstable particle: " << p->Name();
 
         //-- find the first decayer to handle the current particle
-        dec_iter = fDecayers->begin();
-        fCurrDecayer=0;
-        for( ; dec_iter != fDecayers->end(); ++dec_iter) {
-          const DecayModelI * decayer = *dec_iter;
-          LOG("ParticleDecayer", pINFO)
-                 << "Requesting decay from " << decayer->Id().Key();
-          if(decayer->IsHandled(p->Pdg())) {
-            fCurrDecayer = decayer;
-            break;
-          }
-        }
+        const DecayModelI * decayer = this->SelectDecayer(p->Pdg());
         //-- handle the case where no decayer is found
-        if(fCurrDecayer==0) {
+        if(decayer==0) {
            LOG("ParticleDecayer", pWARN) 
             << "Couldn't find a decayer for: " << p->Name() << ". Skipping!";
            continue;        
@@ -140,7 +140,7 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
         dinp.PdgCode = p->Pdg();
         dinp.P4      = &p4;
 
-        TClonesArray * decay_products = fCurrDecayer->Decay(dinp);
+        TClonesArray * decay_products = decayer->Decay(dinp);
 
         //-- Check whether the particle was decayed
         if(decay_products) {
@@ -153,7 +153,7 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
            this->CopyToEventRecord(decay_products, evrec, p, ipos, in_nucleus);
 
            //-- Update the event weight for each weighted particle decay
-           double decay_weight = fCurrDecayer->Weight();
+           double decay_weight = decayer->Weight();
            evrec->SetWeight(evrec->Weight() * decay_weight);
 
            //-- Clean-up decay products
@@ -169,6 +169,31 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
           << "Done finding unstable particles & decaying them!";
 }
 //___________________________________________________________________________
+const DecayModelI * UnstableParticleDecayer::SelectDecayer(int pdgc) const
+{
+// The first decayer to handle the input particle (the choice depends only
+// on the particle code, so it is made once per code)
+
+  std::lock_guard<std::mutex> lock(gDecayerByPdgMutex);
+
+  map<int, const DecayModelI *>::const_iterator it = fDecayerByPdg.find(pdgc);
+  if(it != fDecayerByPdg.end()) return it->second;
+
+  const DecayModelI * selected = 0;
+  vector<const DecayModelI *>::const_iterator dec_iter = fDecayers->begin();
+  for( ; dec_iter != fDecayers->end(); ++dec_iter) {
+    const DecayModelI * decayer = *dec_iter;
+    LOG("ParticleDecayer", pINFO)
+           << "Requesting decay from " << decayer->Id().Key();
+    if(decayer->IsHandled(pdgc)) {
+      selected = decayer;
+      break;
+    }
+  }
+  fDecayerByPdg[pdgc] = selected;
+  return selected;
+}
+//___________________________________________________________________________
 bool UnstableParticleDecayer::ToBeDecayed(GHepParticle * particle) const
 {
    if(particle->Pdg() != 0) {
@@ -300,6 +325,7 @@ void UnstableParticleDecayer::LoadConfig(void)
     delete fDecayers;
   }
   fDecayers = new vector<const DecayModelI *>(ndec);
+  fDecayerByPdg.clear();
 
   for(int idec = 0; idec < ndec; idec++) {
      ostringstream alg_key;
@@ -24,11 +24,13 @@
 #ifndef _UNSTABLE_PARTICLE_DECAYER_H_
 #define _UNSTABLE_PARTICLE_DECAYER_H_
 
+#include <map>
 #include <vector>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 
+using std::map;
 using std::vector;
 
 namespace genie {
@@ -57,6 +59,8 @@ private:
   void  LoadConfig        (void);
   bool  ToBeDecayed       (GHepParticle * particle) const;
   bool  IsUnstable        (GHepParticle * particle) const;
+  const DecayModelI *
+        SelectDecayer     (int pdgc) const;
   void  CopyToEventRecord (TClonesArray * dp, GHepRecord * ev, GHepParticle * p,
                            int mother_pos, bool in_nucleus) const;
 
@@ -64,7 +68,7 @@ private:
   PDGCodeList                    fParticlesToDecay;    ///< list of particles to be decayed
   PDGCodeList                    fParticlesNotToDecay; ///< list of particles for which decay is inhibited
   vector <const DecayModelI *> * fDecayers;            ///< list of all specified decayers
-  mutable const DecayModelI *    fCurrDecayer;         ///< current selected decayer
+  mutable map<int, const DecayModelI *> fDecayerByPdg; ///< decayer selected per particle code
 
   //double fMaxLifetime; ///< define "unstable" particle
 };
@@ -36,6 +36,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/PiecewiseProposal2D.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
@@ -74,7 +75,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- Get the interaction 
   Interaction * interaction = evrec->Summary();
@@ -105,13 +106,21 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
   assert(xl.min>0 && yl.min>0);
 
+  //-- If requested, importance sample the kinematics using a proposal
+  //   built over the (x,y) limits (mapped onto the unit square)
+  PiecewiseProposal2D * proposal = 0;
+  if(fUseImportanceSampling && !fGenerateUniformly) {
+    proposal = this->Proposal(interaction);
+    if(proposal->Integral() <= 0) proposal = 0;
+  }
+
   //-- For the subsequent kinematic selection with the rejection method:
   //   Calculate the max differential cross section or retrieve it from the
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space, or importance sampled, the max xsec is irrelevant
+  double xsec_max = (fGenerateUniformly || proposal) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -133,36 +142,44 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        throw exception;
      }
 
-     //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
-     interaction->KinePtr()->Setx(gx);
-     interaction->KinePtr()->Sety(gy);
-     kinematics::UpdateWQ2FromXY(interaction);
+     //-- importance sampled x,y
+     if(proposal) {
+        accept = this->ImportanceSamplingTrial(interaction, proposal, xsec);
+        gx = interaction->Kine().x();
+        gy = interaction->Kine().y();
+     }
+     else {
+        //-- random x,y
+        gx = xl.min + dx * rnd->RndKine().Rndm();
+        gy = yl.min + dy * rnd->RndKine().Rndm();
+        interaction->KinePtr()->Setx(gx);
+        interaction->KinePtr()->Sety(gy);
+        kinematics::UpdateWQ2FromXY(interaction);
 
-     LOG("DISKinematics", pNOTICE) 
-        << "Trying: x = " << gx << ", y = " << gy 
-        << " (W  = " << interaction->KinePtr()->W()  << ","
-        << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
+        LOG("DISKinematics", pNOTICE) 
+           << "Trying: x = " << gx << ", y = " << gy 
+           << " (W  = " << interaction->KinePtr()->W()  << ","
+           << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
 
-     //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxyfE);
+        //-- compute the cross section for current kinematics
+        xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 
-     //-- decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
-        double t = xsec_max * rnd->RndKine().Rndm();
-	double J = 1;
+        //-- decide whether to accept the current kinematics
+        if(!fGenerateUniformly) {
+           this->AssertXSecLimits(interaction, xsec, xsec_max);
+           double t = xsec_max * rnd->RndKine().Rndm();
+           double J = 1;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-        LOG("DISKinematics", pDEBUG)
-              << "xsec= " << xsec << ", J= " << J << ", Rnd= " << t;
+           LOG("DISKinematics", pDEBUG)
+                 << "xsec= " << xsec << ", J= " << J << ", Rnd= " << t;
 #endif
-        accept = (t < J*xsec);
-     } 
-     else {
-        accept = (xsec>0);
-     }
+           accept = (t < J*xsec);
+        } 
+        else {
+           accept = (xsec>0);
+        }
+     } // importance sampled?
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
@@ -242,6 +259,8 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Importance sample the kinematics with a piecewise-constant proposal?
+    this->LoadImportanceSamplingConfig();
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -323,7 +342,7 @@ double DISKinematicsGenerator::ComputeMaxXSec(
         interaction->KinePtr()->Setx(gx);
         kinematics::UpdateWQ2FromXY(interaction);
 
-        double xsec = fXSecModel->XSec(interaction, kPSxyfE);
+        double xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DISKinematics", pINFO) 
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -349,7 +368,7 @@ double DISKinematicsGenerator::ComputeMaxXSec(
    	     gx = gx - dxn;
              interaction->KinePtr()->Setx(gx);
              kinematics::UpdateWQ2FromXY(interaction);
-             xsec = fXSecModel->XSec(interaction, kPSxyfE);
+             xsec = this->XSecModel()->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
              LOG("DISKinematics", pINFO) 
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -378,10 +397,36 @@ double DISKinematicsGenerator::ComputeMaxXSec(
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("DISKinematics", pDEBUG) << interaction->AsString();
   SLOG("DISKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("DISKinematics", pDEBUG) << "Computed using alg = " << *fXSecModel;
+  SLOG("DISKinematics", pDEBUG) << "Computed using alg = " << *this->XSecModel();
 #endif
 
   return max_xsec;
 }
 //___________________________________________________________________________
+double DISKinematicsGenerator::UnitSquareXSec(
+           Interaction * interaction, double u, double v, double * xsec) const
+{
+// Maps (u,v) onto (x,y) over the x,y limits of the input interaction. The
+// mapping is linear, so the xsec d^2xsec/dxdy is returned (the constant
+// Jacobian is irrelevant for the acceptance)
 
+  if(xsec) *xsec = 0;
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W = kps.Limits(kKVW);
+  if(W.max <=0 || W.min>=W.max) return 0.;
+
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+
+  double gx = xl.min + u * (xl.max - xl.min);
+  double gy = yl.min + v * (yl.max - yl.min);
+  interaction->KinePtr()->Setx(gx);
+  interaction->KinePtr()->Sety(gy);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  double xs = this->XSecModel()->XSec(interaction, kPSxyfE);
+  if(xsec) *xsec = xs;
+  return xs;
+}
+//____________________________________________________________________________
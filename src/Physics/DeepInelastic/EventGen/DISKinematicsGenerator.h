@@ -45,6 +45,10 @@ public :
   void Configure(const Registry & config);
   void Configure(string config);
 
+  // importance sampling: (u,v) -> (x,y) over the x,y limits of 'in'
+  double UnitSquareXSec(Interaction * in, double u, double v,
+                        double * xsec = 0) const;
+
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
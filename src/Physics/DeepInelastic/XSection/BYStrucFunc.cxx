@@ -45,21 +45,15 @@ BYStrucFunc::~BYStrucFunc()
 
 }
 //____________________________________________________________________________
-void BYStrucFunc::Configure(const Registry & config)
+void BYStrucFunc::LoadConfig(void)
 {
-// Overload Algorithm::Configure() to read the config. registry and set
-// private data members.
-// QPMDISStrucFuncBase::Configure() creates the owned PDF object that gets
-// configured with the specified PDFModelI
+// Overload QPMDISStrucFuncBase::LoadConfig() to read the config. registry and
+// set private data members.
+// QPMDISStrucFuncBase::LoadConfig() configures the owned PDF objects with the
+// specified PDFModelI
 // For the ReadBYParams() method see below
 
-  QPMDISStrucFuncBase::Configure(config);
-  this->ReadBYParams();
-}
-//____________________________________________________________________________
-void BYStrucFunc::Configure(string param_set)
-{
-  QPMDISStrucFuncBase::Configure(param_set);
+  QPMDISStrucFuncBase::LoadConfig();
   this->ReadBYParams();
 }
 //____________________________________________________________________________
@@ -31,16 +31,15 @@ public:
   BYStrucFunc(string config);
   virtual ~BYStrucFunc();
 
-  // overload Algorithm::Configure() to read the config. registry
-  // at the algorithm initialization and set private data members
-  void Configure (const Registry & config);
-  void Configure (string param_set);
-
 protected:
 
   void Init         (void);
   void ReadBYParams (void);
 
+  // extend QPMDISStrucFuncBase::LoadConfig() to read the BY parameters
+  // (before the base class tabulates the structure functions, if asked to)
+  void LoadConfig   (void);
+
   // override part of the DISStructureFuncModel implementation
   // to compute all the corrections applied by the Bodek-Yang model.
   double ScalingVar (const Interaction * i) const;
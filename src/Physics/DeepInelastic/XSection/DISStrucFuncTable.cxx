@@ -0,0 +1,100 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TMath.h>
+
+#include "Physics/DeepInelastic/XSection/DISStrucFuncTable.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+DISStrucFuncTable::DISStrucFuncTable(unsigned int ncomp,
+     unsigned int nx,  double xmin,  double xmax,
+     unsigned int nQ2, double Q2min, double Q2max)
+{
+  assert(ncomp > 0 && nx > 1 && nQ2 > 1);
+  assert(xmin  > 0. && xmax  > xmin);
+  assert(Q2min > 0. && Q2max > Q2min);
+
+  fNComp    = ncomp;
+  fNX       = nx;
+  fNQ2      = nQ2;
+  fLogXmin  = TMath::Log(xmin);
+  fDLogX    = (TMath::Log(xmax) - fLogXmin) / (nx - 1);
+  fLogQ2min = TMath::Log(Q2min);
+  fDLogQ2   = (TMath::Log(Q2max) - fLogQ2min) / (nQ2 - 1);
+
+  fValues.assign(fNX * fNQ2 * fNComp, 0.);
+}
+//____________________________________________________________________________
+DISStrucFuncTable::~DISStrucFuncTable()
+{
+
+}
+//____________________________________________________________________________
+double DISStrucFuncTable::X(unsigned int ix) const
+{
+  return TMath::Exp(fLogXmin + ix * fDLogX);
+}
+//____________________________________________________________________________
+double DISStrucFuncTable::Q2(unsigned int iQ2) const
+{
+  return TMath::Exp(fLogQ2min + iQ2 * fDLogQ2);
+}
+//____________________________________________________________________________
+void DISStrucFuncTable::Set(
+          unsigned int ix, unsigned int iQ2, const double * values)
+{
+  assert(ix < fNX && iQ2 < fNQ2);
+
+  double * node = &fValues[(ix * fNQ2 + iQ2) * fNComp];
+  for(unsigned int ic = 0; ic < fNComp; ic++) {
+    node[ic] = values[ic];
+  }
+}
+//____________________________________________________________________________
+bool DISStrucFuncTable::Evaluate(
+                            double x, double Q2, double * values) const
+{
+  if(x <= 0. || Q2 <= 0.) return false;
+
+  double ux = (TMath::Log(x)  - fLogXmin ) / fDLogX;
+  double uQ = (TMath::Log(Q2) - fLogQ2min) / fDLogQ2;
+
+  if(ux < 0. || ux > fNX  - 1) return false;
+  if(uQ < 0. || uQ > fNQ2 - 1) return false;
+
+  unsigned int ix  = TMath::Min((unsigned int) ux, fNX  - 2);
+  unsigned int iQ2 = TMath::Min((unsigned int) uQ, fNQ2 - 2);
+
+  double fx = ux - ix;
+  double fQ = uQ - iQ2;
+
+  double w00 = (1.-fx) * (1.-fQ);
+  double w01 = (1.-fx) * fQ;
+  double w10 = fx * (1.-fQ);
+  double w11 = fx * fQ;
+
+  const double * n00 = &fValues[( ix    * fNQ2 + iQ2    ) * fNComp];
+  const double * n01 = &fValues[( ix    * fNQ2 + iQ2 + 1) * fNComp];
+  const double * n10 = &fValues[((ix+1) * fNQ2 + iQ2    ) * fNComp];
+  const double * n11 = &fValues[((ix+1) * fNQ2 + iQ2 + 1) * fNComp];
+
+  for(unsigned int ic = 0; ic < fNComp; ic++) {
+    values[ic] = w00*n00[ic] + w01*n01[ic] + w10*n10[ic] + w11*n11[ic];
+  }
+  return true;
+}
+//____________________________________________________________________________
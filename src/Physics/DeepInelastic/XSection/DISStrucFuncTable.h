@@ -0,0 +1,69 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::DISStrucFuncTable
+
+\brief    Tabulation of DIS structure functions (or any set of functions of
+          Bjorken x and Q2) on a regular grid in log(x) and log(Q2).
+
+          Each grid node holds NComp() components which are interpolated
+          bilinearly in (log x, log Q2). Evaluate() returns false outside the
+          tabulated range so that the caller can fall back to the direct
+          calculation.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _DIS_STRUC_FUNC_TABLE_H_
+#define _DIS_STRUC_FUNC_TABLE_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class DISStrucFuncTable {
+
+public:
+  DISStrucFuncTable(unsigned int ncomp,
+     unsigned int nx,  double xmin,  double xmax,
+     unsigned int nQ2, double Q2min, double Q2max);
+ ~DISStrucFuncTable();
+
+  unsigned int NComp (void) const { return fNComp; }
+  unsigned int NX    (void) const { return fNX;    }
+  unsigned int NQ2   (void) const { return fNQ2;   }
+
+  //! Kinematics at grid node (ix,iQ2)
+  double X  (unsigned int ix ) const;
+  double Q2 (unsigned int iQ2) const;
+
+  //! Store the NComp() values computed at grid node (ix,iQ2)
+  void Set (unsigned int ix, unsigned int iQ2, const double * values);
+
+  //! Interpolate all components at (x,Q2). Returns false if outside the grid
+  bool Evaluate (double x, double Q2, double * values) const;
+
+private:
+
+  unsigned int   fNComp;
+  unsigned int   fNX;
+  unsigned int   fNQ2;
+  double         fLogXmin;
+  double         fDLogX;
+  double         fLogQ2min;
+  double         fDLogQ2;
+  vector<double> fValues;  ///< [ix][iQ2][icomp]
+};
+
+}      // genie namespace
+
+#endif // _DIS_STRUC_FUNC_TABLE_H_
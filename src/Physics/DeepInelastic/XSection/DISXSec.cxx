@@ -25,6 +25,9 @@
  @ Jan 29, 2013 - CA
    Don't look-up depreciated $GDISABLECACHING environmental variable.
    Use the RunOpt singleton instead.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The free nucleon xsecs are computed under a CacheLock and their cache
+   branch is added once complete.
 
 */
 //____________________________________________________________________________
@@ -133,7 +136,12 @@ double DISXSec::Integrate(
      CacheBranchFx * cache_branch =
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
      if(!cache_branch) {
-         this->CacheFreeNucleonXSec(model,interaction);
+         // compute the free nucleon xsecs with the cache locked, unless
+         // another thread has done so meanwhile
+         CacheLock lock;
+         if(!cache->FindCacheBranch(key)) {
+           this->CacheFreeNucleonXSec(model,interaction);
+         }
          cache_branch =
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
          assert(cache_branch);
@@ -177,17 +185,22 @@ double DISXSec::Integrate(
      double xsec = 0.;
 
      if(phsp_ok) {
-       ROOT::Math::IBaseFunctionMultiDim * func = 
-          new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-       ROOT::Math::IntegrationMultiDim::Type ig_type = 
-           utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-           
        double abstol = 1; //We mostly care about relative tolerance.
-       ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
        double kine_min[2] = { Wl.min, Q2l.min };
        double kine_max[2] = { Wl.max, Q2l.max };
-       xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-       delete func;
+       if(this->UseBatchIntegrator()) {
+         xsec = this->IntegrateBatch<utils::gsl::d2XSec_dWdQ2_E>(
+            model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+       } else {
+         ROOT::Math::IBaseFunctionMultiDim * func = 
+            new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
+         ROOT::Math::IntegrationMultiDim::Type ig_type = 
+             utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+           
+         ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
+         xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+         delete func;
+       }
      }//phase space ok?
 
      LOG("DISXSec", pINFO)  << "XSec[DIS] (E = " << Ev << " GeV) = " << xsec;
@@ -223,6 +236,8 @@ void DISXSec::LoadConfig(void)
 
   fGSLMaxEval  = (unsigned int) max_eval ;
   fGSLMinEval  = (unsigned int) min_eval ;
+  GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0 ) ;
+  GetParamDef( "batch-warm-start", fBatchWarmStart, true ) ;
 
   // Energy range for cached splines
   GetParam( "GVLD-Emin", fVldEmin) ;
@@ -243,7 +258,6 @@ void DISXSec::CacheFreeNucleonXSec(
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   assert(!cache_branch);
   cache_branch = new CacheBranchFx("DIS XSec");
-  cache->AddCacheBranch(key, cache_branch);
 
   // Tweak interaction to be on a free nucleon target
   Target * target = interaction->InitStatePtr()->TgtPtr();
@@ -302,7 +316,14 @@ void DISXSec::CacheFreeNucleonXSec(
           (Q2l.min >= 0. && Q2l.max >= 0. && Q2l.max >= Q2l.min &&
             Wl.min >= 0. &&  Wl.max >= 0. &&  Wl.max >=  Wl.min);
 
-       if(phsp_ok) {
+       if(phsp_ok && this->UseBatchIntegrator()) {
+         double abstol = 1; //We mostly care about relative tolerance.
+         double kine_min[2] = { Wl.min, Q2l.min };
+         double kine_max[2] = { Wl.max, Q2l.max };
+         xsec = this->IntegrateBatch<utils::gsl::d2XSec_dWdQ2_E>(
+            model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+       }
+       else if(phsp_ok) {
          ROOT::Math::IntegrationMultiDim::Type ig_type = 
              utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
          double abstol = 1; //We mostly care about relative tolerance.
@@ -330,6 +351,9 @@ void DISXSec::CacheFreeNucleonXSec(
   // Create the spline
   cache_branch->CreateSpline();
 
+  // Add the branch to the cache once complete: it is read without locking
+  cache->AddCacheBranch(key, cache_branch);
+
   delete [] E;
   delete func;
 }
@@ -18,11 +18,17 @@
  @ Jan 29, 2013 - CA
    Don't look-up depreciated $GDISABLECACHING environmental variable.
    Use the RunOpt singleton instead.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The structure functions are computed in a local object rather than in a
+   mutable data member, so that an instance can be used by several threads.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The DIS/RES join suppression factors are cached under a CacheLock.
 
 */
 //____________________________________________________________________________
 
 #include <sstream>
+#include <vector>
 
 #include <TMath.h>
 #include <TH1D.h>
@@ -50,6 +56,7 @@
 #include "Framework/Utils/CacheBranchFx.h"
 
 using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 using namespace genie::constants;
@@ -90,11 +97,6 @@ double QPMDISPXSec::XSec(
   double x     = kinematics.x();
   double y     = kinematics.y();
 
-  double E2    = E    * E;
-  double ml2   = ml   * ml;
-  double ml4   = ml2  * ml2;
-  double Mnuc2 = Mnuc * Mnuc;
-
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DISPXSec", pDEBUG)  
    << "Computing d2xsec/dxdy @ E = " << E << ", x = " << x << ", y = " << y;
@@ -107,60 +109,20 @@ double QPMDISPXSec::XSec(
   int sign = (is_nubar_cc) ? -1 : 1;
 
   // Calculate the DIS structure functions
-  fDISSF.Calculate(interaction); 
+  DISStructureFunc dis_sf;
+  dis_sf.SetModel(fDISSFModel);
+  dis_sf.Calculate(interaction);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISPXSec", pDEBUG) << fDISSF;
+  LOG("DISPXSec", pDEBUG) << dis_sf;
 #endif
 
   //
   // Compute the differential cross section
   //
 
-  double g2 = kGF2;
-  // For EM interaction replace  G_{Fermi} with :
-  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
-  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
-  // ISBN 0-8053-6021-2, p.112 (6.3.57)
-  // Also, take int account that the photon propagator is 1/p^2 but the
-  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
-  // Mass_{W}^4 / q^4
-  // So, overall:
-  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
-  //
-  double Q2 = utils::kinematics::XYtoQ2(E,Mnuc,x,y);
-  double Q4 = Q2*Q2;
-  if(proc_info.IsEM()) {
-    g2 = kAem2 * kPi2 / (2.0 * fSin48w * Q4); 
-  }
-  if (proc_info.IsWeakCC()) {
-    g2 = kGF2 * kMw2 * kMw2 / TMath::Power((Q2 + kMw2), 2);
-  } else if (proc_info.IsWeakNC()) {
-    g2 = kGF2 * kMz2 * kMz2 / TMath::Power((Q2 + kMz2), 2);
-  }
-  double front_factor = (g2*Mnuc*E) / kPi;
-
-  // Build all dxsec/dxdy terms
-  double term1 = y * ( x*y + ml2/(2*E*Mnuc) );
-  double term2 = 1 - y - Mnuc*x*y/(2*E) - ml2/(4*E2);
-  double term3 = sign * (x*y*(1-y/2) - y*ml2/(4*Mnuc*E));
-  double term4 = x*y*ml2/(2*Mnuc*E) + ml4/(4*Mnuc2*E2);
-  double term5 = -1.*ml2/(2*Mnuc*E);
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISPXSec", pDEBUG)  
-    << "\nd2xsec/dxdy ~ (" << term1 << ")*F1+(" << term2 << ")*F2+(" 
-                  << term3 << ")*F3+(" << term4 << ")*F4+(" << term5 << ")*F5";
-#endif
-
-  term1 *= fDISSF.F1();
-  term2 *= fDISSF.F2();
-  term3 *= fDISSF.F3();
-  term4 *= fDISSF.F4();
-  term5 *= fDISSF.F5();
-
-  double xsec = front_factor * (term1 + term2 + term3 + term4 + term5);
-  xsec = TMath::Max(xsec,0.);
+  double xsec = this->FreeNucleonXSec(E, ml, Mnuc, sign, proc_info, x, y,
+     dis_sf.F1(), dis_sf.F2(), dis_sf.F3(), dis_sf.F4(), dis_sf.F5());
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DISPXSec", pINFO)
@@ -210,6 +172,151 @@ double QPMDISPXSec::XSec(
   return xsec;
 }
 //____________________________________________________________________________
+void QPMDISPXSec::BatchXSec(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    unsigned int npoints, unsigned int nkv, const KineVar_t * kv,
+    const double * kine, double * xsec) const
+{
+// Computes the xsec at a batch of points. The structure functions are
+// computed for all points first and then combined in a single arithmetic
+// loop, and the inclusive charm production xsec to be subtracted is also
+// computed as a batch.
+
+  for(unsigned int i = 0; i < npoints; i++) xsec[i] = 0.;
+  if(npoints == 0) return;
+  if(! this -> ValidProcess(interaction) ) return;
+
+  Interaction in(*interaction);
+  in.CopyFlags(*interaction);
+  Kinematics * kinematics = in.KinePtr();
+  const InitialState & init_state = in.InitState();
+  const ProcessInfo &  proc_info  = in.ProcInfo();
+  const Target & target = init_state.Tgt();
+
+  double E     = init_state.ProbeE(kRfHitNucRest);
+  double ml    = in.FSPrimLepton()->Mass();
+  double Mnuc  = target.HitNucMass();
+
+  bool is_nubar_cc = pdg::IsAntiNeutrino(init_state.ProbePdg()) &&
+                     proc_info.IsWeakCC();
+  int sign = (is_nubar_cc) ? -1 : 1;
+
+  // structure functions, D/R join factors & Jacobians at each point
+  vector<bool>   valid(npoints, false);
+  vector<double> x(npoints, 0.), y(npoints, 0.);
+  vector<double> F1(npoints, 0.), F2(npoints, 0.), F3(npoints, 0.),
+                 F4(npoints, 0.), F5(npoints, 0.);
+  vector<double> factor(npoints, 1.);
+  for(unsigned int i = 0; i < npoints; i++) {
+    for(unsigned int j = 0; j < nkv; j++) {
+      kinematics->SetKV(kv[j], kine[i*nkv + j]);
+    }
+    if(! this -> ValidKinematics(&in) ) continue;
+    valid[i] = true;
+    x[i] = kinematics->x();
+    y[i] = kinematics->y();
+    DISStructureFunc dis_sf;
+    dis_sf.SetModel(fDISSFModel);
+    dis_sf.Calculate(&in);
+    F1[i] = dis_sf.F1();
+    F2[i] = dis_sf.F2();
+    F3[i] = dis_sf.F3();
+    F4[i] = dis_sf.F4();
+    F5[i] = dis_sf.F5();
+    if(fUsingDisResJoin) {
+      factor[i] *= this->DISRESJoinSuppressionFactor(&in);
+    }
+    if(kps!=kPSxyfE) {
+      factor[i] *= utils::kinematics::Jacobian(&in,kPSxyfE,kps);
+    }
+  }
+
+  // free nucleon xsec
+  for(unsigned int i = 0; i < npoints; i++) {
+    if(!valid[i]) continue;
+    xsec[i] = factor[i] * this->FreeNucleonXSec(
+       E, ml, Mnuc, sign, proc_info, x[i], y[i],
+       F1[i], F2[i], F3[i], F4[i], F5[i]);
+  }
+
+  // If requested return the free nucleon xsec even for input nuclear tgt
+  if( in.TestBit(kIAssumeFreeNucleon) ) return;
+
+  // Compute nuclear cross section & apply scaling
+  int nucpdgc = target.HitNucPdg();
+  int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N();
+  for(unsigned int i = 0; i < npoints; i++) {
+    xsec[i] *= (NNucl * fScale);
+  }
+
+  // Subtract the inclusive charm production cross section
+  vector<double> xsec_charm(npoints, 0.);
+  in.ExclTagPtr()->SetCharm();
+  fCharmProdModel->BatchXSec(&in, kps, npoints, nkv, kv, kine, &xsec_charm[0]);
+  for(unsigned int i = 0; i < npoints; i++) {
+    if(!valid[i]) continue;
+    xsec[i] = TMath::Max(0., xsec[i]-xsec_charm[i]);
+  }
+}
+//____________________________________________________________________________
+double QPMDISPXSec::FreeNucleonXSec(
+    double E, double ml, double Mnuc, int sign, const ProcessInfo & proc_info,
+    double x, double y,
+    double F1, double F2, double F3, double F4, double F5) const
+{
+  double E2    = E    * E;
+  double ml2   = ml   * ml;
+  double ml4   = ml2  * ml2;
+  double Mnuc2 = Mnuc * Mnuc;
+
+  double g2 = kGF2;
+  // For EM interaction replace  G_{Fermi} with :
+  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
+  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
+  // ISBN 0-8053-6021-2, p.112 (6.3.57)
+  // Also, take int account that the photon propagator is 1/p^2 but the
+  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
+  // Mass_{W}^4 / q^4
+  // So, overall:
+  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
+  //
+  double Q2 = utils::kinematics::XYtoQ2(E,Mnuc,x,y);
+  double Q4 = Q2*Q2;
+  if(proc_info.IsEM()) {
+    g2 = kAem2 * kPi2 / (2.0 * fSin48w * Q4); 
+  }
+  if (proc_info.IsWeakCC()) {
+    g2 = kGF2 * kMw2 * kMw2 / TMath::Power((Q2 + kMw2), 2);
+  } else if (proc_info.IsWeakNC()) {
+    g2 = kGF2 * kMz2 * kMz2 / TMath::Power((Q2 + kMz2), 2);
+  }
+  double front_factor = (g2*Mnuc*E) / kPi;
+
+  // Build all dxsec/dxdy terms
+  double term1 = y * ( x*y + ml2/(2*E*Mnuc) );
+  double term2 = 1 - y - Mnuc*x*y/(2*E) - ml2/(4*E2);
+  double term3 = sign * (x*y*(1-y/2) - y*ml2/(4*Mnuc*E));
+  double term4 = x*y*ml2/(2*Mnuc*E) + ml4/(4*Mnuc2*E2);
+  double term5 = -1.*ml2/(2*Mnuc*E);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISPXSec", pDEBUG)  
+    << "\nd2xsec/dxdy ~ (" << term1 << ")*F1+(" << term2 << ")*F2+(" 
+                  << term3 << ")*F3+(" << term4 << ")*F4+(" << term5 << ")*F5";
+#endif
+
+  term1 *= F1;
+  term2 *= F2;
+  term3 *= F3;
+  term4 *= F4;
+  term5 *= F5;
+
+  double xsec = front_factor * (term1 + term2 + term3 + term4 + term5);
+  xsec = TMath::Max(xsec,0.);
+
+  return xsec;
+}
+//____________________________________________________________________________
 double QPMDISPXSec::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
@@ -292,44 +399,50 @@ double QPMDISPXSec::DISRESJoinSuppressionFactor(
     // and cache DIS xsec suppression factors
     bool non_zero=false;
     if(!cbr) {
-      LOG("DISXSec", pNOTICE) 
-                        << "\n ** Creating cache branch - key = " << key;
-
-      cbr = new CacheBranchFx("DIS Suppr. Factors in DIS/RES Join Scheme");
-      Interaction interaction(*in);
-
-      const int kN   = 300;
-      double WminSpl = Wmin;
-      double WmaxSpl = fWcut + 0.1; // well into the area where scaling factor = 1
-      double dW      = (WmaxSpl-WminSpl)/(kN-1);
-
-      for(int i=0; i<kN; i++) {
-        double W = WminSpl+i*dW;
-        interaction.KinePtr()->SetW(W);
-        mprob = fHadronizationModel->MultiplicityProb(&interaction,"+LowMultSuppr");
-        R = 1;
-        if(mprob) {
-           R = mprob->Integral("width");
-           delete mprob;
-        }
-        // make sure that it takes enough samples where it is non-zero:
-        // modify the step and the sample counter once I've hit the first
-        // non-zero value
-        if(!non_zero && R>0) {
-	  non_zero=true;
-          WminSpl=W;
-          i = 0;
-          dW = (WmaxSpl-WminSpl)/(kN-1);
-        }
+      // look up again and create it with the cache locked, so that no two
+      // threads create it
+      CacheLock lock;
+      cbr = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+      if(!cbr) {
         LOG("DISXSec", pNOTICE) 
-	    << "Cached DIS XSec Suppr. factor (@ W=" << W << ") = " << R;
+                          << "\n ** Creating cache branch - key = " << key;
+
+        cbr = new CacheBranchFx("DIS Suppr. Factors in DIS/RES Join Scheme");
+        Interaction interaction(*in);
+
+        const int kN   = 300;
+        double WminSpl = Wmin;
+        double WmaxSpl = fWcut + 0.1; // well into the area where scaling factor = 1
+        double dW      = (WmaxSpl-WminSpl)/(kN-1);
+
+        for(int i=0; i<kN; i++) {
+          double W = WminSpl+i*dW;
+          interaction.KinePtr()->SetW(W);
+          mprob = fHadronizationModel->MultiplicityProb(&interaction,"+LowMultSuppr");
+          R = 1;
+          if(mprob) {
+             R = mprob->Integral("width");
+             delete mprob;
+          }
+          // make sure that it takes enough samples where it is non-zero:
+          // modify the step and the sample counter once I've hit the first
+          // non-zero value
+          if(!non_zero && R>0) {
+            non_zero=true;
+            WminSpl=W;
+            i = 0;
+            dW = (WmaxSpl-WminSpl)/(kN-1);
+          }
+          LOG("DISXSec", pNOTICE) 
+              << "Cached DIS XSec Suppr. factor (@ W=" << W << ") = " << R;
+
+          cbr->AddValues(W,R);
+        }
+        cbr->CreateSpline();
 
-        cbr->AddValues(W,R);
+        cache->AddCacheBranch(key, cbr);
+        assert(cbr);
       }
-      cbr->CreateSpline();
-
-      cache->AddCacheBranch(key, cbr);
-      assert(cbr);
     } // cache data
 
     // get the reduction factor from the cache branch
@@ -380,8 +493,6 @@ void QPMDISPXSec::LoadConfig(void)
      dynamic_cast<const DISStructureFuncModelI *> (this->SubAlg("SFAlg"));
   assert(fDISSFModel);
 
-  fDISSF.SetModel(fDISSFModel); // <-- attach algorithm
-
   GetParam( "UseDRJoinScheme", fUsingDisResJoin ) ;
 
   fHadronizationModel = 0;
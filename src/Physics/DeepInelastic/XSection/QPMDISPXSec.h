@@ -42,6 +42,10 @@ public:
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral        (const Interaction * i) const;
   bool   ValidProcess    (const Interaction * i) const;
+  void   BatchXSec       (const Interaction * i, KinePhaseSpace_t k,
+                          unsigned int npoints, unsigned int nkv,
+                          const KineVar_t * kv, const double * kine,
+                          double * xsec) const;
 
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
@@ -52,7 +56,12 @@ private:
   void   LoadConfig                  (void);
   double DISRESJoinSuppressionFactor (const Interaction * in) const;
 
-  mutable DISStructureFunc fDISSF;
+  //! Free nucleon d2xsec/dxdy for the input init-state, x, y & structure functions
+  double FreeNucleonXSec (double E, double ml, double Mnuc, int sign,
+                          const ProcessInfo & proc_info, double x, double y,
+                          double F1, double F2, double F3,
+                          double F4, double F5) const;
+
   bool                     fInInitPhase;
 
   const DISStructureFuncModelI * fDISSFModel;         ///< SF model
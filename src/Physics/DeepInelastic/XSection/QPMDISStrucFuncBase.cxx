@@ -22,9 +22,20 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The parton densities are computed in local objects and F1-F6 are kept in
+   per-thread scratch state, so that an instance can be used by several
+   event generation threads.
 */
 //____________________________________________________________________________
 
+#include <cassert>
+#include <map>
+#include <mutex>
+#include <sstream>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -32,6 +43,8 @@
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/RefFrame.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Physics/DeepInelastic/XSection/DISStrucFuncTable.h"
 #include "Physics/DeepInelastic/XSection/QPMDISStrucFuncBase.h"
 #include "Physics/PartonDistributions/PDFModelI.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -39,44 +52,123 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PhysUtils.h"
 
+using std::map;
+using std::ostringstream;
+
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  // PDFs kept by CalcPDFs() while building the structure function tables
+  const int kPDFAll         = 0;
+  const int kPDFBelowCharm  = 1; // all but the charm slow rescaling PDFs
+  const int kPDFAboveCharm  = 2; // only the charm slow rescaling PDFs
+
+  // Structure function tables: one per hit nucleon (p,n) and probe/current:
+  // nu CC, nubar CC, nu NC, nubar NC, charged lepton EM
+  const int kNSFTableChannels = 5;
+  const int kNSFTables        = 2 * kNSFTableChannels;
+
+  // Components per grid node: x*F1 ... x*F5 below and above the charm
+  // threshold (the x factor takes out the 1/x behaviour of F1,F3,F5)
+  const int kNSFTableComp     = 10;
+
+  // Tables shared by all instances with the same algorithm configuration
+  typedef vector<const DISStrucFuncTable *> SFTableSet_t;
+  map<string, SFTableSet_t *> gSFTableCache;
+  std::mutex                  gSFTableCacheMutex;
+
+  int SFTableChannel(const Interaction * interaction)
+  {
+    const ProcessInfo & proc_info = interaction->ProcInfo();
+    int probe_pdgc = interaction->InitState().ProbePdg();
+
+    if(proc_info.IsDarkMatter() || pdg::IsDarkMatter(probe_pdgc)) return -1;
+
+    bool is_nu    = pdg::IsNeutrino     (probe_pdgc);
+    bool is_nubar = pdg::IsAntiNeutrino (probe_pdgc);
+
+    if(proc_info.IsWeakCC() && is_nu   ) return 0;
+    if(proc_info.IsWeakCC() && is_nubar) return 1;
+    if(proc_info.IsWeakNC() && is_nu   ) return 2;
+    if(proc_info.IsWeakNC() && is_nubar) return 3;
+    if(proc_info.IsEM() && pdg::IsChargedLepton(probe_pdgc)) return 4;
+    return -1;
+  }
+
+  // Per-thread state of QPMDISStrucFuncBase: F1-F6 from the last Calculate()
+  class QPMDISScratch : public AlgScratchI {
+  public:
+    QPMDISScratch() { for(int i = 0; i < 6; i++) F[i] = 0.; }
+    double F[6];
+  };
+
+  Interaction * SFTableInteraction(int itable)
+  {
+    int  channel = itable / 2;
+    bool is_p    = (itable % 2 == 0);
+    int  tgt     = (is_p) ? kPdgTgtFreeP : kPdgTgtFreeN;
+    int  nuc     = (is_p) ? kPdgProton   : kPdgNeutron;
+
+    switch(channel) {
+      case 0 : return Interaction::DISCC(tgt, nuc, kPdgNuMu    );
+      case 1 : return Interaction::DISCC(tgt, nuc, kPdgAntiNuMu);
+      case 2 : return Interaction::DISNC(tgt, nuc, kPdgNuMu    );
+      case 3 : return Interaction::DISNC(tgt, nuc, kPdgAntiNuMu);
+      case 4 : return Interaction::DISEM(tgt, nuc, kPdgElectron);
+    }
+    return 0;
+  }
+
+}
+
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase() :
-DISStructureFuncModelI()
+DISStructureFuncModelI(),
+fUseSFTables(false),
+fPDFModel(0),
+fSFTables(0)
 {
-  this->InitPDF();
+
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name) :
-DISStructureFuncModelI(name)
+DISStructureFuncModelI(name),
+fUseSFTables(false),
+fPDFModel(0),
+fSFTables(0)
 {
-  this->InitPDF();
+
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name, string config):
-DISStructureFuncModelI(name, config)
+DISStructureFuncModelI(name, config),
+fUseSFTables(false),
+fPDFModel(0),
+fSFTables(0)
 {
-  this->InitPDF();
+
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::~QPMDISStrucFuncBase()
 {
-  delete fPDF;
-  delete fPDFc;
+
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
   this->LoadConfig();
+  this->LoadSFTables();
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Configure(string param_set)
 {
   Algorithm::Configure(param_set);
   this->LoadConfig();
+  this->LoadSFTables();
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::LoadConfig(void)
@@ -84,10 +176,7 @@ void QPMDISStrucFuncBase::LoadConfig(void)
   LOG("DISSF", pDEBUG) << "Loading configuration...";
 
   //-- pdf
-  const PDFModelI * pdf_model =
-         dynamic_cast<const PDFModelI *> (this->SubAlg("PDF-Set"));
-  fPDF  -> SetModel(pdf_model);
-  fPDFc -> SetModel(pdf_model);
+  fPDFModel = dynamic_cast<const PDFModelI *> (this->SubAlg("PDF-Set"));
 
   //-- get CKM elements
   GetParam( "CKM-Vcd", fVcd ) ;
@@ -126,25 +215,88 @@ void QPMDISStrucFuncBase::LoadConfig(void)
   GetParam( "WeinbergAngle", thw ) ;
   fSin2thw = TMath::Power(TMath::Sin(thw), 2);
 
+  //-- tabulate the structure functions?
+  GetParamDef( "UseSFTables",     fUseSFTables,  false ) ;
+  GetParamDef( "SFTable-NX",      fSFTableNX,    100   ) ;
+  GetParamDef( "SFTable-NQ2",     fSFTableNQ2,   120   ) ;
+  GetParamDef( "SFTable-XMin",    fSFTableXMin,  1E-4  ) ;
+  GetParamDef( "SFTable-Q2Min",   fSFTableQ2Min, 1E-2  ) ;
+  GetParamDef( "SFTable-Q2Max",   fSFTableQ2Max, 1E+4  ) ;
+
   LOG("DISSF", pDEBUG) << "Done loading configuration";
 }
 //____________________________________________________________________________
-void QPMDISStrucFuncBase::InitPDF(void)
+double QPMDISStrucFuncBase::F1(void) const
 {
-                     // evaluated at:
-  fPDF  = new PDF(); //   x = computed (+/-corrections) scaling var, Q2
-  fPDFc = new PDF(); //   x = computed charm slow re-scaling var,    Q2
+  return static_cast<QPMDISScratch *>(this->Scratch())->F[0];
+}
+//____________________________________________________________________________
+double QPMDISStrucFuncBase::F2(void) const
+{
+  return static_cast<QPMDISScratch *>(this->Scratch())->F[1];
+}
+//____________________________________________________________________________
+double QPMDISStrucFuncBase::F3(void) const
+{
+  return static_cast<QPMDISScratch *>(this->Scratch())->F[2];
+}
+//____________________________________________________________________________
+double QPMDISStrucFuncBase::F4(void) const
+{
+  return static_cast<QPMDISScratch *>(this->Scratch())->F[3];
+}
+//____________________________________________________________________________
+double QPMDISStrucFuncBase::F5(void) const
+{
+  return static_cast<QPMDISScratch *>(this->Scratch())->F[4];
+}
+//____________________________________________________________________________
+double QPMDISStrucFuncBase::F6(void) const
+{
+  return static_cast<QPMDISScratch *>(this->Scratch())->F[5];
+}
+//____________________________________________________________________________
+AlgScratchI * QPMDISStrucFuncBase::NewScratch(void) const
+{
+  return new QPMDISScratch;
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
 {
-  // Reset mutable members
-  fF1 = 0;
-  fF2 = 0;
-  fF3 = 0;
-  fF4 = 0;
-  fF5 = 0;
-  fF6 = 0;
+  // Reset the structure functions of the calling thread
+  double * F = static_cast<QPMDISScratch *>(this->Scratch())->F;
+  for(int i = 0; i < 6; i++) F[i] = 0;
+
+  // Free nucleon structure functions F1-F5, tabulated or computed
+  double sf[5];
+  bool ok = this->TabulatedSF(interaction, sf);
+  if(!ok) {
+    ok = this->CalculateSF(interaction, kPDFAll, sf);
+  }
+  if(!ok) return;
+
+  // Nuclear modification
+  double f = this->NuclMod(interaction);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) << "Nucl. mod   = " << f;
+#endif
+
+  for(int i = 0; i < 5; i++) F[i] = f * sf[i];
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) 
+     << "F1-F5 = " 
+     << F[0] << ", " << F[1] << ", " << F[2] << ", " << F[3] << ", " << F[4];
+#endif
+}
+//____________________________________________________________________________
+bool QPMDISStrucFuncBase::CalculateSF(
+   const Interaction * interaction, int pdf_select, double * sf) const
+{
+// Computes the free nucleon structure functions F1-F5 (without the nuclear
+// modification) from the PDFs. Returns false if they vanish for the input
+// interaction.
 
   // Get process info & perform various checks
   const ProcessInfo &  proc_info  = interaction->ProcInfo();
@@ -164,10 +316,10 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
   bool is_EM       = proc_info.IsEM();
   bool is_dmi      = proc_info.IsDarkMatter();
 
-  if ( !is_lepton && !is_dm ) return;
-  if ( !is_p && !is_n       ) return;
-  if ( tgt.N() == 0 && is_n ) return;
-  if ( tgt.Z() == 0 && is_p ) return;
+  if ( !is_lepton && !is_dm ) return false;
+  if ( !is_p && !is_n       ) return false;
+  if ( tgt.N() == 0 && is_n ) return false;
+  if ( tgt.Z() == 0 && is_p ) return false;
 
   // Flags switching on/off quark contributions so that this algorithm can be 
   // used for both l + N -> l' + X, and l + q -> l' + q' level calculations
@@ -218,23 +370,24 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
      else if ( sea && is_sbar) { switch_sbar = 1; }
      else if ( sea && is_c   ) { switch_c    = 1; }
      else if ( sea && is_cbar) { switch_cbar = 1; }
-     else return;
+     else return false;
 
      // make sure user inputs make sense
-    if(is_nu    && is_CC && is_u   ) return;
-    if(is_nu    && is_CC && is_c   ) return;
-    if(is_nu    && is_CC && is_dbar) return;
-    if(is_nu    && is_CC && is_sbar) return;
-    if(is_nubar && is_CC && is_ubar) return;
-    if(is_nubar && is_CC && is_cbar) return;
-    if(is_nubar && is_CC && is_d   ) return;
-    if(is_nubar && is_CC && is_s   ) return;
+    if(is_nu    && is_CC && is_u   ) return false;
+    if(is_nu    && is_CC && is_c   ) return false;
+    if(is_nu    && is_CC && is_dbar) return false;
+    if(is_nu    && is_CC && is_sbar) return false;
+    if(is_nubar && is_CC && is_ubar) return false;
+    if(is_nubar && is_CC && is_cbar) return false;
+    if(is_nubar && is_CC && is_d   ) return false;
+    if(is_nubar && is_CC && is_s   ) return false;
   }
 
   // Compute PDFs [both at (scaling-var,Q2) and (slow-rescaling-var,Q2)
   // Applying all PDF K-factors abd scaling variable corrections
 
-  this -> CalcPDFs (interaction);
+  PartonDensities_t pd;
+  this -> CalcPDFs (interaction, pdf_select, pd);
 
   //
   // Compute structure functions for the EM, NC and CC cases
@@ -247,7 +400,7 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
   // Include DM in NC
   if(is_NC || is_dmi) {
 
-    if(!is_nu && !is_nubar && !is_dm) return;
+    if(!is_nu && !is_nubar && !is_dm) return false;
 
     double GL   = (is_nu) ? ( 0.5 - (2./3.)*fSin2thw) : (     - (2./3.)*fSin2thw); // clu
     double GR   = (is_nu) ? (     - (2./3.)*fSin2thw) : ( 0.5 - (2./3.)*fSin2thw); // cru
@@ -269,15 +422,15 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
     double gvd2 = TMath::Power(gvd, 2.);
     double gad2 = TMath::Power(gad, 2.);
 
-    double q2   = (switch_uv   * fuv + switch_us   * fus + switch_c    * fc)  * (gvu2+gau2) + 
-                  (switch_dv   * fdv + switch_ds   * fds + switch_s    * fs)  * (gvd2+gad2);
-    double q3   = (switch_uv   * fuv + switch_us   * fus + switch_c    * fc)  * (2*gvu*gau) + 
-                  (switch_dv   * fdv + switch_ds   * fds + switch_s    * fs)  * (2*gvd*gad);
+    double q2   = (switch_uv   * pd.uv + switch_us   * pd.us + switch_c    * pd.c)  * (gvu2+gau2) + 
+                  (switch_dv   * pd.dv + switch_ds   * pd.ds + switch_s    * pd.s)  * (gvd2+gad2);
+    double q3   = (switch_uv   * pd.uv + switch_us   * pd.us + switch_c    * pd.c)  * (2*gvu*gau) + 
+                  (switch_dv   * pd.dv + switch_ds   * pd.ds + switch_s    * pd.s)  * (2*gvd*gad);
 
-    double qb2  = (switch_ubar * fus + switch_cbar * fc)  * (gvu2+gau2) + 
-                  (switch_dbar * fds + switch_sbar * fs)  * (gvd2+gad2);    
-    double qb3  = (switch_ubar * fus + switch_cbar * fc)  * (2*gvu*gau) + 
-                  (switch_dbar * fds + switch_sbar * fs)  * (2*gvd*gad);    
+    double qb2  = (switch_ubar * pd.us + switch_cbar * pd.c)  * (gvu2+gau2) + 
+                  (switch_dbar * pd.ds + switch_sbar * pd.s)  * (gvd2+gad2);    
+    double qb3  = (switch_ubar * pd.us + switch_cbar * pd.c)  * (2*gvu*gau) + 
+                  (switch_dbar * pd.ds + switch_sbar * pd.s)  * (2*gvd*gad);    
  
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("DISSF", pINFO) << "f2 : q = " << q2 << ", bar{q} = " << qb2;
@@ -294,30 +447,30 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
     double q=0, qbar=0;
 
     if (is_nu) {
-      q    = ( switch_dv * fdv   + switch_ds * fds   ) * fVud2 + 
-             ( switch_s  * fs                        ) * fVus2 + 
-             ( switch_dv * fdv_c + switch_ds * fds_c ) * fVcd2 + 
-             ( switch_s  * fs_c                      ) * fVcs2;
-
-      qbar = ( switch_ubar * fus  ) * fVud2 + 
-             ( switch_ubar * fus  ) * fVus2 + 
-             ( switch_cbar * fc_c ) * fVcd2 + 
-             ( switch_cbar * fc_c ) * fVcs2;
+      q    = ( switch_dv * pd.dv   + switch_ds * pd.ds   ) * fVud2 + 
+             ( switch_s  * pd.s                        ) * fVus2 + 
+             ( switch_dv * pd.dv_c + switch_ds * pd.ds_c ) * fVcd2 + 
+             ( switch_s  * pd.s_c                      ) * fVcs2;
+
+      qbar = ( switch_ubar * pd.us  ) * fVud2 + 
+             ( switch_ubar * pd.us  ) * fVus2 + 
+             ( switch_cbar * pd.c_c ) * fVcd2 + 
+             ( switch_cbar * pd.c_c ) * fVcs2;
     }
     else 
     if (is_nubar) {
-      q    = ( switch_uv * fuv + switch_us * fus    ) * fVud2 + 
-             ( switch_uv * fuv + switch_us * fus    ) * fVus2 + 
-             ( switch_c  * fc_c                     ) * fVcd2 + 
-             ( switch_c  * fc_c                     ) * fVcs2;
-
-      qbar = ( switch_dbar * fds_c ) * fVcd2 + 
-             ( switch_dbar * fds   ) * fVud2 + 
-             ( switch_sbar * fs    ) * fVus2 + 
-             ( switch_sbar * fs_c  ) * fVcs2;
+      q    = ( switch_uv * pd.uv + switch_us * pd.us    ) * fVud2 + 
+             ( switch_uv * pd.uv + switch_us * pd.us    ) * fVus2 + 
+             ( switch_c  * pd.c_c                     ) * fVcd2 + 
+             ( switch_c  * pd.c_c                     ) * fVcs2;
+
+      qbar = ( switch_dbar * pd.ds_c ) * fVcd2 + 
+             ( switch_dbar * pd.ds   ) * fVud2 + 
+             ( switch_sbar * pd.s    ) * fVus2 + 
+             ( switch_sbar * pd.s_c  ) * fVcs2;
     }
     else {
-      return;
+      return false;
     }
 
     F2val  = 2*(q+qbar);
@@ -328,17 +481,17 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
 
   if(is_EM) {
 
-    if(!pdg::IsChargedLepton(probe_pdgc)) return;
+    if(!pdg::IsChargedLepton(probe_pdgc)) return false;
 
     double sq23 = TMath::Power(2./3., 2.);
     double sq13 = TMath::Power(1./3., 2.);
 
-    double qu   = sq23 * ( switch_uv   * fuv + switch_us * fus );
-    double qd   = sq13 * ( switch_dv   * fdv + switch_ds * fds );
-    double qs   = sq13 * ( switch_s    * fs  );
-    double qbu  = sq23 * ( switch_ubar * fus );
-    double qbd  = sq13 * ( switch_dbar * fds );
-    double qbs  = sq13 * ( switch_sbar * fs  );
+    double qu   = sq23 * ( switch_uv   * pd.uv + switch_us * pd.us );
+    double qd   = sq13 * ( switch_dv   * pd.dv + switch_ds * pd.ds );
+    double qs   = sq13 * ( switch_s    * pd.s  );
+    double qbu  = sq23 * ( switch_ubar * pd.us );
+    double qbd  = sq13 * ( switch_dbar * pd.ds );
+    double qbs  = sq13 * ( switch_sbar * pd.s  );
 
     double q    = qu  + qd  + qs;
     double qbar = qbu + qbd + qbs;
@@ -350,11 +503,9 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
 
   double Q2val = this->Q2        (interaction);
   double x     = this->ScalingVar(interaction);
-  double f     = this->NuclMod   (interaction); // nuclear modification
   double r     = this->R         (interaction); // R ~ FL
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISSF", pDEBUG) << "Nucl. mod   = " << f;
   LOG("DISSF", pDEBUG) << "R(=FL/2xF1) = " << r;
 #endif
 
@@ -372,11 +523,11 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
     double a = TMath::Power(bjx,2.) / TMath::Max(Q2val, fLowQ2CutoffF1F2);
     double c = (1. + 4. * kNucleonMass2 * a) / (1.+r);
 
-    fF3 = f * xF3val/bjx;
-    fF2 = f * F2val;
-    fF1 = fF2 * 0.5*c/bjx;
-    fF5 = fF2/bjx;           // Albright-Jarlskog relation
-    fF4 = 0.;                // Nucl.Phys.B 84, 467 (1975)
+    sf[2] = xF3val/bjx;
+    sf[1] = F2val;
+    sf[0] = sf[1] * 0.5*c/bjx;
+    sf[4] = sf[1]/bjx;         // Albright-Jarlskog relation
+    sf[3] = 0.;                // Nucl.Phys.B 84, 467 (1975)
   } 
   else {
     double a = TMath::Power(x,2.) / TMath::Max(Q2val, fLowQ2CutoffF1F2);
@@ -384,18 +535,14 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
     //double a = TMath::Power(x,2.) / Q2val;
     //double c = (1. + 4. * kNucleonMass * a) / (1.+r);
 
-    fF3 = f * xF3val / x;
-    fF2 = f * F2val;
-    fF1 = fF2 * 0.5 * c / x;
-    fF5 = fF2 / x;         // Albright-Jarlskog relation
-    fF4 = 0.;              // Nucl.Phys.B 84, 467 (1975)
+    sf[2] = xF3val / x;
+    sf[1] = F2val;
+    sf[0] = sf[1] * 0.5 * c / x;
+    sf[4] = sf[1] / x;         // Albright-Jarlskog relation
+    sf[3] = 0.;                // Nucl.Phys.B 84, 467 (1975)
   }
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISSF", pDEBUG) 
-     << "F1-F5 = " 
-     << fF1 << ", " << fF2 << ", " << fF3 << ", " << fF4 << ", " << fF5;
-#endif
+  return true;
 }
 //____________________________________________________________________________
 double QPMDISStrucFuncBase::Q2(const Interaction * interaction) const
@@ -494,11 +641,14 @@ double QPMDISStrucFuncBase::R(const Interaction * interaction) const
   return 0;
 }
 //____________________________________________________________________________
-void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
+void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction,
+                          int pdf_select, PartonDensities_t & pd) const
 {
-  // Clean-up previous calculation
-  fPDF  -> Reset();
-  fPDFc -> Reset();
+  // PDFs evaluated at:
+  PDF pdf;  //  x = computed (+/-corrections) scaling var, Q2
+  PDF pdfc; //  x = computed charm slow re-scaling var,    Q2
+  pdf .SetModel(fPDFModel);
+  pdfc.SetModel(fPDFModel);
 
   // Get the kinematical variables x,Q2 (could include corrections)
   double x     = this->ScalingVar(interaction);
@@ -515,10 +665,10 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DISSF", pDEBUG) << "Calculating PDFs @ x = " << x << ", Q2 = " << Q2pdf;
 #endif
-  fPDF->Calculate(x, Q2pdf);
+  pdf.Calculate(x, Q2pdf);
 
   // Check whether it is above charm threshold
-  bool above_charm = 
+  bool above_charm = (pdf_select == kPDFAboveCharm) ||
            utils::kinematics::IsAboveCharmThreshold(x, Q2val, M, fMc);
   if(above_charm) {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -538,7 +688,7 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
           LOG("DISSF", pDEBUG) 
               << "Calculating PDFs @ xc (slow rescaling) = " << x << ", Q2 = " << Q2val;
 #endif
-          fPDFc->Calculate(xc, Q2pdf);
+          pdfc.Calculate(xc, Q2pdf);
        }
     }// charm off?
   }//above charm thr?
@@ -568,19 +718,19 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
   // Debdatta & Donna noted (Sep.2006) that a similar swap in the neugen
   // implementation was the cause of the difference in nu and nubar F2
   //
-  fPDF->ScaleUpValence   (kval_u);
-  fPDF->ScaleDownValence (kval_d);
-  fPDF->ScaleUpSea       (ksea_u);
-  fPDF->ScaleDownSea     (ksea_d);
-  fPDF->ScaleStrange     (ksea_d);
-  fPDF->ScaleCharm       (ksea_u);
+  pdf.ScaleUpValence   (kval_u);
+  pdf.ScaleDownValence (kval_d);
+  pdf.ScaleUpSea       (ksea_u);
+  pdf.ScaleDownSea     (ksea_d);
+  pdf.ScaleStrange     (ksea_d);
+  pdf.ScaleCharm       (ksea_u);
   if(above_charm) {
-     fPDFc->ScaleUpValence   (kval_u);
-     fPDFc->ScaleDownValence (kval_d);
-     fPDFc->ScaleUpSea       (ksea_u);
-     fPDFc->ScaleDownSea     (ksea_d);
-     fPDFc->ScaleStrange     (ksea_d);
-     fPDFc->ScaleCharm       (ksea_u);
+     pdfc.ScaleUpValence   (kval_u);
+     pdfc.ScaleDownValence (kval_d);
+     pdfc.ScaleUpSea       (ksea_u);
+     pdfc.ScaleDownSea     (ksea_d);
+     pdfc.ScaleStrange     (ksea_d);
+     pdfc.ScaleCharm       (ksea_u);
   }
 
   // Rules of thumb 
@@ -595,18 +745,26 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
   // - For s,c use q=qbar
   // - For t,b use q=qbar=0
 
-  fuv   = fPDF  -> UpValence();
-  fus   = fPDF  -> UpSea();
-  fdv   = fPDF  -> DownValence();
-  fds   = fPDF  -> DownSea();
-  fs    = fPDF  -> Strange();
-  fc    = 0.;
-  fuv_c = fPDFc -> UpValence();   // will be 0 if < charm threshold
-  fus_c = fPDFc -> UpSea();       // ...
-  fdv_c = fPDFc -> DownValence(); // ...
-  fds_c = fPDFc -> DownSea();     // ...
-  fs_c  = fPDFc -> Strange();     // ...
-  fc_c  = fPDFc -> Charm();       // ...
+  pd.uv   = pdf .UpValence();
+  pd.us   = pdf .UpSea();
+  pd.dv   = pdf .DownValence();
+  pd.ds   = pdf .DownSea();
+  pd.s    = pdf .Strange();
+  pd.c    = 0.;
+  pd.uv_c = pdfc.UpValence();   // will be 0 if < charm threshold
+  pd.us_c = pdfc.UpSea();       // ...
+  pd.dv_c = pdfc.DownValence(); // ...
+  pd.ds_c = pdfc.DownSea();     // ...
+  pd.s_c  = pdfc.Strange();     // ...
+  pd.c_c  = pdfc.Charm();       // ...
+
+  // Keep only the contributions below / above the charm threshold?
+  if(pdf_select == kPDFBelowCharm) {
+    pd.uv_c = 0.; pd.us_c = 0.; pd.dv_c = 0.; pd.ds_c = 0.; pd.s_c = 0.; pd.c_c = 0.;
+  }
+  else if(pdf_select == kPDFAboveCharm) {
+    pd.uv   = 0.; pd.us   = 0.; pd.dv   = 0.; pd.ds   = 0.; pd.s   = 0.; pd.c   = 0.;
+  }
 
   // The above are the proton parton density function. Get the PDFs for the 
   // hit nucleon (p or n) by swapping u<->d if necessary
@@ -618,11 +776,120 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
 
   double tmp = 0;
   if (isN) {  // swap u <-> d
-    tmp = fuv;   fuv   = fdv;   fdv   = tmp;
-    tmp = fus;   fus   = fds;   fds   = tmp;
-    tmp = fuv_c; fuv_c = fdv_c; fdv_c = tmp;
-    tmp = fus_c; fus_c = fds_c; fds_c = tmp;
+    tmp = pd.uv;   pd.uv   = pd.dv;   pd.dv   = tmp;
+    tmp = pd.us;   pd.us   = pd.ds;   pd.ds   = tmp;
+    tmp = pd.uv_c; pd.uv_c = pd.dv_c; pd.dv_c = tmp;
+    tmp = pd.us_c; pd.us_c = pd.ds_c; pd.ds_c = tmp;
   }
 
 }
 //____________________________________________________________________________
+bool QPMDISStrucFuncBase::TabulatedSF(
+                          const Interaction * interaction, double * sf) const
+{
+// Interpolates the free nucleon structure functions F1-F5 from the tables.
+// Returns false if they are not tabulated for the input interaction.
+
+  if(!fSFTables) return false;
+
+  const Target & tgt = interaction->InitState().Tgt();
+  if(tgt.HitQrkIsSet()) return false;
+
+  int nuc_pdgc = tgt.HitNucPdg();
+  bool is_p = pdg::IsProton  (nuc_pdgc);
+  bool is_n = pdg::IsNeutron (nuc_pdgc);
+  if( !is_p && !is_n ) return false;
+  if( tgt.N() == 0 && is_n ) return false;
+  if( tgt.Z() == 0 && is_p ) return false;
+
+  int channel = SFTableChannel(interaction);
+  if(channel < 0) return false;
+
+  const DISStrucFuncTable * table = (*fSFTables)[2*channel + (is_p ? 0 : 1)];
+
+  double x  = interaction->Kine().x();
+  double Q2 = this->Q2(interaction);
+
+  double values[kNSFTableComp];
+  if(!table->Evaluate(x, Q2, values)) return false;
+
+  // add the charm contributions if above the threshold for this hit nucleon
+  // (it may be off the mass shell)
+  double M = tgt.HitNucP4().M();
+  bool above_charm = utils::kinematics::IsAboveCharmThreshold(
+                                   this->ScalingVar(interaction), Q2, M, fMc);
+  for(int i = 0; i < 5; i++) {
+    double xF = values[i] + (above_charm ? values[5+i] : 0.);
+    sf[i] = xF / x;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::LoadSFTables(void)
+{
+// Gets the structure function tables for the current configuration, or
+// builds them if no other instance has done so already.
+
+  fSFTables = 0;
+  if(!fUseSFTables) return;
+
+  ostringstream key;
+  key << this->Id().Key() << "/" << this->GetConfig();
+
+  std::lock_guard<std::mutex> lock(gSFTableCacheMutex);
+
+  map<string, SFTableSet_t *>::const_iterator it = gSFTableCache.find(key.str());
+  if(it != gSFTableCache.end()) {
+    fSFTables = it->second;
+    return;
+  }
+
+  LOG("DISSF", pNOTICE)
+     << "Tabulating the structure functions on a " << fSFTableNX << " x "
+     << fSFTableNQ2 << " (x,Q2) grid: x in [" << fSFTableXMin << ", 1], Q2 in ["
+     << fSFTableQ2Min << ", " << fSFTableQ2Max << "] GeV^2";
+
+  SFTableSet_t * tables = new SFTableSet_t;
+  for(int itable = 0; itable < kNSFTables; itable++) {
+    DISStrucFuncTable * table = new DISStrucFuncTable(kNSFTableComp,
+       fSFTableNX,  fSFTableXMin,  1.,
+       fSFTableNQ2, fSFTableQ2Min, fSFTableQ2Max);
+    this->BuildSFTable(itable, table);
+    tables->push_back(table);
+  }
+  gSFTableCache.insert(map<string, SFTableSet_t *>::value_type(key.str(), tables));
+  fSFTables = tables;
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::BuildSFTable(
+                           int itable, DISStrucFuncTable * table) const
+{
+  Interaction * interaction = SFTableInteraction(itable);
+  assert(interaction);
+  interaction->SetBit(kIAssumeFreeNucleon);
+
+  double values[kNSFTableComp];
+  double sf[5];
+
+  for(unsigned int ix = 0; ix < table->NX(); ix++) {
+    // stay just inside x=1, where the scaling variables are singular
+    double x = TMath::Min(table->X(ix), 1.-1E-6);
+    for(unsigned int iQ2 = 0; iQ2 < table->NQ2(); iQ2++) {
+      double Q2 = table->Q2(iQ2);
+      interaction->KinePtr()->Setx (x);
+      interaction->KinePtr()->SetQ2(Q2);
+      int select[2] = { kPDFBelowCharm, kPDFAboveCharm };
+      for(int is = 0; is < 2; is++) {
+        bool ok = this->CalculateSF(interaction, select[is], sf);
+        for(int i = 0; i < 5; i++) {
+          values[5*is + i] = (ok) ? x * sf[i] : 0.;
+        }
+      }
+      table->Set(ix, iQ2, values);
+    }
+  }
+
+
+  delete interaction;
+}
+//____________________________________________________________________________
@@ -7,6 +7,23 @@
           Provides common implementation for concrete objects implementing the
           DISStructureFuncModelI interface.
 
+          Optionally (UseSFTables), F1-F5 are tabulated on a (log x, log Q2)
+          grid for each hit nucleon / probe / current at configuration time
+          and interpolated instead of being computed from the PDFs at every
+          call. The tables hold the free nucleon structure functions with the
+          contributions above and below the charm threshold kept apart, so
+          that the nuclear factor and the (hit nucleon mass dependent) charm
+          threshold are still applied for each call. Kinematics outside the
+          grid, interactions on a given quark and dark matter probes are
+          computed directly. Tables are shared by all instances with the
+          same configuration, including those running on other threads.
+          Note that the charm contribution is tabulated at the slow rescaling
+          variable of an on-shell nucleon, whereas the direct calculation
+          (CalcPDFs) uses the mass of the hit nucleon, which may be off the
+          mass shell. For bound nucleons the tabulated charm part is thus an
+          approximation (only the charm threshold itself is evaluated with
+          the actual hit nucleon mass).
+
 \ref      For a discussion of DIS SF see for example E.A.Paschos and J.Y.Yu, 
           Phys.Rev.D 65.033002 and R.Devenish and A.Cooper-Sarkar, OUP 2004.
 
@@ -28,24 +45,32 @@
 #ifndef _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 #define _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 
+#include <vector>
+
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/PartonDistributions/PDF.h"
 
+using std::vector;
+
 namespace genie {
 
+class DISStrucFuncTable;
+
 class QPMDISStrucFuncBase : public DISStructureFuncModelI {
 
 public:
   virtual ~QPMDISStrucFuncBase();
 
   // common code for all DISFormFactorsModelI interface implementations
-  virtual double F1 (void) const { return fF1; }
-  virtual double F2 (void) const { return fF2; }
-  virtual double F3 (void) const { return fF3; }
-  virtual double F4 (void) const { return fF4; }
-  virtual double F5 (void) const { return fF5; }
-  virtual double F6 (void) const { return fF6; }
+  // (F1-F6 return the values computed by the last Calculate() call of the
+  // calling thread: they are kept in per-thread scratch state)
+  virtual double F1 (void) const;
+  virtual double F2 (void) const;
+  virtual double F3 (void) const;
+  virtual double F4 (void) const;
+  virtual double F5 (void) const;
+  virtual double F6 (void) const;
 
   virtual void Calculate (const Interaction * interaction) const;
 
@@ -59,13 +84,20 @@ protected:
   QPMDISStrucFuncBase(string name);
   QPMDISStrucFuncBase(string name, string config);
 
+  // parton densities of the hit nucleon computed by CalcPDFs(), at the
+  // scaling variable and (_c) at the charm slow rescaling variable
+  struct PartonDensities_t {
+    double uv, us, dv, ds, s, c;
+    double uv_c, us_c, dv_c, ds_c, s_c, c_c;
+  };
+
   // commom code for SF calculation for all DISFormFactorsModelI
   // interface implementations inheriting from QPMDISStrucFuncBase
   virtual void   LoadConfig (void);
-  virtual void   InitPDF    (void);
   virtual double Q2         (const Interaction * i) const;
   virtual double ScalingVar (const Interaction * i) const;
-  virtual void   CalcPDFs   (const Interaction * i) const;
+  virtual void   CalcPDFs   (const Interaction * i, int pdf_select,
+                             PartonDensities_t & pd) const;
   virtual double NuclMod    (const Interaction * i) const;
   virtual double R          (const Interaction * i) const;
   virtual void   KFactors   (const Interaction * i, double & kuv, 
@@ -88,28 +120,24 @@ protected:
   double fSin2thw;           ///<
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  bool   fUseSFTables;       ///< tabulate F1-F5 on a (log x, log Q2) grid?
+  int    fSFTableNX;         ///< number of x grid points
+  int    fSFTableNQ2;        ///< number of Q2 grid points
+  double fSFTableXMin;       ///< min x of the grid (max x is 1)
+  double fSFTableQ2Min;      ///< Q2 range of the grid
+  double fSFTableQ2Max;      ///<
+
+  const PDFModelI * fPDFModel; ///< PDF set evaluated @ (x,Q2) and (slow-rescaling-var,Q2)
+
+private:
 
-  mutable double fF1;
-  mutable double fF2;
-  mutable double fF3;
-  mutable double fF4;
-  mutable double fF5;
-  mutable double fF6;
-  PDF *  fPDF;           ///< computed PDFs @ (x,Q2)
-  PDF *  fPDFc;          ///< computed PDFs @ (slow-rescaling-var,Q2)
-  mutable double fuv;
-  mutable double fus; 
-  mutable double fdv; 
-  mutable double fds; 
-  mutable double fs;
-  mutable double fc;
-  mutable double fuv_c; 
-  mutable double fus_c; 
-  mutable double fdv_c;
-  mutable double fds_c;
-  mutable double fs_c; 
-  mutable double fc_c; 
+  bool   CalculateSF  (const Interaction * i, int pdf_select, double * sf) const;
+  bool   TabulatedSF  (const Interaction * i, double * sf) const;
+  void   LoadSFTables (void);
+  void   BuildSFTable (int itable, DISStrucFuncTable * table) const;
+  AlgScratchI * NewScratch (void) const;
 
+  const vector<const DISStrucFuncTable *> * fSFTables; ///< shared tables, per nucleon / probe / current
 };
 
 }         // genie namespace
@@ -77,7 +77,7 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- Get the interaction 
   Interaction * interaction = evrec->Summary();
@@ -162,7 +162,7 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        << "Trying: x = " << gx << ", y = " << gy << ", t = " << gt;
 
      //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxytfE);
+     xsec = this->XSecModel()->XSec(interaction, kPSxytfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -329,7 +329,7 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
           double gt = tmin + k*dt;
           interaction->KinePtr()->Sett(gt);
 
-          double xsec = fXSecModel->XSec(interaction, kPSxytfE);
+          double xsec = this->XSecModel()->XSec(interaction, kPSxytfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 	  LOG("DFRKinematics", pINFO) 
 	    << "xsec(y=" << gy << ", x=" << gx << ", t=" << gt << ") = " << xsec;
@@ -356,7 +356,7 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("DFRKinematics", pDEBUG) << interaction->AsString();
   SLOG("DFRKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("DFRKinematics", pDEBUG) << "Computed using alg = " << *fXSecModel;
+  SLOG("DFRKinematics", pDEBUG) << "Computed using alg = " << *this->XSecModel();
 #endif
 
   return max_xsec;
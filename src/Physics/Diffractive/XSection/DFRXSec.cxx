@@ -87,6 +87,15 @@ double DFRXSec::Integrate (const XSecAlgorithmI* model, const Interaction* in) c
   LOG("DFRXSec", pINFO)
     << "t integration range = [" << tl.min << ", " << tl.max << "]";
 
+  if (this->UseBatchIntegrator()) {
+    double abstol = 1; //We mostly care about relative tolerance.
+    double kine_min[3] = { xl.min, yl.min, tl.min };
+    double kine_max[3] = { xl.max, yl.max, tl.max };
+    xsec = this->IntegrateBatch<utils::gsl::d3XSec_dxdydt_E>(
+        model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+    return xsec;
+  }
+
   ROOT::Math::IBaseFunctionMultiDim * func =
     new utils::gsl::d3XSec_dxdydt_E(model, interaction);
   ROOT::Math::IntegrationMultiDim::Type ig_type =
@@ -134,6 +143,8 @@ void DFRXSec::LoadConfig (void)
   GetParamDef( "gsl-min-eval", min, 5000 ) ;
   fGSLMaxEval  = (unsigned int) max ;
   fGSLMinEval  = (unsigned int) min ;
+  GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0 ) ;
+  GetParamDef( "batch-warm-start", fBatchWarmStart, true ) ;
 
   //-- DFR model parameter t_max for t = (q - p_pi)^2
   GetParam( "DFR-t-max", fTMax ) ;
@@ -15,6 +15,8 @@
  @ Apr 24, 2010 - CA
    Add code to decay the off-the-mass-shell W- using PYTHIA6. 
    First complete version of the GLRES event thread.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Hold a Pythia6Lock while generating the W- decay with PYTHIA6.
 */
 //____________________________________________________________________________
 
@@ -38,6 +40,7 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/Pythia6Lock.h"
 #include "Physics/GlashowResonance/EventGen/GLRESGenerator.h"
 
 using namespace genie;
@@ -105,6 +108,8 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   strcpy(p6frame, "CMS"    );
   strcpy(p6nu,    "nu_ebar");
   strcpy(p6tgt,   "e-"     );
+  Pythia6Lock lock; // PYTHIA6 state is shared by the whole process
+
   fPythia->Pyinit(p6frame, p6nu, p6tgt, mass);
   fPythia->Pyevnt();
   fPythia->Pylist(1);
@@ -485,9 +485,9 @@ void HAIntranuke::ElasHA(
     }
 
   // check remnants
-  if(fRemnA<0 || fRemnZ<0) // best to stop it here and not try again.
+  if(State().RemnA<0 || State().RemnZ<0) // best to stop it here and not try again.
     {
-      LOG("HAIntranuke", pWARN) << "Invalid Nucleus! : (A,Z) = ("<<fRemnA<<','<<fRemnZ<<')';
+      LOG("HAIntranuke", pWARN) << "Invalid Nucleus! : (A,Z) = ("<<State().RemnA<<','<<State().RemnZ<<')';
       p->SetStatus(kIStStableFinalState);
       ev->AddParticle(*p);
       return;
@@ -497,14 +497,14 @@ void HAIntranuke::ElasHA(
   int pcode = p->Pdg();
   double Mp = p->Mass();
   double Mt = 0.;
-  if (ev->TargetNucleus()->A()==fRemnA)
+  if (ev->TargetNucleus()->A()==State().RemnA)
     { Mt = PDGLibrary::Instance()->Find(ev->TargetNucleus()->Pdg())->Mass(); }
   else 
     {
-      Mt = fRemnP4.M();
+      Mt = State().RemnP4.M();
     }
   TLorentzVector t4PpL = *p->P4();
-  TLorentzVector t4PtL = fRemnP4;
+  TLorentzVector t4PtL = State().RemnP4;
   double C3CM = 0.0;
 
   // calculate scattering angle
@@ -514,7 +514,7 @@ void HAIntranuke::ElasHA(
   // calculate final 4 momentum of probe
   TLorentzVector t4P3L, t4P4L;
 
-  if (!utils::intranuke::TwoBodyKinematics(Mp,Mt,t4PpL,t4PtL,t4P3L,t4P4L,C3CM,fRemnP4))
+  if (!utils::intranuke::TwoBodyKinematics(Mp,Mt,t4PpL,t4PtL,t4P3L,t4P4L,C3CM,State().RemnP4))
     {
       LOG("HAIntranuke", pNOTICE) << "ElasHA() failed";
       exceptions::INukeException exception;
@@ -527,13 +527,13 @@ void HAIntranuke::ElasHA(
   p->SetStatus(kIStStableFinalState);
 
   // Update Remnant nucleus
-  fRemnP4 = t4P4L;
+  State().RemnP4 = t4P4L;
   LOG("HAIntranuke",pINFO)
     << "C3cm = " << C3CM;
   LOG("HAIntranuke",pINFO)
     << "|p3| = " << t4P3L.Vect().Mag()   << ", E3 = " << t4P3L.E() << ",Mp = " << Mp;
   LOG("HAIntranuke",pINFO)
-    << "|p4| = " << fRemnP4.Vect().Mag() << ", E4 = " << fRemnP4.E() << ",Mt = " << Mt;
+    << "|p4| = " << State().RemnP4.Vect().Mag() << ", E4 = " << State().RemnP4.E() << ",Mt = " << Mt;
 
   ev->AddParticle(*p);
 
@@ -566,7 +566,7 @@ void HAIntranuke::InelasticHA(
   // vars for incoming particle, target, and scattered pdg codes
   int pcode = p->Pdg();
   int tcode, scode, s2code;
-  double ppcnt = (double) fRemnZ / (double) fRemnA; // % of protons
+  double ppcnt = (double) State().RemnZ / (double) State().RemnA; // % of protons
 
   // Select a hadron fate in HN mode
   INukeFateHN_t h_fate;
@@ -606,14 +606,14 @@ void HAIntranuke::InelasticHA(
     }
 
   // check remnants
-  if ( fRemnA < 1 )    //we've blown nucleus apart, no need to retry anything - exit
+  if ( State().RemnA < 1 )    //we've blown nucleus apart, no need to retry anything - exit
     {
       LOG("HAIntranuke",pNOTICE) << "InelasticHA() stops : not enough nucleons";
       p->SetStatus(kIStStableFinalState);
       ev->AddParticle(*p);
       return;
     }
-  else if ( fRemnZ + (((pcode==kPdgProton)||(pcode==kPdgPiP))?1:0) - (pcode==kPdgPiM?1:0)
+  else if ( State().RemnZ + (((pcode==kPdgProton)||(pcode==kPdgPiP))?1:0) - (pcode==kPdgPiM?1:0)
 	    < ((( scode==kPdgProton)||( scode==kPdgPiP)) ?1:0) - (scode ==kPdgPiM ?1:0)
 	    + (((s2code==kPdgProton)||(s2code==kPdgPiP)) ?1:0) - (s2code==kPdgPiM ?1:0) )
     {
@@ -667,7 +667,7 @@ void HAIntranuke::InelasticHA(
   GHepParticle cl1(*p);
   GHepParticle cl2(t);
   bool success = utils::intranuke::TwoBodyCollision(ev,pcode,tcode,scode,s2code,C3CM,
-					       &cl1,&cl2,fRemnA,fRemnZ,fRemnP4,kIMdHA); 
+					       &cl1,&cl2,State().RemnA,State().RemnZ,State().RemnP4,kIMdHA); 
   if(success)
     {
       double P3L = TMath::Sqrt(cl1.Px()*cl1.Px() + cl1.Py()*cl1.Py() + cl1.Pz()*cl1.Pz());
@@ -690,7 +690,7 @@ void HAIntranuke::InelasticHA(
       // always get here, even nucleon decay
 	ev->AddParticle(cl1);
 	ev->AddParticle(cl2);
-	LOG("HAIntranuke", pDEBUG) << "Nucleus : (A,Z) = ("<<fRemnA<<','<<fRemnZ<<')';
+	LOG("HAIntranuke", pDEBUG) << "Nucleus : (A,Z) = ("<<State().RemnA<<','<<State().RemnZ<<')';
 
     } else
     {
@@ -746,7 +746,7 @@ void HAIntranuke::Inelastic(
       GHepParticle s3(*p);
 
       bool success = utils::intranuke::PionProduction(
-         ev,p,&s1,&s2,&s3,fRemnA,fRemnZ,fRemnP4, fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel);
+         ev,p,&s1,&s2,&s3,State().RemnA,State().RemnZ,State().RemnP4, fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel);
 
       if (success){
 	LOG ("HAIntranuke",pINFO) << " successful pion production fate";
@@ -782,21 +782,21 @@ void HAIntranuke::Inelastic(
       double ke = p->KinE() / units::MeV;
       int pdgc = p->Pdg();
 
-      if (fRemnA<2)
+      if (State().RemnA<2)
       {
 	  LOG("HAIntranuke", pNOTICE) << "stop  propagation - could not create absorption final state: too few particles";
       p->SetStatus(kIStStableFinalState);
       ev->AddParticle(*p);
       return;
       }
-      if (fRemnZ<1 && (pdgc==kPdgPiM || pdgc==kPdgKM))
+      if (State().RemnZ<1 && (pdgc==kPdgPiM || pdgc==kPdgKM))
       {
 	LOG("HAIntranuke", pNOTICE) << "stop propagation - could not create absorption final state: Pi- or K- cannot be absorbed by only neutrons";
 	p->SetStatus(kIStStableFinalState);
 	ev->AddParticle(*p);
 	return;
       }
-      if (fRemnA-fRemnZ<1 && (pdgc==kPdgPiP || pdgc==kPdgKP))
+      if (State().RemnA-State().RemnZ<1 && (pdgc==kPdgPiP || pdgc==kPdgKP))
       {
 	LOG("HAIntranuke", pINFO) << "stop propagation - could not create absorption final state: Pi+ or K+ cannot be absorbed by only protons";
 	p->SetStatus(kIStStableFinalState);
@@ -808,12 +808,12 @@ void HAIntranuke::Inelastic(
       //
       // added 03/21/11 - Aaron Meyer
       //
-      if (pdg::IsPion(pdgc) && rnd->RndFsi().Rndm()<1.14*(.903-0.00189*fRemnA)*(1.35-0.00467*ke))
+      if (pdg::IsPion(pdgc) && rnd->RndFsi().Rndm()<1.14*(.903-0.00189*State().RemnA)*(1.35-0.00467*ke))
 	{  // pi d -> N N, probability determined empirically with McKeown data
 
 	  INukeFateHN_t fate_hN=kIHNFtAbs;
 	  int t1code,t2code,scode,s2code;
-	  double ppcnt = (double) fRemnZ / (double) fRemnA; // % of protons
+	  double ppcnt = (double) State().RemnZ / (double) State().RemnA; // % of protons
 
 	  // choose target nucleon
 	  // -- fates weighted by values from Engel, Mosel...
@@ -908,15 +908,15 @@ void HAIntranuke::Inelastic(
 	  t4P2L=TLorentzVector(TVector3(tP2_1L+tP2_2L),E2L);
 	  double bindE=0.075; // set to fit McKeown data
 	  //double bindE=0.0; 
-	  if (utils::intranuke::TwoBodyKinematics(M3,M4,t4P1L,t4P2L,t4P3L,t4P4L,C3CM,fRemnP4,bindE))
+	  if (utils::intranuke::TwoBodyKinematics(M3,M4,t4P1L,t4P2L,t4P3L,t4P4L,C3CM,State().RemnP4,bindE))
 	    {
-	      if (pdgc==kPdgPiP || pdgc==kPdgKP) fRemnZ++;
-	      if (pdgc==kPdgPiM || pdgc==kPdgKM) fRemnZ--;
-	      if (t1code==kPdgProton) fRemnZ--;
-	      if (t2code==kPdgProton) fRemnZ--;
-	      fRemnA-=2;
+	      if (pdgc==kPdgPiP || pdgc==kPdgKP) State().RemnZ++;
+	      if (pdgc==kPdgPiM || pdgc==kPdgKM) State().RemnZ--;
+	      if (t1code==kPdgProton) State().RemnZ--;
+	      if (t2code==kPdgProton) State().RemnZ--;
+	      State().RemnA-=2;
 
-	      fRemnP4-=dNucl_P4;
+	      State().RemnP4-=dNucl_P4;
 
 	      // create t particles w/ appropriate momenta, code, and status
 	      // Set target's mom to be the mom of the hadron that was cloned
@@ -969,19 +969,19 @@ void HAIntranuke::Inelastic(
       if ( pdg::IsNeutronOrProton (pdgc) ) // nucleon probe
 	{
 	  // antisymmetric about Z=N
-	  if (fRemnA-fRemnZ > fRemnZ) 
-	    nd0 =  135.227 * TMath::Exp(-7.124*(fRemnA-fRemnZ)/double(fRemnA)) - 2.762;
+	  if (State().RemnA-State().RemnZ > State().RemnZ) 
+	    nd0 =  135.227 * TMath::Exp(-7.124*(State().RemnA-State().RemnZ)/double(State().RemnA)) - 2.762;
 	  else 
-	    nd0 = -135.227 * TMath::Exp(-7.124*        fRemnZ /double(fRemnA)) + 4.914; 
+	    nd0 = -135.227 * TMath::Exp(-7.124*        State().RemnZ /double(State().RemnA)) + 4.914; 
 
-	  Sig_nd = 2.034 + fRemnA * 0.007846;
+	  Sig_nd = 2.034 + State().RemnA * 0.007846;
 
 	  double c1 = 0.041 + ke * 0.0001525;
 	  double c2 = -0.003444 - ke * 0.00002324;
 //change last factor from 30 to 15 so that gam_ns always larger than 0
 //add check to be certain
 	  double c3 = 0.064 - ke * 0.000015;  
-	  gam_ns = c1 * TMath::Exp(c2*fRemnA) + c3;
+	  gam_ns = c1 * TMath::Exp(c2*State().RemnA) + c3;
 	  if(gam_ns<0.002) gam_ns = 0.002;
 	  //gam_ns = 10.;
 	  LOG("HAIntranuke", pINFO) << "nucleon absorption";
@@ -991,9 +991,9 @@ void HAIntranuke::Inelastic(
 	}
       else if ( pdgc==kPdgPiP || pdgc==kPdgPi0 || pdgc==kPdgPiM) //pion probe
 	{
-	  ns0 = .0001*(1.+ke/250.) * (fRemnA-10)*(fRemnA-10) + 3.5;
-	  nd0 = (1.+ke/250.) - ((fRemnA/200.)*(1. + 2.*ke/250.));
-	  Sig_ns = (10. + 4. * ke/250.)*TMath::Power(fRemnA/250.,0.9);  //(1. - TMath::Exp(-0.02*fRemnA));
+	  ns0 = .0001*(1.+ke/250.) * (State().RemnA-10)*(State().RemnA-10) + 3.5;
+	  nd0 = (1.+ke/250.) - ((State().RemnA/200.)*(1. + 2.*ke/250.));
+	  Sig_ns = (10. + 4. * ke/250.)*TMath::Power(State().RemnA/250.,0.9);  //(1. - TMath::Exp(-0.02*State().RemnA));
 	  Sig_nd = 4*(1 - TMath::Exp(-0.03*ke));
 	  LOG("HAIntranuke", pINFO) << "pion absorption";
 	  LOG("HAIntranuke", pINFO) << "--> mean diff distr = " << nd0 << ", stand dev = " << Sig_nd;
@@ -1031,7 +1031,7 @@ void HAIntranuke::Inelastic(
 	    LOG("HAIntranuke", pNOTICE) << "--> mean diff distr = " << nd0 << ", stand dev = " << Sig_nd;
 	    LOG("HAIntranuke", pNOTICE) << "--> mean sum distr = " << ns0 << ", Stand dev = " << Sig_ns;
 	    LOG("HAIntranuke", pNOTICE) << "--> gam_ns = " << gam_ns;
-	    LOG("HAIntranuke", pNOTICE) << "--> A = " << fRemnA << ", Z = " << fRemnZ << ", Energy = " << ke;
+	    LOG("HAIntranuke", pNOTICE) << "--> A = " << State().RemnA << ", Z = " << State().RemnZ << ", Energy = " << ke;
 	    exceptions::INukeException exception;
 	    exception.SetReason("Absorption choice of # of p,n failed");
 	    throw exception;
@@ -1070,7 +1070,7 @@ void HAIntranuke::Inelastic(
 	      // minimum allowed value is 0
 
 	      double max = ns0 + Sig_ns * 10;
-	      if(max>fRemnA) max=fRemnA;
+	      if(max>State().RemnA) max=State().RemnA;
 	      double x1 = 0;
 	      bool not_found = true;
 	      int iter2 = 0;
@@ -1082,7 +1082,7 @@ void HAIntranuke::Inelastic(
 		    {
 		      LOG("HAIntranuke", pNOTICE) << "Error: stuck in random variable loop for ns";
 		      LOG("HAIntranuke", pNOTICE) << "--> mean of sum parent distr = " << ns0 << ", Stand dev = " << Sig_ns;
-		      LOG("HAIntranuke", pNOTICE) << "--> A = " << fRemnA << ", Z = " << fRemnZ << ", Energy = " << ke;
+		      LOG("HAIntranuke", pNOTICE) << "--> A = " << State().RemnA << ", Z = " << State().RemnZ << ", Energy = " << ke;
 
 		      exceptions::INukeException exception;
 		      exception.SetReason("Random number generator for choice of #p,n final state failed - unusual - redo kinematics");
@@ -1115,7 +1115,7 @@ void HAIntranuke::Inelastic(
 	  nn = int((ns-nd)/2.+.5);
 
 	  LOG("HAIntranuke", pINFO) << "ns = "<<ns<<", nd = "<<nd<<", np = "<<np<<", nn = "<<nn;
-	  //LOG("HAIntranuke", pNOTICE) << "RemA = "<<fRemnA<<", RemZ = "<<fRemnZ<<", probe = "<<pdgc;
+	  //LOG("HAIntranuke", pNOTICE) << "RemA = "<<State().RemnA<<", RemZ = "<<State().RemnZ<<", probe = "<<pdgc;
 
 	  /*if ((ns+nd)/2. < 0 || (ns-nd)/2. < 0)  {iter++; continue;}
 	    else */ 
@@ -1123,9 +1123,9 @@ void HAIntranuke::Inelastic(
 	       if (np < 0 || nn < 0 )                 {iter++; continue;}
           else if (np + nn < 2. )                     {iter++; continue;}
           else if ((np + nn == 2.) &&  pdg::IsNeutronOrProton (pdgc))                     {iter++; continue;}
-          else if (np > fRemnZ + ((pdg::IsProton(pdgc) || pdgc==kPdgPiP || pdgc==kPdgKP)?1:0)
+          else if (np > State().RemnZ + ((pdg::IsProton(pdgc) || pdgc==kPdgPiP || pdgc==kPdgKP)?1:0)
 		   - ((pdgc==kPdgPiM || pdgc==kPdgKM)?1:0)) {iter++; continue;}
-          else if (nn > fRemnA-fRemnZ + ((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)
+          else if (nn > State().RemnA-State().RemnZ + ((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)
 		   - ((pdgc==kPdgPiP||pdgc==kPdgKP)?1:0)) {iter++; continue;}
 	  else { 
 	    not_done=false;   //success
@@ -1137,8 +1137,8 @@ void HAIntranuke::Inelastic(
 		nn = int(nn*frac);
 	      }
 
-	    if (  (np==fRemnZ       +((pdg::IsProton (pdgc)||pdgc==kPdgPiP||pdgc==kPdgKP)?1:0)-(pdgc==kPdgPiM||pdgc==kPdgKM?1:0))
-		&&(nn==fRemnA-fRemnZ+((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)-(pdgc==kPdgPiP||pdgc==kPdgKP?1:0)) )
+	    if (  (np==State().RemnZ       +((pdg::IsProton (pdgc)||pdgc==kPdgPiP||pdgc==kPdgKP)?1:0)-(pdgc==kPdgPiM||pdgc==kPdgKM?1:0))
+		&&(nn==State().RemnA-State().RemnZ+((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)-(pdgc==kPdgPiP||pdgc==kPdgKP?1:0)) )
 	      { // leave at least one nucleon in the nucleus to prevent excess momentum
 		if (rnd->RndFsi().Rndm()<np/(double)(np+nn)) np--;
 		else nn--;
@@ -1150,9 +1150,9 @@ void HAIntranuke::Inelastic(
 	} //while(not_done)
 
       // change remnants to reflect probe
-      if ( pdgc==kPdgProton || pdgc==kPdgPiP || pdgc==kPdgKP)     fRemnZ++;
-      if ( pdgc==kPdgPiM || pdgc==kPdgKM)                         fRemnZ--;
-      if ( pdg::IsNeutronOrProton (pdgc) )         fRemnA++;
+      if ( pdgc==kPdgProton || pdgc==kPdgPiP || pdgc==kPdgKP)     State().RemnZ++;
+      if ( pdgc==kPdgPiM || pdgc==kPdgKM)                         State().RemnZ--;
+      if ( pdg::IsNeutronOrProton (pdgc) )         State().RemnA++;
 
       // PhaseSpaceDecay forbids anything over 18 particles
       //
@@ -1196,18 +1196,18 @@ void HAIntranuke::Inelastic(
 	  GHepParticle * p4 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
 
 	  // To conserve 4-momenta
-	  //	  fRemnP4 -= probP4 + protP4*np_p + neutP4*(4-np_p) - *p->P4();
-	  fRemnP4 -= 5.*clusP4 - *p->P4();
+	  //	  State().RemnP4 -= probP4 + protP4*np_p + neutP4*(4-np_p) - *p->P4();
+	  State().RemnP4 -= 5.*clusP4 - *p->P4();
 
 	  for (int i=0;i<(np+nn);i++)
 	    {
 	      if (i<np)
 		{
 		  listar[i%5]->push_back(kPdgProton);
-		  fRemnZ--;
+		  State().RemnZ--;
 		}
 	      else listar[i%5]->push_back(kPdgNeutron);
-	      fRemnA--;
+	      State().RemnA--;
 	    }
 	  for (int i=0;i<5;i++)
 	    {
@@ -1243,18 +1243,18 @@ void HAIntranuke::Inelastic(
 		      pBuf = fFermiFac * fNuclmodel->Momentum3();
 		      eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
 		      tSum += TLorentzVector(pBuf,eBuf);
-		      fRemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
+		      State().RemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
 		    }
 		  TLorentzVector dP4 = tSum + TLorentzVector(TVector3(0,0,0),-mSum);
 		  p_ar[i]->SetMomentum(dP4);
 		}
 		}*/
 
-	  bool success1 = utils::intranuke::PhaseSpaceDecay(ev,p0,*listar[0],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success2 = utils::intranuke::PhaseSpaceDecay(ev,p1,*listar[1],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success3 = utils::intranuke::PhaseSpaceDecay(ev,p2,*listar[2],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success4 = utils::intranuke::PhaseSpaceDecay(ev,p3,*listar[3],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success5 = utils::intranuke::PhaseSpaceDecay(ev,p4,*listar[4],fRemnP4,fNucRmvE,kIMdHA);
+	  bool success1 = utils::intranuke::PhaseSpaceDecay(ev,p0,*listar[0],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success2 = utils::intranuke::PhaseSpaceDecay(ev,p1,*listar[1],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success3 = utils::intranuke::PhaseSpaceDecay(ev,p2,*listar[2],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success4 = utils::intranuke::PhaseSpaceDecay(ev,p3,*listar[3],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success5 = utils::intranuke::PhaseSpaceDecay(ev,p4,*listar[4],State().RemnP4,fNucRmvE,kIMdHA);
 	  if(success1 && success2 && success3 && success4 && success5)
 	    {
 	      LOG("HAIntranuke", pINFO)<<"Successful many-body absorption - n>=18";
@@ -1265,11 +1265,11 @@ void HAIntranuke::Inelastic(
 	      LOG("HAIntranuke", pWARN) << "PhaseSpace decay fails for HadrCluster- recovery likely incorrect - rethrow event";
 	      p->SetStatus(kIStStableFinalState);
 	      ev->AddParticle(*p);
-	      fRemnA+=np+nn;
-	      fRemnZ+=np;
-	      if ( pdgc==kPdgProton || pdgc==kPdgPiP )     fRemnZ--;
-	      if ( pdgc==kPdgPiM )                         fRemnZ++;
-	      if ( pdg::IsNeutronOrProton (pdgc) )         fRemnA--;	
+	      State().RemnA+=np+nn;
+	      State().RemnZ+=np;
+	      if ( pdgc==kPdgProton || pdgc==kPdgPiP )     State().RemnZ--;
+	      if ( pdgc==kPdgPiM )                         State().RemnZ++;
+	      if ( pdg::IsNeutronOrProton (pdgc) )         State().RemnA--;	
 		/*	      exceptions::INukeException exception;
 	      exception.SetReason("Phase space generation of absorption final state failed");
 	      throw exception;
@@ -1291,13 +1291,13 @@ void HAIntranuke::Inelastic(
 	  for (int i=0;i<np;i++)
 	    {
 	      list.push_back(kPdgProton);
-	      fRemnA--;
-	      fRemnZ--;
+	      State().RemnA--;
+	      State().RemnZ--;
 	    }
 	  for (int i=0;i<nn;i++)
 	    {
 	      list.push_back(kPdgNeutron);
-	      fRemnA--;
+	      State().RemnA--;
 	    }
 	  
 	  // Library instance for reference
@@ -1323,14 +1323,14 @@ void HAIntranuke::Inelastic(
 		  pBuf = fFermiFac * fNuclmodel->Momentum3();
 		  eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
 		  tSum += TLorentzVector(pBuf,eBuf);
-		  fRemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
+		  State().RemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
 		}
 	      TLorentzVector dP4 = tSum + TLorentzVector(TVector3(0,0,0),-mSum);
 	      p->SetMomentum(dP4);    
 	      }*/
 	  
 	  LOG("HAIntranuke", pDEBUG)
-	    << "Remnant nucleus (A,Z) = (" << fRemnA << ", " << fRemnZ << ")";
+	    << "Remnant nucleus (A,Z) = (" << State().RemnA << ", " << State().RemnZ << ")";
 	  LOG("HAIntranuke", pINFO) << " list size: " << np+nn;
 	  if (np+nn <2)
 	    {
@@ -1340,7 +1340,7 @@ void HAIntranuke::Inelastic(
 	    }
 	  //	  GHepParticle * cl = new GHepParticle(*p);
 	  //	  cl->SetPdgCode(kPdgDecayNuclCluster);
-	  bool success = utils::intranuke::PhaseSpaceDecay(ev,p,list,fRemnP4,fNucRmvE,kIMdHA);
+	  bool success = utils::intranuke::PhaseSpaceDecay(ev,p,list,State().RemnP4,fNucRmvE,kIMdHA);
 	  if (success)
 	    {
 	      LOG ("HAIntranuke",pINFO) << "Successful many-body absorption, n<=18";
@@ -1349,11 +1349,11 @@ void HAIntranuke::Inelastic(
 	    // recover
 	    p->SetStatus(kIStStableFinalState);
 	    ev->AddParticle(*p);
-	    fRemnA+=np+nn;
-	    fRemnZ+=np;
-	    if ( pdgc==kPdgProton || pdgc==kPdgPiP )     fRemnZ--;
-	    if ( pdgc==kPdgPiM )                         fRemnZ++;
-	    if ( pdg::IsNeutronOrProton (pdgc) )         fRemnA--;	
+	    State().RemnA+=np+nn;
+	    State().RemnZ+=np;
+	    if ( pdgc==kPdgProton || pdgc==kPdgPiP )     State().RemnZ--;
+	    if ( pdgc==kPdgPiM )                         State().RemnZ++;
+	    if ( pdg::IsNeutronOrProton (pdgc) )         State().RemnA--;	
 	    exceptions::INukeException exception;
 	    exception.SetReason("Phase space generation of absorption final state failed");
 	    throw exception;
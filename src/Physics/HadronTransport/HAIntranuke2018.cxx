@@ -197,7 +197,7 @@ void HAIntranuke2018::SimulateHadronicFinalStateKinematics(
 	else if (fate == kIHAFtCmp) //(suarez edit, 17 July, 2017: cmp)
 	  {
 	    LOG("HAIntranuke2018", pWARN) << "Running PreEquilibrium for kIHAFtCmp";
-	    utils::intranuke2018::PreEquilibrium(ev,p,fRemnA,fRemnZ,fRemnP4,fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHA); //should be kiMdHA or HN?
+	    utils::intranuke2018::PreEquilibrium(ev,p,State().RemnA,State().RemnZ,State().RemnP4,fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHA); //should be kiMdHA or HN?
 	  }
     }
   catch(exceptions::INukeException exception)
@@ -497,9 +497,9 @@ void HAIntranuke2018::ElasHA(
       } */
 
   // check remnants
-  if(fRemnA<0 || fRemnZ<0) // best to stop it here and not try again.
+  if(State().RemnA<0 || State().RemnZ<0) // best to stop it here and not try again.
     {
-      LOG("HAIntranuke2018", pWARN) << "Invalid Nucleus! : (A,Z) = ("<<fRemnA<<','<<fRemnZ<<')';
+      LOG("HAIntranuke2018", pWARN) << "Invalid Nucleus! : (A,Z) = ("<<State().RemnA<<','<<State().RemnZ<<')';
       p->SetStatus(kIStStableFinalState);
       ev->AddParticle(*p);
       return;
@@ -509,14 +509,14 @@ void HAIntranuke2018::ElasHA(
   int pcode = p->Pdg();
   double Mp = p->Mass();
   double Mt = 0.;
-  if (ev->TargetNucleus()->A()==fRemnA)
-    { Mt = PDGLibrary::Instance()->Find(ev->TargetNucleus()->Pdg())->Mass(); }
+  if (ev->TargetNucleus()->A()==State().RemnA)
+    { Mt = PDGLibrary::Instance()->Mass(ev->TargetNucleus()->Pdg()); }
   else 
     {
-      Mt = fRemnP4.M();
+      Mt = State().RemnP4.M();
     }
   TLorentzVector t4PpL = *p->P4();
-  TLorentzVector t4PtL = fRemnP4;
+  TLorentzVector t4PtL = State().RemnP4;
   double C3CM = 0.0;
 
   // calculate scattering angle
@@ -526,7 +526,7 @@ void HAIntranuke2018::ElasHA(
   // calculate final 4 momentum of probe
   TLorentzVector t4P3L, t4P4L;
 
-  if (!utils::intranuke2018::TwoBodyKinematics(Mp,Mt,t4PpL,t4PtL,t4P3L,t4P4L,C3CM,fRemnP4))
+  if (!utils::intranuke2018::TwoBodyKinematics(Mp,Mt,t4PpL,t4PtL,t4P3L,t4P4L,C3CM,State().RemnP4))
     {
       LOG("HAIntranuke2018", pNOTICE) << "ElasHA() failed";
       exceptions::INukeException exception;
@@ -539,13 +539,13 @@ void HAIntranuke2018::ElasHA(
   p->SetStatus(kIStStableFinalState);
 
   // Update Remnant nucleus
-  fRemnP4 = t4P4L;
+  State().RemnP4 = t4P4L;
   LOG("HAIntranuke2018",pINFO)
     << "C3cm = " << C3CM;
   LOG("HAIntranuke2018",pINFO)
     << "|p3| = " << t4P3L.Vect().Mag()   << ", E3 = " << t4P3L.E() << ",Mp = " << Mp;
   LOG("HAIntranuke2018",pINFO)
-    << "|p4| = " << fRemnP4.Vect().Mag() << ", E4 = " << fRemnP4.E() << ",Mt = " << Mt;
+    << "|p4| = " << State().RemnP4.Vect().Mag() << ", E4 = " << State().RemnP4.E() << ",Mt = " << Mt;
 
   ev->AddParticle(*p);
 
@@ -578,7 +578,7 @@ void HAIntranuke2018::InelasticHA(
   // vars for incoming particle, target, and scattered pdg codes
   int pcode = p->Pdg();
   int tcode, scode, s2code;
-  double ppcnt = (double) fRemnZ / (double) fRemnA; // % of protons
+  double ppcnt = (double) State().RemnZ / (double) State().RemnA; // % of protons
 
   // Select a hadron fate in HN mode
   INukeFateHN_t h_fate;
@@ -618,14 +618,14 @@ void HAIntranuke2018::InelasticHA(
     }
 
   // check remnants
-  if ( fRemnA < 1 )    //we've blown nucleus apart, no need to retry anything - exit
+  if ( State().RemnA < 1 )    //we've blown nucleus apart, no need to retry anything - exit
     {
       LOG("HAIntranuke2018",pNOTICE) << "InelasticHA() stops : not enough nucleons";
       p->SetStatus(kIStStableFinalState);
       ev->AddParticle(*p);
       return;
     }
-  else if ( fRemnZ + (((pcode==kPdgProton)||(pcode==kPdgPiP))?1:0) - (pcode==kPdgPiM?1:0)
+  else if ( State().RemnZ + (((pcode==kPdgProton)||(pcode==kPdgPiP))?1:0) - (pcode==kPdgPiM?1:0)
 	    < ((( scode==kPdgProton)||( scode==kPdgPiP)) ?1:0) - (scode ==kPdgPiM ?1:0)
 	    + (((s2code==kPdgProton)||(s2code==kPdgPiP)) ?1:0) - (s2code==kPdgPiM ?1:0) )
     {
@@ -679,7 +679,7 @@ void HAIntranuke2018::InelasticHA(
   GHepParticle cl1(*p);
   GHepParticle cl2(t);
   bool success = utils::intranuke2018::TwoBodyCollision(ev,pcode,tcode,scode,s2code,C3CM,
-					       &cl1,&cl2,fRemnA,fRemnZ,fRemnP4,kIMdHA); 
+					       &cl1,&cl2,State().RemnA,State().RemnZ,State().RemnP4,kIMdHA); 
   if(success)
     {
       double P3L = TMath::Sqrt(cl1.Px()*cl1.Px() + cl1.Py()*cl1.Py() + cl1.Pz()*cl1.Pz());
@@ -692,26 +692,26 @@ void HAIntranuke2018::InelasticHA(
 	<< P3L << "   " << E3L << "  P4L, E4L = "<< P4L << "   " << E4L ;
       if(ev->Probe() ) { LOG("HAIntranuke",pINFO)
 	  << "P4L = " << P4L << " ;E4L=  " << E4L << "\n probe KE = " << ev->Probe()->KinE() << "\n";
-	LOG("HAIntranuke2018", pINFO) << "Nucleus : (A,Z) = ("<<fRemnA<<','<<fRemnZ<<')';
+	LOG("HAIntranuke2018", pINFO) << "Nucleus : (A,Z) = ("<<State().RemnA<<','<<State().RemnZ<<')';
 	TParticlePDG * remn = 0;
 	double MassRem = 0.;
-	int ipdgc = pdg::IonPdgCode(fRemnA, fRemnZ);
+	int ipdgc = pdg::IonPdgCode(State().RemnA, State().RemnZ);
 	remn = PDGLibrary::Instance()->Find(ipdgc);
 	if(!remn) 
 	  {
 	    LOG("HAIntranuke2018", pINFO)
-	      << "NO Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+	      << "NO Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 	      << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 	  }
 	else
 	  {
 	    MassRem = remn->Mass();
 	    LOG("HAIntranuke2018", pINFO)
-	      << "Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+	      << "Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 	      << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 	  }
-	double ERemn = fRemnP4.E();
-	double PRemn = TMath::Sqrt(fRemnP4.Px()*fRemnP4.Px() + fRemnP4.Py()*fRemnP4.Py() + fRemnP4.Pz()*fRemnP4.Pz());
+	double ERemn = State().RemnP4.E();
+	double PRemn = TMath::Sqrt(State().RemnP4.Px()*State().RemnP4.Px() + State().RemnP4.Py()*State().RemnP4.Py() + State().RemnP4.Pz()*State().RemnP4.Pz());
 	double MRemn = TMath::Sqrt(ERemn*ERemn - PRemn*PRemn);
 	LOG("HAIntranuke2018",pINFO) << "PRemn = " << PRemn << " ;ERemn=  " << ERemn;
 	LOG("HAIntranuke2018",pINFO) << "MRemn=  " << MRemn << "  ;true Mass=  " << MassRem << "   ; excitation energy= " << (MRemn-MassRem)*1000. << " MeV";
@@ -727,7 +727,7 @@ void HAIntranuke2018::InelasticHA(
       ev->AddParticle(cl1);
       ev->AddParticle(cl2);
 
-      LOG("HAIntranuke2018", pDEBUG) << "Nucleus : (A,Z) = ("<<fRemnA<<','<<fRemnZ<<')';
+      LOG("HAIntranuke2018", pDEBUG) << "Nucleus : (A,Z) = ("<<State().RemnA<<','<<State().RemnZ<<')';
     } else
     {
       exceptions::INukeException exception;
@@ -782,7 +782,7 @@ void HAIntranuke2018::Inelastic(
       GHepParticle s3(*p);
 
       bool success = utils::intranuke2018::PionProduction(
-         ev,p,&s1,&s2,&s3,fRemnA,fRemnZ,fRemnP4, fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel);
+         ev,p,&s1,&s2,&s3,State().RemnA,State().RemnZ,State().RemnP4, fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel);
 
       if (success){
 	LOG ("HAIntranuke2018",pINFO) << " successful pion production fate";
@@ -818,21 +818,21 @@ void HAIntranuke2018::Inelastic(
       double ke = p->KinE() / units::MeV;
       int pdgc = p->Pdg();
 
-      if (fRemnA<2)
+      if (State().RemnA<2)
       {
 	  LOG("HAIntranuke2018", pNOTICE) << "stop  propagation - could not create absorption final state: too few particles";
       p->SetStatus(kIStStableFinalState);
       ev->AddParticle(*p);
       return;
       }
-      if (fRemnZ<1 && (pdgc==kPdgPiM || pdgc==kPdgKM))
+      if (State().RemnZ<1 && (pdgc==kPdgPiM || pdgc==kPdgKM))
       {
 	LOG("HAIntranuke2018", pNOTICE) << "stop propagation - could not create absorption final state: Pi- or K- cannot be absorbed by only neutrons";
 	p->SetStatus(kIStStableFinalState);
 	ev->AddParticle(*p);
 	return;
       }
-      if (fRemnA-fRemnZ<1 && (pdgc==kPdgPiP || pdgc==kPdgKP))
+      if (State().RemnA-State().RemnZ<1 && (pdgc==kPdgPiP || pdgc==kPdgKP))
       {
 	LOG("HAIntranuke2018", pINFO) << "stop propagation - could not create absorption final state: Pi+ or K+ cannot be absorbed by only protons";
 	p->SetStatus(kIStStableFinalState);
@@ -844,12 +844,12 @@ void HAIntranuke2018::Inelastic(
       //
       // added 03/21/11 - Aaron Meyer
       //
-      if (pdg::IsPion(pdgc) && rnd->RndFsi().Rndm()<1.14*(.903-0.00189*fRemnA)*(1.35-0.00467*ke))
+      if (pdg::IsPion(pdgc) && rnd->RndFsi().Rndm()<1.14*(.903-0.00189*State().RemnA)*(1.35-0.00467*ke))
 	{  // pi d -> N N, probability determined empirically with McKeown data
 
 	  INukeFateHN_t fate_hN=kIHNFtAbs;
 	  int t1code,t2code,scode,s2code;
-	  double ppcnt = (double) fRemnZ / (double) fRemnA; // % of protons
+	  double ppcnt = (double) State().RemnZ / (double) State().RemnA; // % of protons
 
 	  // choose target nucleon
 	  // -- fates weighted by values from Engel, Mosel...
@@ -889,12 +889,12 @@ void HAIntranuke2018::Inelastic(
 	  }
 	  LOG("HAIntranuke2018",pINFO) << "choose 2 body absorption, probe, fs = " << pdgc <<"  "<< scode <<"  "<<s2code;
 	  // assign proper masses
-	  //double M1   = pLib->Find(pdgc) ->Mass();
-	  double M2_1 = pLib->Find(t1code)->Mass();
-	  double M2_2 = pLib->Find(t2code)->Mass();
+	  //double M1   = pLib->Mass(pdgc);
+	  double M2_1 = pLib->Mass(t1code);
+	  double M2_2 = pLib->Mass(t2code);
 	  //double M2   = M2_1 + M2_2;
-	  double M3   = pLib->Find(scode) ->Mass();
-	  double M4   = pLib->Find(s2code)->Mass();
+	  double M3   = pLib->Mass(scode);
+	  double M4   = pLib->Mass(s2code);
 
 	  // handle fermi momentum 
 	  double E2_1L, E2_2L;
@@ -945,37 +945,37 @@ void HAIntranuke2018::Inelastic(
 	  t4P2L=TLorentzVector(TVector3(tP2_1L+tP2_2L),E2L);
 	  double bindE=0.050; // set to fit McKeown data, updated aug 18
 	  //double bindE=0.0; 
-	  if (utils::intranuke2018::TwoBodyKinematics(M3,M4,t4P1L,t4P2L,t4P3L,t4P4L,C3CM,fRemnP4,bindE))
+	  if (utils::intranuke2018::TwoBodyKinematics(M3,M4,t4P1L,t4P2L,t4P3L,t4P4L,C3CM,State().RemnP4,bindE))
 	    {
 	      //construct remnant nucleus and its mass
 
-	      if (pdgc==kPdgPiP || pdgc==kPdgKP) fRemnZ++;
-	      if (pdgc==kPdgPiM || pdgc==kPdgKM) fRemnZ--;
-	      if (t1code==kPdgProton) fRemnZ--;
-	      if (t2code==kPdgProton) fRemnZ--;
-	      fRemnA-=2;
+	      if (pdgc==kPdgPiP || pdgc==kPdgKP) State().RemnZ++;
+	      if (pdgc==kPdgPiM || pdgc==kPdgKM) State().RemnZ--;
+	      if (t1code==kPdgProton) State().RemnZ--;
+	      if (t2code==kPdgProton) State().RemnZ--;
+	      State().RemnA-=2;
 
-	      fRemnP4-=dNucl_P4;
+	      State().RemnP4-=dNucl_P4;
 
 	      TParticlePDG * remn = 0;
 	      double MassRem = 0.;
-	      int ipdgc = pdg::IonPdgCode(fRemnA, fRemnZ);
+	      int ipdgc = pdg::IonPdgCode(State().RemnA, State().RemnZ);
 	      remn = PDGLibrary::Instance()->Find(ipdgc);
 	      if(!remn) 
 		{
 		  LOG("HAIntranuke2018", pINFO)
-		    << "NO Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+		    << "NO Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 		    << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 		}
 	      else
 		{
 		  MassRem = remn->Mass();
 		  LOG("HAIntranuke2018", pINFO)
-		    << "Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+		    << "Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 		    << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 		}
-	      double ERemn = fRemnP4.E();
-	      double PRemn = TMath::Sqrt(fRemnP4.Px()*fRemnP4.Px() + fRemnP4.Py()*fRemnP4.Py() + fRemnP4.Pz()*fRemnP4.Pz());
+	      double ERemn = State().RemnP4.E();
+	      double PRemn = TMath::Sqrt(State().RemnP4.Px()*State().RemnP4.Px() + State().RemnP4.Py()*State().RemnP4.Py() + State().RemnP4.Pz()*State().RemnP4.Pz());
 	      double MRemn = TMath::Sqrt(ERemn*ERemn - PRemn*PRemn);
 	      LOG("HAIntranuke2018",pINFO) << "PRemn = " << PRemn << " ;ERemn=  " << ERemn;
 	      LOG("HAIntranuke2018",pINFO) << "expt MRemn=  " << MRemn << "  ;true Mass=  " << MassRem << "   ; excitation energy (>0 good)= " << (MRemn-MassRem)*1000. << " MeV";
@@ -1031,19 +1031,19 @@ void HAIntranuke2018::Inelastic(
       if ( pdg::IsNeutronOrProton (pdgc) ) // nucleon probe
 	{
 	  // antisymmetric about Z=N
-	  if (fRemnA-fRemnZ > fRemnZ) 
-	    nd0 =  135.227 * TMath::Exp(-7.124*(fRemnA-fRemnZ)/double(fRemnA)) - 2.762;
+	  if (State().RemnA-State().RemnZ > State().RemnZ) 
+	    nd0 =  135.227 * TMath::Exp(-7.124*(State().RemnA-State().RemnZ)/double(State().RemnA)) - 2.762;
 	  else 
-	    nd0 = -135.227 * TMath::Exp(-7.124*        fRemnZ /double(fRemnA)) + 4.914; 
+	    nd0 = -135.227 * TMath::Exp(-7.124*        State().RemnZ /double(State().RemnA)) + 4.914; 
 
-	  Sig_nd = 2.034 + fRemnA * 0.007846;
+	  Sig_nd = 2.034 + State().RemnA * 0.007846;
 
 	  double c1 = 0.041 + ke * 0.0001525;
 	  double c2 = -0.003444 - ke * 0.00002324;
 //change last factor from 30 to 15 so that gam_ns always larger than 0
 //add check to be certain
 	  double c3 = 0.064 - ke * 0.000015;  
-	  gam_ns = c1 * TMath::Exp(c2*fRemnA) + c3;
+	  gam_ns = c1 * TMath::Exp(c2*State().RemnA) + c3;
 	  if(gam_ns<0.002) gam_ns = 0.002;
 	  //gam_ns = 10.;
 	  LOG("HAIntranuke2018", pINFO) << "nucleon absorption";
@@ -1053,9 +1053,9 @@ void HAIntranuke2018::Inelastic(
 	}
       else if ( pdgc==kPdgPiP || pdgc==kPdgPi0 || pdgc==kPdgPiM) //pion probe
 	{
-	  ns0 = .0001*(1.+ke/250.) * (fRemnA-10)*(fRemnA-10) + 3.5;
-	  nd0 = (1.+ke/250.) - ((fRemnA/200.)*(1. + 2.*ke/250.));
-	  Sig_ns = (10. + 4. * ke/250.)*TMath::Power(fRemnA/250.,0.9);  //(1. - TMath::Exp(-0.02*fRemnA));
+	  ns0 = .0001*(1.+ke/250.) * (State().RemnA-10)*(State().RemnA-10) + 3.5;
+	  nd0 = (1.+ke/250.) - ((State().RemnA/200.)*(1. + 2.*ke/250.));
+	  Sig_ns = (10. + 4. * ke/250.)*TMath::Power(State().RemnA/250.,0.9);  //(1. - TMath::Exp(-0.02*State().RemnA));
 	  Sig_nd = 4*(1 - TMath::Exp(-0.03*ke));
 	  LOG("HAIntranuke2018", pINFO) << "pion absorption";
 	  LOG("HAIntranuke2018", pINFO) << "--> mean diff distr = " << nd0 << ", stand dev = " << Sig_nd;
@@ -1093,7 +1093,7 @@ void HAIntranuke2018::Inelastic(
 	    LOG("HAIntranuke2018", pNOTICE) << "--> mean diff distr = " << nd0 << ", stand dev = " << Sig_nd;
 	    LOG("HAIntranuke2018", pNOTICE) << "--> mean sum distr = " << ns0 << ", Stand dev = " << Sig_ns;
 	    LOG("HAIntranuke2018", pNOTICE) << "--> gam_ns = " << gam_ns;
-	    LOG("HAIntranuke2018", pNOTICE) << "--> A = " << fRemnA << ", Z = " << fRemnZ << ", Energy = " << ke;
+	    LOG("HAIntranuke2018", pNOTICE) << "--> A = " << State().RemnA << ", Z = " << State().RemnZ << ", Energy = " << ke;
 	    exceptions::INukeException exception;
 	    exception.SetReason("Absorption choice of # of p,n failed");
 	    throw exception;
@@ -1132,7 +1132,7 @@ void HAIntranuke2018::Inelastic(
 	      // minimum allowed value is 0
 
 	      double max = ns0 + Sig_ns * 10;
-	      if(max>fRemnA) max=fRemnA;
+	      if(max>State().RemnA) max=State().RemnA;
 	      double x1 = 0;
 	      bool not_found = true;
 	      int iter2 = 0;
@@ -1144,7 +1144,7 @@ void HAIntranuke2018::Inelastic(
 		    {
 		      LOG("HAIntranuke2018", pNOTICE) << "Error: stuck in random variable loop for ns";
 		      LOG("HAIntranuke2018", pNOTICE) << "--> mean of sum parent distr = " << ns0 << ", Stand dev = " << Sig_ns;
-		      LOG("HAIntranuke2018", pNOTICE) << "--> A = " << fRemnA << ", Z = " << fRemnZ << ", Energy = " << ke;
+		      LOG("HAIntranuke2018", pNOTICE) << "--> A = " << State().RemnA << ", Z = " << State().RemnZ << ", Energy = " << ke;
 
 		      exceptions::INukeException exception;
 		      exception.SetReason("Random number generator for choice of #p,n final state failed - unusual - redo kinematics");
@@ -1177,7 +1177,7 @@ void HAIntranuke2018::Inelastic(
 	  nn = int((ns-nd)/2.+.5);
 
 	  LOG("HAIntranuke2018", pINFO) << "ns = "<<ns<<", nd = "<<nd<<", np = "<<np<<", nn = "<<nn;
-	  //LOG("HAIntranuke2018", pNOTICE) << "RemA = "<<fRemnA<<", RemZ = "<<fRemnZ<<", probe = "<<pdgc;
+	  //LOG("HAIntranuke2018", pNOTICE) << "RemA = "<<State().RemnA<<", RemZ = "<<State().RemnZ<<", probe = "<<pdgc;
 
 	  /*if ((ns+nd)/2. < 0 || (ns-nd)/2. < 0)  {iter++; continue;}
 	    else */ 
@@ -1185,9 +1185,9 @@ void HAIntranuke2018::Inelastic(
 	       if (np < 0 || nn < 0 )                 {iter++; continue;}
           else if (np + nn < 2. )                     {iter++; continue;}
           else if ((np + nn == 2.) &&  pdg::IsNeutronOrProton (pdgc))                     {iter++; continue;}
-          else if (np > fRemnZ + ((pdg::IsProton(pdgc) || pdgc==kPdgPiP || pdgc==kPdgKP)?1:0)
+          else if (np > State().RemnZ + ((pdg::IsProton(pdgc) || pdgc==kPdgPiP || pdgc==kPdgKP)?1:0)
 		   - ((pdgc==kPdgPiM || pdgc==kPdgKM)?1:0)) {iter++; continue;}
-          else if (nn > fRemnA-fRemnZ + ((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)
+          else if (nn > State().RemnA-State().RemnZ + ((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)
 		   - ((pdgc==kPdgPiP||pdgc==kPdgKP)?1:0)) {iter++; continue;}
 	  else { 
 	    not_done=false;   //success
@@ -1199,8 +1199,8 @@ void HAIntranuke2018::Inelastic(
 		nn = int(nn*frac);
 	      }
 
-	    if (  (np==fRemnZ       +((pdg::IsProton (pdgc)||pdgc==kPdgPiP||pdgc==kPdgKP)?1:0)-(pdgc==kPdgPiM||pdgc==kPdgKM?1:0))
-		&&(nn==fRemnA-fRemnZ+((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)-(pdgc==kPdgPiP||pdgc==kPdgKP?1:0)) )
+	    if (  (np==State().RemnZ       +((pdg::IsProton (pdgc)||pdgc==kPdgPiP||pdgc==kPdgKP)?1:0)-(pdgc==kPdgPiM||pdgc==kPdgKM?1:0))
+		&&(nn==State().RemnA-State().RemnZ+((pdg::IsNeutron(pdgc)||pdgc==kPdgPiM||pdgc==kPdgKM)?1:0)-(pdgc==kPdgPiP||pdgc==kPdgKP?1:0)) )
 	      { // leave at least one nucleon in the nucleus to prevent excess momentum
 		if (rnd->RndFsi().Rndm()<np/(double)(np+nn)) np--;
 		else nn--;
@@ -1212,9 +1212,9 @@ void HAIntranuke2018::Inelastic(
 	} //while(not_done)
 
       // change remnants to reflect probe
-      if ( pdgc==kPdgProton || pdgc==kPdgPiP || pdgc==kPdgKP)     fRemnZ++;
-      if ( pdgc==kPdgPiM || pdgc==kPdgKM)                         fRemnZ--;
-      if ( pdg::IsNeutronOrProton (pdgc) )         fRemnA++;
+      if ( pdgc==kPdgProton || pdgc==kPdgPiP || pdgc==kPdgKP)     State().RemnZ++;
+      if ( pdgc==kPdgPiM || pdgc==kPdgKM)                         State().RemnZ--;
+      if ( pdg::IsNeutronOrProton (pdgc) )         State().RemnA++;
 
       // PhaseSpaceDecay forbids anything over 18 particles
       //
@@ -1240,7 +1240,7 @@ void HAIntranuke2018::Inelastic(
 	  //set up HadronClusters
 	  // simple for now, each (of 5) in hadron cluster has 1/5 of mom and KE
 
-       	  double probM = pLib->Find(pdgc)   ->Mass();
+       	  double probM = pLib->Mass(pdgc);
 	  probM -= .025;   // BE correction
 	  TVector3 pP3 = p->P4()->Vect() * (1./5.);
 	  double probKE = p->P4()->E() -probM;
@@ -1259,18 +1259,18 @@ void HAIntranuke2018::Inelastic(
 	  GHepParticle * p4 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
 
 	  // To conserve 4-momenta
-	  //	  fRemnP4 -= probP4 + protP4*np_p + neutP4*(4-np_p) - *p->P4();
-	  fRemnP4 -= 5.*clusP4 - *p->P4();
+	  //	  State().RemnP4 -= probP4 + protP4*np_p + neutP4*(4-np_p) - *p->P4();
+	  State().RemnP4 -= 5.*clusP4 - *p->P4();
 
 	  for (int i=0;i<(np+nn);i++)
 	    {
 	      if (i<np)
 		{
 		  listar[i%5]->push_back(kPdgProton);
-		  fRemnZ--;
+		  State().RemnZ--;
 		}
 	      else listar[i%5]->push_back(kPdgNeutron);
-	      fRemnA--;
+	      State().RemnA--;
 	    }
 	  for (int i=0;i<5;i++)
 	    {
@@ -1301,46 +1301,46 @@ void HAIntranuke2018::Inelastic(
 		    {
 		      target.SetHitNucPdg(*pdg_iter); 
 		      fNuclmodel->GenerateNucleon(target);
-		      mBuf = pLib->Find(*pdg_iter)->Mass();
+		      mBuf = pLib->Mass(*pdg_iter);
 		      mSum += mBuf;
 		      pBuf = fFermiFac * fNuclmodel->Momentum3();
 		      eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
 		      tSum += TLorentzVector(pBuf,eBuf);
-		      fRemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
+		      State().RemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
 		    }
 		  TLorentzVector dP4 = tSum + TLorentzVector(TVector3(0,0,0),-mSum);
 		  p_ar[i]->SetMomentum(dP4);
 		}
 		}*/
 
-	  bool success1 = utils::intranuke2018::PhaseSpaceDecay(ev,p0,*listar[0],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success2 = utils::intranuke2018::PhaseSpaceDecay(ev,p1,*listar[1],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success3 = utils::intranuke2018::PhaseSpaceDecay(ev,p2,*listar[2],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success4 = utils::intranuke2018::PhaseSpaceDecay(ev,p3,*listar[3],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success5 = utils::intranuke2018::PhaseSpaceDecay(ev,p4,*listar[4],fRemnP4,fNucRmvE,kIMdHA);
+	  bool success1 = utils::intranuke2018::PhaseSpaceDecay(ev,p0,*listar[0],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success2 = utils::intranuke2018::PhaseSpaceDecay(ev,p1,*listar[1],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success3 = utils::intranuke2018::PhaseSpaceDecay(ev,p2,*listar[2],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success4 = utils::intranuke2018::PhaseSpaceDecay(ev,p3,*listar[3],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success5 = utils::intranuke2018::PhaseSpaceDecay(ev,p4,*listar[4],State().RemnP4,fNucRmvE,kIMdHA);
 	  if(success1 && success2 && success3 && success4 && success5)
 	    {
 	      LOG("HAIntranuke2018", pINFO)<<"Successful many-body absorption - n>=18";
-	      LOG("HAIntranuke2018", pDEBUG) << "Nucleus : (A,Z) = ("<<fRemnA<<','<<fRemnZ<<')';
+	      LOG("HAIntranuke2018", pDEBUG) << "Nucleus : (A,Z) = ("<<State().RemnA<<','<<State().RemnZ<<')';
 	      TParticlePDG * remn = 0;
 	      double MassRem = 0.;
-	      int ipdgc = pdg::IonPdgCode(fRemnA, fRemnZ);
+	      int ipdgc = pdg::IonPdgCode(State().RemnA, State().RemnZ);
 	      remn = PDGLibrary::Instance()->Find(ipdgc);
 	      if(!remn) 
 		{
 		  LOG("HAIntranuke2018", pINFO)
-		    << "NO Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+		    << "NO Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 		    << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 		}
 	      else
 		{
 		  MassRem = remn->Mass();
 		  LOG("HAIntranuke2018", pINFO)
-		    << "Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+		    << "Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 		    << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 		}
-	      double ERemn = fRemnP4.E();
-	      double PRemn = TMath::Sqrt(fRemnP4.Px()*fRemnP4.Px() + fRemnP4.Py()*fRemnP4.Py() + fRemnP4.Pz()*fRemnP4.Pz());
+	      double ERemn = State().RemnP4.E();
+	      double PRemn = TMath::Sqrt(State().RemnP4.Px()*State().RemnP4.Px() + State().RemnP4.Py()*State().RemnP4.Py() + State().RemnP4.Pz()*State().RemnP4.Pz());
 	      double MRemn = TMath::Sqrt(ERemn*ERemn - PRemn*PRemn);
 	      LOG("HAIntranuke2018",pINFO) << "PRemn = " << PRemn << " ;ERemn=  " << ERemn;
 	      LOG("HAIntranuke2018",pINFO) << "MRemn=  " << MRemn << "  ;true Mass=  " << MassRem << "   ; excitation energy (>0 good)= " << (MRemn-MassRem)*1000. << " MeV";
@@ -1352,11 +1352,11 @@ void HAIntranuke2018::Inelastic(
 	      LOG("HAIntranuke2018", pWARN) << "PhaseSpace decay fails for HadrCluster- recovery likely incorrect - rethrow event";
 	      p->SetStatus(kIStStableFinalState);
 	      ev->AddParticle(*p);
-	      fRemnA+=np+nn;
-	      fRemnZ+=np;
-	      if ( pdgc==kPdgProton || pdgc==kPdgPiP )     fRemnZ--;
-	      if ( pdgc==kPdgPiM )                         fRemnZ++;
-	      if ( pdg::IsNeutronOrProton (pdgc) )         fRemnA--;	
+	      State().RemnA+=np+nn;
+	      State().RemnZ+=np;
+	      if ( pdgc==kPdgProton || pdgc==kPdgPiP )     State().RemnZ--;
+	      if ( pdgc==kPdgPiM )                         State().RemnZ++;
+	      if ( pdg::IsNeutronOrProton (pdgc) )         State().RemnA--;	
 		/*	      exceptions::INukeException exception;
 	      exception.SetReason("Phase space generation of absorption final state failed");
 	      throw exception;
@@ -1377,18 +1377,18 @@ void HAIntranuke2018::Inelastic(
 	  if (pdgc==kPdgKM)  list.push_back(kPdgKM);
 	  /*
 	  TParticlePDG * remn0 = 0;
-	  int ipdgc0 = pdg::IonPdgCode(fRemnA, fRemnZ);
+	  int ipdgc0 = pdg::IonPdgCode(State().RemnA, State().RemnZ);
 	  remn0 = PDGLibrary::Instance()->Find(ipdgc0);
 	  double Mass0 = remn0->Mass();
 	  TParticlePDG * remnt = 0;
-	  int ipdgct = pdg::IonPdgCode(fRemnA-(nn+np), fRemnZ-np);
+	  int ipdgct = pdg::IonPdgCode(State().RemnA-(nn+np), State().RemnZ-np);
 	  remnt = PDGLibrary::Instance()->Find(ipdgct);
 	  double MassRemt = remnt->Mass();
 	  LOG("HAIntranuke2018",pINFO) << "Mass0 = " << Mass0 << " ;Masst=  " << MassRemt << "  ; diff/nucleon= "<< (Mass0-MassRemt)/(np+nn);
 	  */
 	  //set up HadronCluster
 
-       	  double probM = pLib->Find(pdgc)   ->Mass();
+       	  double probM = pLib->Mass(pdgc);
 	  double probBE = (np+nn)*.005;   // BE correction
 	  TVector3 pP3 = p->P4()->Vect();
 	  double probKE = p->P4()->E() - (probM - probBE);
@@ -1402,18 +1402,18 @@ void HAIntranuke2018::Inelastic(
 	  GHepParticle * p0 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
 
 	  //set up remnant nucleus
-	  fRemnP4 -= clusP4 - *p->P4();
+	  State().RemnP4 -= clusP4 - *p->P4();
 
 	  for (int i=0;i<np;i++)
 	    {
 	      list.push_back(kPdgProton);
-	      fRemnA--;
-	      fRemnZ--;
+	      State().RemnA--;
+	      State().RemnZ--;
 	    }
 	  for (int i=0;i<nn;i++)
 	    {
 	      list.push_back(kPdgNeutron);
-	      fRemnA--;
+	      State().RemnA--;
 	    }
 	  
 	  // Library instance for reference
@@ -1434,19 +1434,19 @@ void HAIntranuke2018::Inelastic(
 		{
 		  target.SetHitNucPdg(*pdg_iter);
 		  fNuclmodel->GenerateNucleon(target);
-		  mBuf = pLib->Find(*pdg_iter)->Mass();
+		  mBuf = pLib->Mass(*pdg_iter);
 		  mSum += mBuf;
 		  pBuf = fFermiFac * fNuclmodel->Momentum3();
 		  eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
 		  tSum += TLorentzVector(pBuf,eBuf);
-		  fRemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
+		  State().RemnP4 -= TLorentzVector(pBuf,eBuf-mBuf);
 		}
 	      TLorentzVector dP4 = tSum + TLorentzVector(TVector3(0,0,0),-mSum);
 	      p->SetMomentum(dP4);    
 	      }*/
 	  
 	  LOG("HAIntranuke2018", pDEBUG)
-	    << "Remnant nucleus (A,Z) = (" << fRemnA << ", " << fRemnZ << ")";
+	    << "Remnant nucleus (A,Z) = (" << State().RemnA << ", " << State().RemnZ << ")";
 	  LOG("HAIntranuke2018", pINFO) << " list size: " << np+nn;
 	  if (np+nn <2)
 	    {
@@ -1456,31 +1456,31 @@ void HAIntranuke2018::Inelastic(
 	    }
 	  //	  GHepParticle * cl = new GHepParticle(*p);
 	  //	  cl->SetPdgCode(kPdgDecayNuclCluster);
-     	  //bool success1 = utils::intranuke2018::PhaseSpaceDecay(ev,p0,*listar[0],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success = utils::intranuke2018::PhaseSpaceDecay(ev,p0,list,fRemnP4,fNucRmvE,kIMdHA);
+     	  //bool success1 = utils::intranuke2018::PhaseSpaceDecay(ev,p0,*listar[0],State().RemnP4,fNucRmvE,kIMdHA);
+	  bool success = utils::intranuke2018::PhaseSpaceDecay(ev,p0,list,State().RemnP4,fNucRmvE,kIMdHA);
 	  if (success)
 	    {
 	      LOG ("HAIntranuke2018",pINFO) << "Successful many-body absorption, n<=18";
-	      LOG("HAIntranuke2018", pDEBUG) << "Nucleus : (A,Z) = ("<<fRemnA<<','<<fRemnZ<<')';
+	      LOG("HAIntranuke2018", pDEBUG) << "Nucleus : (A,Z) = ("<<State().RemnA<<','<<State().RemnZ<<')';
 	      TParticlePDG * remn = 0;
 	      double MassRem = 0.;
-	      int ipdgc = pdg::IonPdgCode(fRemnA, fRemnZ);
+	      int ipdgc = pdg::IonPdgCode(State().RemnA, State().RemnZ);
 	      remn = PDGLibrary::Instance()->Find(ipdgc);
 	      if(!remn) 
 		{
 		  LOG("HAIntranuke2018", pINFO)
-		    << "NO Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+		    << "NO Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 		    << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 		}
 	      else
 		{
 		  MassRem = remn->Mass();
 		  LOG("HAIntranuke2018", pINFO)
-		    << "Particle with [A = " << fRemnA << ", Z = " << fRemnZ
+		    << "Particle with [A = " << State().RemnA << ", Z = " << State().RemnZ
 		    << ", pdgc = " << ipdgc << "] in PDGLibrary!";
 		}
-	      double ERemn = fRemnP4.E();
-	      double PRemn = TMath::Sqrt(fRemnP4.Px()*fRemnP4.Px() + fRemnP4.Py()*fRemnP4.Py() + fRemnP4.Pz()*fRemnP4.Pz());
+	      double ERemn = State().RemnP4.E();
+	      double PRemn = TMath::Sqrt(State().RemnP4.Px()*State().RemnP4.Px() + State().RemnP4.Py()*State().RemnP4.Py() + State().RemnP4.Pz()*State().RemnP4.Pz());
 	      double MRemn = TMath::Sqrt(ERemn*ERemn - PRemn*PRemn);
 	      LOG("HAIntranuke2018",pINFO) << "PRemn = " << PRemn << " ;ERemn=  " << ERemn;
 	      LOG("HAIntranuke2018",pINFO) << "expt MRemn=  " << MRemn << "  ;true Mass=  " << MassRem << "   ; excitation energy (>0 good)= " << (MRemn-MassRem)*1000. << " MeV";
@@ -1489,11 +1489,11 @@ void HAIntranuke2018::Inelastic(
 	    // recover
 	    p->SetStatus(kIStStableFinalState);
 	    ev->AddParticle(*p);
-	    fRemnA+=np+nn;
-	    fRemnZ+=np;
-	    if ( pdgc==kPdgProton || pdgc==kPdgPiP )     fRemnZ--;
-	    if ( pdgc==kPdgPiM )                         fRemnZ++;
-	    if ( pdg::IsNeutronOrProton (pdgc) )         fRemnA--;	
+	    State().RemnA+=np+nn;
+	    State().RemnZ+=np;
+	    if ( pdgc==kPdgProton || pdgc==kPdgPiP )     State().RemnZ--;
+	    if ( pdgc==kPdgPiM )                         State().RemnZ++;
+	    if ( pdg::IsNeutronOrProton (pdgc) )         State().RemnA--;	
 	    exceptions::INukeException exception;
 	    exception.SetReason("Phase space generation of absorption final state failed");
 	    throw exception;
@@ -1591,7 +1591,7 @@ INukeFateHA_t HAIntranuke2018::HadronFateOset () const
     << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << fractionCex
     << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << 1-fractionCex-fractionAbsorption
     << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << fractionAbsorption;
-  if (randomNumber < fractionAbsorption && fRemnA > 1) return kIHAFtAbs;
+  if (randomNumber < fractionAbsorption && State().RemnA > 1) return kIHAFtAbs;
   else if (randomNumber < fractionAbsorption + fractionCex) return kIHAFtCEx;
   else return kIHAFtInelas;
 }
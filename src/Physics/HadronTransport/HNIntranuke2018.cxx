@@ -157,8 +157,8 @@ void HNIntranuke2018::SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p
       if(fate == kIHNFtUndefined)
 	{
 	  LOG("HNIntranuke2018", pERROR) << "** Couldn't select a fate";
-	  LOG("HNIntranuke2018", pERROR) << "** Num Protons: " << fRemnZ 
-				     << ",  Num Neutrons: "<<(fRemnA-fRemnZ);
+	  LOG("HNIntranuke2018", pERROR) << "** Num Protons: " << State().RemnZ 
+				     << ",  Num Neutrons: "<<(State().RemnA-State().RemnZ);
 	  LOG("HNIntranuke2018", pERROR) << "** Particle: " << "\n" << (*p);
 	  //LOG("HNIntranuke2018", pERROR) << "** Event Record: " << "\n" << (*ev);
 	  //p->SetStatus(kIStUndefined);
@@ -187,7 +187,7 @@ void HNIntranuke2018::SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p
 	  this-> InelasticHN(ev,p);
 	}
       else if(fate == kIHNFtInelas && pdgc == kPdgGamma) {this-> GammaInelasticHN(ev,p,fate);}
-      else if(fate == kIHNFtCmp){utils::intranuke2018::PreEquilibrium(ev,p,fRemnA,fRemnZ,fRemnP4,fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHN);}
+      else if(fate == kIHNFtCmp){utils::intranuke2018::PreEquilibrium(ev,p,State().RemnA,State().RemnZ,State().RemnP4,fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHN);}
       else if(fate == kIHNFtNoInteraction)
 	{
 	  p->SetStatus(kIStStableFinalState);
@@ -231,13 +231,13 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
 
        double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, fRemnA, fRemnZ);
+	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, State().RemnA, State().RemnZ);
        double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, fRemnA, fRemnZ);
+	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, State().RemnA, State().RemnZ);
        double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtInelas,  ke, fRemnA, fRemnZ);
+	                            * fHadroData2018->Frac(pdgc, kIHNFtInelas,  ke, State().RemnA, State().RemnZ);
        double frac_abs      = this->FateWeight(pdgc, kIHNFtAbs)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtAbs,     ke, fRemnA, fRemnZ);
+	                            * fHadroData2018->Frac(pdgc, kIHNFtAbs,     ke, State().RemnA, State().RemnZ);
 
        frac_cex     *= fNucCEXFac;    // scaling factors
        frac_abs     *= fNucAbsFac;
@@ -279,11 +279,11 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
 
       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtElas,   ke, fRemnA, fRemnZ);
+	                           * fHadroData2018->Frac(pdgc, kIHNFtElas,   ke, State().RemnA, State().RemnZ);
       double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtInelas, ke, fRemnA, fRemnZ);
+	                           * fHadroData2018->Frac(pdgc, kIHNFtInelas, ke, State().RemnA, State().RemnZ);
       double frac_cmp      = this->FateWeight(pdgc, kIHNFtCmp)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtCmp,    ke, fRemnA , fRemnZ);
+	                           * fHadroData2018->Frac(pdgc, kIHNFtCmp,    ke, State().RemnA , State().RemnZ);
 
       LOG("HNIntranuke2018", pINFO) 
 	<< "\n frac{" << INukeHadroFates::AsString(kIHNFtElas)    << "} = " << frac_elas
@@ -317,9 +317,9 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     // Handle kaon -- elastic + charge exchange
     else if (pdgc==kPdgKP){
        double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, fRemnA, fRemnZ);
+	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, State().RemnA, State().RemnZ);
        double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, fRemnA, fRemnZ);
+	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, State().RemnA, State().RemnZ);
 
        //       frac_cex     *= fNucCEXFac;    // scaling factors
        //       frac_elas    *= fNucQEFac;   // Flor - Correct scaling factors?
@@ -365,8 +365,8 @@ double HNIntranuke2018::FateWeight(int pdgc, INukeFateHN_t fate) const
   // turn fates off if the remnant nucleus does not have the number of p,n
   // required
 
-  int np = fRemnZ;
-  int nn = fRemnA - fRemnZ;
+  int np = State().RemnZ;
+  int nn = State().RemnA - State().RemnZ;
  
   if (np < 1 && nn < 1)
     {
@@ -379,7 +379,7 @@ double HNIntranuke2018::FateWeight(int pdgc, INukeFateHN_t fate) const
       if (fate == kIHNFtCEx && pdgc==kPdgPiM ) { return (np>=1) ? 1. : 0.; }
       if (fate == kIHNFtCEx && pdgc==kPdgKP  ) { return (nn>=1) ? 1. : 0.; } //Added, changed np to nn
       if (fate == kIHNFtAbs)      { return ((nn>=1) && (np>=1)) ? 1. : 0.; }
-      if (fate == kIHNFtCmp )     { return ((pdgc==kPdgProton||pdgc==kPdgNeutron)&&fDoCompoundNucleus&&fRemnA>5) ? 1. : 0.; }
+      if (fate == kIHNFtCmp )     { return ((pdgc==kPdgProton||pdgc==kPdgNeutron)&&fDoCompoundNucleus&&State().RemnA>5) ? 1. : 0.; }
 
     }
   return 1.;
@@ -475,11 +475,11 @@ void HNIntranuke2018::AbsorbHN(
     }
  
   // assign proper masses
-  M1   = pLib->Find(pcode) ->Mass();
-  M2_1 = pLib->Find(t1code)->Mass();
-  M2_2 = pLib->Find(t2code)->Mass();
-  M3   = pLib->Find(scode) ->Mass();
-  M4   = pLib->Find(s2code)->Mass();
+  M1   = pLib->Mass(pcode);
+  M2_1 = pLib->Mass(t1code);
+  M2_2 = pLib->Mass(t2code);
+  M3   = pLib->Mass(scode);
+  M4   = pLib->Mass(s2code);
 
   // handle fermi momentum 
   if(fDoFermi)
@@ -597,7 +597,7 @@ void HNIntranuke2018::AbsorbHN(
       /*
       p->SetStatus(kIStHadronInTheNucleus);
       //disable until needed
-      //      utils::intranuke2018::StepParticle(p,fFreeStep,fTrackingRadius);
+      //      utils::intranuke2018::StepParticle(p,fFreeStep,State().TrackingRadius);
       ev->AddParticle(*p);   
       return;
       */
@@ -609,10 +609,10 @@ void HNIntranuke2018::AbsorbHN(
     }
 
   // handle remnant nucleus updates
-  fRemnZ--;
-  fRemnA -=2;
-  fRemnP4 -= TLorentzVector(tP2_1L,E2_1L);
-  fRemnP4 -= TLorentzVector(tP2_2L,E2_2L);
+  State().RemnZ--;
+  State().RemnA -=2;
+  State().RemnP4 -= TLorentzVector(tP2_1L,E2_1L);
+  State().RemnP4 -= TLorentzVector(tP2_2L,E2_2L);
 
   // get random phi angle, distributed uniformally in 360 deg
   PHI3 = 2 * kPi * rnd->RndFsi().Rndm();
@@ -680,7 +680,7 @@ void HNIntranuke2018::ElasHN(
   // vars for incoming particle, target, and scattered pdg codes
   int pcode = p->Pdg();
   int tcode, scode, s2code;
-  double ppcnt = (double) fRemnZ / (double) fRemnA; // % of protons
+  double ppcnt = (double) State().RemnZ / (double) State().RemnA; // % of protons
 
   // Select a target randomly, weighted to #
   // -- Unless, of course, the fate is CEx,
@@ -739,7 +739,7 @@ void HNIntranuke2018::ElasHN(
     }
 
   bool pass = utils::intranuke2018::TwoBodyCollision(ev,pcode,tcode,scode,s2code,C3CM,
-						  p,t,fRemnA,fRemnZ,fRemnP4,kIMdHN);
+						  p,t,State().RemnA,State().RemnZ,State().RemnP4,kIMdHN);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("HNIntranuke2018",pDEBUG)
@@ -775,7 +775,7 @@ void HNIntranuke2018::InelasticHN(GHepRecord* ev, GHepParticle* p) const
   GHepParticle s3(*p);
   
   
-  if (utils::intranuke2018::PionProduction(ev,p,&s1,&s2,&s3,fRemnA,fRemnZ,fRemnP4,fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel))
+  if (utils::intranuke2018::PionProduction(ev,p,&s1,&s2,&s3,State().RemnA,State().RemnZ,State().RemnP4,fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel))
 	{
 	  // set status of particles and return
 	  
@@ -819,7 +819,7 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
   RandomGen * rnd = RandomGen::Instance();
 
   // vars for incoming particle, target, and scattered reaction products
-  double ppcnt = (double) fRemnZ / (double) fRemnA; // % of protons
+  double ppcnt = (double) State().RemnZ / (double) State().RemnA; // % of protons
   int pcode = p->Pdg();
   int tcode = (rnd->RndFsi().Rndm()<=ppcnt)?(kPdgProton):(kPdgNeutron);
   int scode, s2code;
@@ -878,7 +878,7 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
     }
 
   bool pass = utils::intranuke2018::TwoBodyCollision(ev,pcode,tcode,scode,s2code,C3CM,
-						  p,t,fRemnA,fRemnZ,fRemnP4,kIMdHN);
+						  p,t,State().RemnA,State().RemnZ,State().RemnP4,kIMdHN);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("HNIntranuke2018",pDEBUG)
@@ -913,13 +913,13 @@ int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int
 
       if((p->KinE() < fEPreEq) )
 	{
-	  if(fRemnA>4)  //this needs to be matched to what is in PreEq and Eq
+	  if(State().RemnA>4)  //this needs to be matched to what is in PreEq and Eq
             {
               GHepParticle * sp = new GHepParticle(*p);
               sp->SetFirstMother(mom);
 	      // this was PreEquilibrium - now just used for hN
 	      //same arguement lists for PreEq and Eq
-	      utils::intranuke2018::Equilibrium(ev,sp,fRemnA,fRemnZ,fRemnP4,
+	      utils::intranuke2018::Equilibrium(ev,sp,State().RemnA,State().RemnZ,State().RemnP4,
 					       fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHN);
 
               delete sp;
@@ -1018,7 +1018,7 @@ INukeFateHN_t HNIntranuke2018::HadronFateOset () const
   //LOG("HNIntranuke2018", pWARN) << "  frac cex  = " << fractionCex;
   //LOG("HNIntranuke2018", pWARN) << "  frac elas = " << 1-fractionAbsorption-fractionCex << " }";
 
-  if (randomNumber < fractionAbsorption && fRemnA > 1) return kIHNFtAbs;
+  if (randomNumber < fractionAbsorption && State().RemnA > 1) return kIHNFtAbs;
   else if (randomNumber < fractionAbsorption + fractionCex) return kIHNFtCEx;
   else return kIHNFtElas;
 }
@@ -82,8 +82,8 @@ double INukeNucleonCorr::mstar (const double rho, const double k2)
 {
   // density [fm^-3], momentum square [GeV^2]
 
-  static const double m = (PDGLibrary::Instance()->Find(kPdgProton)->Mass() +
-                           PDGLibrary::Instance()->Find(kPdgNeutron)->Mass()) / 2.0;
+  static const double m = (PDGLibrary::Instance()->Mass(kPdgProton) +
+                           PDGLibrary::Instance()->Mass(kPdgNeutron)) / 2.0;
 
   const double L = lambda (rho); // potential coefficient lambda
   const double B =   beta (rho); // potential coefficient beta
@@ -149,7 +149,7 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
 
   setFermiLevel (rho, A, Z); // set Fermi momenta for protons and neutrons
 
-  const double mass   = PDGLibrary::Instance()->Find(pdg)->Mass(); // mass of incoming nucleon
+  const double mass   = PDGLibrary::Instance()->Mass(pdg); // mass of incoming nucleon
   const double energy = Ek + mass;
 
   TLorentzVector p (0.0, 0.0, sqrt (energy * energy - mass * mass), energy); // incoming particle 4-momentum
@@ -163,7 +163,7 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
     // get proton vs neutron randomly based on Z/A
     const int targetPdg = rnd->RndGen().Rndm() < (double) Z / A ? kPdgProton : kPdgNeutron;
 
-    const double targetMass = PDGLibrary::Instance()->Find(targetPdg)->Mass(); // set nucleon mass
+    const double targetMass = PDGLibrary::Instance()->Mass(targetPdg); // set nucleon mass
 
     const TLorentzVector target = generateTargetNucleon (targetMass, fermiMomentum (targetPdg)); // generate target nucl
 
@@ -107,7 +107,7 @@ double genie::utils::intranuke::MeanFreePath(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+  double rho  = A * utils::nuclear::DensityTabulated(rnow,(int) A,ring);
 
   // the hadron+nucleon cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -187,7 +187,7 @@ double genie::utils::intranuke::MeanFreePath_Delta(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A);
+  double rho  = A * utils::nuclear::DensityTabulated(rnow,(int) A);
 
   // the Delta+N->N+N cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
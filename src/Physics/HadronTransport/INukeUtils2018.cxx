@@ -34,6 +34,10 @@
  @ Jan 9, 2015 - SD, NG, TG
    Added 2014 version of INTRANUKE codes for v2.9.0.  Uses INukeHadroData2014,
    but no changes to mean free path.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   TwoBodyKinematics() uses the value-type FourVector/ThreeVector classes
+   internally and takes its input 4-momenta by const reference. Its
+   per-call diagnostics are only compiled with low-level messages enabled.
 */
 //____________________________________________________________________________
 
@@ -53,6 +57,7 @@
 #include "Physics/HadronTransport/INukeUtils2018.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/FourVector.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -129,7 +134,7 @@ double genie::utils::intranuke2018::MeanFreePath(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+  double rho  = A * utils::nuclear::DensityTabulated(rnow,(int) A,ring);
 
   // the hadron+nucleon cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -163,8 +168,8 @@ double genie::utils::intranuke2018::MeanFreePath(
       PDGLibrary * pLib = PDGLibrary::Instance();
       double hc = 197.327;
       double R0 = 1.25 * TMath::Power(A,1./3.) + 2.0 * 0.65; // should all be in units of fm
-      double Mp = pLib->Find(2212)->Mass();
-      double M  = pLib->Find(pdgc)->Mass();
+      double Mp = pLib->Mass(2212);
+      double M  = pLib->Mass(pdgc);
       //double E  = (p4.Energy() - Mp) * 1000.; // Convert GeV to MeV.
       double E = ke;
       if (Z*hc/137./x4.Vect().Mag() > E)  // Coulomb correction (Cohen, Concepts of Nuclear Physics, pg. 259-260)
@@ -211,7 +216,7 @@ double genie::utils::intranuke2018::MeanFreePath(
 
   if (xsecNNCorr and is_nucleon)
     sigtot *= INukeNucleonCorr::getInstance()->
-      getAvgCorrection (rho, A, p4.E() - PDGLibrary::Instance()->Find(pdgc)->Mass());   //uses lookup tables
+      getAvgCorrection (rho, A, p4.E() - PDGLibrary::Instance()->Mass(pdgc));   //uses lookup tables
 
   // avoid defective error handling
   if(sigtot<1E-6){sigtot=1E-6;}
@@ -252,7 +257,7 @@ double genie::utils::intranuke2018::MeanFreePath_Delta(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A);
+  double rho  = A * utils::nuclear::DensityTabulated(rnow,(int) A);
 
   // the Delta+N->N+N cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -515,7 +520,7 @@ void genie::utils::intranuke2018::PreEquilibrium(
         {
           target.SetHitNucPdg(*pdg_iter);
           Nuclmodel->GenerateNucleon(target);
-          mBuf = pLib->Find(*pdg_iter)->Mass();
+          mBuf = pLib->Mass(*pdg_iter);
           mSum += mBuf;
           pBuf = FermiFac * Nuclmodel->Momentum3();
           eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -672,7 +677,7 @@ void genie::utils::intranuke2018::Equilibrium(
         {
           target.SetHitNucPdg(*pdg_iter);
           Nuclmodel->GenerateNucleon(target);
-          mBuf = pLib->Find(*pdg_iter)->Mass();
+          mBuf = pLib->Mass(*pdg_iter);
           mSum += mBuf;
           pBuf = FermiFac * Nuclmodel->Momentum3();
           eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -726,10 +731,10 @@ bool genie::utils::intranuke2018::TwoBodyCollision(
   Target target(ev->TargetNucleus()->Pdg());
 
   // get mass for particles
-  M1 = pLib->Find(pcode)->Mass();
-  // usused // M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(scode)->Mass();
-  M4 = pLib->Find(s2code)->Mass();
+  M1 = pLib->Mass(pcode);
+  // usused // M2 = pLib->Mass(tcode);
+  M3 = pLib->Mass(scode);
+  M4 = pLib->Mass(s2code);
 
   // get lab energy and momenta and assign to 4 vectors
   TLorentzVector t4P1L = *p->P4();
@@ -842,7 +847,7 @@ bool genie::utils::intranuke2018::TwoBodyCollision(
 }
 //___________________________________________________________________________
 bool genie::utils::intranuke2018::TwoBodyKinematics(
-  double M3, double M4, TLorentzVector t4P1L, TLorentzVector t4P2L,
+  double M3, double M4, const TLorentzVector & t4P1L, const TLorentzVector & t4P2L,
   TLorentzVector &t4P3L, TLorentzVector &t4P4L, double C3CM, TLorentzVector &RemnP4, double bindE)
 {
   // Aaron Meyer (05/17/10)
@@ -862,6 +867,9 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   // Gives outgoing 4-momenta of particles 3 and 4 (t4P3L, t4P4L respectively)
   //
   // All 4-momenta should be on mass shell
+  //
+  // The kinematics are computed with the value types of FourVector.h;
+  // the TLorentzVector arguments are only read / written at the boundary.
 
   double E1L, E2L, P1L, P2L, E3L, P3L;
   double beta, gm; // speed and gamma for CM frame in Lab
@@ -870,13 +878,8 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   double E1CM, E2CM, E3CM, P3CM;//, E4CM, P4CM;
   double P3zL, P3tL;//, P4zL, P4tL;
   double Et;
-  double theta1, theta2, theta5, P1zL, P2zL, P1tL, P2tL;
-  TVector3 tbeta, tbetadir, tTrans, tVect;
-  TVector3 tP1zCM, tP2zCM, vP3L;
-  TLorentzVector t4P1buf, t4P2buf, t4Ptot;
-
-  // Library instance for reference
-  //PDGLibrary * pLib = PDGLibrary::Instance();
+  double P1zL, P2zL, P1tL, P2tL;
+  ThreeVector tbeta, tbetadir, tTrans, tVect;
 
   // random number generator
   RandomGen * rnd = RandomGen::Instance();
@@ -888,19 +891,20 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   S3CM = TMath::Sqrt(1.0 - C3CM*C3CM);
 
   // fill buffers
-  t4P1buf = t4P1L;
-  t4P2buf = t4P2L;
+  const FourVector t4P1buf(t4P1L);
+  const FourVector t4P2buf(t4P2L);
 
   // get lab energy and momenta
   E1L = t4P1buf.E();
   P1L = t4P1buf.P();
   E2L = t4P2buf.E();
   P2L = t4P2buf.P();
-  t4Ptot = t4P1buf + t4P2buf;
+  FourVector t4Ptot = t4P1buf + t4P2buf;
 
-  LOG("INukeUtils",pINFO) <<"M1   "<<t4P1L.M()<<  ", M2    "<<t4P2L.M();
-  LOG("INukeUtils",pINFO) <<"E1L  "<<E1L<< ", E1CM  "<<E1CM;
-  LOG("INukeUtils",pINFO) <<"bindE = " << bindE;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("INukeUtils",pDEBUG) <<"M1   "<<t4P1buf.M()<<  ", M2    "<<t4P2buf.M();
+  LOG("INukeUtils",pDEBUG) <<"bindE = " << bindE;
+#endif
 
   // binding energy
   if (bindE!=0)
@@ -924,32 +928,30 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   beta = tbeta.Mag();
   gm = 1.0 / TMath::Sqrt(1.0 - beta*beta);
 
-  // get angle and component info
-  theta1 = t4P1buf.Angle(tbeta);
-  theta2 = t4P2buf.Angle(tbeta);
-  P1zL = P1L*TMath::Cos(theta1);
-  P2zL = P2L*TMath::Cos(theta2);
-  P1tL = TMath::Sqrt(P1L*P1L - P1zL*P1zL);
-  P2tL = -TMath::Sqrt(P2L*P2L - P2zL*P2zL);
+  // get component info (parallel to / transverse to the CM velocity)
+  bool has_dir = (beta > 0);
+  P1zL = (has_dir && P1L > 0) ? t4P1buf.Vect().Dot(tbetadir) : P1L;
+  P2zL = (has_dir && P2L > 0) ? t4P2buf.Vect().Dot(tbetadir) : P2L;
+  P1tL = TMath::Sqrt(TMath::Max(0., P1L*P1L - P1zL*P1zL));
+  P2tL = -TMath::Sqrt(TMath::Max(0., P2L*P2L - P2zL*P2zL));
   tVect.SetXYZ(1,0,0);
-  if(TMath::Abs((tVect - tbetadir).Mag())<.01) tVect.SetXYZ(0,1,0);
-  theta5 = tVect.Angle(tbetadir);
-  tTrans = (tVect - TMath::Cos(theta5)*tbetadir).Unit();
+  if((tVect - tbetadir).Mag()<.01) tVect.SetXYZ(0,1,0);
+  double ctheta5 = (has_dir) ? tVect.Dot(tbetadir) : 1.;
+  tTrans = (tVect - ctheta5*tbetadir).Unit();
 
   // boost to CM frame to get scattered particle momenta
   E1CM = gm*E1L - gm*beta*P1zL;
-  tP1zCM = gm*P1zL*tbetadir - gm*tbeta*E1L;
   E2CM = gm*E2L - gm*beta*P2zL;
-  tP2zCM = gm*P2zL*tbetadir - gm*tbeta*E2L;
   Et = E1CM + E2CM;
 //-------
 
-  LOG("INukeUtils",pINFO) <<"M1   "<<t4P1L.M()<<  ", M2    "<<t4P2L.M();
-  LOG("INukeUtils",pINFO) <<"E1L  "<<E1L<< ", E1CM  "<<E1CM;
-  LOG("INukeUtils",pINFO) <<"P1zL "<<P1zL<<", P1zCM "<<tP1zCM.Mag()<<", P1tL "<<P1tL;
-  LOG("INukeUtils",pINFO) <<"E2L  "<<E2L<< ", E2CM  "<<E2CM;
-  LOG("INukeUtils",pINFO) <<"P2zL "<<P2zL<<", P2zCM "<<tP2zCM.Mag()<<", P2tL "<<P2tL;
-  LOG("INukeUtils",pINFO) <<"C3CM "<<C3CM;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("INukeUtils",pDEBUG) <<"E1L  "<<E1L<< ", E1CM  "<<E1CM;
+  LOG("INukeUtils",pDEBUG) <<"P1zL "<<P1zL<<", P1tL "<<P1tL;
+  LOG("INukeUtils",pDEBUG) <<"E2L  "<<E2L<< ", E2CM  "<<E2CM;
+  LOG("INukeUtils",pDEBUG) <<"P2zL "<<P2zL<<", P2tL "<<P2tL;
+  LOG("INukeUtils",pDEBUG) <<"C3CM "<<C3CM;
+#endif
 
 //-------
   E3CM = (Et*Et + M3*M3 - M4*M4) / (2.0 * Et);
@@ -975,27 +977,29 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
 
   //-------
 
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   double E4CM = Et-E3CM;
   double P4zL = gm*beta*E4CM - gm*P3CM*C3CM;
   double P4tL = -1.*P3tL;
   double P4L = TMath::Sqrt(P4zL*P4zL + P4tL*P4tL);
   double E4L = TMath::Sqrt(P4L*P4L + M4*M4);
 
-  LOG("INukeUtils",pINFO) <<"M3   "<< M3 <<  ", M4    "<< M4;
-  LOG("INukeUtils",pINFO) <<"E3L   "<<E3L<< ", E3CM "<<E3CM;
-  LOG("INukeUtils",pINFO) <<"P3zL  "<<P3zL<<", P3tL "<<P3tL;
-  LOG("INukeUtils",pINFO) <<"C3L   "<<P3zL/P3L;
-  LOG("INukeUtils",pINFO) <<"Check:";
-  LOG("INukeUtils",pINFO) <<"E4L   "<<E4L<< ", E4CM "<<E4CM;
-  LOG("INukeUtils",pINFO) <<"P4zL  "<<P4zL<<", P4tL "<<P4tL;
-  LOG("INukeUtils",pINFO) <<"P4L   "<<P4L;
-  LOG("INukeUtils",pINFO) <<"C4L   "<<P4zL/P4L;
+  LOG("INukeUtils",pDEBUG) <<"M3   "<< M3 <<  ", M4    "<< M4;
+  LOG("INukeUtils",pDEBUG) <<"E3L   "<<E3L<< ", E3CM "<<E3CM;
+  LOG("INukeUtils",pDEBUG) <<"P3zL  "<<P3zL<<", P3tL "<<P3tL;
+  LOG("INukeUtils",pDEBUG) <<"C3L   "<<P3zL/P3L;
+  LOG("INukeUtils",pDEBUG) <<"Check:";
+  LOG("INukeUtils",pDEBUG) <<"E4L   "<<E4L<< ", E4CM "<<E4CM;
+  LOG("INukeUtils",pDEBUG) <<"P4zL  "<<P4zL<<", P4tL "<<P4tL;
+  LOG("INukeUtils",pDEBUG) <<"P4L   "<<P4L;
+  LOG("INukeUtils",pDEBUG) <<"C4L   "<<P4zL/P4L;
 
   double echeck = E1L + E2L - (E3L + E4L);
   double pzcheck = P1zL+ P2zL - (P3zL + P4zL);
   double ptcheck = P1tL+ P2tL - (P3tL + P4tL);
 
-  LOG("INukeUtils",pINFO) <<"Check 4-momentum conservation -  Energy  "<<echeck<<", z momentum "<<pzcheck << ",    transverse momentum  " << ptcheck ;
+  LOG("INukeUtils",pDEBUG) <<"Check 4-momentum conservation -  Energy  "<<echeck<<", z momentum "<<pzcheck << ",    transverse momentum  " << ptcheck ;
+#endif
 
   // -------
 
@@ -1014,21 +1018,18 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   // get random phi angle, distributed uniformally in 360 deg
   PHI3 = 2 * kPi * rnd->RndFsi().Rndm();
 
-  vP3L = P3zL*tbetadir + P3tL*tTrans;
-  vP3L.Rotate(PHI3,tbetadir);
+  // transverse momentum rotated by PHI3 around the CM velocity
+  ThreeVector tTransRot = TMath::Cos(PHI3)*tTrans +
+                          TMath::Sin(PHI3)*tbetadir.Cross(tTrans);
+  FourVector t4P3(P3zL*tbetadir + P3tL*tTransRot, E3L);
 
-  t4P3L.SetVect(vP3L);
-  t4P3L.SetE(E3L);
+  FourVector t4P4 = t4Ptot - t4P3;
+  t4P4.SetE(t4P4.E() - bindE);
 
-  t4P4L = t4P1buf + t4P2buf - t4P3L;
-  t4P4L-= TLorentzVector(0,0,0,bindE);
-  /*LOG("INukeUtils",pINFO) <<"GENIE:";
-  LOG("INukeUtils",pINFO) <<"E4L   "<<t4P4L.E();
-  LOG("INukeUtils",pINFO) <<"P4zL  "<<t4P4L.Vect()*tbetadir<<", P4tL "<<-1.*TMath::Sqrt(t4P4L.Vect().Mag2()-TMath::Power(t4P4L.Vect()*tbetadir,2.));
-  LOG("INukeUtils",pINFO) <<"P4L   "<<t4P4L.Vect().Mag();
-  LOG("INukeUtils",pINFO) <<"C4L   "<<t4P4L.Vect()*tbetadir/t4P4L.Vect().Mag();  */
+  t4P3L = t4P3.ToTLorentzVector();
+  t4P4L = t4P4.ToTLorentzVector();
 
-  if(t4P4L.Mag2()<0 || t4P4L.E()<0)
+  if(t4P4.Mag2()<0 || t4P4.E()<0)
   {
     LOG("INukeUtils",pNOTICE)<<"TwoBodyKinematics Failed: Target mass or energy is negative";
     t4P3L.SetPxPyPzE(0,0,0,0);
@@ -1074,11 +1075,11 @@ bool genie::utils::intranuke2018::ThreeBodyKinematics(
   // random number generator
   RandomGen * rnd = RandomGen::Instance();
 
-  M1 = pLib->Find(p->Pdg())->Mass();
-  M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(s1->Pdg())->Mass();
-  M4 = pLib->Find(s2->Pdg())->Mass();
-  M5 = pLib->Find(s3->Pdg())->Mass();
+  M1 = pLib->Mass(p->Pdg());
+  M2 = pLib->Mass(tcode);
+  M3 = pLib->Mass(s1->Pdg());
+  M4 = pLib->Mass(s2->Pdg());
+  M5 = pLib->Mass(s3->Pdg());
 
   // set up fermi target
   Target target(ev->TargetNucleus()->Pdg());
@@ -1449,17 +1450,17 @@ bool genie::utils::intranuke2018::PionProduction(
     {
 
       double tote = p->Energy();
-      double pMass = pLib->Find(2212)->Mass();
-      double nMass = pLib->Find(2112)->Mass();
+      double pMass = pLib->Mass(2212);
+      double nMass = pLib->Mass(2112);
       double etapp2ppPi0 =
-        utils::intranuke2018::CalculateEta(pMass,tote,pMass,pMass+pMass,pLib->Find(111)->Mass());
+        utils::intranuke2018::CalculateEta(pMass,tote,pMass,pMass+pMass,pLib->Mass(111));
       double etapp2pnPip =
-        utils::intranuke2018::CalculateEta(pLib->Find(p1code)->Mass(),tote,((p1code==kPdgProton)?pMass:nMass),
-                                       pMass+nMass,pLib->Find(211)->Mass());
+        utils::intranuke2018::CalculateEta(pLib->Mass(p1code),tote,((p1code==kPdgProton)?pMass:nMass),
+                                       pMass+nMass,pLib->Mass(211));
       double etapn2nnPip =
-        utils::intranuke2018::CalculateEta(pMass,tote,nMass,nMass+nMass,pLib->Find(211)->Mass());
+        utils::intranuke2018::CalculateEta(pMass,tote,nMass,nMass+nMass,pLib->Mass(211));
       double etapn2ppPim =
-        utils::intranuke2018::CalculateEta(pMass,tote,nMass,pMass+pMass,pLib->Find(211)->Mass());
+        utils::intranuke2018::CalculateEta(pMass,tote,nMass,pMass+pMass,pLib->Mass(211));
 
       if ((etapp2ppPi0<=0.)&&(etapp2pnPip<=0.)&&(etapn2nnPip<=0.)&&(etapn2ppPim<=0.)) { // below threshold
         LOG("INukeUtils",pNOTICE) << "PionProduction() called below threshold energy";
@@ -1669,7 +1670,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   double   mass_sum = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m  = PDGLibrary::Instance()->Mass(pdgc);
     string nm = PDGLibrary::Instance()->Find(pdgc)->GetName();
     mass[i++] = m;
     mass_sum += m;
@@ -1801,7 +1802,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
      //   not going at a simulated f/s particle at a "hadronic blob"
      //   representing the remnant system: do the binding energy subtraction
      //   here & update the remnant hadronic system 4p
-     double M  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+     double M  = PDGLibrary::Instance()->Mass(pdgc);
      double En = p4fin->Energy();
 
      double KE = En-M;
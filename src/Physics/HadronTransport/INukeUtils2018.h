@@ -80,7 +80,7 @@ namespace intranuke2018
     GHepParticle* t, int &RemnA, int &RemnZ, TLorentzVector &RemnP4, EINukeMode mode=kIMdHA);
 
   bool TwoBodyKinematics(
-    double M3, double M4, TLorentzVector tP1L, TLorentzVector tP2L, 
+    double M3, double M4, const TLorentzVector & tP1L, const TLorentzVector & tP2L, 
     TLorentzVector &tP3L, TLorentzVector &tP4L, double C3CM, TLorentzVector &RemnP4, double bindE=0);
 
   bool ThreeBodyKinematics(
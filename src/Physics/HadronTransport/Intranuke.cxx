@@ -48,6 +48,10 @@
    start of the event processing and is used throughout. fInTestMode flag and
    special INTRANUKE configs not needed. ProcessEventRecord() was added by 
    factoring out code from HNIntranuke and HAIntranuke. Some comments added.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The remnant nucleus, the tracking radius and the event generation mode of
+   the event being processed are kept in per-thread scratch state (State()),
+   so that one instance can be used by several threads.
 
 */
 //____________________________________________________________________________
@@ -109,6 +113,16 @@ EventRecordVisitorI(name, config)
 Intranuke::~Intranuke()
 {
 
+}
+//___________________________________________________________________________
+Intranuke::EventState & Intranuke::State(void) const
+{
+  return *static_cast<EventState *>(this->Scratch());
+}
+//___________________________________________________________________________
+AlgScratchI * Intranuke::NewScratch(void) const
+{
+  return new EventState;
 }
 //___________________________________________________________________________
 void Intranuke::ProcessEventRecord(GHepRecord * evrec) const
@@ -128,15 +142,15 @@ void Intranuke::ProcessEventRecord(GHepRecord * evrec) const
   // The determined mode has an effect on INTRANUKE behaviour (how to lookup
   // the residual nucleus, whether to set an intranuclear vtx etc) but it
   // does not affect the INTRANUKE physics.
-  fGMode = evrec->EventGenerationMode();
+  State().GMode = evrec->EventGenerationMode();
 
   // For lepton-nucleus scattering and for nucleon decay intranuclear vtx 
   // position (in the target nucleus coord system) is set elsewhere.
   // This method only takes effect in hadron/photon-nucleus interactions.
   // In this special mode, an interaction vertex is set at the periphery 
   // of the target nucleus.
-  if(fGMode == kGMdHadronNucleus ||
-     fGMode == kGMdPhotonNucleus)
+  if(State().GMode == kGMdHadronNucleus ||
+     State().GMode == kGMdPhotonNucleus)
   {
     this->GenerateVertex(evrec);  
   }
@@ -163,11 +177,11 @@ void Intranuke::GenerateVertex(GHepRecord * evrec) const
   // Assume a hadron beam with uniform intensity across an area, 
   // so we need to choose events uniformly within that area.
   double x=999999., y=999999., epsilon = 0.001;
-  double R2  = TMath::Power(fTrackingRadius,2.);
+  double R2  = TMath::Power(State().TrackingRadius,2.);
   double rp2 = TMath::Power(x,2.) + TMath::Power(y,2.);
   while(rp2 > R2-epsilon) {
-      x = (fTrackingRadius-epsilon) * rnd->RndFsi().Rndm();
-      y = -fTrackingRadius + 2*fTrackingRadius * rnd->RndFsi().Rndm();
+      x = (State().TrackingRadius-epsilon) * rnd->RndFsi().Rndm();
+      y = -State().TrackingRadius + 2*State().TrackingRadius * rnd->RndFsi().Rndm();
       y -= ((y>0) ? epsilon : -epsilon);
       rp2 = TMath::Power(x,2.) + TMath::Power(y,2.);
   }
@@ -198,15 +212,15 @@ void Intranuke::SetTrackingRadius(const GHepParticle * p) const
 {
   assert(p && pdg::IsIon(p->Pdg()));
   double A = p->A();
-  fTrackingRadius = fR0 * TMath::Power(A, 1./3.);
+  State().TrackingRadius = fR0 * TMath::Power(A, 1./3.);
 
   // multiply that by some input factor so that hadrons are tracked
   // beyond the nuclear 'boundary' since the nuclear density distribution
   // is not zero there
-  fTrackingRadius *= fNR; 
+  State().TrackingRadius *= fNR; 
 
   LOG("Intranuke", pNOTICE) 
-      << "Setting tracking radius to R = " << fTrackingRadius;
+      << "Setting tracking radius to R = " << State().TrackingRadius;
 }
 //___________________________________________________________________________
 bool Intranuke::NeedsRescattering(const GHepParticle * p) const
@@ -215,8 +229,8 @@ bool Intranuke::NeedsRescattering(const GHepParticle * p) const
 
   assert(p);
 
-  if(fGMode == kGMdHadronNucleus ||
-     fGMode == kGMdPhotonNucleus) {
+  if(State().GMode == kGMdHadronNucleus ||
+     State().GMode == kGMdPhotonNucleus) {
     // hadron/photon-nucleus scattering propagate the incoming particle
     return (
       (p->Status() == kIStInitialState || p->Status() == kIStHadronInTheNucleus)
@@ -249,7 +263,7 @@ bool Intranuke::IsInNucleus(const GHepParticle * p) const
 {
 // check whether the input particle is still within the nucleus
 //
-  return (p->X4()->Vect().Mag() < fTrackingRadius + fHadStep);
+  return (p->X4()->Vect().Mag() < State().TrackingRadius + fHadStep);
 }
 //___________________________________________________________________________
 void Intranuke::TransportHadrons(GHepRecord * evrec) const
@@ -257,22 +271,22 @@ void Intranuke::TransportHadrons(GHepRecord * evrec) const
 // transport all hadrons outside the nucleus
 
   int inucl = -1;
-  fRemnA = -1;
-  fRemnZ = -1;
+  State().RemnA = -1;
+  State().RemnZ = -1;
 
   //  Get 'nuclear environment' at the beginning of hadron transport 
   //  and keep track of the remnant nucleus A,Z  
 
-  if(fGMode == kGMdHadronNucleus ||
-     fGMode == kGMdPhotonNucleus)
+  if(State().GMode == kGMdHadronNucleus ||
+     State().GMode == kGMdPhotonNucleus)
   {
      inucl = evrec->TargetNucleusPosition();
   }
   else
-  if(fGMode == kGMdLeptonNucleus || 
-     fGMode == kGMdDarkMatterNucleus || 
-     fGMode == kGMdNucleonDecay  ||
-     fGMode == kGMdNeutronOsc) 
+  if(State().GMode == kGMdLeptonNucleus || 
+     State().GMode == kGMdDarkMatterNucleus || 
+     State().GMode == kGMdNucleonDecay  ||
+     State().GMode == kGMdNeutronOsc) 
   {
      inucl = evrec->RemnantNucleusPosition();
   }
@@ -288,14 +302,14 @@ void Intranuke::TransportHadrons(GHepRecord * evrec) const
     return;
   }
   
-  fRemnA = nucl->A();
-  fRemnZ = nucl->Z();
+  State().RemnA = nucl->A();
+  State().RemnZ = nucl->Z();
 
   LOG("Intranuke", pNOTICE)
-      << "Nucleus (A,Z) = (" << fRemnA << ", " << fRemnZ << ")";
+      << "Nucleus (A,Z) = (" << State().RemnA << ", " << State().RemnZ << ")";
 
   const TLorentzVector & p4nucl = *(nucl->P4());
-  fRemnP4 = p4nucl; 
+  State().RemnP4 = p4nucl; 
 
   // Loop over GHEP and run intranuclear rescattering on handled particles
   TObjArrayIter piter(evrec);
@@ -347,13 +361,13 @@ void Intranuke::TransportHadrons(GHepRecord * evrec) const
       if(has_interacted) break;
     }//stepping
  
-    if(has_interacted && fRemnA>0)  {
+    if(has_interacted && State().RemnA>0)  {
         // the particle interacts - simulate the hadronic interaction
       LOG("Intranuke", pNOTICE) 
           << "Particle has interacted at location:  " 
-          << sp->X4()->Vect().Mag() << " / nucl rad= " << fTrackingRadius;
+          << sp->X4()->Vect().Mag() << " / nucl rad= " << State().TrackingRadius;
 	this->SimulateHadronicFinalState(evrec,sp);
-    } else if(has_interacted && fRemnA<=0) {
+    } else if(has_interacted && State().RemnA<=0) {
         // nothing left to interact with!
       LOG("Intranuke", pNOTICE)
           << "*** Nothing left to interact with, escaping.";
@@ -379,13 +393,13 @@ void Intranuke::TransportHadrons(GHepRecord * evrec) const
   // 4p not  put explicitly into the simulated particles
   TLorentzVector v4(0.,0.,0.,0.);
   GHepParticle remnant_nucleus(
-    kPdgHadronicBlob, kIStFinalStateNuclearRemnant, inucl,-1,-1,-1, fRemnP4, v4);
+    kPdgHadronicBlob, kIStFinalStateNuclearRemnant, inucl,-1,-1,-1, State().RemnP4, v4);
   evrec->AddParticle(remnant_nucleus);
   // Mark the initial remnant nucleus as an intermediate state 
   // Don't do that in the hadron/photon-nucleus scatterig mode since the initial 
   // remnant nucleus and the target nucleus coincide.
-  if(fGMode != kGMdHadronNucleus &&
-     fGMode != kGMdPhotonNucleus) {
+  if(State().GMode != kGMdHadronNucleus &&
+     State().GMode != kGMdPhotonNucleus) {
      evrec->Particle(inucl)->SetStatus(kIStIntermediateState);
   }
 }
@@ -408,8 +422,8 @@ double Intranuke::GenerateStep(GHepRecord* /*evrec*/, GHepParticle* p) const
     scale = fNucleonMFPScale;
   }
 
-  double L = utils::intranuke::MeanFreePath(pdgc, *p->X4(), *p->P4(), fRemnA,
-     fRemnZ, fDelRPion, fDelRNucleon);
+  double L = utils::intranuke::MeanFreePath(pdgc, *p->X4(), *p->P4(), State().RemnA,
+     State().RemnZ, fDelRPion, fDelRNucleon);
   L *= scale; 
   double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
 
@@ -31,16 +31,17 @@
 #define _INTRANUKE_2018_H_
 
 #include <TGenPhaseSpace.h>
+#include <TLorentzVector.h>
 
 #include "Physics/NuclearState/NuclearModelI.h"
 
 #include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Algorithm/AlgScratchI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Conventions/GMode.h"
 #include "Physics/HadronTransport/INukeMode.h"
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 
-class TLorentzVector;
 class TVector3;
 
 namespace genie {
@@ -86,20 +87,29 @@ protected:
   void   SetTrackingRadius  (const GHepParticle* p) const;
   double GenerateStep       (GHepRecord* ev, GHepParticle* p) const;
 
+  // state of the event being processed: kept per thread (see AlgScratchI),
+  // as a single instance is shared by all event generation threads
+  class EventState : public AlgScratchI {
+  public:
+    EventState() : TrackingRadius(0), RemnA(0), RemnZ(0), GMode(kGMdUnknown) {}
+    double         TrackingRadius; ///< tracking radius for the nucleus in the current event
+    int            RemnA;          ///< remnant nucleus A
+    int            RemnZ;          ///< remnant nucleus Z
+    TLorentzVector RemnP4;         ///< P4 of remnant system
+    GEvGenMode_t   GMode;          ///< event generation mode (lepton+A, hadron+A, ...)
+  };
+  EventState &  State      (void) const;
+  AlgScratchI * NewScratch (void) const;
+
   // virtual functions for individual modes
   virtual void SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p) const = 0;
   virtual int HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int mom) const = 0;
 
   // utility objects & params
-  mutable double         fTrackingRadius;///< tracking radius for the nucleus in the current event
   mutable TGenPhaseSpace fGenPhaseSpace; ///< a phase space generator
   INukeHadroData2018 *       fHadroData2018;     ///< a collection of h+N,h+A data & calculations
   AlgFactory *           fAlgf;          ///< algorithm factory instance
   const NuclearModelI *  fNuclmodel;     ///< nuclear model used to generate fermi momentum
-  mutable int            fRemnA;         ///< remnant nucleus A
-  mutable int            fRemnZ;         ///< remnant nucleus Z
-  mutable TLorentzVector fRemnP4;        ///< P4 of remnant system
-  mutable GEvGenMode_t   fGMode;         ///< event generation mode (lepton+A, hadron+A, ...)
 
   // configuration parameters
   double       fR0;           ///< effective nuclear size param
@@ -10,6 +10,15 @@
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
 
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Fragment the remnant system through the StringFragmentationI backend.
+   The PYTHIA decay switches are restored to their previous values after
+   the fragmentation.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Use a phase space generator local to each Hadronize() call rather than a
+   mutable data member, so that threads can share the hadronizer.
+
 */
 //____________________________________________________________________________
 
@@ -19,9 +28,9 @@
 #else
 #include <TMCParticle6.h>
 #endif
-#include <TPythia6.h>
 #include <TVector3.h>
 #include <TF1.h>
+#include <TGenPhaseSpace.h>
 #include <TROOT.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -38,15 +47,13 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/Hadronization/FragmRecUtils.h"
+#include "Physics/Hadronization/Pythia6Fragmentation.h"
 #include "Framework/Utils/PrintUtils.h"
 
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
-extern "C" void py1ent_(int *,  int *, double *, double *, double *);
-extern "C" void py2ent_(int *,  int *, int *, double *);
-
 //____________________________________________________________________________
 CharmHadronization::CharmHadronization() :
 HadronizationModelI("genie::CharmHadronization")
@@ -77,7 +84,15 @@ CharmHadronization::~CharmHadronization()
 //____________________________________________________________________________
 void CharmHadronization::Initialize(void) const
 {
-  fPythia = TPythia6::Instance();
+  fFragmenter = Pythia6Fragmentation::Instance();
+
+  // remnant fragmentation: pi0 are left to the decayer, Deltas are decayed
+  fRemnantFragmSettings = StringFragmSettings_t();
+  fRemnantFragmSettings.NoDecay.push_back(kPdgPi0);
+  fRemnantFragmSettings.Decay.push_back(kPdgP33m1232_DeltaM);
+  fRemnantFragmSettings.Decay.push_back(kPdgP33m1232_Delta0);
+  fRemnantFragmSettings.Decay.push_back(kPdgP33m1232_DeltaP);
+  fRemnantFragmSettings.Decay.push_back(kPdgP33m1232_DeltaPP);
 }
 //____________________________________________________________________________
 TClonesArray * CharmHadronization::Hadronize(
@@ -87,6 +102,8 @@ TClonesArray * CharmHadronization::Hadronize(
 
   PDGLibrary * pdglib = PDGLibrary::Instance();
   RandomGen *  rnd    = RandomGen::Instance();
+
+  TGenPhaseSpace phase_space_generator;
   
   // ....................................................................
   // Get information on the input event
@@ -131,7 +148,7 @@ TClonesArray * CharmHadronization::Hadronize(
 
      // Generate a charmed hadron PDG code
      int    pdg = this->GenerateCharmHadron(nu_pdg,Ev); // generate hadron
-     double mc  = pdglib->Find(pdg)->Mass();           // lookup mass
+     double mc  = pdglib->Mass(pdg);           // lookup mass
      
      LOG("CharmHad", pNOTICE) 
          << "Trying charm hadron = " << pdg << "(m = " << mc << ")";
@@ -215,7 +232,7 @@ TClonesArray * CharmHadronization::Hadronize(
          << "Trying an alternative strategy";
 
      double qfsl  = interaction->FSPrimLepton()->Charge() / 3.;
-     double qinit = pdglib->Find(nuc_pdg)->Charge() / 3.;
+     double qinit = pdglib->Charge(nuc_pdg) / 3.;
      int qhad  = (int) (qinit - qfsl);
 
      int remn_pdg = -1; 
@@ -237,19 +254,19 @@ TClonesArray * CharmHadronization::Hadronize(
          chrm_pdg = kPdgDM; remn_pdg = kPdgNeutron; 
      } 
 
-     double mc  = pdglib->Find(chrm_pdg)->Mass();           
-     double mn  = pdglib->Find(remn_pdg)->Mass();          
+     double mc  = pdglib->Mass(chrm_pdg);           
+     double mn  = pdglib->Mass(remn_pdg);          
 
      if(mc+mn < W) {
         // Set decay
         double mass[2] = {mc, mn};
-        bool permitted = fPhaseSpaceGenerator.SetDecay(p4H, 2, mass);
+        bool permitted = phase_space_generator.SetDecay(p4H, 2, mass);
         assert(permitted);
  
         // Get the maximum weight
         double wmax = -1;
         for(int i=0; i<200; i++) {
-           double w = fPhaseSpaceGenerator.Generate();
+           double w = phase_space_generator.Generate();
            wmax = TMath::Max(wmax,w);
         }
 
@@ -268,7 +285,7 @@ TClonesArray * CharmHadronization::Hadronize(
                   << "Couldn't generate an unweighted phase space decay after "
                   << idecay_try << " attempts";
              }
-             double w  = fPhaseSpaceGenerator.Generate();
+             double w  = phase_space_generator.Generate();
              if(w > wmax) {
                 LOG("CharmHad", pWARN)
                  << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -278,7 +295,7 @@ TClonesArray * CharmHadronization::Hadronize(
 
              if(accept_decay) {
                  used_lowW_strategy = true;
-                 TLorentzVector * p4 = fPhaseSpaceGenerator.GetDecay(0);
+                 TLorentzVector * p4 = phase_space_generator.GetDecay(0);
                  p4C            = *p4;
                  ch_pdg         = chrm_pdg;
                  fs_nucleon_pdg = remn_pdg;
@@ -301,7 +318,7 @@ TClonesArray * CharmHadronization::Hadronize(
 
   TLorentzVector p4R = p4H - p4C;
   double WR = p4R.M();
-  double MC = pdglib->Find(ch_pdg)->Mass();
+  double MC = pdglib->Mass(ch_pdg);
 
   LOG("CharmHad", pNOTICE) << "Remnant hadronic system mass = " << WR;
 
@@ -480,24 +497,10 @@ TClonesArray * CharmHadronization::Hadronize(
 
      //
      // Run PYTHIA for the hadronization of remnant system
+     // (pi0 are not decayed, Deltas are)
      //
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),              1,0); // don't decay pi0
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1,1); // decay Delta+
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1,1); // decay Delta++
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1,1); // decay Delta++
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1,1); // decay Delta++
-//   fPythia->SetMDCY(fPythia->Pycomp(kPdgDeltaP),  1,1); // decay Delta+
-//   fPythia->SetMDCY(fPythia->Pycomp(kPdgDeltaPP), 1,1); // decay Delta++
-
-     int ip = 0;
-     py2ent_(&ip, &qrkSyst1, &qrkSyst2, &WR); // hadronize
-
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),1,1); // restore
-
-     //-- Get PYTHIA's LUJETS event record
-     TClonesArray * remnants = 0;
-     fPythia->GetPrimaries();
-     remnants = dynamic_cast<TClonesArray *>(fPythia->ImportParticles("All"));
+     TClonesArray * remnants =
+          fFragmenter->Fragment(qrkSyst1, qrkSyst2, WR, fRemnantFragmSettings);
      if(!remnants) {
          LOG("CharmHad", pWARN) << "Couldn't hadronize (non-charm) remnants!";
          return 0;
@@ -534,6 +537,8 @@ TClonesArray * CharmHadronization::Hadronize(
          bremn -> SetFirstChild ( (ifc == 0 ? -1 : ifc+1) );
          bremn -> SetLastChild  ( (ilc == 0 ? -1 : ilc+1) );
       }
+      remnants->Delete();
+      delete remnants;
   } // use_pythia
 
   // ....................................................................
@@ -553,8 +558,8 @@ TClonesArray * CharmHadronization::Hadronize(
      // -1    :  (n pi-)
      //
      double qfsl  = interaction->FSPrimLepton()->Charge() / 3.;
-     double qinit = pdglib->Find(nuc_pdg)->Charge() / 3.;
-     double qch   = pdglib->Find(ch_pdg)->Charge() / 3.;
+     double qinit = pdglib->Charge(nuc_pdg) / 3.;
+     double qch   = pdglib->Charge(ch_pdg) / 3.;
      int Q = (int) (qinit - qfsl - qch); // remnant hadronic system charge
 
      bool allowdup=true;
@@ -577,11 +582,11 @@ TClonesArray * CharmHadronization::Hadronize(
            pd.push_back(kPdgNeutron);  pd.push_back(kPdgPiM);  }
 
      double mass[2] = {
-       pdglib->Find(pd[0])->Mass(), pdglib->Find(pd[1])->Mass()
+       pdglib->Mass(pd[0]), pdglib->Mass(pd[1])
      };
 
      // Set the decay
-     bool permitted = fPhaseSpaceGenerator.SetDecay(p4R, 2, mass);
+     bool permitted = phase_space_generator.SetDecay(p4R, 2, mass);
      if(!permitted) {
        LOG("CharmHad", pERROR) << " *** Phase space decay is not permitted";
        return 0;
@@ -589,7 +594,7 @@ TClonesArray * CharmHadronization::Hadronize(
      // Get the maximum weight
      double wmax = -1;
      for(int i=0; i<200; i++) {
-       double w = fPhaseSpaceGenerator.Generate();
+       double w = phase_space_generator.Generate();
        wmax = TMath::Max(wmax,w);
      }
      if(wmax<=0) {
@@ -615,7 +620,7 @@ TClonesArray * CharmHadronization::Hadronize(
              << itry << " attempts";
          return 0;
       }
-      double w = fPhaseSpaceGenerator.Generate();
+      double w = phase_space_generator.Generate();
       if(w > wmax) {
           LOG("CharmHad", pWARN)
              << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -627,7 +632,7 @@ TClonesArray * CharmHadronization::Hadronize(
      }
      for(unsigned int i=0; i<2; i++) {
         int pdgc = pd[i];
-        TLorentzVector * p4d = fPhaseSpaceGenerator.GetDecay(i);
+        TLorentzVector * p4d = phase_space_generator.GetDecay(i);
         new ( (*particle_list)[rpos+i] ) TMCParticle(
            1,pdgc,1,-1,-1,p4d->Px(),p4d->Py(),p4d->Pz(),p4d->Energy(),
            mass[i],0,0,0,0,0);
@@ -23,11 +23,9 @@
 #ifndef _CHARM_HADRONIZATION_H_
 #define _CHARM_HADRONIZATION_H_
 
-#include <TGenPhaseSpace.h>
-
 #include "Physics/Hadronization/HadronizationModelI.h"
+#include "Physics/Hadronization/StringFragmentationI.h"
 
-class TPythia6;
 class TF1;
 
 namespace genie {
@@ -61,8 +59,6 @@ private:
   void LoadConfig          (void);
   int  GenerateCharmHadron (int nupdg, double EvLab) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
-
   // Configuration parameters
   //
   bool                           fCharmOnly;   ///< don't hadronize non-charm blob
@@ -73,7 +69,8 @@ private:
   Spline *                       fDsFracSpl;   ///< nu charm fraction vs Ev: Ds+
   double                         fD0BarFrac;   ///< nubar \bar{D0} charm fraction
   double                         fDmFrac;      ///< nubar D- charm fraction
-  mutable TPythia6 *             fPythia;      ///< remnant (non-charm) hadronizer
+  mutable const StringFragmentationI * fFragmenter; ///< remnant (non-charm) hadronizer
+  mutable StringFragmSettings_t  fRemnantFragmSettings; ///< remnant fragmentation settings
 };
 
 }         // genie namespace
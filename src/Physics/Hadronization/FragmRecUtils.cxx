@@ -69,7 +69,7 @@ int genie::utils::fragmrec::NPositives(const TClonesArray * const part_list)
   int npos = 0;
 
   while( (p = (TMCParticle *) piter.Next()) )
-         if( PDGLibrary::Instance()->Find(p->GetKF())->Charge() > 0 ) npos++;
+         if( PDGLibrary::Instance()->Charge(p->GetKF()) > 0 ) npos++;
 
   return npos;
 }
@@ -84,7 +84,7 @@ int genie::utils::fragmrec::NNegatives(const TClonesArray * const part_list)
   int nneg = 0;
 
   while( (p = (TMCParticle *) piter.Next()) )
-         if( PDGLibrary::Instance()->Find(p->GetKF())->Charge() < 0 ) nneg++;
+         if( PDGLibrary::Instance()->Charge(p->GetKF()) < 0 ) nneg++;
 
   return nneg;
 }
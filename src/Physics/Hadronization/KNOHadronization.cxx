@@ -22,6 +22,12 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The phase space generator and the weight of the generated system are
+   kept in per-thread scratch state, so that one instance can hadronize
+   on several threads.
 */
 //____________________________________________________________________________
 
@@ -63,6 +69,18 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils::print;
 
+//____________________________________________________________________________
+namespace {
+
+  // Per-thread state of KNOHadronization
+  class KNOScratch : public AlgScratchI {
+  public:
+    KNOScratch() : Weight(1.) {}
+    TGenPhaseSpace PhaseSpaceGenerator; ///< a phase space generator
+    double         Weight;              ///< weight for generated event
+  };
+}
+
 //____________________________________________________________________________
 KNOHadronization::KNOHadronization() :
 HadronizationModelBase("genie::KNOHadronization")
@@ -104,7 +122,7 @@ TClonesArray * KNOHadronization::Hadronize(
      LOG("KNOHad", pWARN) << "Returning a null particle list!";
      return 0;
   }
-  fWeight=1;
+  static_cast<KNOScratch *>(this->Scratch())->Weight = 1;
 
   double W = utils::kinematics::W(interaction);
   LOG("KNOHad", pINFO) << "W = " << W << " GeV";
@@ -265,7 +283,7 @@ PDGCodeList * KNOHadronization::SelectParticles(
     vector<int>::const_iterator pdg_iter;
     for(pdg_iter = pdgcv->begin(); pdg_iter != pdgcv->end(); ++pdg_iter) {
       int pdgc = *pdg_iter;
-      double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+      double m = PDGLibrary::Instance()->Mass(pdgc);
 
       msum += m;
       LOG("KNOHad", pDEBUG) << "- PDGC=" << pdgc << ", m=" << m << " GeV";
@@ -407,7 +425,12 @@ TH1D * KNOHadronization::MultiplicityProb(
 //____________________________________________________________________________
 double KNOHadronization::Weight(void) const
 {
-  return fWeight;
+  return static_cast<KNOScratch *>(this->Scratch())->Weight;
+}
+//____________________________________________________________________________
+AlgScratchI * KNOHadronization::NewScratch(void) const
+{
+  return new KNOScratch;
 }
 //____________________________________________________________________________
 // methods overloading the default Algorithm interface implementation:
@@ -675,7 +698,7 @@ int KNOHadronization::HadronShowerCharge(const Interaction* interaction) const
   assert( pdg::IsProton(hit_nucleon) || pdg::IsNeutron(hit_nucleon) );
 
   // Ask PDGLibrary for the nucleon charge
-  double qnuc = PDGLibrary::Instance()->Find(hit_nucleon)->Charge() / 3.;
+  double qnuc = PDGLibrary::Instance()->Charge(hit_nucleon) / 3.;
 
   // calculate the hadron shower charge
   hadronShowerCharge = (int) ( qp + qnuc - ql );
@@ -722,7 +745,7 @@ TClonesArray * KNOHadronization::DecayMethod2(
 
   // Take the baryon
   int    baryon = pdgv[0]; 
-  double MN     = PDGLibrary::Instance()->Find(baryon)->Mass();
+  double MN     = PDGLibrary::Instance()->Mass(baryon);
   double MN2    = TMath::Power(MN, 2);
 
   // Check baryon code
@@ -738,7 +761,7 @@ TClonesArray * KNOHadronization::DecayMethod2(
   vector<int>::const_iterator pdg_iter = pdgv_strip.begin();
   for( ; pdg_iter != pdgv_strip.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    mass_sum += PDGLibrary::Instance()->Find(pdgc)->Mass();
+    mass_sum += PDGLibrary::Instance()->Mass(pdgc);
   }
 
   // Create the particle list
@@ -908,7 +931,7 @@ bool KNOHadronization::PhaseSpaceDecay(
   double   sum  = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m = PDGLibrary::Instance()->Mass(pdgc);
     mass[i++] = m;
     sum += m;
   }
@@ -919,7 +942,10 @@ bool KNOHadronization::PhaseSpaceDecay(
     << "Decaying system p4 = " << utils::print::P4AsString(&pd);
 
   // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(pd, pdgv.size(), mass);
+  KNOScratch * scratch = static_cast<KNOScratch *>(this->Scratch());
+  TGenPhaseSpace & phase_space = scratch->PhaseSpaceGenerator;
+
+  bool permitted = phase_space.SetDecay(pd, pdgv.size(), mass);
   if(!permitted) {
      LOG("KNOHad", pERROR) 
        << " *** Phase space decay is not permitted \n"
@@ -932,11 +958,11 @@ bool KNOHadronization::PhaseSpaceDecay(
   }
 
   // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
+  //double wmax = phase_space.GetWtMax();
   double wmax = -1;
   for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     if(reweight) { w *= this->ReWeightPt2(pdgv); }
+     double w = phase_space.Generate();   
+     if(reweight) { w *= this->ReWeightPt2(phase_space, pdgv); }
      wmax = TMath::Max(wmax,w);
   }
   assert(wmax>0);
@@ -951,9 +977,9 @@ bool KNOHadronization::PhaseSpaceDecay(
   if(fGenerateWeighted) 
   {
     // *** generating weighted decays ***
-    double w = fPhaseSpaceGenerator.Generate();   
-    if(reweight) { w *= this->ReWeightPt2(pdgv); }
-    fWeight *= TMath::Max(w/wmax, 1.);
+    double w = phase_space.Generate();   
+    if(reweight) { w *= this->ReWeightPt2(phase_space, pdgv); }
+    scratch->Weight *= TMath::Max(w/wmax, 1.);
   }
   else 
   {
@@ -975,8 +1001,8 @@ bool KNOHadronization::PhaseSpaceDecay(
          return false;
        }
 
-       double w  = fPhaseSpaceGenerator.Generate();   
-       if(reweight) { w *= this->ReWeightPt2(pdgv); }
+       double w  = phase_space.Generate();   
+       if(reweight) { w *= this->ReWeightPt2(phase_space, pdgv); }
        if(w > wmax) {
           LOG("KNOHad", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -1007,7 +1033,7 @@ bool KNOHadronization::PhaseSpaceDecay(
      int pdgc = *pdg_iter;
 
      //-- get the 4-momentum of the i-th final state particle
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(i);
+     TLorentzVector * p4fin = phase_space.GetDecay(i);
 
      new ( plist[offset+i] ) TMCParticle(
            1,               /* KS Code                          */
@@ -1035,7 +1061,8 @@ bool KNOHadronization::PhaseSpaceDecay(
   return true;
 }
 //____________________________________________________________________________
-double KNOHadronization::ReWeightPt2(const PDGCodeList & pdgcv) const
+double KNOHadronization::ReWeightPt2(
+          TGenPhaseSpace & phase_space, const PDGCodeList & pdgcv) const
 {
 // Phase Space Decay re-weighting to reproduce exp(-pT2/<pT2>) pion pT2 
 // distributions.
@@ -1049,7 +1076,7 @@ double KNOHadronization::ReWeightPt2(const PDGCodeList & pdgcv) const
      //int pdgc = pdgcv[i];
      //if(pdgc!=kPdgPiP&&pdgc!=kPdgPiM) continue;
 
-     TLorentzVector * p4 = fPhaseSpaceGenerator.GetDecay(i); 
+     TLorentzVector * p4 = phase_space.GetDecay(i); 
      double pt2 = TMath::Power(p4->Px(),2) + TMath::Power(p4->Py(),2);
      double wi  = TMath::Exp(-fPhSpRwA*TMath::Sqrt(pt2));
      //double wi = (9.41 * TMath::Landau(pt2,0.24,0.12));
@@ -1092,7 +1119,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
   if(baryon_chg_is_pos) maxQ -= 1;
   if(baryon_chg_is_neg) maxQ += 1;
   hadrons_to_add--;
-  W -= pdg->Find( (*pdgc)[0] )->Mass();
+  W -= pdg->Mass( (*pdgc)[0] );
 
   //
   // Assign remaining hadrons up to n = multiplicity
@@ -1112,7 +1139,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               maxQ -= 1;
               hadrons_to_add--;
-              W -= pdg->Find(kPdgKP)->Mass();
+              W -= pdg->Mass(kPdgKP);
            }
            else if(maxQ == 0) {
               LOG("KNOHad", pDEBUG) << " -> Adding a K0";
@@ -1120,7 +1147,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
     
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               hadrons_to_add--;
-              W -= pdg->Find(kPdgK0)->Mass();
+              W -= pdg->Mass(kPdgK0);
            }
         }
 
@@ -1132,7 +1159,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
            // update n-of-hadrons to add, avail. shower charge & invariant mass
            maxQ -= 1;
            hadrons_to_add--;
-           W -= pdg->Find(kPdgKP)->Mass();
+           W -= pdg->Mass(kPdgKP);
         }
         else if(multiplicity == 3 && maxQ == -1) { //adding K+ makes it impossible to balance charge
            LOG("KNOHad", pDEBUG) << " -> Adding a K0"; 
@@ -1140,7 +1167,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
    
            // update n-of-hadrons to add, avail. shower charge & invariant mass
            hadrons_to_add--;
-           W -= pdg->Find(kPdgK0)->Mass();
+           W -= pdg->Mass(kPdgK0);
         }
 
         //simply conserve strangeness, without regard to charge
@@ -1153,7 +1180,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               maxQ -= 1;
               hadrons_to_add--;
-              W -= pdg->Find(kPdgKP)->Mass();
+              W -= pdg->Mass(kPdgKP);
            }
            else {
               LOG("KNOHad", pDEBUG) <<" -> Adding a K0";
@@ -1161,7 +1188,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
     
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               hadrons_to_add--;
-              W -= pdg->Find(kPdgK0)->Mass();
+              W -= pdg->Mass(kPdgK0);
            } 
         }
   }//if the baryon is strange
@@ -1178,7 +1205,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
         maxQ += 1;
         hadrons_to_add--;
 
-        W -= pdg->Find(kPdgPiM)->Mass();
+        W -= pdg->Mass(kPdgPiM);
 
      } else if (maxQ > 0) {
         // Need more positive charge
@@ -1189,7 +1216,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
         maxQ -= 1;
         hadrons_to_add--;
 
-        W -= pdg->Find(kPdgPiP)->Mass();
+        W -= pdg->Mass(kPdgPiP);
      }
   }
 
@@ -1225,7 +1252,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
 
         // update n-of-hadrons to add & available invariant mass
         hadrons_to_add--;
-        W -= pdg->Find(kPdgPi0)->Mass();
+        W -= pdg->Mass(kPdgPi0);
      }
 
      // Now add pairs (pi0 pi0 / pi+ pi- / K+ K- / K0 K0bar)
@@ -83,7 +83,8 @@ private:
   double        KNO                   (int nu, int nuc, double z)    const;
   double        AverageChMult         (int nu, int nuc, double W)    const;
   void          HandleDecays          (TClonesArray * particle_list) const;
-  double        ReWeightPt2           (const PDGCodeList & pdgcv)    const;
+  double        ReWeightPt2           (TGenPhaseSpace & phase_space,
+                                       const PDGCodeList & pdgcv)    const;
 
   TClonesArray* DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
   TClonesArray* DecayMethod2    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
@@ -93,8 +94,8 @@ private:
          TClonesArray & pl, TLorentzVector & pd, 
 	   const PDGCodeList & pdgv, int offset=0, bool reweight=false) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
-  mutable double         fWeight;              ///< weight for generated event
+  // per-thread phase space generator & weight of the generated system
+  AlgScratchI * NewScratch (void) const;
 
   // Configuration parameters
   // Note: additional configuration parameters common to all hadronizers
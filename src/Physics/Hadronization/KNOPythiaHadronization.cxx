@@ -13,6 +13,8 @@
  @ Feb 10, 2011
    Fixed a bug reported by Torben Ferber affecting the KNO -> PYTHIA
    model transition (the order was reversed!)
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Keep the weight of the last hadronization in the per-thread scratch.
 
 */
 //____________________________________________________________________________
@@ -34,6 +36,17 @@
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+
+  // Per-thread state of KNOPythiaHadronization: the weight of the last event
+  class KNOPythiaHadronizationScratch : public AlgScratchI {
+  public:
+    KNOPythiaHadronizationScratch() : Weight(1.) {}
+    double Weight;
+  };
+}
+
 //____________________________________________________________________________
 KNOPythiaHadronization::KNOPythiaHadronization() :
 HadronizationModelI("genie::KNOPythiaHadronization")
@@ -73,7 +86,9 @@ TClonesArray * KNOPythiaHadronization::Hadronize(
   }
 
   //-- Init event weight (to be set if producing weighted events)
-  fWeight = 1.;
+  double & weight =
+     static_cast<KNOPythiaHadronizationScratch *>(this->Scratch())->Weight;
+  weight = 1.;
 
   //-- Select hadronizer
   const HadronizationModelI * hadronizer = this->SelectHadronizer(interaction);
@@ -82,7 +97,7 @@ TClonesArray * KNOPythiaHadronization::Hadronize(
   TClonesArray * particle_list = hadronizer->Hadronize(interaction);
 
   //-- Update the weight
-  fWeight = hadronizer->Weight();
+  weight = hadronizer->Weight();
 
   return particle_list;
 }
@@ -113,7 +128,12 @@ TH1D * KNOPythiaHadronization::MultiplicityProb(
 //____________________________________________________________________________
 double KNOPythiaHadronization::Weight(void) const
 {
-  return fWeight;
+  return static_cast<KNOPythiaHadronizationScratch *>(this->Scratch())->Weight;
+}
+//____________________________________________________________________________
+AlgScratchI * KNOPythiaHadronization::NewScratch(void) const
+{
+  return new KNOPythiaHadronizationScratch;
 }
 //____________________________________________________________________________
 const HadronizationModelI * KNOPythiaHadronization::SelectHadronizer(
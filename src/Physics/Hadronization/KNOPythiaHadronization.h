@@ -52,8 +52,7 @@ private:
 
   void LoadConfig (void);
   const HadronizationModelI * SelectHadronizer(const Interaction *) const;
-
-  mutable double fWeight; ///< weight for generated event
+  AlgScratchI * NewScratch (void) const;
 
   //-- configuration
 
@@ -0,0 +1,123 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
+#include <TMCParticle.h>
+#else
+#include <TMCParticle6.h>
+#endif
+#include <TClonesArray.h>
+#include <TPythia6.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/Pythia6Lock.h"
+#include "Physics/Hadronization/Pythia6Fragmentation.h"
+
+using namespace genie;
+
+// the actual PYTHIA call
+extern "C" void py2ent_(int *,  int *, int *, double *);
+
+//____________________________________________________________________________
+Pythia6Fragmentation * Pythia6Fragmentation::Instance()
+{
+  static Pythia6Fragmentation frag;
+  return &frag;
+}
+//____________________________________________________________________________
+Pythia6Fragmentation::Pythia6Fragmentation()
+{
+  // sync GENIE/PYTHIA6 seed number
+  RandomGen::Instance();
+}
+//____________________________________________________________________________
+Pythia6Fragmentation::~Pythia6Fragmentation()
+{
+
+}
+//____________________________________________________________________________
+TClonesArray * Pythia6Fragmentation::Fragment(
+   int q1, int q2, double W, const StringFragmSettings_t & settings) const
+{
+  Pythia6Lock lock;
+
+  TPythia6 * pythia = TPythia6::Instance();
+
+  // set the fragmentation parameters requested by the caller, keeping the
+  // current ones so as to restore them after the call
+  const int kNParj = 4;
+  const int parj_index[kNParj] = { 2, 21, 23, 33 };
+  double    parj_saved[kNParj];
+  if(settings.SetParams) {
+    for(int i = 0; i < kNParj; i++) {
+      parj_saved[i] = pythia->GetPARJ(parj_index[i]);
+    }
+    pythia->SetPARJ(2,  settings.SSBarSuppression);
+    pythia->SetPARJ(21, settings.GaussianPt2);
+    pythia->SetPARJ(23, settings.NonGaussianPt2Tail);
+    pythia->SetPARJ(33, settings.RemainingECutoff);
+  }
+
+  // set the decay switches requested by the caller, keeping the current
+  // ones so as not to interfere with the decayer
+  unsigned int ndec   = settings.Decay.size();
+  unsigned int nnodec = settings.NoDecay.size();
+  vector<int> kc   (ndec+nnodec);
+  vector<int> flag (ndec+nnodec);
+  for(unsigned int i = 0; i < ndec+nnodec; i++) {
+    int pdgc = (i < ndec) ? settings.Decay[i] : settings.NoDecay[i-ndec];
+    kc  [i] = pythia->Pycomp(pdgc);
+    flag[i] = pythia->GetMDCY(kc[i], 1);
+    pythia->SetMDCY(kc[i], 1, (i < ndec) ? 1 : 0);
+  }
+
+  // -- hadronize --
+  int ip = 0;
+  py2ent_(&ip, &q1, &q2, &W);
+
+  // restore pythia decay settings & fragmentation parameters
+  for(unsigned int i = 0; i < ndec+nnodec; i++) {
+    pythia->SetMDCY(kc[i], 1, flag[i]);
+  }
+  if(settings.SetParams) {
+    for(int i = 0; i < kNParj; i++) {
+      pythia->SetPARJ(parj_index[i], parj_saved[i]);
+    }
+  }
+
+  // get LUJETS record
+  pythia->GetPrimaries();
+  TClonesArray * pythia_particles =
+       (TClonesArray *) pythia->ImportParticles("All");
+  if(!pythia_particles) {
+     LOG("Pythia6Frag", pWARN) << "No LUJETS record was imported!";
+     return 0;
+  }
+
+  // copy PYTHIA container to a new TClonesArray so as to transfer ownership
+  // of the container and of its elements to the calling method
+  int np = pythia_particles->GetEntries();
+  if(np <= 0) return 0;
+
+  TClonesArray * particle_list = new TClonesArray("TMCParticle", np);
+  particle_list->SetOwner(true);
+
+  for(int i = 0; i < np; i++) {
+     TMCParticle * particle = (TMCParticle *) pythia_particles->At(i);
+     new ( (*particle_list)[i] ) TMCParticle(*particle);
+  }
+
+  return particle_list;
+}
+//____________________________________________________________________________
@@ -0,0 +1,52 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::Pythia6Fragmentation
+
+\brief    StringFragmentationI backend using the PYTHIA6 / JETSET string
+          fragmentation (PY2ENT).
+
+          There is only one PYTHIA6 state per process, so the backend is a
+          singleton and each Fragment() call holds a Pythia6Lock while it
+          applies the caller's settings, fragments, restores the decay
+          switches and fragmentation parameters it changed and copies the
+          LUJETS record. Hadronization models sharing
+          it from several threads get correct, but serialized, fragmentation.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PYTHIA6_FRAGMENTATION_H_
+#define _PYTHIA6_FRAGMENTATION_H_
+
+#include "Physics/Hadronization/StringFragmentationI.h"
+
+namespace genie {
+
+class Pythia6Fragmentation : public StringFragmentationI {
+
+public:
+
+  static Pythia6Fragmentation * Instance (void);
+
+  // Implement the StringFragmentationI interface
+  TClonesArray * Fragment (int q1, int q2, double W,
+                  const StringFragmSettings_t & settings) const;
+
+private:
+
+  Pythia6Fragmentation();
+  Pythia6Fragmentation(const Pythia6Fragmentation & frag);
+  virtual ~Pythia6Fragmentation();
+};
+
+}         // genie namespace
+
+#endif    // _PYTHIA6_FRAGMENTATION_H_
@@ -9,6 +9,11 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Fragmentation goes through the StringFragmentationI backend, with the
+   PYTHIA parameters and decay switches of this instance passed per call.
 */
 //____________________________________________________________________________
 
@@ -35,13 +40,11 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/Hadronization/FragmRecUtils.h"
+#include "Physics/Hadronization/Pythia6Fragmentation.h"
 
 using namespace genie;
 using namespace genie::constants;
 
-// the actual PYTHIA call
-extern "C" void py2ent_(int *,  int *, int *, double *);
-
 //____________________________________________________________________________
 PythiaHadronization::PythiaHadronization() :
 HadronizationModelBase("genie::PythiaHadronization")
@@ -62,10 +65,7 @@ PythiaHadronization::~PythiaHadronization()
 //____________________________________________________________________________
 void PythiaHadronization::Initialize(void) const
 {
-  fPythia = TPythia6::Instance();
-
-  // sync GENIE/PYTHIA6 seed number
-  RandomGen::Instance();
+  fFragmenter = Pythia6Fragmentation::Instance();
 }
 //____________________________________________________________________________
 TClonesArray * 
@@ -223,72 +223,18 @@ TClonesArray *
   LOG("PythiaHad", pNOTICE)
         << "Fragmentation / Init System: "
         << "q = " << final_quark << ", qq = " << diquark;
-  int ip = 0;
-
-  // Determine how jetset treats un-stable particles appearing in hadronization
-
-  int pi0_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgPi0),              1); 
-  int K0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgK0),               1); 
-  int K0b_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgAntiK0),           1); 
-  int L0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgLambda),           1); 
-  int L0b_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgAntiLambda),       1);
-  int Dm_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1); 
-  int D0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1); 
-  int Dp_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1); 
-  int Dpp_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1); 
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for pi0           =  " << pi0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for K0            =  " << K0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for \bar{K0}      =  " << K0b_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for Lambda        =  " << L0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for \bar{Lambda0} =  " << L0b_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D-            =  " << Dm_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D0            =  " << D0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D+            =  " << Dp_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D++           =  " << Dpp_decflag;
-#endif
-
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),               1,0); // don't decay pi0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgK0),                1,0); // don't decay K0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiK0),            1,0); // don't decay \bar{K0}
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgLambda),            1,0); // don't decay Lambda0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiLambda),        1,0); // don't decay \bar{Lambda0}
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),   1,1); // decay Delta-
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),   1,1); // decay Delta0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),   1,1); // decay Delta+
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP),  1,1); // decay Delta++
 
   // -- hadronize --
-  py2ent_(&ip, &final_quark, &diquark, &W); // hadronizer
-
-  // restore pythia decay settings so as not to interfere with decayer 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),              1, pi0_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgK0),               1, K0_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiK0),           1, K0b_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgLambda),           1, L0_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiLambda),       1, L0b_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1, Dm_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1, D0_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1, Dp_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1, Dpp_decflag); 
-
-  // get LUJETS record
-  fPythia->GetPrimaries();
-  TClonesArray * pythia_particles =
-       (TClonesArray *) fPythia->ImportParticles("All");
-
-  // copy PYTHIA container to a new TClonesArray so as to transfer ownership
-  // of the container and of its elements to the calling method
-
-  int np = pythia_particles->GetEntries();
-  assert(np>0);
-  TClonesArray * particle_list = new TClonesArray("TMCParticle", np);
-  particle_list->SetOwner(true);
-
-  unsigned int i = 0;
+  // (pi0, K0, \bar{K0}, Lambda0, \bar{Lambda0} are not decayed, Deltas are)
+  TClonesArray * particle_list =
+       fFragmenter->Fragment(final_quark, diquark, W, fFragmSettings);
+  if(!particle_list) {
+     LOG("PythiaHad", pERROR) << "Hadronization failed!";
+     return 0;
+  }
+
   TMCParticle * particle = 0;
-  TIter particle_iter(pythia_particles);
+  TIter particle_iter(particle_list);
 
   while( (particle = (TMCParticle *) particle_iter.Next()) ) {
      LOG("PythiaHad", pDEBUG)
@@ -310,9 +256,6 @@ TClonesArray *
      particle->SetParent     (particle->GetParent()     - 1);
      particle->SetFirstChild (particle->GetFirstChild() - 1);
      particle->SetLastChild  (particle->GetLastChild()  - 1);
-
-     // insert the particle in the list
-     new ( (*particle_list)[i++] ) TMCParticle(*particle);
   }
 
   utils::fragmrec::Print(particle_list);
@@ -444,10 +387,24 @@ void PythiaHadronization::LoadConfig(void)
   GetParam( "PYTHIA-NonGaussianPt2Tail", fNonGaussianPt2Tail  ) ;
   GetParam( "PYTHIA-RemainingEnergyCutoff", fRemainingECutoff ) ;
 
-  fPythia->SetPARJ(2,  fSSBarSuppression);
-  fPythia->SetPARJ(21, fGaussianPt2);
-  fPythia->SetPARJ(23, fNonGaussianPt2Tail);
-  fPythia->SetPARJ(33, fRemainingECutoff);
+  fFragmSettings = StringFragmSettings_t();
+  fFragmSettings.SetParams          = true;
+  fFragmSettings.SSBarSuppression   = fSSBarSuppression;
+  fFragmSettings.GaussianPt2        = fGaussianPt2;
+  fFragmSettings.NonGaussianPt2Tail = fNonGaussianPt2Tail;
+  fFragmSettings.RemainingECutoff   = fRemainingECutoff;
+
+  // decay flags used in hadronization: Deltas decay, while the pi0, K0 and
+  // Lambda0 (and antiparticles) are left to the decayer
+  fFragmSettings.NoDecay.push_back(kPdgPi0);
+  fFragmSettings.NoDecay.push_back(kPdgK0);
+  fFragmSettings.NoDecay.push_back(kPdgAntiK0);
+  fFragmSettings.NoDecay.push_back(kPdgLambda);
+  fFragmSettings.NoDecay.push_back(kPdgAntiLambda);
+  fFragmSettings.Decay.push_back(kPdgP33m1232_DeltaM);
+  fFragmSettings.Decay.push_back(kPdgP33m1232_Delta0);
+  fFragmSettings.Decay.push_back(kPdgP33m1232_DeltaP);
+  fFragmSettings.Decay.push_back(kPdgP33m1232_DeltaPP);
 
   // Load Wcut determining the phase space area where the multiplicity prob.
   // scaling factors would be applied -if requested-
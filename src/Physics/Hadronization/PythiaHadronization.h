@@ -5,6 +5,9 @@
 
 \brief    Provides access to the PYTHIA hadronization models. \n
           Is a concrete implementation of the HadronizationModelI interface.
+          The string fragmentation is delegated to a StringFragmentationI
+          backend (PYTHIA6 / JETSET by default), called with the settings
+          of this instance.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -14,15 +17,20 @@
 \cpright  Copyright (c) 2003-2018, The GENIE Collaboration
           For the full text of the license visit http://copyright.genie-mc.org
           or see $GENIE/LICENSE
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Fragment through a StringFragmentationI backend instead of driving the
+   global TPythia6 instance directly.
+
 */
 //____________________________________________________________________________
 
 #ifndef _PYTHIA_HADRONIZATION_H_
 #define _PYTHIA_HADRONIZATION_H_
 
-#include <TPythia6.h>
-
 #include "Physics/Hadronization/HadronizationModelBase.h"
+#include "Physics/Hadronization/StringFragmentationI.h"
 
 namespace genie {
 
@@ -54,7 +62,7 @@ private:
   void SwitchDecays   (int pdgc, bool on_off) const;
   void HandleDecays   (TClonesArray * plist) const;
 */
-  mutable TPythia6 * fPythia;   ///< PYTHIA6 wrapper class
+  mutable const StringFragmentationI * fFragmenter; ///< string fragmentation backend
 
   const DecayModelI * fDecayer;
 
@@ -65,6 +73,8 @@ private:
   double fGaussianPt2;        ///< gaussian pt2 distribution width
   double fNonGaussianPt2Tail; ///< non gaussian pt2 tail parameterization
   double fRemainingECutoff;   ///< remaining E cutoff for stopping fragmentation
+
+  StringFragmSettings_t fFragmSettings; ///< settings passed to the backend
 };
 
 }         // genie namespace
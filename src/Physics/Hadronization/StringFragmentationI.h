@@ -0,0 +1,91 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::StringFragmentationI
+
+\brief    Pure abstract base class.
+          Defines the interface of the string fragmentation backends used by
+          the hadronization models (PythiaHadronization, CharmHadronization):
+          fragmentation of a colour singlet string stretched between a quark
+          and a diquark (or an antiquark) into hadrons.
+
+          The hadronization models do not drive a fragmentation program
+          directly. All the settings they need (fragmentation parameters,
+          particles to be decayed or not during fragmentation) are collected
+          in a StringFragmSettings_t built at configuration and passed with
+          every Fragment() call, so that a backend can apply them to the
+          state it uses for that call only. A backend hosting one
+          fragmentation state per thread can therefore be plugged in without
+          changes to the hadronization models; Pythia6Fragmentation, driving
+          the process-wide PYTHIA6 / JETSET state, serializes its callers.
+
+\class    genie::StringFragmSettings_t
+
+\brief    Per-caller settings for a StringFragmentationI::Fragment() call.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _STRING_FRAGMENTATION_I_H_
+#define _STRING_FRAGMENTATION_I_H_
+
+#include <vector>
+
+using std::vector;
+
+class TClonesArray;
+
+namespace genie {
+
+class StringFragmSettings_t {
+
+public:
+
+  StringFragmSettings_t()  { this->Init(); }
+  ~StringFragmSettings_t() { }
+
+  bool        SetParams;          ///< apply the parameters below? (else use the backend's)
+  double      SSBarSuppression;   ///< s/u quark suppression (PARJ(2))
+  double      GaussianPt2;        ///< width of the gaussian pT^2 (PARJ(21))
+  double      NonGaussianPt2Tail; ///< non-gaussian pT^2 tail (PARJ(23))
+  double      RemainingECutoff;   ///< remaining energy cutoff (PARJ(33))
+  vector<int> Decay;              ///< pdg codes of particles to decay
+  vector<int> NoDecay;            ///< pdg codes of particles not to decay
+
+private:
+
+  void Init(void) {
+    SetParams          = false;
+    SSBarSuppression   = 0;
+    GaussianPt2        = 0;
+    NonGaussianPt2Tail = 0;
+    RemainingECutoff   = 0;
+  }
+};
+
+class StringFragmentationI {
+
+public:
+
+  virtual ~StringFragmentationI() {}
+
+  //! Fragment the string stretched between q1 and q2 (pdg codes) with
+  //! invariant mass W, at its rest frame with q1 moving along +z.
+  //! The input settings apply to this call only.
+  //! Returns the fragmentation record (TMCParticles, with the mother and
+  //! daughter indices numbered from 1 as in the LUJETS record), owned by the
+  //! caller, or 0 if the fragmentation failed.
+  virtual TClonesArray * Fragment (int q1, int q2, double W,
+                  const StringFragmSettings_t & settings) const = 0;
+};
+
+}         // genie namespace
+
+#endif    // _STRING_FRAGMENTATION_I_H_
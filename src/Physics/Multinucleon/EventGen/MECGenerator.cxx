@@ -19,9 +19,17 @@
    Major development leading to the first complete version of the generator.
  @ Nov 20, 2015 - CA, SD  
    Add proper exception handling for failure of phase space decay.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The cross section model and the phase space generator are kept in
+   per-thread scratch state, so that one instance can generate events on
+   several threads.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The NSV importance sampling proposals are built under a CacheLock.
 */
 //____________________________________________________________________________
 
+#include <atomic>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -36,6 +44,11 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Numerical/PiecewiseProposal2D.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchProposal.h"
+#include "Framework/Utils/XSecSplineList.h"
 #include "Physics/Multinucleon/EventGen/MECGenerator.h"
 
 #include "Physics/NuclearState/NuclearModelI.h"
@@ -52,15 +65,74 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//___________________________________________________________________________
+namespace {
+
+  // Per-thread state of MECGenerator
+  class MECScratch : public AlgScratchI {
+  public:
+    MECScratch() : XSecModel(0) {}
+    const XSecAlgorithmI * XSecModel;           ///< xsec model of the current event
+    TGenPhaseSpace         PhaseSpaceGenerator; ///< nucleon cluster decays
+  };
+
+  // Number of times the xsec was found above the tabulated NSV max xsec
+  std::atomic<unsigned long> gNSVMaxXSecViolations(0);
+
+  // The NSV xsec tested first in the (T, costheta) accept/reject loop of
+  // MECGenerator::SelectNSVLeptonKinematics(), with (T, costheta) mapped
+  // onto the unit square
+  class NSVUnitSquareXSecFunc : public ROOT::Math::IBaseFunctionMultiDim
+  {
+  public:
+    NSVUnitSquareXSecFunc(const XSecAlgorithmI * xsec_model,
+       Interaction * in, double TMin, double TMax, double CosthMin,
+       double Q3Max) :
+      fXSecModel(xsec_model), fInteraction(in),
+      fTMin(TMin), fTMax(TMax), fCosthMin(CosthMin), fQ3Max(Q3Max)
+    {
+      fEnu     = in->InitState().ProbeE(kRfHitNucRest);
+      fLepMass = in->FSPrimLepton()->Mass();
+      int NuPDG = in->InitState().ProbePdg();
+      in->InitStatePtr()->TgtPtr()->SetHitNucPdg(
+            (NuPDG > 0) ? kPdgClusterNN : kPdgClusterPP);
+      in->ExclTagPtr()->SetResonance(genie::kNoResonance);
+    }
+    unsigned int NDim (void) const { return 2; }
+    double DoEval (const double * x) const {
+      double T     = fTMin     + x[0] * (fTMax - fTMin);
+      double Costh = fCosthMin + x[1] * (1.    - fCosthMin);
+      double Plep  = TMath::Sqrt( T * (T + (2.0 * fLepMass)));
+      double Q3    = TMath::Sqrt(Plep*Plep + fEnu*fEnu - 2.0 * Plep * fEnu * Costh);
+      if(Q3 >= fQ3Max) return 0.;
+      fInteraction->KinePtr()->SetKV(kKVTl,  T);
+      fInteraction->KinePtr()->SetKV(kKVctl, Costh);
+      return fXSecModel->XSec(fInteraction, kPSTlctl);
+    }
+    ROOT::Math::IBaseFunctionMultiDim * Clone (void) const {
+      return new NSVUnitSquareXSecFunc(
+         fXSecModel, fInteraction, fTMin, fTMax, fCosthMin, fQ3Max);
+    }
+  private:
+    const XSecAlgorithmI * fXSecModel;
+    Interaction *          fInteraction;
+    double fTMin, fTMax, fCosthMin, fQ3Max;
+    double fEnu, fLepMass;
+  };
+
+}
+
 //___________________________________________________________________________
 MECGenerator::MECGenerator() :
-EventRecordVisitorI("genie::MECGenerator")
+EventRecordVisitorI("genie::MECGenerator"),
+fUseImportanceSampling(false)
 {
 
 }
 //___________________________________________________________________________
 MECGenerator::MECGenerator(string config) :
-EventRecordVisitorI("genie::MECGenerator", config)
+EventRecordVisitorI("genie::MECGenerator", config),
+fUseImportanceSampling(false)
 {
 
 }
@@ -68,6 +140,21 @@ EventRecordVisitorI("genie::MECGenerator", config)
 MECGenerator::~MECGenerator()
 {
 
+}
+//___________________________________________________________________________
+const XSecAlgorithmI * MECGenerator::XSecModel(void) const
+{
+  return static_cast<MECScratch *>(this->Scratch())->XSecModel;
+}
+//___________________________________________________________________________
+void MECGenerator::SetXSecModel(const XSecAlgorithmI * xsec_model) const
+{
+  static_cast<MECScratch *>(this->Scratch())->XSecModel = xsec_model;
+}
+//___________________________________________________________________________
+AlgScratchI * MECGenerator::NewScratch(void) const
+{
+  return new MECScratch;
 }
 //___________________________________________________________________________
 void MECGenerator::ProcessEventRecord(GHepRecord * event) const
@@ -75,8 +162,8 @@ void MECGenerator::ProcessEventRecord(GHepRecord * event) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
-  if (fXSecModel->Id().Name() == "genie::EmpiricalMECPXSec2015") {
+  this->SetXSecModel(evg->CrossSectionAlg());
+  if (this->XSecModel()->Id().Name() == "genie::EmpiricalMECPXSec2015") {
       this -> AddTargetRemnant      (event); /// shortly, this will be handled by the InitialStateAppender module
       this -> GenerateFermiMomentum(event);
       this -> SelectEmpiricalKinematics(event);
@@ -89,7 +176,7 @@ void MECGenerator::ProcessEventRecord(GHepRecord * event) const
       // TODO: `DecayNucleonCluster` should probably be in `MECHadronicSystemGenerator`,
       // if we make that...
       this -> DecayNucleonCluster(event);
-  } else if (fXSecModel->Id().Name() == "genie::NievesSimoVacasMECPXSec2016") {
+  } else if (this->XSecModel()->Id().Name() == "genie::NievesSimoVacasMECPXSec2016") {
       this -> SelectNSVLeptonKinematics(event);
       this -> AddTargetRemnant(event);
       this -> GenerateNSVInitialHadrons(event);
@@ -101,7 +188,7 @@ void MECGenerator::ProcessEventRecord(GHepRecord * event) const
   else {
       LOG("MECGenerator",pFATAL) <<
           "ProcessEventRecord >> Cannot calculate kinematics for " <<
-          fXSecModel->Id().Name();
+          this->XSecModel()->Id().Name();
   }
 
 
@@ -229,7 +316,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
   // Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   Interaction * interaction = event->Summary();
   double Ev = interaction->InitState().ProbeE(kRfHitNucRest);
@@ -255,7 +342,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
       double W  = Wmin  + iw*dW;
       interaction->KinePtr()->SetQ2(Q2);  
       interaction->KinePtr()->SetW (W);   
-      double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+      double xsec = this->XSecModel()->XSec(interaction, kPSWQ2fE);
       xsec_max = TMath::Max(xsec, xsec_max);
     }
   }
@@ -285,7 +372,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
      // Calculate d2sigma/dQ2dW
      interaction->KinePtr()->SetQ2(gQ2);  
      interaction->KinePtr()->SetW (gW);   
-     double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+     double xsec = this->XSecModel()->XSec(interaction, kPSWQ2fE);
      
      // Decide whether to accept the current kinematics
      double t = xsec_max * rnd->RndKine().Rndm();
@@ -460,7 +547,9 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
     << "Decaying system p4 = " << utils::print::P4AsString(p4d);
 
   // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+  TGenPhaseSpace & phase_space =
+                static_cast<MECScratch *>(this->Scratch())->PhaseSpaceGenerator;
+  bool permitted = phase_space.SetDecay(*p4d, pdgv.size(), mass);
   if(!permitted) {
      LOG("MEC", pERROR) 
        << " *** Phase space decay is not permitted \n"
@@ -482,7 +571,7 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
   // Get the maximum weight
   double wmax = -1;
   for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();   
+     double w = phase_space.Generate();   
      wmax = TMath::Max(wmax,w);
   }
   assert(wmax>0);
@@ -515,7 +604,7 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
        exception.SetReturnStep(0);
        throw exception;
      }
-     double w  = fPhaseSpaceGenerator.Generate();   
+     double w  = phase_space.Generate();   
      if(w > wmax) {
         LOG("MEC", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -535,7 +624,7 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
   int idp = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
      int pdgc = *pdg_iter;
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
+     TLorentzVector * p4fin = phase_space.GetDecay(idp);
      event->AddParticle(pdgc, ist, nucleon_cluster_id,-1,-1,-1, *p4fin, v4);
      idp++;
   }
@@ -618,22 +707,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   double Q3 = 0.0; // magnitude of transfered 3 momentum
   double Q2 = 0.0; // properly Q^2 (Q squared) - transfered 4 momentum.
 
-  // Set lepton KE TMax for for throwing rndm in the accept/reject loop.
-  // We can accidentally set it too high, because the xsec will return zero.
-  // This way if someone reuses this code, they are not tripped up by it.
-  TMax = Enu - LepMass;
-
-  // Set Tmin for throwing rndm in the accept/reject loop
-  // the hadron tensors we expect will be limited in q3
-  // therefore also the outgoing lepton KE can't be too low or costheta too backward
-  // make the accept/reject loop more efficient by using Min values.
-  if(Enu < fQ3Max){
-    TMin = 0 ;
-    CosthMin = -1 ; 
-  } else {
-    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
-    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
-  }
+  this->NSVLeptonKinematicLimits(Enu, LepMass, TMin, TMax, CosthMin);
 
   // The accept/reject loop tests a rand against a maxxsec - must scale with A.
   int NuclearA = 12;
@@ -653,6 +727,20 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
     }
   }
   
+  // Use the max xsec tabulated at spline generation time, if available
+  // (this is much tighter than the parametrization used below, but it is
+  // found on a grid: the xsec may exceed it between grid points)
+  double XSecMaxTab = this->TabulatedNSVMaxXSec(interaction);
+
+  // If requested, generate (T, costheta) according to a piecewise-constant
+  // proposal following the xsec rather than uniformly
+  PiecewiseProposal2D * proposal = 0;
+  if(fUseImportanceSampling && TMax > TMin) {
+    proposal = this->NSVProposal(interaction, TMin, TMax, CosthMin);
+    if(proposal->Integral() <= 0) proposal = 0;
+  }
+  double u = 0, v = 0, XSecMaxIS = 0;
+
   // -- Generate and Test the Kinematics----------------------------------//
 
   RandomGen * rnd = RandomGen::Instance();
@@ -675,8 +763,14 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
       }
 
       // generate random kinetic energy T and Costh
-      T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
-      Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+      if(proposal) {
+        XSecMaxIS = proposal->Generate(rnd->RndKine(), u, v);
+        T = TMin + (TMax-TMin)*u;
+        Costh = CosthMin + (CosthMax-CosthMin)*v;
+      } else {
+        T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
+        Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+      }
 
       // Calculate useful values for judging this choice
       Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));  // ok is sqrt(E2 - m2)
@@ -707,6 +801,8 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
               //  and fit a line.  Use that plus 1.35 safety factors to limit the accept/reject loop.
               double XSecMax = 1.35 * TMath::Power(10.0, XSecMaxPar1 * TMath::Log10(Enu) - XSecMaxPar2);
               if (NuclearA > 12) XSecMax *=  NuclearAfactorXSecMax;  // Scale it by A, precomputed above.
+              if (XSecMaxTab > 0) XSecMax = XSecMaxTab;
+              if (proposal) XSecMax = XSecMaxIS;
 
               LOG("MEC", pDEBUG) << " T, Costh: " << T << ", " << Costh ;
 
@@ -722,28 +818,50 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
               else {
                   interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterPP);
               }
-              double XSec = fXSecModel->XSec(interaction, kPSTlctl);
-              // now get all with delta
-              interaction->ExclTagPtr()->SetResonance(genie::kP33_1232);
-              double XSecDelta = fXSecModel->XSec(interaction, kPSTlctl);
-              // get PN with delta
-              interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
-              double XSecDeltaPN = fXSecModel->XSec(interaction, kPSTlctl);
-              // now get delta-less PN
-              interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
-              double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
-
-              if (XSec > XSecMax) {
+              double XSec = this->XSecModel()->XSec(interaction, kPSTlctl);
+
+              if (proposal && XSec > XSecMax) {
+                  // proposal bound violated: raise it for subsequent events
+                  proposal->RaiseBound(u, v, fISSafetyFactor * XSec);
+                  LOG("MEC", pWARN) << "XSec is > proposal bound for nucleus " << TgtPDG
+                                    << " " << XSec << " > " << XSecMax
+                                    << " (" << proposal->NViolations() << " violations in "
+                                    << proposal->NGenerated() << " trials so far)";
+              }
+              else if (XSecMaxTab > 0 && XSec > XSecMax) {
+                  // tabulated max violated: raise it for the remaining
+                  // throws of this event
+                  unsigned long nviol = ++gNSVMaxXSecViolations;
+                  LOG("MEC", pWARN) << "XSec is > tabulated XSecMax for nucleus " << TgtPDG
+                                    << " " << XSec << " > " << XSecMax
+                                    << " (" << nviol << " violations so far)";
+                  XSecMaxTab = fNSVMaxXSecSafetyFactor * XSec;
+              }
+              else if (XSec > XSecMax) {
                   LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " " 
 				   << XSec << " > " << XSecMax 
 				   << " don't let this happen.";
               }
-              assert(XSec <= XSecMax);
+              assert(proposal || XSecMaxTab > 0 || XSec <= XSecMax);
               accept = XSec > XSecMax*rnd->RndKine().Rndm();
               LOG("MEC", pINFO) << "Xsec, Max, Accept: " << XSec << ", " 
                   << XSecMax << ", " << accept; 
 
               if(accept){
+                  if (proposal) proposal->Accepted();
+
+                  // The remaining cross sections are only needed for the
+                  // accepted kinematics
+                  // now get all with delta
+                  interaction->ExclTagPtr()->SetResonance(genie::kP33_1232);
+                  double XSecDelta = this->XSecModel()->XSec(interaction, kPSTlctl);
+                  // get PN with delta
+                  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
+                  double XSecDeltaPN = this->XSecModel()->XSec(interaction, kPSTlctl);
+                  // now get delta-less PN
+                  interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
+                  double XSecPN = this->XSecModel()->XSec(interaction, kPSTlctl);
+
                   // If it passes the All cross section we still need to do two things:
                   // * Was the initial state pn or not?
                   // * Do we assign the reaction to have had a Delta on the inside?
@@ -1074,6 +1192,234 @@ void MECGenerator::LoadConfig(void)
     assert(fNuclModel);
 
     GetParam( "NSV-Q3Max", fQ3Max ) ;
+
+    // Safety factor applied to the tabulated max xsec for the NSV model
+    GetParamDef( "NSV-MaxXSec-SafetyFactor", fNSVMaxXSecSafetyFactor, 1.2 ) ;
+
+    // Importance sampling of the NSV lepton kinematics
+    GetParamDef( "ImportanceSampling",      fUseImportanceSampling, false ) ;
+    GetParamDef( "IS-NCells",               fISNCells,              10    ) ;
+    GetParamDef( "IS-SafetyFactor",         fISSafetyFactor,        1.2   ) ;
+    GetParamDef( "IS-NEnergyBinsPerDecade", fISNEBinsPerDecade,     20    ) ;
+    assert(fISNCells > 0 && fISNEBinsPerDecade > 0 && fISSafetyFactor >= 1);
 }
 //___________________________________________________________________________
+void MECGenerator::NSVLeptonKinematicLimits(double Enu, double LepMass,
+          double & TMin, double & TMax, double & CosthMin) const
+{
+  // Set lepton KE TMax for for throwing rndm in the accept/reject loop.
+  // We can accidentally set it too high, because the xsec will return zero.
+  // This way if someone reuses this code, they are not tripped up by it.
+  TMax = Enu - LepMass;
 
+  // Set Tmin for throwing rndm in the accept/reject loop
+  // the hadron tensors we expect will be limited in q3
+  // therefore also the outgoing lepton KE can't be too low or costheta too backward
+  // make the accept/reject loop more efficient by using Min values.
+  if(Enu < fQ3Max){
+    TMin = 0 ;
+    CosthMin = -1 ; 
+  } else {
+    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
+    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
+  }
+}
+//___________________________________________________________________________
+double MECGenerator::ComputeNSVMaxXSec(Interaction * interaction) const
+{
+  // Scan the (T, costheta) region sampled by SelectNSVLeptonKinematics()
+  // for the max of the cross section tested in its accept/reject loop.
+  // A coarse grid scan is followed by a few finer scans around the maximum.
+
+  double Enu     = interaction->InitState().ProbeE(kRfHitNucRest);
+  double LepMass = interaction->FSPrimLepton()->Mass();
+  int    NuPDG   = interaction->InitState().ProbePdg();
+
+  double TMin = 0, TMax = 0, CosthMin = -1;
+  this->NSVLeptonKinematicLimits(Enu, LepMass, TMin, TMax, CosthMin);
+  if(TMax <= TMin) return 0.;
+
+  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(
+        (NuPDG > 0) ? kPdgClusterNN : kPdgClusterPP);
+  interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
+  Kinematics * kinematics = interaction->KinePtr();
+
+  const int    kNLayers  = 4;
+  const int    kNT[]     = { 40, 10, 10, 10 };
+  const int    kNCosth[] = { 40, 10, 10, 10 };
+
+  double T_min     = TMin,     T_max     = TMax;
+  double Costh_min = CosthMin, Costh_max = 1.;
+  double T_at_max  = 0, Costh_at_max = 0;
+  double xsec_max  = 0;
+
+  for(int ilayer = 0; ilayer < kNLayers; ilayer++) {
+    double dT     = (T_max     - T_min    ) / (kNT[ilayer]     - 1);
+    double dCosth = (Costh_max - Costh_min) / (kNCosth[ilayer] - 1);
+    for(int iT = 0; iT < kNT[ilayer]; iT++) {
+      double T    = T_min + iT * dT;
+      double Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));
+      for(int ic = 0; ic < kNCosth[ilayer]; ic++) {
+        double Costh = Costh_min + ic * dCosth;
+        double Q3 = TMath::Sqrt(Plep*Plep + Enu*Enu - 2.0 * Plep * Enu * Costh);
+        if(Q3 >= fQ3Max) continue;
+        kinematics->SetKV(kKVTl,  T);
+        kinematics->SetKV(kKVctl, Costh);
+        double xsec = this->XSecModel()->XSec(interaction, kPSTlctl);
+        if(xsec > xsec_max) {
+          xsec_max     = xsec;
+          T_at_max     = T;
+          Costh_at_max = Costh;
+        }
+      }
+    }
+    if(xsec_max <= 0) break;
+
+    // zoom in around the current max
+    T_min     = TMath::Max(TMin,     T_at_max     - dT);
+    T_max     = TMath::Min(TMax,     T_at_max     + dT);
+    Costh_min = TMath::Max(CosthMin, Costh_at_max - dCosth);
+    Costh_max = TMath::Min(1.,       Costh_at_max + dCosth);
+  }
+
+  return fNSVMaxXSecSafetyFactor * xsec_max;
+}
+//___________________________________________________________________________
+double MECGenerator::TabulatedNSVMaxXSec(const Interaction * interaction) const
+{
+  // Returns the max xsec tabulated by CreateMaxXSecSpline(), or -1 if there
+  // is no such table for the input interaction & energy
+
+  const Spline * spl =
+     XSecSplineList::Instance()->FindSpline(this->Id(), interaction);
+  if( !spl ) return -1.;
+
+  double Enu = interaction->InitState().ProbeE(kRfHitNucRest);
+  if( Enu < spl->XMin() || Enu > spl->XMax() ) return -1.;
+
+  double xsec_max = spl->Evaluate(Enu);
+  LOG("MEC", pINFO) << "Tabulated: max xsec (E=" << Enu << ") = " << xsec_max;
+
+  return (xsec_max > 0) ? xsec_max : -1.;
+}
+//___________________________________________________________________________
+PiecewiseProposal2D * MECGenerator::NSVProposal(
+    const Interaction * interaction,
+    double TMin, double TMax, double CosthMin) const
+{
+  // Returns the proposal used for importance sampling (T, costheta) in
+  // SelectNSVLeptonKinematics(), for the energy bin containing the current
+  // neutrino energy. It is built at the first call, from scans at the
+  // current energy and at both edges of the energy bin (each with its own
+  // (T, costheta) limits), and it is kept in the cache.
+
+  Cache * cache = Cache::Instance();
+
+  // the proposals are added at event generation time: look up, build & add
+  // them with the cache locked, so that each is built once
+  CacheLock lock;
+
+  CacheBranchProposal * cb = dynamic_cast<CacheBranchProposal *> (
+       cache->FindCacheBranch(this->Id(), interaction, "proposal"));
+  if(!cb) {
+    string intkey = interaction->AsString();
+    string key = cache->CacheBranchKey(this->Id().Key(), intkey) + "/proposal";
+
+    cb = dynamic_cast<CacheBranchProposal *> (cache->FindCacheBranch(key));
+    if(!cb) {
+      LOG("MEC", pINFO) << "Creating cache branch - key = " << key;
+      cb = new CacheBranchProposal("NSV d2xsec/dTdcostheta proposal");
+      cache->AddCacheBranch(key, cb);
+    }
+    cache->IndexCacheBranch(this->Id(), interaction, cb, "proposal");
+  }
+
+  double Enu = interaction->InitState().ProbeE(kRfHitNucRest);
+  int ebin = TMath::FloorNint(fISNEBinsPerDecade * TMath::Log10(Enu));
+
+  PiecewiseProposal2D * proposal = cb->Proposal(ebin);
+  if(!proposal) {
+    double Ebin[3] = {
+      Enu,
+      TMath::Power(10., double(ebin)   / fISNEBinsPerDecade),
+      TMath::Power(10., double(ebin+1) / fISNEBinsPerDecade)
+    };
+    LOG("MEC", pNOTICE)
+      << "Building importance sampling proposal for E = [" << Ebin[1]
+      << ", " << Ebin[2] << "] for " << interaction->AsString();
+    double LepMass = interaction->FSPrimLepton()->Mass();
+    proposal = new PiecewiseProposal2D(fISNCells, fISNCells);
+    for(int i = 0; i < 3; i++) {
+      Interaction in(*interaction);
+      double Tmin = TMin, Tmax = TMax, Costhmin = CosthMin;
+      if(i > 0) {
+        // the neutrino is massless: ProbeE(kRfHitNucRest) scales with
+        // its momentum
+        TLorentzVector * p4 = in.InitState().GetProbeP4(kRfLab);
+        in.InitStatePtr()->SetProbeP4((*p4) * (Ebin[i] / Enu));
+        delete p4;
+        this->NSVLeptonKinematicLimits(
+           in.InitState().ProbeE(kRfHitNucRest), LepMass, Tmin, Tmax, Costhmin);
+        if(Tmax <= Tmin) continue;
+      }
+      NSVUnitSquareXSecFunc func(this->XSecModel(), &in, Tmin, Tmax, Costhmin, fQ3Max);
+      proposal->Build(func, fISSafetyFactor);
+    }
+    cb->AddProposal(ebin, proposal);
+  }
+  return proposal;
+}
+//___________________________________________________________________________
+void MECGenerator::CreateMaxXSecSpline(
+     const XSecAlgorithmI * xsec_alg, const Interaction * interaction,
+     int nknots, double e_min, double e_max) const
+{
+  // Tabulate the max xsec used in SelectNSVLeptonKinematics() vs energy.
+  // The empirical MEC model does not use an accept/reject method with a
+  // fixed max, so there is nothing to tabulate for it.
+
+  if(xsec_alg->Id().Name() != "genie::NievesSimoVacasMECPXSec2016") return;
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+  string key = this->Id().Key() + "/" + interaction->AsString();
+  if( xssl->SplineExists(key) ) return;
+
+  LOG("MEC", pNOTICE) << "Tabulating max xsec for: " << key;
+
+  this->SetXSecModel(xsec_alg);
+
+  Interaction in(*interaction);
+  double pr_mass = interaction->InitState().Probe()->Mass();
+  double E0 = TMath::Max(e_min, 1.001 * interaction->PhaseSpace().Threshold());
+  if(nknots < 2) nknots = 30;
+  if(E0 >= e_max) return;
+
+  double * E       = new double[nknots];
+  double * maxxsec = new double[nknots];
+  double * envelop = new double[nknots];
+
+  double dlogE = (TMath::Log10(e_max) - TMath::Log10(E0)) / (nknots-1);
+  for(int i = 0; i < nknots; i++) {
+    E[i] = (i == nknots-1) ?
+       e_max : TMath::Power(10., TMath::Log10(E0) + i * dlogE);
+    double pz = TMath::Sqrt(TMath::Max(0., E[i]*E[i] - pr_mass*pr_mass));
+    in.InitStatePtr()->SetProbeP4(TLorentzVector(0, 0, pz, E[i]));
+    Interaction in_curr(in);
+    maxxsec[i] = this->ComputeNSVMaxXSec(&in_curr);
+    LOG("MEC", pINFO) << "max xsec (E = " << E[i] << ") = " << maxxsec[i];
+  }
+
+  // let each knot envelope its neighbours too
+  for(int i = 0; i < nknots; i++) {
+    envelop[i] = maxxsec[i];
+    if(i > 0)        envelop[i] = TMath::Max(envelop[i], maxxsec[i-1]);
+    if(i < nknots-1) envelop[i] = TMath::Max(envelop[i], maxxsec[i+1]);
+  }
+
+  xssl->AdoptSpline(key, new Spline(nknots, E, envelop));
+
+  delete [] E;
+  delete [] maxxsec;
+  delete [] envelop;
+}
+//___________________________________________________________________________
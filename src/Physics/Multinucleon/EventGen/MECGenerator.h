@@ -31,6 +31,7 @@ namespace genie {
 
 class XSecAlgorithmI;
 class NuclearModelI;
+class PiecewiseProposal2D;
 
 class MECGenerator : public EventRecordVisitorI {
 
@@ -42,6 +43,11 @@ public :
   // implement the EventRecordVisitorI interface
   void ProcessEventRecord (GHepRecord * event) const;
 
+  // tabulate the max xsec used for the Nieves et al. lepton kinematics
+  void CreateMaxXSecSpline (const XSecAlgorithmI * xsec_alg,
+                            const Interaction * interaction,
+                            int nknots, double e_min, double e_max) const;
+
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
   void Configure(const Registry & config);
@@ -59,13 +65,31 @@ private:
   void    DecayNucleonCluster               (GHepRecord * event) const;
   void    SelectNSVLeptonKinematics         (GHepRecord * event) const;
   void    GenerateNSVInitialHadrons         (GHepRecord * event) const;
+  void    NSVLeptonKinematicLimits          (double Enu, double LepMass,
+                                             double & TMin, double & TMax,
+                                             double & CosthMin) const;
+  double  ComputeNSVMaxXSec                 (Interaction * interaction) const;
+  double  TabulatedNSVMaxXSec               (const Interaction * interaction) const;
+  PiecewiseProposal2D * NSVProposal         (const Interaction * interaction,
+                                             double TMin, double TMax,
+                                             double CosthMin) const;
   PDGCodeList NucleonClusterConstituents    (int pdgc)           const;
-  
-  mutable const XSecAlgorithmI * fXSecModel;
-  mutable TGenPhaseSpace         fPhaseSpaceGenerator;
+
+  // the cross section model of the event being processed and the phase space
+  // generator are kept per thread (see AlgScratchI)
+  const XSecAlgorithmI * XSecModel          (void) const;
+  void                   SetXSecModel       (const XSecAlgorithmI * xsec_model) const;
+  AlgScratchI *          NewScratch         (void) const;
+
   const NuclearModelI *          fNuclModel;
 
   double fQ3Max;
+  double fNSVMaxXSecSafetyFactor; ///< applied to the tabulated NSV max xsec
+
+  bool   fUseImportanceSampling;  ///< importance sample the NSV (T, costheta)?
+  int    fISNCells;               ///< proposal cells per dimension
+  double fISSafetyFactor;         ///< safety factor applied to the proposal bounds
+  int    fISNEBinsPerDecade;      ///< energy bins (with their own proposal) per decade
 };
 
 }      // genie namespace
@@ -93,6 +93,14 @@ double MECXSec::Integrate(
   double xsec = 0;
 
   double abstol = 1; //We mostly care about relative tolerance.
+
+  if(this->UseBatchIntegrator()) {
+    xsec = this->IntegrateBatch<utils::gsl::d2Xsec_dTCosth>(
+         model, interaction, kine_min, kine_max, abstol);
+    delete interaction;
+    return xsec;
+  }
+
   ROOT::Math::IBaseFunctionMultiDim * func = 
         new utils::gsl::d2Xsec_dTCosth(model, interaction);
   ROOT::Math::IntegrationMultiDim::Type ig_type = 
@@ -132,6 +140,8 @@ void MECXSec::LoadConfig(void)
   fGSLMaxEval    = (unsigned int) max ;
 
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol, 0.01 ) ;
+  GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0 ) ;
+  GetParamDef( "batch-warm-start", fBatchWarmStart, true ) ;
   GetParamDef( "split-integral", fSplitIntegral, true ) ;
 
 }
@@ -184,5 +194,23 @@ ROOT::Math::IBaseFunctionMultiDim *
     new genie::utils::gsl::d2Xsec_dTCosth(fModel,fInteraction);
 }
 //____________________________________________________________________________
+unsigned int genie::utils::gsl::d2Xsec_dTCosth::BatchKine(
+     const double * xin, KineVar_t * kv, double * kine) const
+{
+  kv[0] = kKVTl;  kine[0] = xin[0];
+  kv[1] = kKVctl; kine[1] = xin[1];
+  return 2;
+}
+//____________________________________________________________________________
+KinePhaseSpace_t genie::utils::gsl::d2Xsec_dTCosth::BatchPhaseSpace(void) const
+{
+  return kPSTlctl;
+}
+//____________________________________________________________________________
+double genie::utils::gsl::d2Xsec_dTCosth::BatchScale(void) const
+{
+  return 1.;
+}
+//____________________________________________________________________________
 
 
@@ -21,6 +21,8 @@
 #ifndef _MEC_XSEC_H_
 #define _MEC_XSEC_H_
 
+#include "Framework/Conventions/KineVar.h"
+#include "Framework/Conventions/KinePhaseSpace.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 
 #include <Math/Integrator.h>
@@ -72,6 +74,10 @@ private:
       unsigned int                        NDim   (void)               const;
       double                              DoEval (const double * xin) const;
       ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+      // batch evaluation, see XSecBatchFunc
+      unsigned int                        BatchKine       (const double * xin, KineVar_t * kv, double * kine) const;
+      KinePhaseSpace_t                    BatchPhaseSpace (void) const;
+      double                              BatchScale      (void) const;
     private:
       const XSecAlgorithmI * fModel;
       const Interaction *    fInteraction;
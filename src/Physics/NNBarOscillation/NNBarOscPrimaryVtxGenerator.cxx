@@ -10,6 +10,9 @@
  For documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Select the oscillating neutron radius by inverting the tabulated radial
+   distribution rather than with rejection sampling.
 
 */
 //____________________________________________________________________________
@@ -146,52 +149,20 @@ void NNBarOscPrimaryVtxGenerator::GenerateOscillatingNeutronPosition(
   LOG("NNBarOsc", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
-  double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
-  
-  // select a vertex using the rejection method 
+  // select the radius by inverting the (tabulated) cumulative
+  // distribution of r^2*density over [0,3R]
+  double r = utils::nuclear::InverseRadialCDF(A, 3*R, rnd->RndFsi().Rndm());
+
   TLorentzVector vtx(0,0,0,0);
-  unsigned int iter = 0;
-  while(1) {
-    iter++;
-
-    // throw an exception if it hasn't find a solution after many attempts
-    if(iter > controls::kRjMaxIterations) {
-       LOG("NNBarOsc", pWARN)
-           << "Couldn't generate a vertex position after " << iter << " iterations";
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't generate vertex");
-       exception.SwitchOnFastForward();
-       throw exception;
-    }
-           
-    double r = rmax * rnd->RndFsi().Rndm();
-    double t = ymax * rnd->RndFsi().Rndm();
-    double y = r*r * utils::nuclear::Density(r,A);
-    if(y > ymax) {   
-       LOG("NNBarOsc", pERROR)
-          << "y = " << y << " > ymax = " << ymax << " for r = " << r << ", A = " << A;
-    }
-    bool accept = (t < y);
-    if(accept) {
-       double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
-       double cosphi   = TMath::Cos(phi);
-       double sinphi   = TMath::Sin(phi);
-       double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-       double sintheta = TMath::Sqrt(1-costheta*costheta);
-       vtx.SetX(r*sintheta*cosphi);
-       vtx.SetY(r*sintheta*sinphi);
-       vtx.SetZ(r*costheta);
-       vtx.SetT(0.);
-       break;
-    }
-  } // while 1
+  double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
+  double cosphi   = TMath::Cos(phi);
+  double sinphi   = TMath::Sin(phi);
+  double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+  double sintheta = TMath::Sqrt(1-costheta*costheta);
+  vtx.SetX(r*sintheta*cosphi);
+  vtx.SetY(r*sintheta*sinphi);
+  vtx.SetZ(r*costheta);
+  vtx.SetT(0.);
 
   // giving position to oscillating neutron
   GHepParticle * oscillating_neutron = event->Particle(1);
@@ -67,7 +67,7 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- For the subsequent kinematic selection with the rejection method:
   //   Calculate the max differential cross section or retrieve it from the
@@ -109,7 +109,7 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      LOG("NuEKinematics", pINFO) << "Trying: y = " << y;
 
      //-- computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSyfE);
+     xsec = this->XSecModel()->XSec(interaction, kPSyfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -181,7 +181,7 @@ double NuEKinematicsGenerator::ComputeMaxXSec(
   for(int i=0; i<N; i++) {
     double y = ymin + i * dy;
     interaction->KinePtr()->Sety(y);
-    double xsec = fXSecModel->XSec(interaction, kPSyfE);
+    double xsec = this->XSecModel()->XSec(interaction, kPSyfE);
 
     SLOG("NuEKinematics", pDEBUG) << "xsec(y = " << y << ") = " << xsec;
     max_xsec = TMath::Max(xsec, max_xsec);
@@ -198,7 +198,7 @@ double NuEKinematicsGenerator::ComputeMaxXSec(
 	 y = y-dy;
          if(y<ymin) break;
          interaction->KinePtr()->Sety(y);
-         xsec = fXSecModel->XSec(interaction, kPSyfE);
+         xsec = this->XSecModel()->XSec(interaction, kPSyfE);
          SLOG("NuEKinematics", pDEBUG) << "xsec(y = " << y << ") = " << xsec;
          max_xsec = TMath::Max(xsec, max_xsec);
        }
@@ -213,7 +213,7 @@ double NuEKinematicsGenerator::ComputeMaxXSec(
 
   SLOG("NuEKinematics", pDEBUG) << interaction->AsString();
   SLOG("NuEKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("NuEKinematics", pDEBUG) << "Computed using alg = " << *fXSecModel;
+  SLOG("NuEKinematics", pDEBUG) << "Computed using alg = " << *this->XSecModel();
 
   return max_xsec;
 }
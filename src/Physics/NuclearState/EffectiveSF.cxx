@@ -13,6 +13,7 @@
 
 #include <sstream>
 #include <cstdlib>
+#include <mutex>
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -22,6 +23,7 @@
 #include "Physics/NuclearState/EffectiveSF.h"
 #include "Physics/NuclearState/FermiMomentumTablePool.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
+#include "Physics/NuclearState/NucleonMomentumCDF.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -34,6 +36,11 @@ using namespace genie::constants;
 using namespace genie::utils;
 using namespace genie::utils::config;
 
+namespace {
+  // guards the lazily filled momentum distribution maps
+  std::mutex gProbDistroMutex;
+}
+
 //____________________________________________________________________________
 EffectiveSF::EffectiveSF() :
 NuclearModelI("genie::EffectiveSF")
@@ -51,13 +58,9 @@ NuclearModelI("genie::EffectiveSF", config)
 //____________________________________________________________________________
 EffectiveSF::~EffectiveSF()
 {
-  map<string, TH1D*>::iterator iter = fProbDistroMap.begin();
-  for( ; iter != fProbDistroMap.begin(); ++iter) {
-    TH1D * hst = iter->second;
-    if(hst) {
-      delete hst;
-      hst=0;
-    }
+  map<int, const NucleonMomentumCDF*>::iterator iter = fProbDistroMap.begin();
+  for( ; iter != fProbDistroMap.end(); ++iter) {
+    delete iter->second;
   }
   fProbDistroMap.clear();
 }
@@ -66,60 +69,63 @@ EffectiveSF::~EffectiveSF()
 //____________________________________________________________________________
 bool EffectiveSF::GenerateNucleon(const Target & target) const
 {
-  assert(target.HitNucIsSet());
-  fCurrRemovalEnergy = 0;
-  fCurrMomentum.SetXYZ(0,0,0);
+  RandomGen * rnd = RandomGen::Instance();
 
-  //-- set fermi momentum vector
-  //
+  double u[kNDimUnitCube];
+  for(unsigned int i = 0; i < kNDimUnitCube; i++) u[i] = rnd->RndGen().Rndm();
+
+  return this->GenerateNucleonFromUnitCube(target, 0., u);
+}
+//____________________________________________________________________________
+bool EffectiveSF::GenerateNucleonFromUnitCube(const Target & target,
+                          double hitNucleonRadius, const double * u) const
+{
+  return this->SampleCurrentNucleon(target, hitNucleonRadius, u);
+}
+//____________________________________________________________________________
+bool EffectiveSF::SampleNucleon(const Target & target,
+                          double /*hitNucleonRadius*/, const double * u,
+                          double * p3, double & removalEnergy,
+                          FermiMoverInteractionType_t & type) const
+{
+  assert(target.HitNucIsSet());
+  p3[0] = p3[1] = p3[2] = 0.;
 
   if ( target.A() > 1 ) {
-    TH1D * prob = this->ProbDistro(target);
+    const NucleonMomentumCDF * prob = this->ProbDistro(target);
     if(!prob) {
       LOG("EffectiveSF", pNOTICE)
               << "Null nucleon momentum probability distribution";
       exit(1);
     }
-
-    double p = prob->GetRandom();
+    double p = prob->InverseCDF(u[0]);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("EffectiveSF", pDEBUG) << "|p,nucleon| = " << p;
 #endif
 
-    RandomGen * rnd = RandomGen::Instance();
-
-    double costheta = -1. + 2. * rnd->RndGen().Rndm();
-    double sintheta = TMath::Sqrt(1.-costheta*costheta);
-    double fi       = 2 * kPi * rnd->RndGen().Rndm();
-    double cosfi    = TMath::Cos(fi);
-    double sinfi    = TMath::Sin(fi);
-
-    double px = p*sintheta*cosfi;
-    double py = p*sintheta*sinfi;
-    double pz = p*costheta;
-
-    fCurrMomentum.SetXYZ(px, py, pz);
-
+    MomentumFromUnitCube(p, u[1], u[2], p3);
   }
 
-  //-- set removal energy
-  //
+  removalEnergy = this->ReturnBindingEnergy(target);
+  type          = this->SelectInteractionType(target, u[3]);
 
-  fCurrRemovalEnergy = this->ReturnBindingEnergy(target);
+  return true;
+}
+//____________________________________________________________________________
+FermiMoverInteractionType_t EffectiveSF::SelectInteractionType(
+                                   const Target & target, double u) const
+{
   double f1p1h = this->Returnf1p1h(target);
   // Since TE increases the QE peak via a 2p2h process, we decrease f1p1h
   // in order to increase the 2p2h interaction to account for this enhancement.
   f1p1h /= this->GetTransEnh1p1hMod(target);
-  if ( RandomGen::Instance() -> RndGen().Rndm() < f1p1h) {
-    fFermiMoverInteractionType = kFermiMoveEffectiveSF1p1h;
+  if ( u < f1p1h) {
+    return kFermiMoveEffectiveSF1p1h;
   } else if (fEjectSecondNucleon2p2h) {
-    fFermiMoverInteractionType = kFermiMoveEffectiveSF2p2h_eject;
-  } else {
-    fFermiMoverInteractionType = kFermiMoveEffectiveSF2p2h_noeject;
+    return kFermiMoveEffectiveSF2p2h_eject;
   }
-
-  return true;
+  return kFermiMoveEffectiveSF2p2h_noeject;
 }
 //____________________________________________________________________________
 // Returns the probability of the bin with given momentum. I don't know what w
@@ -129,23 +135,41 @@ bool EffectiveSF::GenerateNucleon(const Target & target) const
 double EffectiveSF::Prob(double mom, double w, const Target & target) const
 {
   if(w < 0) {
-     TH1D * prob_distr = this->ProbDistro(target);
-     int bin = prob_distr->FindBin(mom);
-     double y  = prob_distr->GetBinContent(bin);
-     double dx = prob_distr->GetBinWidth(bin);
-     double prob  = y * dx;
-     return prob;
+     const NucleonMomentumCDF * prob_distr = this->ProbDistro(target);
+     if(!prob_distr) return 0;
+     return prob_distr->BinProb(mom);
   }
   return 1;
 }
 //____________________________________________________________________________
+void EffectiveSF::BatchProb(unsigned int n, const double * mom,
+                            const Target & target, double * prob) const
+{
+  const NucleonMomentumCDF * prob_distr = this->ProbDistro(target);
+  if(!prob_distr) {
+     for(unsigned int i = 0; i < n; i++) prob[i] = 0;
+     return;
+  }
+  prob_distr->BinProb(n, mom, prob);
+}
+//____________________________________________________________________________
 // Check the map of nucleons to see if we have a probability distribution to
 // compute with.  If not, make one.
 //____________________________________________________________________________
-TH1D * EffectiveSF::ProbDistro(const Target & target) const
+const NucleonMomentumCDF * EffectiveSF::ProbDistro(const Target & target) const
 {
+  //-- get information for the nuclear target
+  int nucleon_pdgc = target.HitNucPdg();
+  assert( pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc) );
+
+  // The distribution only depends on the nucleus
+  int pdgc = pdg::IonPdgCode(target.A(), target.Z());
+
+  std::lock_guard<std::mutex> lock(gProbDistroMutex);
+
   //-- return stored /if already computed/
-  map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
+  map<int, const NucleonMomentumCDF*>::const_iterator it =
+                                                fProbDistroMap.find(pdgc);
   if(it != fProbDistroMap.end()) return it->second;
 
   LOG("EffectiveSF", pNOTICE)
@@ -153,11 +177,10 @@ TH1D * EffectiveSF::ProbDistro(const Target & target) const
   LOG("EffectiveSF", pNOTICE)
                << "P(cut-off) = " << fPCutOff << ", P(max) = " << fPMax;
 
-  //-- get information for the nuclear target
-  int nucleon_pdgc = target.HitNucPdg();
-  assert( pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc) );
-  return this->MakeEffectiveSF(target);
-
+  // stored even if NULL, so that missing parameters are looked up only once
+  const NucleonMomentumCDF * prob = this->MakeEffectiveSF(target);
+  fProbDistroMap[pdgc] = prob;
+  return prob;
 }
 //____________________________________________________________________________
 // If transverse enhancement form factor modification is enabled, we must
@@ -178,7 +201,7 @@ double EffectiveSF::GetTransEnh1p1hMod(const Target& target) const {
 // Makes a momentum distribtuion for the given target using parameters
 // from the config file.
 //____________________________________________________________________________
-TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
+NucleonMomentumCDF * EffectiveSF::MakeEffectiveSF(const Target & target) const
 {
   // First check for individually specified nuclei
   int pdgc  = pdg::IonPdgCode(target.A(), target.Z());
@@ -186,7 +209,7 @@ TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
   if(it != fProbDistParams.end()) {
     vector<double> v = it->second;
     return this->MakeEffectiveSF(v[0], v[1], v[2], v[3],
-                                 v[4], v[5], v[6], target);
+                                 v[4], v[5], v[6]);
   }
 
   // Then check in the ranges of A
@@ -195,52 +218,45 @@ TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
     if (target.A() >= range_it->first.first && target.A() <= range_it->first.second) {
       vector<double> v = range_it->second;
       return this->MakeEffectiveSF(v[0], v[1], v[2], v[3],
-                                   v[4], v[5], v[6], target);
+                                   v[4], v[5], v[6]);
     }
   }
 
   return NULL;
 }
 //____________________________________________________________________________
-// Makes a momentum distribution using the factors below (see reference) and
-// inserts it into the nucleus/momentum distribution map.
+// Makes a momentum distribution using the factors below (see reference).
+// The density is evaluated at the centre of each momentum bin.
 //____________________________________________________________________________
-TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
-                                    double beta, double c1, double c2,
-                                    double c3, const Target & target) const
+NucleonMomentumCDF * EffectiveSF::MakeEffectiveSF(double bs, double bp,
+                                    double alpha, double beta,
+                                    double c1, double c2, double c3) const
 {
   //-- create the probability distribution
   int npbins = (int) (1000 * fPMax);
 
-  TH1D * prob = new TH1D("", "", npbins, 0, fPMax);
-  prob->SetDirectory(0);
+  vector<double> density(npbins, 0.);
 
-  double dp = fPMax / (npbins-1);
+  double dp = fPMax / npbins;
   for(int i = 0; i < npbins; i++) {
-    double p  = i * dp;
+    double p  = (i + 0.5) * dp;
+    if(p > fPCutOff) break;
     double y = p / 0.197;
     double as = c1 * exp(-pow(bs*y,2));
     double ap = c2 * pow(bp * y, 2) * exp(-pow(bp * y, 2));
     double at = c3 * pow(y, beta) * exp(-alpha * (y - 2));
     double rr = (3.14159265 / 4) * (as + ap + at) * pow(y, 2) / 0.197;
     double dP_dp = rr / 1.01691371;
-    if(p>fPCutOff)
-      dP_dp = 0;
     assert(dP_dp >= 0);
     // calculate probability density : dProbability/dp
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("EffectiveSF", pDEBUG) << "p = " << p << ", dP/dp = " << dP_dp;
 #endif
-    prob->Fill(p, dP_dp);
- }
-
-  //-- normalize the probability distribution
-  prob->Scale( 1.0 / prob->Integral("width") );
+    density[i] = dP_dp;
+  }
 
-  //-- store
-  fProbDistroMap.insert(
-      map<string, TH1D*>::value_type(target.AsString(),prob));
-  return prob;
+  //-- normalized on construction
+  return new NucleonMomentumCDF(density, fPMax);
 }
 //____________________________________________________________________________
 // Returns the binding energy for a given nucleus.
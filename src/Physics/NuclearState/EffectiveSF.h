@@ -23,14 +23,14 @@
 
 #include <map>
 
-#include <TH1D.h>
-
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
 
 namespace genie {
 
+class NucleonMomentumCDF;
+
 class EffectiveSF : public NuclearModelI {
 
 public:
@@ -48,6 +48,15 @@ public:
   {
     return kNucmEffSpectralFunc;
   }
+  bool           GenerateNucleonFromUnitCube (const Target & t,
+                            double hitNucleonRadius, const double * u) const;
+  bool           SampleNucleon   (const Target & t, double hitNucleonRadius,
+                            const double * u, double * p3, double & removalEnergy,
+                            FermiMoverInteractionType_t & type) const;
+
+  //-- Prob(mom[i], -1, t) for n nucleon momenta, stored in prob[i]
+  void           BatchProb       (unsigned int n, const double * mom,
+                                  const Target & t, double * prob) const;
 
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
@@ -55,21 +64,24 @@ public:
   void Configure (string param_set);
 
 private:
-  TH1D * ProbDistro (const Target & t) const;
+  const NucleonMomentumCDF * ProbDistro (const Target & t) const;
 
-  TH1D * MakeEffectiveSF(const Target & target) const;
+  NucleonMomentumCDF * MakeEffectiveSF(const Target & target) const;
 
-  TH1D * MakeEffectiveSF(double bs, double bp, double alpha, double beta,
-                         double c1, double c2, double c3,
-                         const Target & target) const;
+  NucleonMomentumCDF * MakeEffectiveSF(double bs, double bp,
+                         double alpha, double beta,
+                         double c1, double c2, double c3) const;
 
   double ReturnBindingEnergy(const Target & target) const;
   double GetTransEnh1p1hMod(const Target& target) const;
 
   double Returnf1p1h(const Target & target) const;
+  FermiMoverInteractionType_t SelectInteractionType(const Target & target,
+                                                    double u) const;
   void   LoadConfig (void);
 
-  mutable map<string, TH1D *> fProbDistroMap;
+  // Momentum distributions, built on first use and keyed by ion PDG code
+  mutable map<int, const NucleonMomentumCDF *> fProbDistroMap;
   double fPMax;
   double fPCutOff;
   bool   fEjectSecondNucleon2p2h;
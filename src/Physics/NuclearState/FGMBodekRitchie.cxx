@@ -15,11 +15,17 @@
    it from being automatically written out at the event file.
  @ Jun 18, 2008 - CA
    Deallocate the momentum distribution histograms map at dtor
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Store the momentum distributions as NucleonMomentumCDF tables, built under
+   a lock, and implement the stateless SampleNucleon()
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <cstdlib>
+#include <mutex>
+#include <vector>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -29,16 +35,23 @@
 #include "Physics/NuclearState/FGMBodekRitchie.h"
 #include "Physics/NuclearState/FermiMomentumTablePool.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
+#include "Physics/NuclearState/NucleonMomentumCDF.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using std::ostringstream;
+using std::vector;
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::utils;
 
+namespace {
+  // guards the lazily filled momentum distribution maps
+  std::mutex gProbDistroMutex;
+}
+
 //____________________________________________________________________________
 FGMBodekRitchie::FGMBodekRitchie() :
 NuclearModelI("genie::FGMBodekRitchie")
@@ -54,84 +67,102 @@ NuclearModelI("genie::FGMBodekRitchie", config)
 //____________________________________________________________________________
 FGMBodekRitchie::~FGMBodekRitchie()
 {
-  map<string, TH1D*>::iterator iter = fProbDistroMap.begin();
+  map<pair<int,int>, const NucleonMomentumCDF*>::iterator iter =
+                                                     fProbDistroMap.begin();
   for( ; iter != fProbDistroMap.end(); ++iter) {
-    TH1D * hst = iter->second;
-    if(hst) {
-      delete hst;
-      hst=0;
-    }
+    delete iter->second;
   }
   fProbDistroMap.clear();
 }
 //____________________________________________________________________________
 bool FGMBodekRitchie::GenerateNucleon(const Target & target) const
 {
-  assert(target.HitNucIsSet());
+  RandomGen * rnd = RandomGen::Instance();
+
+  double u[kNDimUnitCube];
+  for(unsigned int i = 0; i < kNDimUnitCube; i++) u[i] = rnd->RndGen().Rndm();
 
-  fCurrRemovalEnergy = 0;
-  fCurrMomentum.SetXYZ(0,0,0);
+  return this->GenerateNucleonFromUnitCube(target, 0., u);
+}
+//____________________________________________________________________________
+bool FGMBodekRitchie::GenerateNucleonFromUnitCube(const Target & target,
+                          double hitNucleonRadius, const double * u) const
+{
+  return this->SampleCurrentNucleon(target, hitNucleonRadius, u);
+}
+//____________________________________________________________________________
+bool FGMBodekRitchie::SampleNucleon(const Target & target,
+                          double /*hitNucleonRadius*/, const double * u,
+                          double * p3, double & removalEnergy,
+                          FermiMoverInteractionType_t & type) const
+{
+  assert(target.HitNucIsSet());
 
-  //-- set fermi momentum vector
+  //-- fermi momentum vector
   //
-  TH1D * prob = this->ProbDistro(target);
+  const NucleonMomentumCDF * prob = this->ProbDistro(target);
   if ( ! prob ) {
     LOG("BodekRitchie", pNOTICE)
               << "Null nucleon momentum probability distribution";
     exit(1);
   }
-  double p = prob->GetRandom();
-  LOG("BodekRitchie", pINFO) << "|p,nucleon| = " << p;
+  double p = prob->InverseCDF(u[0]);
 
-  RandomGen * rnd = RandomGen::Instance();
-
-  double costheta = -1. + 2. * rnd->RndGen().Rndm();
-  double sintheta = TMath::Sqrt(1.-costheta*costheta);
-  double fi       = 2 * kPi * rnd->RndGen().Rndm();
-  double cosfi    = TMath::Cos(fi);
-  double sinfi    = TMath::Sin(fi);
-
-  double px = p*sintheta*cosfi;
-  double py = p*sintheta*sinfi;
-  double pz = p*costheta;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("BodekRitchie", pDEBUG) << "|p,nucleon| = " << p;
+#endif
 
-  fCurrMomentum.SetXYZ(px,py,pz);
+  MomentumFromUnitCube(p, u[1], u[2], p3);
 
-  //-- set removal energy
+  //-- removal energy
   //
+  removalEnergy = this->SelectRemovalEnergy(target);
+  type          = kFermiMoveDefault;
+
+  return true;
+}
+//____________________________________________________________________________
+double FGMBodekRitchie::SelectRemovalEnergy(const Target & target) const
+{
   if ( target.A() < 6 || ! fUseParametrization )
   {
      int Z = target.Z();
      map<int,double>::const_iterator it = fNucRmvE.find(Z);
-     if(it != fNucRmvE.end()) fCurrRemovalEnergy = it->second;
-     else fCurrRemovalEnergy = nuclear::BindEnergyPerNucleon(target);
-  }
-  else {
-     fCurrRemovalEnergy = nuclear::BindEnergyPerNucleonParametrization(target);
+     if(it != fNucRmvE.end()) return it->second;
+     else return nuclear::BindEnergyPerNucleon(target);
   }
-
-  return true;
+  return nuclear::BindEnergyPerNucleonParametrization(target);
 }
 //____________________________________________________________________________
 double FGMBodekRitchie::Prob(double mom, double w, const Target & target) const
 {
   if(w<0) {
-     TH1D * prob_distr = this->ProbDistro(target);
-     int bin = prob_distr->FindBin(mom);
-     double y  = prob_distr->GetBinContent(bin);
-     double dx = prob_distr->GetBinWidth(bin);
-     double prob = y*dx;
-     return prob;
+     const NucleonMomentumCDF * prob_distr = this->ProbDistro(target);
+     return prob_distr->BinProb(mom);
   }
   return 1;
 }
 //____________________________________________________________________________
-TH1D * FGMBodekRitchie::ProbDistro(const Target & target) const
+const NucleonMomentumCDF * FGMBodekRitchie::ProbDistro(
+                                               const Target & target) const
 {
+  pair<int,int> key(target.Pdg(), target.HitNucPdg());
+
+  std::lock_guard<std::mutex> lock(gProbDistroMutex);
+
   //-- return stored /if already computed/
-  map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
+  map<pair<int,int>, const NucleonMomentumCDF*>::const_iterator it =
+                                                     fProbDistroMap.find(key);
   if(it != fProbDistroMap.end()) return it->second;
 
+  const NucleonMomentumCDF * prob = this->MakeProbDistro(target);
+  fProbDistroMap[key] = prob;
+  return prob;
+}
+//____________________________________________________________________________
+NucleonMomentumCDF * FGMBodekRitchie::MakeProbDistro(
+                                               const Target & target) const
+{
   LOG("BodekRitchie", pNOTICE)
              << "Computing P = f(p_nucleon) for: " << target.AsString();
   LOG("BodekRitchie", pNOTICE)
@@ -179,18 +210,17 @@ TH1D * FGMBodekRitchie::ProbDistro(const Target & target) const
   LOG("BodekRitchie", pDEBUG) << "R  = " << R;
 #endif
 
-  //-- create the probability distribution
+  //-- create the probability distribution, evaluated at the bin centres
 
   int npbins = (int) (1000*fPMax);
-  TH1D * prob = new TH1D("", "", npbins, 0, fPMax);
-  prob->SetDirectory(0);
+  vector<double> density(npbins, 0.);
 
-  double dp = fPMax / (npbins-1);
+  double dp = fPMax / npbins;
   double iC = (C>0) ? 1./C : 0.;
   double kfa_pi_2 = TMath::Power(KF*a/kPi,2);
 
   for(int i = 0; i < npbins; i++) {
-     double p  = i * dp;
+     double p  = (i + 0.5) * dp;
      double p2 = TMath::Power(p,2);
 
      // calculate |phi(p)|^2
@@ -205,17 +235,11 @@ TH1D * FGMBodekRitchie::ProbDistro(const Target & target) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("BodekRitchie", pDEBUG) << "p = " << p << ", dP/dp = " << dP_dp;
 #endif
-     prob->Fill(p, dP_dp);
+     density[i] = dP_dp;
   }
 
-  //-- normalize the probability distribution
-  prob->Scale( 1.0 / prob->Integral("width") );
-
-  //-- store
-  fProbDistroMap.insert(
-      map<string, TH1D*>::value_type(target.AsString(),prob));
-
-  return prob;
+  //-- normalized on construction
+  return new NucleonMomentumCDF(density, fPMax);
 }
 //____________________________________________________________________________
 void FGMBodekRitchie::Configure(const Registry & config)
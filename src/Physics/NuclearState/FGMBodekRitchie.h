@@ -23,15 +23,17 @@
 #define _FGM_BODEK_RITCHIE_H_
 
 #include <map>
-
-#include <TH1D.h>
+#include <utility>
 
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
+using std::pair;
 
 namespace genie {
 
+class NucleonMomentumCDF;
+
 class FGMBodekRitchie : public NuclearModelI {
 
 public:
@@ -49,6 +51,11 @@ public:
   { 
     return kNucmFermiGas; 
   }
+  bool           GenerateNucleonFromUnitCube (const Target & t,
+                            double hitNucleonRadius, const double * u) const;
+  bool           SampleNucleon   (const Target & t, double hitNucleonRadius,
+                            const double * u, double * p3, double & removalEnergy,
+                            FermiMoverInteractionType_t & type) const;
 
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
@@ -57,9 +64,13 @@ public:
 
 private:
   void   LoadConfig (void);
-  TH1D * ProbDistro (const Target & t) const;
+  const NucleonMomentumCDF * ProbDistro (const Target & t) const;
+  NucleonMomentumCDF *       MakeProbDistro (const Target & t) const;
+  double SelectRemovalEnergy (const Target & t) const;
 
-  mutable map<string, TH1D *> fProbDistroMap;
+  // Momentum distributions, built on first use and keyed by the
+  // (ion, hit nucleon) PDG codes
+  mutable map<pair<int,int>, const NucleonMomentumCDF *> fProbDistroMap;
 
   map<int, double> fNucRmvE;
 
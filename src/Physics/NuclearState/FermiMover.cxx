@@ -24,6 +24,8 @@
    gas model can access the radius.
    Added a check to see if a local Fermi gas model is being used. If so,
    use a local Fermi gas model when deciding whether to eject a recoil nucleon.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Generate the hit nucleon with the stateless NuclearModelI::GenerateNucleons()
 */
 //____________________________________________________________________________
 
@@ -116,12 +118,16 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
   assert(nucleus);
 
   // generate a Fermi momentum & removal energy
-  // call GenerateNucleon with a radius in case the model is LocalFGM
+  // pass the radius in case the model is LocalFGM. The nucleon is returned
+  // rather than stored in the (shared) nuclear model
   double rad = nucleon->X4()->Vect().Mag();
-  fNuclModel->GenerateNucleon(*tgt,rad);
+  double pF[3] = { 0., 0., 0. };
+  double w     = 0.;
+  FermiMoverInteractionType_t interaction_type = kFermiMoveDefault;
+  fNuclModel->GenerateNucleons(*tgt, 1, RandomGen::Instance()->RndGen(),
+                               &rad, pF, &w, &interaction_type);
 
-  TVector3 p3 = fNuclModel->Momentum3();
-  double w    = fNuclModel->RemovalEnergy();
+  TVector3 p3(pF[0], pF[1], pF[2]);
 
   LOG("FermiMover", pINFO)
      << "Generated nucleon momentum: ("
@@ -141,8 +147,6 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
   double EN=0;
   // Set this to either a proton or neutron to eject a secondary particle
   int eject_nucleon_pdg = 0;
-  FermiMoverInteractionType_t interaction_type =
-      fNuclModel->GetFermiMoverInteractionType();
   if (interaction_type == kFermiMoveEffectiveSF1p1h) {
     EN = nucleon->Mass() - w -
            pF2 / (2 * (nucleus->Mass() - nucleon->Mass()));
@@ -209,7 +213,7 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
 	double radius = nucleon->X4()->Vect().Mag();
 	double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
 	kF= TMath::Power(3*kPi2*numNuc*
-		  genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
+		  genie::utils::nuclear::DensityTabulated(radius,A),1.0/3.0) *hbarc;
       }else{
 	FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
 	const FermiMomentumTable * kft  = kftp->GetTable("Default");
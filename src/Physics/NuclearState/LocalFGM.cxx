@@ -13,6 +13,9 @@
 
 #include <sstream>
 #include <cstdlib>
+#include <mutex>
+#include <vector>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -27,10 +30,75 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using std::ostringstream;
+using std::vector;
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  const unsigned int kKFTableNBins = 1000;
+
+  // Local Fermi momentum of numNuc nucleons of one type in nucleus A at r
+  double FermiMomentum(int A, int numNuc, double r)
+  {
+    double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
+    return TMath::Power(3*kPi2*numNuc*nuclear::Density(r,A), 1.0/3.0) * hbarc;
+  }
+
+  // kF at r = i*dr, for r up to 4 nuclear radii (past the vertex generator's
+  // 3 radii), beyond which it is computed directly
+  struct KFTable {
+    double         dr;
+    vector<double> kf;
+  };
+
+  // Tables shared by all instances, keyed by A & number of nucleons of the
+  // hit nucleon type, and kept for the whole job
+  map<int, KFTable *> gKFTables;
+  std::mutex          gKFTablesMutex;
+
+  // The tables last used by each thread for hit protons [0] & neutrons [1],
+  // read without the lock (tables are never modified or deleted once built)
+  thread_local int             gThreadKFTableKey[2] = { -1, -1 };
+  thread_local const KFTable * gThreadKFTable   [2] = {  0,  0 };
+
+  const KFTable & GetKFTable(int A, int numNuc, int type)
+  {
+    int key = 1000*A + numNuc;
+    if(key == gThreadKFTableKey[type]) return *gThreadKFTable[type];
+
+    std::lock_guard<std::mutex> lock(gKFTablesMutex);
+
+    map<int, KFTable *>::const_iterator it = gKFTables.find(key);
+    if(it != gKFTables.end()) {
+      gThreadKFTableKey[type] = key;
+      gThreadKFTable   [type] = it->second;
+      return *(it->second);
+    }
+
+    KFTable * table = new KFTable;
+    // FermiMomentum() takes the radius in fm
+    table->dr = 4 * nuclear::Radius(A, kNucRo/units::fm) / kKFTableNBins;
+    table->kf.resize(kKFTableNBins+1);
+    for(unsigned int i = 0; i <= kKFTableNBins; i++) {
+      table->kf[i] = FermiMomentum(A, numNuc, i * table->dr);
+    }
+    gKFTables[key] = table;
+    gThreadKFTableKey[type] = key;
+    gThreadKFTable   [type] = table;
+
+    LOG("LocalFGM", pNOTICE)
+      << "Tabulated the local Fermi momentum for A = " << A
+      << ", " << numNuc << " nucleons of the hit type, up to r = "
+      << kKFTableNBins * table->dr << " fm";
+
+    return *table;
+  }
+
+}
+
 //____________________________________________________________________________
 LocalFGM::LocalFGM() :
 NuclearModelI("genie::LocalFGM")
@@ -52,43 +120,42 @@ LocalFGM::~LocalFGM()
 bool LocalFGM::GenerateNucleon(const Target & target,
 				      double hitNucleonRadius) const
 {
-  assert(target.HitNucIsSet());
+  RandomGen * rnd = RandomGen::Instance();
 
-  fCurrRemovalEnergy = 0;
-  fCurrMomentum.SetXYZ(0,0,0);
+  double u[3];
+  for(int i = 0; i < 3; i++) u[i] = rnd->RndGen().Rndm();
 
-  //-- set fermi momentum vector
-  //
-  TH1D * prob = this->ProbDistro(target,hitNucleonRadius);
-  if(!prob) {
-    LOG("LocalFGM", pNOTICE)
-              << "Null nucleon momentum probability distribution";
-    exit(1);
-  }
-  double p = prob->GetRandom();
-  delete prob;
-  LOG("LocalFGM", pINFO) << "|p,nucleon| = " << p;
-
-  RandomGen * rnd = RandomGen::Instance();
+  return this->GenerateNucleonFromUnitCube(target, hitNucleonRadius, u);
+}
+//____________________________________________________________________________
+bool LocalFGM::GenerateNucleonFromUnitCube(const Target & target,
+                      double hitNucleonRadius, const double * u) const
+{
+  return this->SampleCurrentNucleon(target, hitNucleonRadius, u);
+}
+//____________________________________________________________________________
+bool LocalFGM::SampleNucleon(const Target & target, double hitNucleonRadius,
+                      const double * u, double * p3, double & removalEnergy,
+                      FermiMoverInteractionType_t & type) const
+{
+  assert(target.HitNucIsSet());
 
-  double costheta = -1. + 2. * rnd->RndGen().Rndm();
-  double sintheta = TMath::Sqrt(1.-costheta*costheta);
-  double fi       = 2 * kPi * rnd->RndGen().Rndm();
-  double cosfi    = TMath::Cos(fi);
-  double sinfi    = TMath::Sin(fi);
+  //-- fermi momentum vector: dP/dp ~ p^2 up to min(kF,pmax), so that
+  //   the inverse CDF is p = min(kF,pmax) * u^(1/3)
+  //
+  double KF = TMath::Min(this->LocalFermiMomentum(target,hitNucleonRadius), fPMax);
+  double p  = KF * TMath::Power(u[0], 1./3.);
 
-  double px = p*sintheta*cosfi;
-  double py = p*sintheta*sinfi;
-  double pz = p*costheta;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("LocalFGM", pDEBUG) << "|p,nucleon| = " << p;
+#endif
 
-  fCurrMomentum.SetXYZ(px,py,pz);
+  MomentumFromUnitCube(p, u[1], u[2], p3);
 
-  //-- set removal energy
+  //-- removal energy
   //
-  int Z = target.Z();
-  map<int,double>::const_iterator it = fNucRmvE.find(Z);
-  if(it != fNucRmvE.end()) fCurrRemovalEnergy = it->second;
-  else fCurrRemovalEnergy = nuclear::BindEnergyPerNucleon(target);
+  removalEnergy = this->RemovalEnergy(target);
+  type          = kFermiMoveDefault;
 
   return true;
 }
@@ -97,88 +164,43 @@ double LocalFGM::Prob(double p, double w, const Target & target,
 			     double hitNucleonRadius) const
 {
   if(w<0) {
-    TH1D * prob = this->ProbDistro(target, hitNucleonRadius);
-    int bin = prob->FindBin(p);
-    double y  = prob->GetBinContent(bin);
-    double dx = prob->GetBinWidth(bin);
-    double pr  = y*dx;
-    delete prob;
-    return pr;
+    // probability for p to be within a 1 MeV wide momentum bin
+    double KF = TMath::Min(this->LocalFermiMomentum(target,hitNucleonRadius), fPMax);
+    if(p < 0 || p > KF || KF <= 0) return 0;
+    int    npbins = (int) (1000*fPMax);
+    double dx     = fPMax / npbins;
+    double dP_dp  = 3. * p*p / (KF*KF*KF);
+    return dP_dp * dx;
   }
   return 1;
 }
 //____________________________________________________________________________
-// *** The TH1D object must be deleted after it is used ***
-TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
+double LocalFGM::RemovalEnergy(const Target & target) const
+{
+  map<int,double>::const_iterator it = fNucRmvE.find(target.Z());
+  if(it != fNucRmvE.end()) return it->second;
+  return nuclear::BindEnergyPerNucleon(target);
+}
+//____________________________________________________________________________
+double LocalFGM::LocalFermiMomentum(const Target & target, double r) const
 {
-  LOG("LocalFGM", pNOTICE)
-             << "Computing P = f(p_nucleon) for: " << target.AsString()
-	     << ", Nucleon Radius = " << r;
-  LOG("LocalFGM", pNOTICE)
-             << ", P(max) = " << fPMax;
-
   //-- get information for the nuclear target
   int nucleon_pdgc = target.HitNucPdg();
   assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
   int A = target.A();
-
-  assert(target.HitNucIsSet());
   bool is_p = pdg::IsProton(nucleon_pdgc);
-  double numNuc = (is_p) ? (double)target.Z():(double)target.N();
-
-  // Calculate Fermi Momentum using Local FG equations
-  double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
-  double KF= TMath::Power(3*kPi2*numNuc*genie::utils::nuclear::Density(r,A),
-			    1.0/3.0) *hbarc;
-
-  LOG("LocalFGM",pNOTICE) << "KF = " << KF;
+  int numNuc = (is_p) ? target.Z() : target.N();
 
-  double a  = 2.0;
-  double C  = 4. * kPi * TMath::Power(KF,3) / 3.;
+  // kF tabulated in radius bins for this nucleus & nucleon type
+  const KFTable & table = GetKFTable(A, numNuc, (is_p) ? 0 : 1);
 
-  // Do not include nucleon correlation tail
-  //double R  = 1. / (1.- KF/4.);
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("LocalFGM", pDEBUG) << "a  = " << a;
-  LOG("LocalFGM", pDEBUG) << "C  = " << C;
-  //LOG("LocalFGM", pDEBUG) << "R  = " << R;
-#endif
-
-  //-- create the probability distribution
-
-  int npbins = (int) (1000*fPMax);
-  TH1D * prob = new TH1D("", "", npbins, 0, fPMax);
-  prob->SetDirectory(0);
-
-  double dp = fPMax / (npbins-1);
-  double iC = (C>0) ? 1./C : 0.;
-  double kfa_pi_2 = TMath::Power(KF*a/kPi,2);
-
-  for(int i = 0; i < npbins; i++) {
-     double p  = i * dp;
-     double p2 = TMath::Power(p,2);
-
-     // calculate |phi(p)|^2
-     double phi2 = 0;
-     if (p <= KF)
-        phi2 = iC * (1. - 6.*kfa_pi_2);
-
-     // Do not include nucleon correlation tail
-     //else if ( p > KF && p < fPCutOff)
-     //   phi2 = iC * (2*R*kfa_pi_2*TMath::Power(KF/p,4.));
-
-     // calculate probability density : dProbability/dp
-     double dP_dp = 4*kPi * p2 * phi2;
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("LocalFGM", pDEBUG) << "p = " << p << ", dP/dp = " << dP_dp;
-#endif
-     prob->Fill(p, dP_dp);
+  double x = r / table.dr;
+  if(x < 0 || x >= table.kf.size()-1) {
+    return FermiMomentum(A, numNuc, r);
   }
-
-  //-- normalize the probability distribution
-  prob->Scale( 1.0 / prob->Integral("width") );
-
-  return prob;
+  unsigned int i = (unsigned int) x;
+  double       w = x - i;
+  return (1-w) * table.kf[i] + w * table.kf[i+1];
 }
 //____________________________________________________________________________
 void LocalFGM::Configure(const Registry & config)
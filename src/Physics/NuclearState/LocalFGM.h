@@ -6,6 +6,11 @@
 \brief    local Fermi gas model. Implements the NuclearModelI 
           interface.
 
+          The momentum distribution at radius r is uniform within the local
+          Fermi sphere, dP/dp ~ p^2 for p < kF(r), and is sampled with its
+          analytic inverse CDF. kF(r) is tabulated in radius bins once per
+          nucleus and nucleon type; the tables are shared by all instances.
+
 \ref      
 
 \author   Joe Johnston, Steven Dytman
@@ -23,8 +28,6 @@
 
 #include <map>
 
-#include <TH1D.h>
-
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
@@ -45,6 +48,11 @@ public:
   bool   GenerateNucleon (const Target & t, double hitNucleonRadius) const;
   double Prob            (double p, double w, const Target & t,
 			  double hitNucleonRadius) const;
+  bool   GenerateNucleonFromUnitCube (const Target & t,
+                          double hitNucleonRadius, const double * u) const;
+  bool   SampleNucleon   (const Target & t, double hitNucleonRadius,
+                          const double * u, double * p3, double & removalEnergy,
+                          FermiMoverInteractionType_t & type) const;
 
   //-- implement the NuclearModelI interface
   bool GenerateNucleon (const Target & t) const {
@@ -64,8 +72,9 @@ public:
   void Configure (string param_set)
 ;
 private:
-  void   LoadConfig (void);
-  TH1D * ProbDistro (const Target & t, double r) const;
+  void   LoadConfig         (void);
+  double LocalFermiMomentum (const Target & t, double r) const;
+  double RemovalEnergy      (const Target & t) const;
 
   map<int, double> fNucRmvE;
 
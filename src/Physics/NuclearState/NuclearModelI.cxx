@@ -14,10 +14,17 @@
  @ Mar 18, 2016- Joe Johnston (SD)
    Update GenerateNucleon() and Prob() to accept a radius as the argument,
    and call the corresponding methods in the nuclear model with a radius.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added SampleNucleon() and GenerateNucleons().
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The current nucleon is kept in per-thread scratch state.
 
 */
 //____________________________________________________________________________
 
+#include <TMath.h>
+#include <TH1D.h>
+#include <TRandom3.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
@@ -34,6 +41,20 @@ using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//____________________________________________________________________________
+namespace {
+
+  // Per-thread state of NuclearModelI: the current nucleon
+  class NuclearModelScratch : public AlgScratchI {
+  public:
+    NuclearModelScratch() :
+      RemovalEnergy(0), Momentum(0,0,0), FermiMoverType(kFermiMoveDefault) {}
+    double                      RemovalEnergy;  ///< removal energy
+    TVector3                    Momentum;       ///< momentum
+    FermiMoverInteractionType_t FermiMoverType; ///< FermiMover interaction type
+  };
+}
+
 //____________________________________________________________________________
 
 bool NuclearModelI::GenerateNucleon(const Target & tgt,
@@ -49,3 +70,147 @@ double NuclearModelI::Prob(double p, double w, const Target & tgt,
   }
 
 //____________________________________________________________________________
+double NuclearModelI::RemovalEnergy(void) const
+{
+  return static_cast<NuclearModelScratch *>(this->Scratch())->RemovalEnergy;
+}
+//____________________________________________________________________________
+double NuclearModelI::Momentum(void) const
+{
+  return static_cast<NuclearModelScratch *>(this->Scratch())->Momentum.Mag();
+}
+//____________________________________________________________________________
+const TVector3 & NuclearModelI::Momentum3(void) const
+{
+  return static_cast<NuclearModelScratch *>(this->Scratch())->Momentum;
+}
+//____________________________________________________________________________
+FermiMoverInteractionType_t
+                   NuclearModelI::GetFermiMoverInteractionType(void) const
+{
+  return static_cast<NuclearModelScratch *>(this->Scratch())->FermiMoverType;
+}
+//____________________________________________________________________________
+void NuclearModelI::SetMomentum3(const TVector3 & mom) const
+{
+  static_cast<NuclearModelScratch *>(this->Scratch())->Momentum = mom;
+}
+//____________________________________________________________________________
+void NuclearModelI::SetRemovalEnergy(double E) const
+{
+  static_cast<NuclearModelScratch *>(this->Scratch())->RemovalEnergy = E;
+}
+//____________________________________________________________________________
+void NuclearModelI::SetFermiMoverInteractionType(
+                                   FermiMoverInteractionType_t type) const
+{
+  static_cast<NuclearModelScratch *>(this->Scratch())->FermiMoverType = type;
+}
+//____________________________________________________________________________
+AlgScratchI * NuclearModelI::NewScratch(void) const
+{
+  return new NuclearModelScratch;
+}
+//____________________________________________________________________________
+bool NuclearModelI::GenerateNucleonFromUnitCube(const Target & tgt,
+                      double hitNucleonRadius, const double * /*u*/) const
+{
+  return GenerateNucleon(tgt, hitNucleonRadius);
+}
+//____________________________________________________________________________
+bool NuclearModelI::SampleNucleon(const Target & tgt,
+                   double hitNucleonRadius, const double * u, double * p3,
+                   double & removalEnergy,
+                   FermiMoverInteractionType_t & type) const
+{
+  bool ok = this->GenerateNucleonFromUnitCube(tgt, hitNucleonRadius, u);
+
+  const TVector3 & p = this->Momentum3();
+  p3[0] = p.Px();
+  p3[1] = p.Py();
+  p3[2] = p.Pz();
+  removalEnergy = this->RemovalEnergy();
+  type          = this->GetFermiMoverInteractionType();
+
+  return ok;
+}
+//____________________________________________________________________________
+bool NuclearModelI::GenerateNucleons(const Target & tgt, unsigned int n,
+                   TRandom3 & rnd, const double * radius, double * p3,
+                   double * removalEnergy,
+                   FermiMoverInteractionType_t * type) const
+{
+  bool all_ok = true;
+
+  double u[kNDimUnitCube];
+  for(unsigned int i = 0; i < n; i++) {
+    for(unsigned int j = 0; j < kNDimUnitCube; j++) u[j] = rnd.Rndm();
+
+    double r = (radius) ? radius[i] : 0.;
+    FermiMoverInteractionType_t itype = kFermiMoveDefault;
+    bool ok = this->SampleNucleon(tgt, r, u, &p3[3*i], removalEnergy[i], itype);
+    if(!ok) {
+      p3[3*i] = p3[3*i+1] = p3[3*i+2] = 0.;
+      removalEnergy[i] = 0.;
+      all_ok = false;
+    }
+    if(type) type[i] = itype;
+  }
+  return all_ok;
+}
+//____________________________________________________________________________
+bool NuclearModelI::SampleCurrentNucleon(const Target & tgt,
+                   double hitNucleonRadius, const double * u) const
+{
+  double p3[3] = { 0., 0., 0. };
+  double removal_energy = 0.;
+  FermiMoverInteractionType_t type = kFermiMoveDefault;
+
+  bool ok = this->SampleNucleon(
+                 tgt, hitNucleonRadius, u, p3, removal_energy, type);
+
+  this->SetMomentum3(TVector3(p3[0], p3[1], p3[2]));
+  this->SetRemovalEnergy(removal_energy);
+  this->SetFermiMoverInteractionType(type);
+
+  return ok;
+}
+//____________________________________________________________________________
+void NuclearModelI::SetMomentumFromUnitCube(
+                            double p, double ucostheta, double uphi) const
+{
+  double p3[3];
+  MomentumFromUnitCube(p, ucostheta, uphi, p3);
+  this->SetMomentum3(TVector3(p3[0], p3[1], p3[2]));
+}
+//____________________________________________________________________________
+void NuclearModelI::MomentumFromUnitCube(
+                  double p, double ucostheta, double uphi, double * p3)
+{
+  double costheta = -1. + 2. * ucostheta;
+  double sintheta = TMath::Sqrt(TMath::Max(0., 1.-costheta*costheta));
+  double fi       = 2 * kPi * uphi;
+
+  p3[0] = p*sintheta*TMath::Cos(fi);
+  p3[1] = p*sintheta*TMath::Sin(fi);
+  p3[2] = p*costheta;
+}
+//____________________________________________________________________________
+double NuclearModelI::InverseCDF(TH1D * h, double u)
+{
+// Same as TH1::GetRandom() but for an input, rather than a random, u
+
+  int nbins = h->GetNbinsX();
+  double * integral = h->GetIntegral();
+  if(integral[nbins] <= 0) return 0;
+
+  u = TMath::Min(TMath::Max(u, 0.), 1.);
+  int ibin = TMath::BinarySearch(nbins, integral, u);
+  double x = h->GetBinLowEdge(ibin+1);
+  if(ibin < nbins && u > integral[ibin]) {
+    x += h->GetBinWidth(ibin+1) *
+           (u - integral[ibin]) / (integral[ibin+1] - integral[ibin]);
+  }
+  return x;
+}
+//____________________________________________________________________________
@@ -22,6 +22,12 @@
    as the arguments. Currently used by LocalFGM. Calls
    GenerateNucleon() with the radius set to 0 for all other NuclearModelI
    implementations.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added the stateless SampleNucleon() and the batch GenerateNucleons(),
+   which leave the current nucleon untouched and can be called concurrently.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The current nucleon is kept in per-thread scratch state, so that a model
+   instance can generate nucleons on several threads.
 
 */
 //____________________________________________________________________________
@@ -37,6 +43,9 @@
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Interaction/Target.h"
 
+class TH1D;
+class TRandom3;
+
 namespace genie {
 
 class NuclearModelI : public Algorithm {
@@ -54,60 +63,82 @@ public:
 
   virtual NuclearModel_t ModelType       (const Target &) const = 0;
 
-  inline double         RemovalEnergy   (void)           const
-  {
-    return fCurrRemovalEnergy;
-  }
+  //! Generate a nucleon by mapping a point u of the kNDimUnitCube-dimensional
+  //! unit hypercube onto the model phase space, instead of drawing random
+  //! numbers internally: u[0] selects the momentum magnitude (by inverting
+  //! its cumulative distribution), u[1] and u[2] the direction (cos(theta)
+  //! and phi), and u[3] any further variate the model needs (removal energy,
+  //! interaction type). This allows quasi-random or stratified samplers to
+  //! drive the nuclear model. Models without an inverse transform fall back
+  //! to GenerateNucleon(tgt, r), ignoring u.
+  virtual bool GenerateNucleonFromUnitCube (const Target & tgt,
+                     double hitNucleonRadius, const double * u) const;
+
+  static const unsigned int kNDimUnitCube = 4;
+
+  //! Stateless version of GenerateNucleonFromUnitCube(): the nucleon momentum
+  //! (p3[0..2]), removal energy and FermiMover interaction type are returned
+  //! to the caller instead of being stored as the model's current nucleon,
+  //! so that one model instance can be shared by several threads.
+  //! The default implementation goes through GenerateNucleonFromUnitCube()
+  //! and is therefore not thread-safe; LocalFGM, FGMBodekRitchie,
+  //! SpectralFunc, SpectralFunc1d and EffectiveSF override it.
+  virtual bool SampleNucleon (const Target & tgt, double hitNucleonRadius,
+                     const double * u, double * p3, double & removalEnergy,
+                     FermiMoverInteractionType_t & type) const;
+
+  //! Generate n nucleons with SampleNucleon(), drawing the unit cube points
+  //! from the input random number stream, into caller-owned arrays: the
+  //! momenta in p3[3*i..3*i+2], the removal energies in removalEnergy[i]
+  //! and, if not NULL, the FermiMover interaction types in type[i].
+  //! The nucleons are placed at radius[i] (in fm), or at 0 if radius is NULL.
+  //! Returns false if any nucleon could not be generated (left at rest).
+  bool GenerateNucleons (const Target & tgt, unsigned int n, TRandom3 & rnd,
+                     const double * radius, double * p3, double * removalEnergy,
+                     FermiMoverInteractionType_t * type = 0) const;
+
+  //! The current nucleon, set by the last GenerateNucleon() call of the
+  //! calling thread (it is kept in per-thread scratch state, see AlgScratchI)
+  double                      RemovalEnergy                (void) const;
+  double                      Momentum                     (void) const;
+  const TVector3 &            Momentum3                    (void) const;
+  FermiMoverInteractionType_t GetFermiMoverInteractionType (void) const;
 
-  inline double         Momentum        (void)           const
-  {
-    return fCurrMomentum.Mag();
-  }
+  // These setters have to be const. I hate it. We should really update this class interface
+  void SetMomentum3     (const TVector3 & mom) const;
+  void SetRemovalEnergy (double E) const;
 
-  inline const TVector3& Momentum3      (void)           const
-  {
-    return fCurrMomentum;
-  }
+protected:
+  void SetFermiMoverInteractionType (FermiMoverInteractionType_t type) const;
 
-  inline FermiMoverInteractionType_t GetFermiMoverInteractionType(void) const
-  {
-    return fFermiMoverInteractionType;
-  }
+  AlgScratchI * NewScratch (void) const;
 
-  // These setters have to be const. I hate it. We should really update this class interface
-  inline void SetMomentum3(const TVector3 & mom) const
-  {
-    fCurrMomentum = mom;
-  };
-  inline void SetRemovalEnergy(double E) const
-  {
-    fCurrRemovalEnergy = E;
-  }
+  //! Set the current momentum from its magnitude and the variates
+  //! selecting its direction (see GenerateNucleonFromUnitCube())
+  void SetMomentumFromUnitCube (double p, double ucostheta, double uphi) const;
+
+  //! Momentum components p3[0..2] from its magnitude and direction variates
+  static void MomentumFromUnitCube (double p, double ucostheta, double uphi,
+                                    double * p3);
+
+  //! GenerateNucleonFromUnitCube() for models implementing SampleNucleon():
+  //! sample a nucleon and store it as the current one
+  bool SampleCurrentNucleon (const Target & tgt, double hitNucleonRadius,
+                             const double * u) const;
+
+  //! Invert the cumulative distribution of the input histogram at u in [0,1]
+  static double InverseCDF (TH1D * h, double u);
 
-protected:
   NuclearModelI()
     : Algorithm()
-    , fCurrRemovalEnergy(0)
-    , fCurrMomentum(0,0,0)
-    , fFermiMoverInteractionType(kFermiMoveDefault)
     {};
   NuclearModelI(std::string name)
     : Algorithm(name)
-    , fCurrRemovalEnergy(0)
-    , fCurrMomentum(0,0,0)
-    , fFermiMoverInteractionType(kFermiMoveDefault)
     {};
   NuclearModelI(std::string name, std::string config)
     : Algorithm(name, config)
-    , fCurrRemovalEnergy(0)
-    , fCurrMomentum(0,0,0)
-    , fFermiMoverInteractionType(kFermiMoveDefault)
     {};
 
-  mutable double   fCurrRemovalEnergy;
-  mutable TVector3 fCurrMomentum;
-  mutable FermiMoverInteractionType_t fFermiMoverInteractionType;
-
 };
 
 }         // genie namespace
@@ -65,14 +65,39 @@ bool NuclearModelMap::GenerateNucleon(const Target & target,
 
   bool ok = nm->GenerateNucleon(target,hitNucleonRadius);
 
-  fCurrRemovalEnergy = nm->RemovalEnergy();
-  const TVector3& p  = nm->Momentum3();
-  fCurrMomentum.SetXYZ(p.Px(), p.Py(), p.Pz());
-  fFermiMoverInteractionType = nm->GetFermiMoverInteractionType();
+  this->SetRemovalEnergy(nm->RemovalEnergy());
+  this->SetMomentum3(nm->Momentum3());
+  this->SetFermiMoverInteractionType(nm->GetFermiMoverInteractionType());
 
   return ok;
 }
 //____________________________________________________________________________
+bool NuclearModelMap::GenerateNucleonFromUnitCube(const Target & target,
+                          double hitNucleonRadius, const double * u) const
+{
+  const NuclearModelI * nm = this->SelectModel(target);
+  if(!nm) return false;
+
+  bool ok = nm->GenerateNucleonFromUnitCube(target,hitNucleonRadius,u);
+
+  this->SetRemovalEnergy(nm->RemovalEnergy());
+  this->SetMomentum3(nm->Momentum3());
+  this->SetFermiMoverInteractionType(nm->GetFermiMoverInteractionType());
+
+  return ok;
+}
+//____________________________________________________________________________
+bool NuclearModelMap::SampleNucleon(const Target & target,
+                          double hitNucleonRadius, const double * u,
+                          double * p3, double & removalEnergy,
+                          FermiMoverInteractionType_t & type) const
+{
+  const NuclearModelI * nm = this->SelectModel(target);
+  if(!nm) return false;
+
+  return nm->SampleNucleon(target,hitNucleonRadius,u,p3,removalEnergy,type);
+}
+//____________________________________________________________________________
 double NuclearModelMap::Prob(double p, double w, const Target & target,
                              double hitNucRadius) const
 {
@@ -43,6 +43,11 @@ public:
                                   double hitNucleonRadius) const;
   virtual double  Prob           (double p, double w, const Target & t,
                                   double hitNucleonRadius) const;
+  virtual bool   GenerateNucleonFromUnitCube (const Target & t,
+                              double hitNucleonRadius, const double * u) const;
+  virtual bool   SampleNucleon   (const Target & t, double hitNucleonRadius,
+                              const double * u, double * p3, double & removalEnergy,
+                              FermiMoverInteractionType_t & type) const;
 
   //-- implement the NuclearModelI interface
   bool GenerateNucleon (const Target & t) const {
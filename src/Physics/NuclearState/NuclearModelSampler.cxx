@@ -0,0 +1,141 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <cassert>
+
+#include <TMath.h>
+
+#include "Framework/Interaction/Target.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Physics/NuclearState/NuclearModelI.h"
+#include "Physics/NuclearState/NuclearModelSampler.h"
+#include "Physics/NuclearState/NuclearUtils.h"
+
+using std::vector;
+using std::string;
+
+using namespace genie;
+
+//____________________________________________________________________________
+NuclearModelSampler::NuclearModelSampler(
+   const NuclearModelI * model, NucleonSampling_t method, double R0) :
+fNuclModel(model),
+fMethod(method),
+fR0(R0)
+{
+  assert(fNuclModel);
+  if(fMethod == kNSmpUndefined) fMethod = kNSmpPseudoRandom;
+}
+//____________________________________________________________________________
+NuclearModelSampler::~NuclearModelSampler()
+{
+
+}
+//____________________________________________________________________________
+void NuclearModelSampler::Generate(
+                    const Target & tgt, unsigned int nnuc, double radius)
+{
+  fRadius.resize(nnuc);
+  fMomentum.resize(nnuc);
+  fRemovalEnergy.resize(nnuc);
+
+  RandomGen * rnd = RandomGen::Instance();
+  const unsigned int ndim = 1 + NuclearModelI::kNDimUnitCube;
+  bool sample_radius = (radius < 0);
+
+  if(fMethod != kNSmpPseudoRandom) {
+    this->UnitCubePoints(nnuc, ndim);
+  }
+
+  double u_rnd[ndim];
+  double p3[3];
+  FermiMoverInteractionType_t type;
+
+  for(unsigned int inuc = 0; inuc < nnuc; inuc++) {
+    const double * u = 0;
+    if(fMethod == kNSmpPseudoRandom) {
+      for(unsigned int idim = 0; idim < ndim; idim++) {
+        u_rnd[idim] = rnd->RndGen().Rndm();
+      }
+      u = u_rnd;
+    }
+    else {
+      u = &fUnitCube[inuc*ndim];
+    }
+    double r = (sample_radius) ?
+        this->InverseRadialCDF(tgt.A(), u[0]) : radius;
+    fNuclModel->SampleNucleon(tgt, r, u+1, p3, fRemovalEnergy[inuc], type);
+    fRadius  [inuc] = r;
+    fMomentum[inuc].SetXYZ(p3[0], p3[1], p3[2]);
+  }
+
+  LOG("NuclSampler", pINFO)
+    << "Generated " << nnuc << " nucleons for " << tgt.AsString();
+}
+//____________________________________________________________________________
+NucleonSampling_t NuclearModelSampler::MethodFromString(string method)
+{
+  if      (method == "PseudoRandom") return kNSmpPseudoRandom;
+  else if (method == "QuasiRandom" ) return kNSmpQuasiRandom;
+  else if (method == "Stratified"  ) return kNSmpStratified;
+
+  LOG("NuclSampler", pERROR)
+    << "Unknown nucleon sampling method: " << method;
+  return kNSmpUndefined;
+}
+//____________________________________________________________________________
+void NuclearModelSampler::UnitCubePoints(unsigned int nnuc, unsigned int ndim)
+{
+  static const unsigned int kPrimes[] = { 2, 3, 5, 7, 11, 13, 17, 19 };
+  assert(ndim <= sizeof(kPrimes)/sizeof(kPrimes[0]));
+
+  RandomGen * rnd = RandomGen::Instance();
+  fUnitCube.resize(nnuc*ndim);
+
+  if(fMethod == kNSmpQuasiRandom) {
+    // Halton sequence with a random (Cranley-Patterson) shift
+    for(unsigned int idim = 0; idim < ndim; idim++) {
+      double shift = rnd->RndNum().Rndm();
+      for(unsigned int inuc = 0; inuc < nnuc; inuc++) {
+        double u = utils::math::RadicalInverse(inuc+1, kPrimes[idim]) + shift;
+        fUnitCube[inuc*ndim + idim] = u - TMath::Floor(u);
+      }
+    }
+  }
+  else {
+    // Latin hypercube: every dimension has exactly one point per 1/nnuc
+    // stratum, with the strata combined at random across dimensions
+    vector<unsigned int> strata(nnuc);
+    for(unsigned int idim = 0; idim < ndim; idim++) {
+      for(unsigned int inuc = 0; inuc < nnuc; inuc++) strata[inuc] = inuc;
+      for(unsigned int inuc = nnuc; inuc > 1; inuc--) {
+        unsigned int j = rnd->RndNum().Integer(inuc);
+        std::swap(strata[inuc-1], strata[j]);
+      }
+      for(unsigned int inuc = 0; inuc < nnuc; inuc++) {
+        fUnitCube[inuc*ndim + idim] =
+            (strata[inuc] + rnd->RndNum().Rndm()) / nnuc;
+      }
+    }
+  }
+}
+//____________________________________________________________________________
+double NuclearModelSampler::InverseRadialCDF(int A, double u) const
+{
+  // same radial distribution as the one used by the VertexGenerator
+  double rmax = 3 * fR0 * TMath::Power(A, 1./3.);
+  return utils::nuclear::InverseRadialCDF(A, rmax, u);
+}
+//____________________________________________________________________________
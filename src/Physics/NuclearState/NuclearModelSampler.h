@@ -0,0 +1,95 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NuclearModelSampler
+
+\brief    Generates sets of hit nucleon positions, momenta and removal
+          energies according to a NuclearModelI, for use in loops averaging
+          a quantity over the nuclear phase space (eg. the cross section
+          integral of NievesQELCCPXSec, or the maximum cross section
+          estimate of QELEventGenerator).
+          Instead of independent random throws, the nucleons are placed
+          at the points of a randomized quasi-random (Halton) sequence or
+          of a stratified (Latin hypercube) sample of the unit hypercube,
+          which are then mapped onto the nuclear radius and the model's
+          momentum distribution by inverse transform (see
+          NuclearModelI::SampleNucleon()). Both methods cover
+          the phase space far more evenly than pseudo-random throws, so the
+          same precision is reached with several times fewer nucleons.
+          The sequences are randomly shifted at each call, using the GENIE
+          random number generator, so the averages remain unbiased.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NUCLEAR_MODEL_SAMPLER_H_
+#define _NUCLEAR_MODEL_SAMPLER_H_
+
+#include <vector>
+#include <string>
+
+#include <TVector3.h>
+
+namespace genie {
+
+class Target;
+class NuclearModelI;
+
+typedef enum ENucleonSampling {
+  kNSmpUndefined = -1,
+  kNSmpPseudoRandom,   ///< independent random throws
+  kNSmpQuasiRandom,    ///< randomly shifted Halton sequence
+  kNSmpStratified      ///< Latin hypercube sample
+} NucleonSampling_t;
+
+class NuclearModelSampler {
+
+public:
+  NuclearModelSampler(const NuclearModelI * model,
+                      NucleonSampling_t method = kNSmpQuasiRandom,
+                      double R0 = 1.4);
+ ~NuclearModelSampler();
+
+  //! Generate nnuc nucleons for the input target (its hit nucleon must be set).
+  //! If radius >= 0 all nucleons are placed at that radius (in fm), otherwise
+  //! their radii follow the nuclear density profile.
+  void Generate (const Target & tgt, unsigned int nnuc, double radius = -1.);
+
+  //! Access the generated nucleons
+  unsigned int      NNucleons     (void)           const { return fRadius.size();   }
+  double            Radius        (unsigned int i) const { return fRadius[i];        }
+  const TVector3 &  Momentum3     (unsigned int i) const { return fMomentum[i];      }
+  double            RemovalEnergy (unsigned int i) const { return fRemovalEnergy[i]; }
+
+  NucleonSampling_t Method        (void)           const { return fMethod; }
+
+  //! Method from its configuration name (PseudoRandom, QuasiRandom, Stratified)
+  static NucleonSampling_t MethodFromString (std::string method);
+
+private:
+  //! Fill fUnitCube with nnuc points in ndim dimensions
+  void   UnitCubePoints (unsigned int nnuc, unsigned int ndim);
+
+  //! Radius (in fm) at which the cumulative r^2*density(r) of nucleus A is u
+  double InverseRadialCDF (int A, double u) const;
+
+  const NuclearModelI *       fNuclModel;     ///< nuclear model
+  NucleonSampling_t           fMethod;        ///< sampling method
+  double                      fR0;            ///< nuclear size parameter, in fm
+
+  std::vector<double>         fUnitCube;      ///< points in the unit hypercube (point-major)
+
+  std::vector<double>         fRadius;        ///< generated nucleon radii
+  std::vector<TVector3>       fMomentum;      ///< generated nucleon momenta
+  std::vector<double>         fRemovalEnergy; ///< generated nucleon removal energies
+};
+
+}      // genie namespace
+#endif // _NUCLEAR_MODEL_SAMPLER_H_
@@ -31,16 +31,30 @@
  @ Mar 18, 2016 - JJ (SD)
    Check if a local Fermi gas model should be used when calculating the
    Fermi momentum
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added PauliBlockingContext, so that the nuclear model type and the Fermi
+   momentum table are looked up once rather than at every evaluation of
+   NuclQELXSecSuppression()
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Added DensityTabulated() and InverseRadialCDF(), using tables shared by
+   all threads. Removed the per-call logging from the density functions
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <cassert>
 #include <cstdlib>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
@@ -51,9 +65,120 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
+using std::map;
+using std::pair;
+using std::vector;
+
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  // Parameters of the density profile of nucleus A [by S.Dytman]:
+  // Woods-Saxon (p0 = c, p1 = z) for A > 20 or modified harmonic
+  // oscillator (p0 = a, p1 = alf) otherwise
+  void DensityProfile(int A, bool & woods_saxon, double & p0, double & p1)
+  {
+    woods_saxon = (A > 20);
+    if(A>20) {
+      double c = 1., z = 1.;
+
+      if      (A ==  27) { c = 3.07; z = 0.52; }  // aluminum
+      else if (A ==  28) { c = 3.07; z = 0.54; }  // silicon
+      else if (A ==  40) { c = 3.53; z = 0.54; }  // argon
+      else if (A ==  56) { c = 4.10; z = 0.56; }  // iron
+      else if (A == 208) { c = 6.62; z = 0.55; }  // lead
+      else {
+         c = TMath::Power(A,0.35); z = 0.54;
+      } //others
+
+      p0 = c; p1 = z;
+    }
+    else if (A>4) {
+      double ap = 1., alf = 1.;
+
+      if      (A ==  7) { ap = 1.77; alf = 0.327; } // lithium
+      else if (A == 12) { ap = 1.69; alf = 1.08;  } // carbon
+      else if (A == 14) { ap = 1.76; alf = 1.23;  } // nitrogen
+      else if (A == 16) { ap = 1.83; alf = 1.54;  } // oxygen
+      else  {
+        ap=1.75; alf=-0.4+.12*A;
+      }  //others- alf=0.08 if A=4
+
+      p0 = ap; p1 = alf;
+    }
+    else {
+      // helium
+      p0 = 1.9/TMath::Sqrt(2.);
+      p1 = 0.;
+    }
+  }
+
+  // Density(r,A) at r = i*dr, for r up to 5 nuclear radii (R = 1.4 A^1/3 fm)
+  const unsigned int kDensityTableNBins = 2000;
+  struct DensityTable {
+    bool           woods_saxon;
+    double         size;   // c (Woods-Saxon) or a (Gaussian), in fm
+    double         dr;
+    vector<double> rho;
+  };
+  map<int, DensityTable *> gDensityTables;
+  std::mutex               gDensityTablesMutex;
+
+  const DensityTable & GetDensityTable(int A)
+  {
+    std::lock_guard<std::mutex> lock(gDensityTablesMutex);
+
+    map<int, DensityTable *>::const_iterator it = gDensityTables.find(A);
+    if(it != gDensityTables.end()) return *(it->second);
+
+    DensityTable * table = new DensityTable;
+    double p1 = 0.;
+    DensityProfile(A, table->woods_saxon, table->size, p1);
+    table->dr = 5 * utils::nuclear::Radius(A, 1.4) / kDensityTableNBins;
+    table->rho.resize(kDensityTableNBins+1);
+    for(unsigned int i = 0; i <= kDensityTableNBins; i++) {
+      table->rho[i] = utils::nuclear::Density(i * table->dr, A);
+    }
+    gDensityTables[A] = table;
+    return *table;
+  }
+
+  // cumulative distribution of r^2*Density(r,A) at r = i*rmax/nbins
+  const unsigned int kRadialCDFNBins = 2000;
+  map<pair<int,double>, vector<double> *> gRadialCDFs;
+  std::mutex                              gRadialCDFsMutex;
+
+  const vector<double> & GetRadialCDF(int A, double rmax)
+  {
+    pair<int,double> key(A, rmax);
+
+    std::lock_guard<std::mutex> lock(gRadialCDFsMutex);
+
+    map<pair<int,double>, vector<double> *>::const_iterator it =
+                                                   gRadialCDFs.find(key);
+    if(it != gRadialCDFs.end()) return *(it->second);
+
+    vector<double> * cdf = new vector<double>(kRadialCDFNBins+1, 0.);
+    double dr = rmax / kRadialCDFNBins;
+    double y_prev = 0.;
+    for(unsigned int ir = 1; ir <= kRadialCDFNBins; ir++) {
+      double r = ir * dr;
+      double y = r*r * utils::nuclear::Density(r, A);
+      (*cdf)[ir] = (*cdf)[ir-1] + 0.5 * (y + y_prev);
+      y_prev = y;
+    }
+    double norm = (*cdf)[kRadialCDFNBins];
+    if(norm > 0) {
+      for(unsigned int ir = 1; ir <= kRadialCDFNBins; ir++) (*cdf)[ir] /= norm;
+    }
+    gRadialCDFs[key] = cdf;
+    return *cdf;
+  }
+
+}
+
 
 //____________________________________________________________________________
 double genie::utils::nuclear::BindEnergy(const Target & target)
@@ -128,8 +253,57 @@ double genie::utils::nuclear::Radius(int A, double Ro)
   return Rn;
 }
 //___________________________________________________________________________
+genie::utils::nuclear::PauliBlockingContext
+  genie::utils::nuclear::LoadPauliBlockingContext(string kftable, double pmax)
+{
+  PauliBlockingContext ctx;
+  ctx.PMax = pmax;
+
+  // Check if an LFG model should be used for Fermi momentum
+  // Create a nuclear model object to check the model type
+  AlgConfigPool * confp = AlgConfigPool::Instance();
+  const Registry * gc = confp->GlobalParameterList();
+  RgKey nuclkey = "NuclearModel";
+  RgAlg nuclalg = gc->GetAlg(nuclkey);
+  AlgFactory * algf = AlgFactory::Instance();
+  const genie::NuclearModelI* nuclModel =
+    dynamic_cast<const genie::NuclearModelI*>(
+			     algf->GetAlgorithm(nuclalg.name,nuclalg.config));
+  // Check if the model is a local Fermi gas
+  ctx.LFG = (nuclModel && nuclModel->ModelType(Target()) == kNucmLocalFermiGas);
+
+  if(!ctx.LFG) {
+    // get the requested Fermi momentum table
+    FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+    ctx.KFTable = kftp->GetTable(kftable);
+    assert(ctx.KFTable);
+  }
+
+  return ctx;
+}
+//___________________________________________________________________________
+double genie::utils::nuclear::FermiMomentum(const PauliBlockingContext & ctx,
+               const Target & target, int nucleon_pdgc, double radius)
+{
+  if(ctx.LFG) {
+    double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
+    bool is_p = pdg::IsProton(nucleon_pdgc);
+    double numNuc = (is_p) ? (double)target.Z():(double)target.N();
+    return TMath::Power(3*kPi2*numNuc*
+		     genie::utils::nuclear::DensityTabulated(radius,target.A()),1.0/3.0) *hbarc;
+  }
+  return ctx.KFTable->FindClosestKF(target.Pdg(), nucleon_pdgc);
+}
+//___________________________________________________________________________
 double genie::utils::nuclear::NuclQELXSecSuppression(
                 string kftable, double pmax, const Interaction * interaction)
+{
+  PauliBlockingContext ctx = LoadPauliBlockingContext(kftable, pmax);
+  return NuclQELXSecSuppression(ctx, interaction);
+}
+//___________________________________________________________________________
+double genie::utils::nuclear::NuclQELXSecSuppression(
+                const PauliBlockingContext & ctx, const Interaction * interaction)
 {
   const InitialState & init_state = interaction->InitState();
   const ProcessInfo &  proc_info  = interaction->ProcInfo();
@@ -152,7 +326,6 @@ double genie::utils::nuclear::NuclQELXSecSuppression(
   // general case
   //
 
-  int target_pdgc         = target.Pdg();
   int struck_nucleon_pdgc = target.HitNucPdg();
   int final_nucleon_pdgc  = struck_nucleon_pdgc;
 
@@ -160,53 +333,19 @@ double genie::utils::nuclear::NuclQELXSecSuppression(
      final_nucleon_pdgc = pdg::SwitchProtonNeutron(struck_nucleon_pdgc);
   }
 
-  // Check if an LFG model should be used for Fermi momentum
-  // Create a nuclear model object to check the model type
-  AlgConfigPool * confp = AlgConfigPool::Instance();
-  const Registry * gc = confp->GlobalParameterList();
-  RgKey nuclkey = "NuclearModel";
-  RgAlg nuclalg = gc->GetAlg(nuclkey);
-  AlgFactory * algf = AlgFactory::Instance();
-  const genie::NuclearModelI* nuclModel =
-    dynamic_cast<const genie::NuclearModelI*>(
-			     algf->GetAlgorithm(nuclalg.name,nuclalg.config));
-  // Check if the model is a local Fermi gas
-  bool lfg = (nuclModel && nuclModel->ModelType(Target()) == kNucmLocalFermiGas);
+  // Fermi momentum for initial, final nucleons
+  // (at the hit nucleon position for a local Fermi gas)
+  double radius = target.HitNucPosition();
+  double kFi = FermiMomentum(ctx, target, struck_nucleon_pdgc, radius);
+  double kFf = (struck_nucleon_pdgc==final_nucleon_pdgc) ? kFi :
+               FermiMomentum(ctx, target, final_nucleon_pdgc, radius);
 
-  double kFi, kFf;
-  if(lfg){
-    double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
-    Target* tgt = interaction->InitStatePtr()->TgtPtr();
-    double radius = tgt->HitNucPosition();
-
-    int A = tgt->A();
-    // kFi
-    bool is_p_i = pdg::IsProton(struck_nucleon_pdgc);
-    double numNuci = (is_p_i) ? (double)tgt->Z():(double)tgt->N();
-    kFi = TMath::Power(3*kPi2*numNuci*
-		     genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
-    // kFi
-    bool is_p_f = pdg::IsProton(final_nucleon_pdgc);
-    double numNucf = (is_p_f) ? (double)tgt->Z():(double)tgt->N();
-    kFf = TMath::Power(3*kPi2*numNucf*
-		     genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
-  }else{
-    // get the requested Fermi momentum table 
-    FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-    const FermiMomentumTable * kft  = kftp->GetTable(kftable);
-    
-    // Fermi momentum for initial, final nucleons
-    kFi = kft->FindClosestKF(target_pdgc, struck_nucleon_pdgc);
-    kFf = (struck_nucleon_pdgc==final_nucleon_pdgc) ? kFi : 
-          kft->FindClosestKF(target_pdgc, final_nucleon_pdgc );
-  }
-  
   double Mn = target.HitNucP4Ptr()->M(); // can be off m/shell
 
   const Kinematics & kine = interaction->Kine();
   double q2 = kine.q2();
 
-  double R = RQEFG_generic(q2, Mn, kFi, kFf, pmax);
+  double R = RQEFG_generic(q2, Mn, kFi, kFf, ctx.PMax);
   return R;
 }
 //___________________________________________________________________________
@@ -388,46 +527,47 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
 {
 // [by S.Dytman]
 //
-  if(A>20) {
-    double c = 1., z = 1.;
-
-    if      (A ==  27) { c = 3.07; z = 0.52; }  // aluminum
-    else if (A ==  28) { c = 3.07; z = 0.54; }  // silicon
-    else if (A ==  40) { c = 3.53; z = 0.54; }  // argon
-    else if (A ==  56) { c = 4.10; z = 0.56; }  // iron
-    else if (A == 208) { c = 6.62; z = 0.55; }  // lead
-    else { 
-       c = TMath::Power(A,0.35); z = 0.54; 
-    } //others
-
-    LOG("Nuclear",pINFO)
-	<< "r= " << r << ", ring= " << ring;
-    double rho = DensityWoodsSaxon(r,c,z,ring);
-    return rho;
-  }
-  else if (A>4) {
-    double ap = 1., alf = 1.;
-
-    if      (A ==  7) { ap = 1.77; alf = 0.327; } // lithium
-    else if (A == 12) { ap = 1.69; alf = 1.08;  } // carbon
-    else if (A == 14) { ap = 1.76; alf = 1.23;  } // nitrogen
-    else if (A == 16) { ap = 1.83; alf = 1.54;  } // oxygen
-    else  { 
-      ap=1.75; alf=-0.4+.12*A; 
-    }  //others- alf=0.08 if A=4
-
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
-  }
-  else {
-    // helium
-    double ap = 1.9/TMath::Sqrt(2.);  
-    double alf=0.;    
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+  bool   woods_saxon = false;
+  double p0 = 0., p1 = 0.;
+  DensityProfile(A, woods_saxon, p0, p1);
+
+  if(woods_saxon) return DensityWoodsSaxon(r,p0,p1,ring);
+  return DensityGaus(r,p0,p1,ring);
+}
+//___________________________________________________________________________
+double genie::utils::nuclear::DensityTabulated(double r, int A, double ring)
+{
+  const DensityTable & table = GetDensityTable(A);
+
+  // radius at which the ring = 0 density equals the requested one
+  // (see DensityGaus & DensityWoodsSaxon: the ring does not change the norm)
+  double x = 0.;
+  if(table.woods_saxon) {
+    x = r - TMath::Min(ring, 0.75*table.size);
+  } else {
+    x = r * table.size / (table.size + TMath::Min(ring, 0.3*table.size));
   }
 
-  return 0;
+  double u = x / table.dr;
+  if(u < 0 || u >= kDensityTableNBins) return Density(r,A,ring);
+
+  unsigned int i = (unsigned int) u;
+  double       w = u - i;
+  return (1-w) * table.rho[i] + w * table.rho[i+1];
+}
+//___________________________________________________________________________
+double genie::utils::nuclear::InverseRadialCDF(int A, double rmax, double u)
+{
+  const vector<double> & cdf = GetRadialCDF(A, rmax);
+  const unsigned int nr = kRadialCDFNBins;
+  const double       dr = rmax / nr;
+
+  unsigned int ir = std::upper_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+  if(ir <= 0)  return 0.;
+  if(ir > nr)  return rmax;
+  double dc = cdf[ir] - cdf[ir-1];
+  double f  = (dc > 0) ? (u - cdf[ir-1]) / dc : 0.;
+  return (ir - 1 + f) * dr;
 }
 //___________________________________________________________________________
 double genie::utils::nuclear::DensityGaus(
@@ -448,9 +588,11 @@ double genie::utils::nuclear::DensityGaus(
   double b     = TMath::Power(r/aeval, 2.);
   double dens  = norm * (1. + alf*b) * TMath::Exp(-b);
 
-  LOG("Nuclear", pINFO) 
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("Nuclear", pDEBUG) 
         << "r = " << r << ", norm = " << norm << ", dens = " << dens 
         << ", aeval= " << aeval;
+#endif
 
   return dens;
 }
@@ -465,18 +607,17 @@ double genie::utils::nuclear::DensityWoodsSaxon(
 // input  : radial distance in nucleus [units: fm]
 // output : nuclear density            [units: fm^-3]
 
-  LOG("Nuclear",pINFO)
-      << "c= " << c << ", z= " << z << ",ring= " << ring;
-
   ring = TMath::Min(ring, 0.75*c);
 
   double ceval = c + ring;
   double norm  = (3./(4.*kPi*TMath::Power(c,3)))*1./(1.+TMath::Power((kPi*z/c),2));
   double dens  = norm / (1 + TMath::Exp((r-ceval)/z));
 
-  LOG("Nuclear", pINFO) 
-     << "r = " << r << ", norm = " << norm 
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("Nuclear", pDEBUG) 
+     << "r = " << r << ", c = " << c << ", z = " << z << ", norm = " << norm 
      << ", dens = " << dens << " , ceval= " << ceval;
+#endif
 
   return dens;
 }
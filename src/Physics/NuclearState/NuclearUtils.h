@@ -30,17 +30,41 @@ namespace genie {
 
 class Target;
 class Interaction;
+class FermiMomentumTable;
 
 namespace utils {
 
 namespace nuclear
 {
+  //! Settings of the Fermi momentum calculation used for Pauli blocking,
+  //! resolved once (see LoadPauliBlockingContext()) so that evaluating the
+  //! Fermi momenta and the QEL nuclear suppression factor only involves
+  //! arithmetic and no algorithm or configuration lookups
+  struct PauliBlockingContext {
+    PauliBlockingContext() : LFG(false), KFTable(0), PMax(0.5) {}
+
+    bool                       LFG;      ///< global nuclear model is a local Fermi gas
+    const FermiMomentumTable * KFTable;  ///< Fermi momenta if not a local Fermi gas
+    double                     PMax;     ///< momentum cut-off used by RQEFG_generic()
+  };
+
+  //! Resolve the global NuclearModel type and, unless it is a local Fermi gas,
+  //! the named Fermi momentum table
+  PauliBlockingContext LoadPauliBlockingContext (string kftable, double pmax=0.5);
+
+  //! Fermi momentum of nucleon_pdgc nucleons in the target, at the input
+  //! radius (in fm) for a local Fermi gas
+  double FermiMomentum (const PauliBlockingContext & ctx,
+                        const Target & target, int nucleon_pdgc, double radius);
+
+  double NuclQELXSecSuppression (const PauliBlockingContext & ctx, const Interaction * in);
   double BindEnergy             (const Target & target);
   double BindEnergy             (int nucA, int nucZ);
   double BindEnergyPerNucleon   (const Target & target);
   double BindEnergyLastNucleon  (const Target & target);
   double Radius                 (int A, double Ro=constants::kNucRo);
 
+  //! As above, but resolving the context at every call
   double NuclQELXSecSuppression (string kftable, double pmax, const Interaction * in);
 
   double RQEFG_generic (
@@ -58,6 +82,17 @@ namespace nuclear
   double DensityGaus       (double r, double ap, double alf, double ring=0.);
   double DensityWoodsSaxon (double r, double c, double z, double ring=0.);
 
+  //! Same as Density(), interpolated in a radial table built on first use
+  //! for nucleus A and shared by all threads. The ring only rescales (for
+  //! the Gaussian) or shifts (for the Woods-Saxon density) the radius, so
+  //! one table per A serves all rings. Falls back to Density() beyond it
+  double DensityTabulated  (double r, int A, double ring=0.);
+
+  //! Radius (in fm) at which the cumulative distribution of r^2*Density(r,A)
+  //! over [0,rmax] equals u in [0,1], from a table built on first use for
+  //! (A,rmax) and shared by all threads. Used to sample interaction vertices
+  double InverseRadialCDF  (int A, double rmax, double u);
+
   double BindEnergyPerNucleonParametrization(const Target & target);
   double FermiMomentumForIsoscalarNucleonParametrization(const Target & target);
 
@@ -0,0 +1,107 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TMath.h>
+
+#include "Physics/NuclearState/NucleonMomentumCDF.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NucleonMomentumCDF::NucleonMomentumCDF(
+                            const vector<double> & density, double pmax) :
+fNBins    (density.size()),
+fPMax     (pmax),
+fBinWidth (pmax / density.size()),
+fDensity  (density),
+fCDF      (density.size()+1, 0.),
+fGuide    (density.size(), 0)
+{
+  assert(fNBins > 0 && fPMax > 0);
+
+  for(unsigned int i = 0; i < fNBins; i++) {
+    assert(fDensity[i] >= 0);
+    fCDF[i+1] = fCDF[i] + fDensity[i] * fBinWidth;
+  }
+
+  // normalize
+  double norm = fCDF[fNBins];
+  if(norm > 0) {
+    for(unsigned int i = 0; i < fNBins;  i++) fDensity[i] /= norm;
+    for(unsigned int i = 0; i <= fNBins; i++) fCDF[i]     /= norm;
+    fCDF[fNBins] = 1.;
+  }
+
+  // guide table
+  unsigned int bin = 0;
+  for(unsigned int i = 0; i < fNBins; i++) {
+    double u = (double)i / fNBins;
+    while(bin < fNBins-1 && fCDF[bin+1] <= u) bin++;
+    fGuide[i] = bin;
+  }
+}
+//____________________________________________________________________________
+NucleonMomentumCDF::~NucleonMomentumCDF()
+{
+
+}
+//____________________________________________________________________________
+int NucleonMomentumCDF::Bin(double p) const
+{
+  if(p < 0 || p > fPMax) return -1;
+  return TMath::Min((unsigned int) (p / fBinWidth), fNBins-1);
+}
+//____________________________________________________________________________
+double NucleonMomentumCDF::Density(double p) const
+{
+  int bin = this->Bin(p);
+  return (bin < 0) ? 0. : fDensity[bin];
+}
+//____________________________________________________________________________
+double NucleonMomentumCDF::BinProb(double p) const
+{
+  int bin = this->Bin(p);
+  return (bin < 0) ? 0. : fCDF[bin+1] - fCDF[bin];
+}
+//____________________________________________________________________________
+void NucleonMomentumCDF::BinProb(
+                  unsigned int n, const double * p, double * prob) const
+{
+  double ibw = 1. / fBinWidth;
+  for(unsigned int i = 0; i < n; i++) {
+    double pi = p[i];
+    if(pi < 0 || pi > fPMax) {
+      prob[i] = 0.;
+      continue;
+    }
+    unsigned int bin = TMath::Min((unsigned int) (pi * ibw), fNBins-1);
+    prob[i] = fCDF[bin+1] - fCDF[bin];
+  }
+}
+//____________________________________________________________________________
+double NucleonMomentumCDF::InverseCDF(double u) const
+{
+  if(fCDF[fNBins] <= 0) return 0;
+
+  u = TMath::Min(TMath::Max(u, 0.), 1.);
+
+  unsigned int ig  = TMath::Min((unsigned int) (u * fNBins), fNBins-1);
+  unsigned int bin = fGuide[ig];
+  while(bin < fNBins-1 && fCDF[bin+1] < u) bin++;
+
+  double dc = fCDF[bin+1] - fCDF[bin];
+  double f  = (dc > 0) ? (u - fCDF[bin]) / dc : 0.;
+  return (bin + TMath::Min(TMath::Max(f, 0.), 1.)) * fBinWidth;
+}
+//____________________________________________________________________________
@@ -0,0 +1,74 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NucleonMomentumCDF
+
+\brief    Tabulated nucleon momentum distribution dP/dp over [0,pmax], made
+          of nbins equal bins with a constant density within each bin (the
+          same model as a TH1D sampled with GetRandom()), and its cumulative
+          distribution.
+
+          The cumulative distribution is inverted in O(1) (expected) time
+          using a guide table: for each of nbins equal intervals of u, the
+          first bin whose cumulative exceeds the interval's lower edge, so
+          that at most a couple of bins have to be scanned.
+          Objects are immutable once built and can be shared among threads.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NUCLEON_MOMENTUM_CDF_H_
+#define _NUCLEON_MOMENTUM_CDF_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class NucleonMomentumCDF {
+
+public:
+  //! Build from the (unnormalized, non-negative) density at the centre of
+  //! each of the density.size() bins spanning [0,pmax]
+  NucleonMomentumCDF(const vector<double> & density, double pmax);
+ ~NucleonMomentumCDF();
+
+  unsigned int NBins    (void) const { return fNBins;    }
+  double       PMax     (void) const { return fPMax;     }
+  double       BinWidth (void) const { return fBinWidth; }
+
+  //! Normalized probability density dP/dp at p (0 outside [0,pmax])
+  double Density (double p) const;
+
+  //! Probability for the momentum to be within the bin containing p
+  double BinProb (double p) const;
+
+  //! Same as BinProb() for n momenta p[i], stored in prob[i]
+  void   BinProb (unsigned int n, const double * p, double * prob) const;
+
+  //! Momentum at which the cumulative distribution equals u in [0,1]
+  double InverseCDF (double u) const;
+
+private:
+
+  int Bin (double p) const;
+
+  unsigned int         fNBins;
+  double               fPMax;
+  double               fBinWidth;
+  vector<double>       fDensity;  ///< normalized dP/dp in each bin
+  vector<double>       fCDF;      ///< cumulative at bin edges (nbins+1)
+  vector<unsigned int> fGuide;    ///< first bin with fCDF[bin+1] > i/nbins
+};
+
+}      // genie namespace
+
+#endif // _NUCLEON_MOMENTUM_CDF_H_
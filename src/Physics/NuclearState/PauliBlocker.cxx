@@ -88,21 +88,14 @@ void PauliBlocker::ProcessEventRecord(GHepRecord * evrec) const
   int nuc_pdgc = recoil  -> Pdg();
   
   // get the Fermi momentum
-  double kf;
-  if(fLFG){
-    int nucleon_pdgc = hit->Pdg();
-    assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
-    Target* tgt = interaction->InitStatePtr()->TgtPtr();
-    int A = tgt->A();
-    bool is_p = pdg::IsProton(nucleon_pdgc);
-    double numNuc = (is_p) ? (double)tgt->Z():(double)tgt->N();
-    double radius = hit->X4()->Vect().Mag();
-    double hbarc = kLightSpeed*kPlankConstant/units::fermi;
-    kf= TMath::Power(3*kPi2*numNuc*
-		     genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
-  }else{
-    kf = fKFTable->FindClosestKF(tgt_pdgc, nuc_pdgc);
-  }
+  // (at the hit nucleon position for a local Fermi gas)
+  int nucleon_pdgc = hit->Pdg();
+  assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
+  const Target & tgt = interaction->InitState().Tgt();
+  double radius = hit->X4()->Vect().Mag();
+  double kf = (fPauliBlocking.LFG) ?
+     utils::nuclear::FermiMomentum(fPauliBlocking, tgt, nucleon_pdgc, radius) :
+     fPauliBlocking.KFTable->FindClosestKF(tgt_pdgc, nuc_pdgc);
   LOG("PauliBlock", pINFO) << "KF = " << kf;
   
   // get the recoil momentum
@@ -151,28 +144,10 @@ void PauliBlocker::Configure(string param_set)
 }
 //___________________________________________________________________________
 void PauliBlocker::LoadModelType(void){
-  AlgConfigPool * confp = AlgConfigPool::Instance();
-  const Registry * gc = confp->GlobalParameterList();
-  
-  // Create a nuclear model object to check the model type
-  RgKey nuclkey = "NuclearModel";
-  RgAlg nuclalg = gc->GetAlg(nuclkey);
-  AlgFactory * algf = AlgFactory::Instance();
-  const NuclearModelI* nuclModel = 
-    dynamic_cast<const NuclearModelI*>(
-			     algf->GetAlgorithm(nuclalg.name,nuclalg.config));
-  // Check if the model is a local Fermi gas
-  fLFG = (nuclModel && nuclModel->ModelType(Target()) == kNucmLocalFermiGas);
-  
-  if(!fLFG){
-    // get the Fermi momentum table for relativistic Fermi gas
-	GetParam( "FermiMomentumTable", fKFTableName ) ;
+  // get the Fermi momentum table for relativistic Fermi gas
+  GetParam( "FermiMomentumTable", fKFTableName ) ;
 
-    fKFTable = 0;
-    
-    FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-    fKFTable = kftp->GetTable(fKFTableName);
-    assert(fKFTable);
-  }
+  // resolve the nuclear model type & the Fermi momentum table once
+  fPauliBlocking = utils::nuclear::LoadPauliBlockingContext(fKFTableName);
 }
 //___________________________________________________________________________
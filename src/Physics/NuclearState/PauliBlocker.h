@@ -27,11 +27,10 @@
 #define _PAULI_BLOCKER_H_
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Physics/NuclearState/NuclearUtils.h"
 
 namespace genie {
 
-class FermiMomentumTable;
-
 class PauliBlocker : public EventRecordVisitorI {
 
 public :
@@ -50,8 +49,7 @@ public :
 private:
    void LoadModelType(void);
 
-   bool fLFG;
-   const FermiMomentumTable * fKFTable;
+   utils::nuclear::PauliBlockingContext fPauliBlocking; ///< resolved nuclear model type & kF table
    string fKFTableName;
 };
 
@@ -12,12 +12,18 @@
  Important revisions after version 2.0.0 :
  @ May 01, 2012 - CA
    Pick spectral function data from $GENIE/data/evgen/nucl/spectral_functions
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Generate nucleons by inverting the CDFs of the bilinearly interpolated
+   (k,w) grid, rather than by accept/reject over a TGraph2D interpolation
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <set>
+
+#include <TMath.h>
 #include <TSystem.h>
 #include <TNtupleD.h>
-#include <TGraph2D.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
@@ -31,102 +37,147 @@ using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  // Fraction x in [0,1] of an interval over which a density varies linearly
+  // from f0 to f1, such that the integral over [0,x] is the fraction v of
+  // the integral over the whole interval
+  double LinearInverseCDF(double f0, double f1, double v)
+  {
+    f0 = TMath::Max(f0, 0.);
+    f1 = TMath::Max(f1, 0.);
+    if(TMath::Abs(f1-f0) <= 1E-9*(f0+f1) || f0+f1 <= 0.) return v;
+    double x = (TMath::Sqrt((1.-v)*f0*f0 + v*f1*f1) - f0) / (f1 - f0);
+    return TMath::Range(0., 1., x);
+  }
+
+}
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc() :
 NuclearModelI("genie::SpectralFunc")
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+
 }
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc(string config) :
 NuclearModelI("genie::SpectralFunc", config)
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+
 }
 //____________________________________________________________________________
 SpectralFunc::~SpectralFunc()
 {
-//if (fSfFe56) delete fSfFe56;
-//if (fSfC12 ) delete fSfC12;
+
 }
 //____________________________________________________________________________
 bool SpectralFunc::GenerateNucleon(const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  RandomGen * rnd = RandomGen::Instance();
 
-  if(!sf) {
-    fCurrRemovalEnergy = 0.;
-    fCurrMomentum.SetXYZ(0.,0.,0.);
-    return false;
-  }
+  double u[kNDimUnitCube];
+  for(unsigned int i = 0; i < kNDimUnitCube; i++) u[i] = rnd->RndGen().Rndm();
 
-  double kmin    = sf->GetXmin(); // momentum range
-  double kmax    = sf->GetXmax();
-  double wmin    = sf->GetYmin(); // removal energy range
-  double wmax    = sf->GetYmax();
-  double probmax = sf->GetZmax(); // maximum probability
-  probmax *= 1.1;
+  return this->GenerateNucleonFromUnitCube(target, 0., u);
+}
+//____________________________________________________________________________
+bool SpectralFunc::GenerateNucleonFromUnitCube(
+       const Target & target, double hitNucleonRadius, const double * u) const
+{
+  return this->SampleCurrentNucleon(target, hitNucleonRadius, u);
+}
+//____________________________________________________________________________
+bool SpectralFunc::SampleNucleon(
+       const Target & target, double /*hitNucleonRadius*/, const double * u,
+       double * p3, double & removalEnergy,
+       FermiMoverInteractionType_t & type) const
+{
+  const SFGrid * sf = this->SelectSpectralFunction(target);
 
-  double dk = kmax - kmin;
-  double dw = wmax - wmin;
+  p3[0] = p3[1] = p3[2] = 0.;
+  removalEnergy = 0.;
+  type          = kFermiMoveDefault;
 
-  LOG("SpectralFunc", pINFO) << "Momentum range = ["   << kmin << ", " << kmax << "]"; 
-  LOG("SpectralFunc", pINFO) << "Rmv energy range = [" << wmin << ", " << wmax << "]";
+  if(!sf || sf->cumk.size() < 2 || sf->cumk.back() <= 0.) return false;
 
-  RandomGen * rnd = RandomGen::Instance();
+  unsigned int nk = sf->k.size();
+  unsigned int nw = sf->w.size();
 
-  unsigned int niter = 0;
-  while(1) {
-    if(niter > kRjMaxIterations) {
-       LOG("SpectralFunc", pWARN) 
-           << "Couldn't generate a hit nucleon after " << niter << " iterations";
-       return false;
-    }
-    niter++;
-
-    // random pair
-    double kc = kmin + dk * rnd->RndGen().Rndm();
-    double wc = wmin + dw * rnd->RndGen().Rndm();
-    LOG("SpectralFunc", pINFO) << "Trying p = " << kc << ", w = " << wc;
-
-    // accept/reject
-    double prob  = this->Prob(kc,wc, target);
-    double probg = probmax * rnd->RndGen().Rndm();
-    bool accept = (probg < prob);
-    if(!accept) continue;
-
-    LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
-    LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
-
-    // generate momentum components
-    double costheta = -1. + 2. * rnd->RndGen().Rndm();
-    double sintheta = TMath::Sqrt(1.-costheta*costheta);
-    double fi       = 2 * kPi * rnd->RndGen().Rndm();
-    double cosfi    = TMath::Cos(fi);
-    double sinfi    = TMath::Sin(fi);
-
-    double kx = kc*sintheta*cosfi;
-    double ky = kc*sintheta*sinfi;
-    double kz = kc*costheta;
-
-    // set generated values
-    fCurrRemovalEnergy = wc;
-    fCurrMomentum.SetXYZ(kx,ky,kz);
-
-    return true;
+  // momentum: invert the marginal CDF. Within a k interval the marginal is
+  // linear between the integrals over w at the two nodes
+  double ck = u[0] * sf->cumk.back();
+  unsigned int ik = std::upper_bound(sf->cumk.begin(), sf->cumk.end(), ck)
+                    - sf->cumk.begin();
+  ik = TMath::Min(TMath::Max(ik, 1u), nk-1) - 1;
+
+  const double * cumw0 = &sf->cumw[ ik   *nw];
+  const double * cumw1 = &sf->cumw[(ik+1)*nw];
+
+  double dck = sf->cumk[ik+1] - sf->cumk[ik];
+  double vk  = (dck > 0.) ? (ck - sf->cumk[ik]) / dck : 0.;
+  double t   = LinearInverseCDF(cumw0[nw-1], cumw1[nw-1], vk);
+  double kc  = sf->k[ik] + t * (sf->k[ik+1] - sf->k[ik]);
+
+  // removal energy: invert the conditional CDF at kc, which interpolates
+  // linearly between the cumulatives at the two k nodes
+  double cwmax = (1.-t)*cumw0[nw-1] + t*cumw1[nw-1];
+  double cw    = u[3] * cwmax;
+  unsigned int lo = 0, hi = nw-1;
+  while(hi - lo > 1) {
+    unsigned int mid = (lo + hi) / 2;
+    if((1.-t)*cumw0[mid] + t*cumw1[mid] <= cw) lo = mid;
+    else                                       hi = mid;
   }
-  return false;
+  unsigned int iw = lo;
+  double cwlo = (1.-t)*cumw0[iw]   + t*cumw1[iw];
+  double cwhi = (1.-t)*cumw0[iw+1] + t*cumw1[iw+1];
+  double f0   = (1.-t)*sf->prob[ik*nw + iw  ] + t*sf->prob[(ik+1)*nw + iw  ];
+  double f1   = (1.-t)*sf->prob[ik*nw + iw+1] + t*sf->prob[(ik+1)*nw + iw+1];
+  double vw   = (cwhi > cwlo) ? (cw - cwlo) / (cwhi - cwlo) : 0.;
+  double s    = LinearInverseCDF(f0, f1, vw);
+  double wc   = sf->w[iw] + s * (sf->w[iw+1] - sf->w[iw]);
+
+  LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
+  LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
+
+  // return generated values
+  MomentumFromUnitCube(kc, u[1], u[2], p3);
+  removalEnergy = wc;
+
+  return true;
 }
 //____________________________________________________________________________
 double SpectralFunc::Prob(
                          double p, double w, const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  const SFGrid * sf = this->SelectSpectralFunction(target);
   if(!sf) return 0;
 
-  return sf->Interpolate(p,w);
+  return this->Interpolate(*sf, p, w);
+}
+//____________________________________________________________________________
+double SpectralFunc::Interpolate(const SFGrid & sf, double k, double w) const
+{
+// Bilinear interpolation of k^2*P(k,w); 0 outside the grid
+
+  unsigned int nk = sf.k.size();
+  unsigned int nw = sf.w.size();
+  if(nk < 2 || nw < 2) return 0;
+  if(k < sf.k.front() || k > sf.k.back()) return 0;
+  if(w < sf.w.front() || w > sf.w.back()) return 0;
+
+  unsigned int ik = std::upper_bound(sf.k.begin(), sf.k.end(), k) - sf.k.begin();
+  unsigned int iw = std::upper_bound(sf.w.begin(), sf.w.end(), w) - sf.w.begin();
+  ik = TMath::Min(TMath::Max(ik, 1u), nk-1) - 1;
+  iw = TMath::Min(TMath::Max(iw, 1u), nw-1) - 1;
+
+  double tk = (k - sf.k[ik]) / (sf.k[ik+1] - sf.k[ik]);
+  double tw = (w - sf.w[iw]) / (sf.w[iw+1] - sf.w[iw]);
+
+  return (1.-tk)*(1.-tw) * sf.prob[ ik   *nw + iw  ] +
+         (1.-tk)*    tw  * sf.prob[ ik   *nw + iw+1] +
+             tk *(1.-tw) * sf.prob[(ik+1)*nw + iw  ] +
+             tk *    tw  * sf.prob[(ik+1)*nw + iw+1];
 }
 //____________________________________________________________________________
 void SpectralFunc::Configure(const Registry & config)
@@ -160,20 +211,24 @@ void SpectralFunc::LoadConfig(void)
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_fe56.GetEntries() << " Fe56 points";
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_c12.GetEntries()  << " C12 points";
 
-  if (fSfFe56) delete fSfFe56;
-  if (fSfC12 ) delete fSfC12;
-
-  fSfFe56 = this->Convert2Graph(sfdata_fe56);
-  fSfC12  = this->Convert2Graph(sfdata_c12);
-
-  fSfFe56->SetName("sf_fe56");
-  fSfC12 ->SetName("sf_c12");
+  if(!this->Convert2Grid(sfdata_fe56, fSfFe56)) {
+    LOG("SpectralFunc", pERROR) << "Invalid Fe56 spectral function in " << fe56file;
+  }
+  if(!this->Convert2Grid(sfdata_c12, fSfC12)) {
+    LOG("SpectralFunc", pERROR) << "Invalid C12 spectral function in " << c12file;
+  }
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
+bool SpectralFunc::Convert2Grid(TNtupleD & sfdata, SFGrid & grid) const
 {
+  grid.k.clear();
+  grid.w.clear();
+  grid.prob.clear();
+  grid.cumw.clear();
+  grid.cumk.clear();
+
   int np = sfdata.GetEntries();
-  TGraph2D * sfgraph = new TGraph2D(np);
+  if(np == 0) return false;
 
   sfdata.Draw("k:e:prob","","GOFF");
   assert(np==sfdata.GetSelectedRows());
@@ -181,28 +236,69 @@ TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
   double * e = sfdata.GetV2();
   double * p = sfdata.GetV3();
 
+  // the data are given on a regular grid: find its nodes
+  std::set<double> kset, wset;
+  for(int i=0; i<np; i++) {
+    kset.insert(k[i] * (units::MeV/units::GeV));
+    wset.insert(e[i] * (units::MeV/units::GeV));
+  }
+  grid.k.assign(kset.begin(), kset.end());
+  grid.w.assign(wset.begin(), wset.end());
+  unsigned int nk = grid.k.size();
+  unsigned int nw = grid.w.size();
+  if(nk < 2 || nw < 2 || (unsigned int) np != nk*nw) {
+    LOG("SpectralFunc", pERROR)
+      << "The " << np << " spectral function points do not fill a "
+      << nk << " x " << nw << " (k,w) grid";
+    grid.k.clear();
+    grid.w.clear();
+    return false;
+  }
+
+  grid.prob.assign(nk*nw, 0.);
   for(int i=0; i<np; i++) {
     double ki = k[i] * (units::MeV/units::GeV); // momentum
     double ei = e[i] * (units::MeV/units::GeV); // removal energy
     double pi = p[i] * TMath::Power(ki,2);      // probabillity
-    sfgraph->SetPoint(i, ki,ei,pi);
+    unsigned int ik = std::lower_bound(grid.k.begin(), grid.k.end(), ki) - grid.k.begin();
+    unsigned int iw = std::lower_bound(grid.w.begin(), grid.w.end(), ei) - grid.w.begin();
+    grid.prob[ik*nw + iw] = TMath::Max(pi, 0.);
+  }
+
+  // cumulative distributions of the bilinear interpolation
+  grid.cumw.assign(nk*nw, 0.);
+  for(unsigned int ik = 0; ik < nk; ik++) {
+    for(unsigned int iw = 1; iw < nw; iw++) {
+      double dw = grid.w[iw] - grid.w[iw-1];
+      grid.cumw[ik*nw + iw] = grid.cumw[ik*nw + iw-1] +
+         0.5 * dw * (grid.prob[ik*nw + iw-1] + grid.prob[ik*nw + iw]);
+    }
+  }
+  grid.cumk.assign(nk, 0.);
+  for(unsigned int ik = 1; ik < nk; ik++) {
+    double dk = grid.k[ik] - grid.k[ik-1];
+    grid.cumk[ik] = grid.cumk[ik-1] +
+         0.5 * dk * (grid.cumw[(ik-1)*nw + nw-1] + grid.cumw[ik*nw + nw-1]);
   }
-  return sfgraph;
+
+  return true;
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::SelectSpectralFunction(const Target & t) const
+const SpectralFunc::SFGrid * SpectralFunc::SelectSpectralFunction(
+                                                     const Target & t) const
 {
-  TGraph2D * sf = 0;
+  const SFGrid * sf = 0;
   int pdgc = t.Pdg();
 
-  if      (pdgc == kPdgTgtC12)  sf = fSfC12;
-  else if (pdgc == kPdgTgtFe56) sf = fSfFe56;
+  if      (pdgc == kPdgTgtC12)  sf = &fSfC12;
+  else if (pdgc == kPdgTgtFe56) sf = &fSfFe56;
   else {
     LOG("SpectralFunc", pERROR) 
      << "** The spectral function for target " << pdgc << " isn't available";
   }
-  if(!sf) {
+  if(sf && sf->k.empty()) {
     LOG("SpectralFunc", pERROR) << "** Null spectral function";
+    sf = 0;
   }
   return sf;
 }
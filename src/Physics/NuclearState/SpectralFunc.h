@@ -6,6 +6,12 @@
 \brief    A realistic spectral function - based nuclear model.
           Is a concrete implementation of the NuclearModelI interface.
 
+          The spectral function data, given on a regular (k,w) grid, are
+          interpolated bilinearly. At load time they are converted into
+          cumulative distributions (the marginal in k and, at every k node,
+          the cumulative in w) so that a nucleon is generated by inverting
+          them directly, without any accept/reject.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,10 +27,13 @@
 #ifndef _SPECTRAL_FUNCTION_H_
 #define _SPECTRAL_FUNCTION_H_
 
+#include <vector>
+
 #include "Physics/NuclearState/NuclearModelI.h"
 
 class TNtupleD;
-class TGraph2D;
+
+using std::vector;
 
 namespace genie {
 
@@ -40,6 +49,11 @@ public:
 
   //-- implement the NuclearModelI interface
   bool           GenerateNucleon (const Target & t) const;
+  bool           GenerateNucleonFromUnitCube (const Target & t,
+                          double hitNucleonRadius, const double * u) const;
+  bool           SampleNucleon   (const Target & t, double hitNucleonRadius,
+                          const double * u, double * p3, double & removalEnergy,
+                          FermiMoverInteractionType_t & type) const;
   double         Prob            (double p, double w, const Target & t) const;
   NuclearModel_t ModelType       (const Target &) const 
   {
@@ -52,12 +66,22 @@ public:
   void Configure (string config);
 
 private:
-  void       LoadConfig             (void);
-  TGraph2D * Convert2Graph          (TNtupleD & data) const;
-  TGraph2D * SelectSpectralFunction (const Target & target) const; 
-
-  TGraph2D * fSfFe56;   ///< Benhar's Fe56 SF
-  TGraph2D * fSfC12;    ///< Benhar's C12 SF
+  //! Spectral function k^2*P(k,w) on a regular grid and its CDFs
+  struct SFGrid {
+    vector<double> k;     ///< momentum nodes
+    vector<double> w;     ///< removal energy nodes
+    vector<double> prob;  ///< k^2*P(k,w) at [ik][iw]
+    vector<double> cumw;  ///< integral over [w0,w(iw)] at k(ik), [ik][iw]
+    vector<double> cumk;  ///< integral over [k0,k(ik)] x [w0,wmax]
+  };
+
+  void           LoadConfig             (void);
+  bool           Convert2Grid           (TNtupleD & data, SFGrid & grid) const;
+  double         Interpolate            (const SFGrid & grid, double k, double w) const;
+  const SFGrid * SelectSpectralFunction (const Target & target) const; 
+
+  SFGrid fSfFe56;   ///< Benhar's Fe56 SF
+  SFGrid fSfC12;    ///< Benhar's C12 SF
 };
 
 }      // genie namespace
@@ -10,11 +10,15 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Sample the momentum by inverting the CDF of the tabulated SF(k), instead
+   of accept/reject, and implement GenerateNucleonFromUnitCube() and the
+   stateless SampleNucleon()
 */
 //____________________________________________________________________________
 
 #include <sstream>
+#include <vector>
 
 #include <TSystem.h>
 
@@ -23,6 +27,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Physics/NuclearState/SpectralFunc1d.h"
+#include "Physics/NuclearState/NucleonMomentumCDF.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -30,6 +35,7 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 using namespace genie::constants;
@@ -57,74 +63,55 @@ SpectralFunc1d::~SpectralFunc1d()
 bool SpectralFunc1d::GenerateNucleon(const Target & target) const
 {
   RandomGen * rnd = RandomGen::Instance();
+
+  double u[kNDimUnitCube];
+  for(unsigned int i = 0; i < kNDimUnitCube; i++) u[i] = rnd->RndGen().Rndm();
+
+  return this->GenerateNucleonFromUnitCube(target, 0., u);
+}
+//____________________________________________________________________________
+bool SpectralFunc1d::GenerateNucleonFromUnitCube(const Target & target,
+                          double hitNucleonRadius, const double * u) const
+{
+  return this->SampleCurrentNucleon(target, hitNucleonRadius, u);
+}
+//____________________________________________________________________________
+bool SpectralFunc1d::SampleNucleon(const Target & target,
+                          double /*hitNucleonRadius*/, const double * u,
+                          double * p3, double & removalEnergy,
+                          FermiMoverInteractionType_t & type) const
+{
   int Z = target.Z();
 
-  map<int, double>::const_iterator  dbl_it;
-  map<int, Spline*>::const_iterator spl_it;
+  p3[0] = p3[1] = p3[2] = 0.;
+  removalEnergy = 0.;
+  type          = kFermiMoveDefault;
 
   // Select fermi momentum from the integrated (over removal energies) s/f.
   //
-  spl_it = fSFk.find(Z);
-  dbl_it = fMaxProb.find(Z);
-  if(spl_it == fSFk.end() || dbl_it == fMaxProb.end()) {
-    fCurrRemovalEnergy = 0.;
-    fCurrMomentum.SetXYZ(0.,0.,0.);
-    return false;
-  }
-
-  double prob_max = dbl_it->second;
-  LOG("SpectralFunc1", pDEBUG) << "Max probability = " << prob_max;
-
-  double p = 0;
-  unsigned int niter = 0;
-  while(1) {
-    if(niter > kRjMaxIterations) {
-       LOG("SpectralFunc1", pWARN)
-        << "Couldn't generate a hit nucleon after " << niter << " iterations";
-       return false;
-    }
-    niter++;
-
-    if(fUseRFGMomentumCutoff) p = fPCutOff * rnd->RndGen().Rndm();
-    else p = rnd->RndGen().Rndm();
-
-    double prob  = spl_it->second->Evaluate(p);
-    double probg = prob_max * rnd->RndGen().Rndm();
-    LOG("SpectralFunc1", pDEBUG) << "Trying p = " << p << " / prob = " << prob;
+  map<int, NucleonMomentumCDF*>::const_iterator cdf_it = fSFkCDF.find(Z);
+  if(cdf_it == fSFkCDF.end()) return false;
 
-    bool accept = (probg<prob);
-    if(accept) break;
-  }
+  double p = cdf_it->second->InverseCDF(u[0]);
 
   LOG("SpectralFunc1", pINFO) << "|p,nucleon| = " << p;
 
-  double costheta = -1. + 2. * rnd->RndGen().Rndm();
-  double sintheta = TMath::Sqrt(1.-costheta*costheta);
-  double fi       = 2 * kPi * rnd->RndGen().Rndm();
-  double cosfi    = TMath::Cos(fi);
-  double sinfi    = TMath::Sin(fi);
-
-  double px = p*sintheta*cosfi;
-  double py = p*sintheta*sinfi;
-  double pz = p*costheta;
-
-  fCurrMomentum.SetXYZ(px,py,pz);
+  MomentumFromUnitCube(p, u[1], u[2], p3);
 
   // Set removal energy
   // Do it either in the same way as in the FG model or by using the average
   // removal energy for the seleced pF as calculated from the s/f itself
   //
   if(fUseRFGRemovalE) {
-    dbl_it = fNucRmvE.find(Z);
-    if(dbl_it != fNucRmvE.end()) fCurrRemovalEnergy = dbl_it->second;
-    else fCurrRemovalEnergy = nuclear::BindEnergyPerNucleon(target);
+    map<int, double>::const_iterator dbl_it = fNucRmvE.find(Z);
+    if(dbl_it != fNucRmvE.end()) removalEnergy = dbl_it->second;
+    else removalEnergy = nuclear::BindEnergyPerNucleon(target);
   } else {
-    spl_it = fSFw.find(Z);
+    map<int, Spline*>::const_iterator spl_it = fSFw.find(Z);
     if(spl_it==fSFw.end()) {
-       fCurrRemovalEnergy = 0.;
-       fCurrMomentum.SetXYZ(0.,0.,0.);
+       p3[0] = p3[1] = p3[2] = 0.;
        return false;
-    } else fCurrRemovalEnergy = spl_it->second->Evaluate(p);
+    } else removalEnergy = spl_it->second->Evaluate(p);
   }
 
   return true;
@@ -184,22 +171,6 @@ void SpectralFunc1d::LoadConfig(void)
   spl = new Spline(fe56_sf1dw_file);
   fSFw.insert(map<int, Spline*>::value_type(26,spl));
 
-  // scan for max.
-  map<int, Spline*>::const_iterator spliter;
-  int    n    = 100;
-  double pmin =  0.000;
-  double dp   =  0.010;
-  for(spliter = fSFk.begin(); spliter != fSFk.end(); ++spliter) {
-    double prob_max = 0;
-    int Z = spliter->first;
-    spl = spliter->second;
-    for(int i=0; i<n; i++) {
-       double p = pmin + i*dp;
-       prob_max = TMath::Max(prob_max, spl->Evaluate(p));
-    }
-    fMaxProb.insert(map<int,double>::value_type(Z,prob_max));
-  }
-
   // Check whether to use the same removal energies as in the FG model or
   // to use the average removal energy for the selected fermi momentum
   // (computed from the spectral function itself)
@@ -211,6 +182,22 @@ void SpectralFunc1d::LoadConfig(void)
   //Get the momentum cutoff
   GetParam( "RFG-MomentumCutOff", fPCutOff ) ;
 
+  // Tabulate SF(k) in 1 MeV bins, up to the cutoff if used or 1 GeV,
+  // for sampling by inverse transform
+  double pmax   = (fUseRFGMomentumCutoff) ? fPCutOff : 1.;
+  int    npbins = TMath::Max(1, (int) (1000*pmax));
+  map<int, Spline*>::const_iterator spliter;
+  for(spliter = fSFk.begin(); spliter != fSFk.end(); ++spliter) {
+    spl = spliter->second;
+    vector<double> density(npbins);
+    for(int i=0; i<npbins; i++) {
+       double p = (i + 0.5) * pmax / npbins;
+       density[i] = TMath::Max(0., spl->Evaluate(p));
+    }
+    fSFkCDF.insert(map<int, NucleonMomentumCDF*>::value_type(
+                     spliter->first, new NucleonMomentumCDF(density, pmax)));
+  }
+
   // Removal energies as used in the FG model
   // Load removal energy for specific nuclei from either the algorithm's
   // configuration file or the UserPhysicsOptions file.
@@ -244,10 +231,14 @@ void SpectralFunc1d::CleanUp(void)
     Spline * spl = spliter->second;
     if(spl) delete spl;
   }
+  map<int, NucleonMomentumCDF*>::iterator cdfiter;
+  for(cdfiter = fSFkCDF.begin(); cdfiter != fSFkCDF.end(); ++cdfiter) {
+    delete cdfiter->second;
+  }
   fSFk.clear();
   fSFw.clear();
   fNucRmvE.clear();
-  fMaxProb.clear();
+  fSFkCDF.clear();
 }
 //____________________________________________________________________________
 
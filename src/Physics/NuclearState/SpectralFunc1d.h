@@ -32,6 +32,7 @@ using std::map;
 namespace genie {
 
 class Spline;
+class NucleonMomentumCDF;
 class SpectralFunc1d : public NuclearModelI {
 
 public:
@@ -49,6 +50,11 @@ public:
   {
     return kNucmFermiGas; /// is not really a spectral func model, just a FG model with different momentum distribution
   }
+  bool           GenerateNucleonFromUnitCube (const Target & t,
+                          double hitNucleonRadius, const double * u) const;
+  bool           SampleNucleon   (const Target & t, double hitNucleonRadius,
+                          const double * u, double * p3, double & removalEnergy,
+                          FermiMoverInteractionType_t & type) const;
 
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
@@ -68,7 +74,7 @@ private:
   map<int, Spline *> fSFk;     ///< All available spectral funcs integrated over removal energy
   map<int, Spline *> fSFw;     ///< Average nucleon removal as a function of pF - computed from the spectral function
   map<int, double>   fNucRmvE; ///< Removal energies as used in FG model
-  map<int, double>   fMaxProb; ///< Max SF(k) probability used in rejection method
+  map<int, NucleonMomentumCDF *> fSFkCDF; ///< Tabulated SF(k) and its CDF, used for sampling
 };
 
 }         // genie namespace
@@ -22,6 +22,9 @@
    dipole form from the dsigma/dQ2 p.d.f.
  @ 2015 - AF
    New QELEventgenerator class replaces previous methods in QEL.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The binding energy of the current event is kept in per-thread scratch
+   state.
 */
 //____________________________________________________________________________
 
@@ -48,6 +51,7 @@
 #include "Physics/QuasiElastic/EventGen/QELEventGenerator.h"
 
 #include "Physics/NuclearState/NuclearModelI.h"
+#include "Physics/NuclearState/NuclearModelSampler.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/PrintUtils.h"
@@ -57,22 +61,45 @@ using namespace genie::controls;
 using namespace genie::constants;
 using namespace genie::utils;
 
+//___________________________________________________________________________
+namespace {
+
+  // Per-thread state of QELEventGenerator
+  class QELScratch : public KineGeneratorScratch {
+  public:
+    QELScratch() : Eb(0) {}
+    double Eb; ///< binding energy of the current event
+  };
+}
+
 //___________________________________________________________________________
 QELEventGenerator::QELEventGenerator() :
-    KineGeneratorWithCache("genie::QELEventGenerator")
+    KineGeneratorWithCache("genie::QELEventGenerator"),
+    fNuclSampler(0)
 {
 
 }
 //___________________________________________________________________________
 QELEventGenerator::QELEventGenerator(string config) :
-    KineGeneratorWithCache("genie::QELEventGenerator", config)
+    KineGeneratorWithCache("genie::QELEventGenerator", config),
+    fNuclSampler(0)
 {
 
 }
 //___________________________________________________________________________
 QELEventGenerator::~QELEventGenerator()
 {
-
+    if(fNuclSampler) delete fNuclSampler;
+}
+//___________________________________________________________________________
+double & QELEventGenerator::Eb(void) const
+{
+  return static_cast<QELScratch *>(this->Scratch())->Eb;
+}
+//___________________________________________________________________________
+AlgScratchI * QELEventGenerator::NewScratch(void) const
+{
+  return new QELScratch;
 }
 //___________________________________________________________________________
 void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -85,7 +112,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     // Access cross section algorithm for running thread
     RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
     const EventGeneratorI * evg = rtinfo->RunningThread();
-    fXSecModel = evg->CrossSectionAlg();
+    this->SetXSecModel(evg->CrossSectionAlg());
 
     // Get the interaction and check we are working with a nuclear target
     Interaction * interaction = evrec->Summary();
@@ -379,7 +406,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
             TLorentzVector p4ptr = interaction->InitStatePtr()->TgtPtr()->HitNucP4();
             LOG("QELEvent",pNOTICE) << "pn: " << p4ptr.X() << ", " <<p4ptr.Y() << ", " <<p4ptr.Z() << ", " <<p4ptr.E();
             nucleon->SetMomentum(p4ptr);
-            nucleon->SetRemovalEnergy(fEb);
+            nucleon->SetRemovalEnergy(this->Eb());
 
             // add a recoiled nucleus remnant
             this->AddTargetNucleusRemnant(evrec);
@@ -507,6 +534,19 @@ void QELEventGenerator::LoadConfig(void)
     //  fQ2max   = -1;
     GetParamDef( "SF-MinAngleEMscattering", fMinAngleEM, 0. ) ;
 
+    // Number of nucleons thrown, and how they are sampled, when looking for
+    // the highest momentum & lowest removal energy in ComputeMaxXSec().
+    // This is an extreme value search: fewer throws find a lower momentum
+    // and underestimate the max xsec, whatever the sampling method
+    GetParamDef( "MaxXSec-NumOfNucleonThrows", fNumOfNucleonThrows, 800 ) ;
+    if(fNumOfNucleonThrows < 1) fNumOfNucleonThrows = 1;
+    string sampling ;
+    GetParamDef( "MaxXSec-NucleonSampling", sampling, string("PseudoRandom") ) ;
+    NucleonSampling_t method = NuclearModelSampler::MethodFromString(sampling);
+    assert(method != kNSmpUndefined);
+    if(fNuclSampler) delete fNuclSampler;
+    fNuclSampler = new NuclearModelSampler(fNuclModel, method);
+
 }
 //____________________________________________________________________________
 double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
@@ -522,31 +562,16 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
 
     double xsec_max = -1;
 
-    const int nnucthrows = 800;
     double min_energy   = 9E9;
     double max_momentum = -9E9;
-    // Loop over tthrown nucleons
-    // We'll select the max momentum and the minimum binding energy
-    // Which should give us the nucleon with the highest xsec
-    for(int inuc = 0; inuc <nnucthrows; inuc++) {
-
-        Interaction * interaction = new Interaction(*in);
-        interaction->SetBit(kISkipProcessChk);
-        interaction->SetBit(kISkipKinematicChk);
-        interaction->SetBit(kIAssumeFreeNucleon);
-
-        // Access the target from the interaction summary
-        Target * tgt = interaction->InitState().TgtPtr();
-        //        TLorentzVector * p4 = tgt->HitNucP4Ptr();
-
-        // First, throw Fermi momentum & removal energy from the nuclear model pdfs
-        // Use r=0. as the radius, since this method should give the max xsec
-        // for all possible kinematics
-        fNuclModel->GenerateNucleon(*tgt,0.0);
-
-        min_energy   = std::min(min_energy  ,fNuclModel->RemovalEnergy());
-        max_momentum = std::max(max_momentum,fNuclModel->Momentum());
-        delete interaction;
+    // Throw nucleons and select the max momentum and the minimum binding
+    // energy, which should give us the nucleon with the highest xsec.
+    // Use r=0. as the radius, since this method should give the max xsec
+    // for all possible kinematics
+    fNuclSampler->Generate(in->InitState().Tgt(), fNumOfNucleonThrows, 0.0);
+    for(unsigned int inuc = 0; inuc < fNuclSampler->NNucleons(); inuc++) {
+        min_energy   = std::min(min_energy  ,fNuclSampler->RemovalEnergy(inuc));
+        max_momentum = std::max(max_momentum,fNuclSampler->Momentum3(inuc).Mag());
     } // nucl throws
 
     { // Just a scoping block for now
@@ -638,7 +663,7 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     SLOG("QELEvent", pDEBUG) << interaction->AsString();
     SLOG("QELEvent", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-    SLOG("QELEvent", pDEBUG) << "Computed using alg = " << *fXSecModel;
+    SLOG("QELEvent", pDEBUG) << "Computed using alg = " << *this->XSecModel();
 #endif
 
     LOG("QELEvent", pINFO) << "Computed maximum cross section to throw against - value is " << xsec_max;
@@ -714,7 +739,7 @@ double QELEventGenerator::ComputeXSec( Interaction * interaction, double costhet
     p4->SetPz( p3.Pz()    );
     p4->SetE ( EN_offshell );
 
-    fEb = EN_onshell - EN_offshell;
+    this->Eb() = EN_onshell - EN_offshell;
 
     double s = interaction->InitState().CMEnergy(); // actually sqrt(s)
     s *= s; // now s actually = s
@@ -791,7 +816,7 @@ double QELEventGenerator::ComputeXSec( Interaction * interaction, double costhet
 
     // Compute the QE cross section for the current kinematics ("~" variables)
     interaction->InitStatePtr()->TgtPtr()->HitNucP4Ptr()->SetE(EN_onshell);
-    xsec = fXSecModel->XSec(interaction, kPSTnctnBnctl); //
+    xsec = this->XSecModel()->XSec(interaction, kPSTnctnBnctl); //
 
     interaction->InitStatePtr()->TgtPtr()->HitNucP4Ptr()->SetE(EN_offshell);
 
@@ -802,7 +827,7 @@ double QELEventGenerator::ComputeXSec( Interaction * interaction, double costhet
     xsec *= jac;
 
     //// BEGIN DEBUG
-    //double debug_xsec = fXSecModel->XSec(interaction, kPSQELEvGen);
+    //double debug_xsec = this->XSecModel()->XSec(interaction, kPSQELEvGen);
     //std::cout << "\nDEBUG: xsec = " << xsec << ", debug_xsec = " << debug_xsec
     //  << " xsec / debug_xsec = " << xsec / debug_xsec << '\n';
     //// END DEBUG
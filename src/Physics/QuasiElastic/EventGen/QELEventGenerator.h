@@ -30,6 +30,8 @@
 
 namespace genie {
 
+class NuclearModelSampler;
+
 class QELEventGenerator: public KineGeneratorWithCache {
 
 public :
@@ -53,7 +55,9 @@ private:
   double COMJacobian(TLorentzVector lepton, TLorentzVector leptonCOM, TLorentzVector outNucleon, TVector3 beta) const;
   
   // unused // double fQ2min;
-  mutable double fEb; // Binding energy
+  // binding energy of the current event, kept per thread (see AlgScratchI)
+  double &      Eb         (void) const;
+  AlgScratchI * NewScratch (void) const;
 
   void   LoadConfig     (void);
   double  ComputeMaxXSec(const Interaction * in) const;
@@ -62,6 +66,8 @@ private:
 
 
   const NuclearModelI *  fNuclModel;   ///< nuclear model
+  NuclearModelSampler *  fNuclSampler; ///< nucleon sampler used in ComputeMaxXSec()
+  int fNumOfNucleonThrows;             ///< number of nucleons thrown in ComputeMaxXSec()
   
   //mutable double fQ2min;
   //mutable double fQ2max;
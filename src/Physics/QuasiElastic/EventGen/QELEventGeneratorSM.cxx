@@ -16,6 +16,12 @@
           University of Liverpool & STFC Rutherford Appleton Lab
 
  For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The Smith-Moniz utilities are kept in per-thread scratch state (see
+   AlgScratchI), each thread using its own copy of the SmithMonizUtils
+   sub-algorithm. The phase space of the current event is a local variable.
 */
 //____________________________________________________________________________
 
@@ -52,16 +58,27 @@ using namespace genie::utils;
 
 namespace { // anonymous namespace (file only visibility)
   const double eps = std::numeric_limits<double>::epsilon();
+
+  // Per-thread state of QELEventGeneratorSM
+  class QELSMScratch : public KineGeneratorScratch {
+  public:
+    QELSMScratch() : Source(0), SMUtils(0) {}
+   ~QELSMScratch() { if(SMUtils) delete SMUtils; }
+    const SmithMonizUtils * Source;  ///< sub-algorithm SMUtils was copied from
+    SmithMonizUtils *       SMUtils; ///< this thread's copy, set to the current interaction
+  };
 }
 //___________________________________________________________________________
 QELEventGeneratorSM::QELEventGeneratorSM() :
-KineGeneratorWithCache("genie::QELEventGeneratorSM")
+KineGeneratorWithCache("genie::QELEventGeneratorSM"),
+fSMUtils(0)
 {
 
 }
 //___________________________________________________________________________
 QELEventGeneratorSM::QELEventGeneratorSM(string config) :
-KineGeneratorWithCache("genie::QELEventGeneratorSM", config)
+KineGeneratorWithCache("genie::QELEventGeneratorSM", config),
+fSMUtils(0)
 {
 
 }
@@ -69,6 +86,28 @@ KineGeneratorWithCache("genie::QELEventGeneratorSM", config)
 QELEventGeneratorSM::~QELEventGeneratorSM()
 {
 
+}
+//___________________________________________________________________________
+SmithMonizUtils * QELEventGeneratorSM::SMUtils(void) const
+{
+// The SmithMonizUtils sub-algorithm keeps the interaction it was set to, so
+// each thread uses its own copy (made again if the sub-algorithm changes)
+
+  QELSMScratch * scratch = static_cast<QELSMScratch *>(this->Scratch());
+  if(scratch->Source != fSMUtils) {
+    if(scratch->SMUtils) delete scratch->SMUtils;
+    scratch->SMUtils = dynamic_cast<SmithMonizUtils *> (
+        AlgFactory::Instance()->AdoptAlgorithm(fSMUtils->Id()));
+    assert(scratch->SMUtils);
+    scratch->SMUtils->Configure(fSMUtils->GetConfig());
+    scratch->Source = fSMUtils;
+  }
+  return scratch->SMUtils;
+}
+//___________________________________________________________________________
+AlgScratchI * QELEventGeneratorSM::NewScratch(void) const
+{
+  return new QELSMScratch;
 }
 //___________________________________________________________________________
 void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
@@ -103,14 +142,15 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
   // Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   // heavy nucleus is nucleus that heavier than hydrogen and deuterium
   bool isHeavyNucleus = tgt->A()>=3;
 
+  SmithMonizUtils * sm_utils = this->SMUtils();
   sm_utils->SetInteraction(interaction);
   // phase space for heavy nucleus is different from light one
-  fkps = isHeavyNucleus?kPSQ2vfE:kPSQ2fE;
+  KinePhaseSpace_t kps = isHeavyNucleus?kPSQ2vfE:kPSQ2fE;
   Range1D_t rQ2 = sm_utils->Q2QES_SM_lim();
   // Try to calculate the maximum cross-section in kinematical limits
   // if not pre-computed already
@@ -167,7 +207,7 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
          Kinematics * kinematics = interaction->KinePtr();
          kinematics->SetKV(kKVQ2, gQ2);
          kinematics->SetKV(kKVv, v);
-         xsec = fXSecModel->XSec(interaction, fkps);
+         xsec = this->XSecModel()->XSec(interaction, kps);
 
           //-- Decide whether to accept the current kinematics
          if(!fGenerateUniformly) {
@@ -279,9 +319,9 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
   interaction->KinePtr()->ClearRunningValues();
 
   // set the cross section for the selected kinematics
-  evrec->SetDiffXSec(xsec,fkps);
+  evrec->SetDiffXSec(xsec,kps);
   if(fGenerateUniformly) {
-          double vol     = sm_utils->PhaseSpaceVolume(fkps);
+          double vol     = sm_utils->PhaseSpaceVolume(kps);
           double totxsec = evrec->XSec();
           double wght    = (vol/totxsec)*xsec;
           LOG("QELEvent", pNOTICE)  << "Kinematics wght = "<< wght;
@@ -428,11 +468,17 @@ void QELEventGeneratorSM::LoadConfig(void)
   //   an event weight?
   GetParamDef( "IsNucleonInNucleus", fGenerateNucleonInNucleus, true);
 
-  sm_utils = const_cast<genie::SmithMonizUtils *>(dynamic_cast<const genie::SmithMonizUtils *>( this -> SubAlg("sm_utils_algo") ) ) ;
+  fSMUtils = dynamic_cast<const genie::SmithMonizUtils *>( this -> SubAlg("sm_utils_algo") ) ;
+  assert(fSMUtils);
 }
 //____________________________________________________________________________
 double QELEventGeneratorSM::ComputeMaxXSec(const Interaction * interaction) const
 {
+        // set the Smith-Moniz utilities & phase space for the input interaction
+        // (not only at event generation, see CreateMaxXSecSpline())
+        SmithMonizUtils * sm_utils = this->SMUtils();
+        sm_utils->SetInteraction(interaction);
+        KinePhaseSpace_t kps = (interaction->InitState().Tgt().A()>=3) ? kPSQ2vfE : kPSQ2fE;
         double xsec_max = -1;
         const int N_Q2 = 8;
         const int N_v = 8;
@@ -456,7 +502,7 @@ double QELEventGeneratorSM::ComputeMaxXSec(const Interaction * interaction) cons
                    kinematics->SetKV(kKVQ2, Q2);
                    kinematics->SetKV(kKVv, v);
                    // Compute the QE cross section for the current kinematics
-                   double xs = fXSecModel->XSec(interaction, fkps);
+                   double xs = this->XSecModel()->XSec(interaction, kps);
                    if (xs > tmp_xsec_max)
                           tmp_xsec_max = xs;
                 } // Done with v scan
@@ -473,6 +519,11 @@ double QELEventGeneratorSM::ComputeMaxXSec(const Interaction * interaction) cons
 //___________________________________________________________________________
 double QELEventGeneratorSM::ComputeMaxXSec2(const Interaction * interaction) const
 {
+        // set the Smith-Moniz utilities & phase space for the input interaction
+        // (not only at event generation, see CreateMaxXSecSpline())
+        SmithMonizUtils * sm_utils = this->SMUtils();
+        sm_utils->SetInteraction(interaction);
+        KinePhaseSpace_t kps = (interaction->InitState().Tgt().A()>=3) ? kPSQ2vfE : kPSQ2fE;
         double xsec_max = -1;
         const int N_Q2 = 8;
         const int N_v = 8;
@@ -497,7 +548,7 @@ double QELEventGeneratorSM::ComputeMaxXSec2(const Interaction * interaction) con
                    kinematics->SetKV(kKVQ2, Q2);
                    kinematics->SetKV(kKVv, v);
                    // Compute the QE cross section for the current kinematics
-                   double xs = fXSecModel->XSec(interaction, fkps);
+                   double xs = this->XSecModel()->XSec(interaction, kps);
                    if (xs > tmp_xsec_max)
                           tmp_xsec_max = xs;
                 } // Done with v scan
@@ -568,7 +619,9 @@ double QELEventGeneratorSM::FindMaxXSec2(
      return -1.;
   }
 
-  // access the the cache branch
+  // access the the cache branch (filled at event generation time, so it is
+  // read under the cache lock)
+  CacheLock lock;
   CacheBranchFx * cb = this->AccessCacheBranch2(interaction);
 
   // if there are enough points stored in the cache buffer to build a
@@ -603,6 +656,7 @@ void QELEventGeneratorSM::CacheMaxXSec2(
 {
   LOG("Kinematics", pINFO)
                        << "Adding the computed max{dxsec/dK} value to cache";
+  CacheLock lock;
   CacheBranchFx * cb = this->AccessCacheBranch2(interaction);
 
   double E = this->Energy(interaction);
@@ -625,6 +679,7 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranch2(
 // Returns the cache branch for this algorithm and this interaction. If no
 // branch is found then one is created.
 
+  CacheLock lock;
   Cache * cache = Cache::Instance();
 
   // build the cache branch key as: namespace::algorithm/config/interaction
@@ -649,6 +704,7 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranch2(
 //___________________________________________________________________________
 double QELEventGeneratorSM::ComputeMaxDiffv(const Interaction * /* interaction */) const
 {
+        SmithMonizUtils * sm_utils = this->SMUtils();
         double max_diffv = -1;
         const int N_Q2 = 10;
 
@@ -721,7 +777,9 @@ double QELEventGeneratorSM::FindMaxDiffv(
      return -1.;
   }
 
-  // access the the cache branch
+  // access the the cache branch (filled at event generation time, so it is
+  // read under the cache lock)
+  CacheLock lock;
   CacheBranchFx * cb = this->AccessCacheBranchDiffv(interaction);
 
   // if there are enough points stored in the cache buffer to build a
@@ -756,6 +814,7 @@ void QELEventGeneratorSM::CacheMaxDiffv(
 {
   LOG("Kinematics", pINFO)
                        << "Adding the computed max{vmax(Q2)-vmin(Q2)} value to cache";
+  CacheLock lock;
   CacheBranchFx * cb = this->AccessCacheBranchDiffv(interaction);
 
   double E = this->Energy(interaction);
@@ -778,6 +837,7 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranchDiffv(
 // Returns the cache branch for this algorithm and this interaction. If no
 // branch is found then one is created.
 
+  CacheLock lock;
   Cache * cache = Cache::Instance();
 
   // build the cache branch key as: namespace::algorithm/config/interaction
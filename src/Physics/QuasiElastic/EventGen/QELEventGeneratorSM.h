@@ -58,7 +58,10 @@ public :
 
 private:
 
-  mutable SmithMonizUtils * sm_utils;
+  // Smith-Moniz utilities set to the current interaction: kept per thread
+  // (see AlgScratchI), each thread having its own copy of the sub-algorithm
+  SmithMonizUtils * SMUtils    (void) const;
+  AlgScratchI *     NewScratch (void) const;
 
   void   LoadConfig     (void);
   double ComputeMaxXSec(const Interaction * in) const;
@@ -76,8 +79,7 @@ private:
   void   CacheMaxDiffv   (const Interaction * in, double xsec) const;
   CacheBranchFx * AccessCacheBranchDiffv (const Interaction * in) const;
 
-  mutable KinePhaseSpace_t fkps;
-
+  const SmithMonizUtils * fSMUtils;         ///< configured Smith-Moniz utilities, copied by each thread
   bool fGenerateNucleonInNucleus;           ///< generate struck nucleon in nucleus
   double fQ2Min;                            ///< Q2-threshold for seeking the second maximum
 
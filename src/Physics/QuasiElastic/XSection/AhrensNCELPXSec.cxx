@@ -121,7 +121,7 @@ double AhrensNCELPXSec::XSec(
 
   //-- compute nuclear suppression factor
   //   (R(Q2) is adapted from NeuGEN - see comments therein)
-  double R = nuclear::NuclQELXSecSuppression("Default", 0.5, interaction);
+  double R = nuclear::NuclQELXSecSuppression(fPauliBlocking, interaction);
 
   //-- number of scattering centers in the target
   int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N();
@@ -161,6 +161,9 @@ void AhrensNCELPXSec::Configure(string config)
 //____________________________________________________________________________
 void AhrensNCELPXSec::LoadConfig(void)
 {
+  // Fermi momenta used for the nuclear suppression factor
+  fPauliBlocking = nuclear::LoadPauliBlockingContext("Default", 0.5);
+
   // alpha and gamma
   double thw ;
   GetParam( "WeinbergAngle", thw ) ;
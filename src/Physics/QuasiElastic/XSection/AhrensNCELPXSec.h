@@ -24,6 +24,7 @@
 #define _AHRENS_NCEL_CROSS_SECTION_H_
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Physics/NuclearState/NuclearUtils.h"
 
 namespace genie {
 
@@ -59,6 +60,7 @@ private:
   double fMv2;
   double fMuP;
   double fMuN;
+  utils::nuclear::PauliBlockingContext fPauliBlocking; ///< settings of the nuclear suppression factor
 };
 
 }       // genie namespace
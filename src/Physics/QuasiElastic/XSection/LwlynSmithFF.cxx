@@ -14,6 +14,10 @@
    Renamed LlewellynSmithModel -> LwlynSmithFF
  @ Aug 27, 2013 - AM
    Implemented Axial Form Factor Model structure
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The form factors are computed in local objects (ELFF(), AxFF()) rather
+   than in mutable data members, so that an instance can be used by several
+   event generation threads.
 
 */
 //____________________________________________________________________________
@@ -109,42 +113,42 @@ double LwlynSmithFF::StrangeFA(const Interaction * interaction) const
   else if (pdgc == kPdgLambda)  value =  -1 / kSqrt6 * (1 + 2 * fFDratio);
   else if (pdgc == kPdgSigma0)  value =  +1 * kSqrt2 / 2 * (1 - 2 * fFDratio);
 
-  fAxFF.Calculate(interaction);
-  value *= fAxFF.FA();
+  AxialFormFactor axff = this->AxFF(interaction);
+  value *= axff.FA();
 
   return value;
 }
 //____________________________________________________________________________
 double LwlynSmithFF::F1P(const Interaction * interaction) const
 { 
-  fELFF.Calculate(interaction);
+  ELFormFactors elff = this->ELFF(interaction);
   double t   = this->tau(interaction);
   double T   = 1 / (1 - t);
-  return T * (fELFF.Gep() - t * fELFF.Gmp());
+  return T * (elff.Gep() - t * elff.Gmp());
 }
 //____________________________________________________________________________
 double LwlynSmithFF::F2P(const Interaction * interaction) const
 {
-  fELFF.Calculate(interaction);
+  ELFormFactors elff = this->ELFF(interaction);
   double t   = this->tau(interaction);
   double T   = 1 / (1 - t);
-  return T * (fELFF.Gmp() - fELFF.Gep());
+  return T * (elff.Gmp() - elff.Gep());
 }
 //____________________________________________________________________________
 double LwlynSmithFF::F1N(const Interaction * interaction) const
 {
-  fELFF.Calculate(interaction);
+  ELFormFactors elff = this->ELFF(interaction);
   double t   = this->tau(interaction);
   double T   = 1 / (1 - t);
-  return T * (fELFF.Gen() - t * fELFF.Gmn());
+  return T * (elff.Gen() - t * elff.Gmn());
 }
 //____________________________________________________________________________
 double LwlynSmithFF::F2N(const Interaction * interaction) const
 {
-  fELFF.Calculate(interaction);
+  ELFormFactors elff = this->ELFF(interaction);
   double t   = this->tau(interaction);
   double T   = 1 / (1 - t);
-  return T * (fELFF.Gmn() - fELFF.Gen());
+  return T * (elff.Gmn() - elff.Gen());
 }
 //____________________________________________________________________________
 double LwlynSmithFF::F1V(const Interaction * interaction) const
@@ -171,8 +175,8 @@ double LwlynSmithFF::FA(const Interaction * interaction) const
 {
   //-- compute FA(q2) 
 
-  fAxFF.Calculate(interaction);
-  return fAxFF.FA();
+  AxialFormFactor axff = this->AxFF(interaction);
+  return axff.FA();
 }
 //____________________________________________________________________________
 double LwlynSmithFF::Fp(const Interaction * interaction) const
@@ -228,13 +232,10 @@ void LwlynSmithFF::LoadConfig(void)
     fCleanUpfElFFModel = true;
   }
 
-  fELFF.SetModel(fElFFModel);  
-
   fAxFFModel =
     dynamic_cast<const AxialFormFactorModelI *> (this->SubAlg("AxialFormFactorModel"));
 
   assert(fAxFFModel);
-  fAxFF.SetModel(fAxFFModel);
 
   // anomalous magnetic moments
   GetParam( "AnomMagnMoment-P", fMuP ) ;
@@ -251,6 +252,22 @@ void LwlynSmithFF::LoadConfig(void)
   fFDratio = f/(d+f); 
 }
 //____________________________________________________________________________
+ELFormFactors LwlynSmithFF::ELFF(const Interaction * interaction) const
+{
+  ELFormFactors elff;
+  elff.SetModel(fElFFModel);
+  elff.Calculate(interaction);
+  return elff;
+}
+//____________________________________________________________________________
+AxialFormFactor LwlynSmithFF::AxFF(const Interaction * interaction) const
+{
+  AxialFormFactor axff;
+  axff.SetModel(fAxFFModel);
+  axff.Calculate(interaction);
+  return axff;
+}
+//____________________________________________________________________________
 double LwlynSmithFF::tau(const Interaction * interaction) const
 {
 // computes q^2 / (4 * MNucl^2)
@@ -270,8 +287,8 @@ double LwlynSmithFF::GVE(const Interaction * interaction) const
 {
   //-- compute GVE using CVC
 
-  fELFF.Calculate(interaction);
-  double gve = fELFF.Gep() - fELFF.Gen();
+  ELFormFactors elff = this->ELFF(interaction);
+  double gve = elff.Gep() - elff.Gen();
   return gve;
 }
 //____________________________________________________________________________
@@ -279,8 +296,8 @@ double LwlynSmithFF::GVM(const Interaction * interaction) const
 {
   //-- compute GVM using CVC
 
-  fELFF.Calculate(interaction);
-  double gvm = fELFF.Gmp() - fELFF.Gmn();
+  ELFormFactors elff = this->ELFF(interaction);
+  double gvm = elff.Gmp() - elff.Gmn();
   return gvm;
 }
 //____________________________________________________________________________
@@ -74,13 +74,15 @@ protected:
   virtual double StrangeF1V   (const Interaction * interaction) const;
   virtual double StrangexiF2V (const Interaction * interaction) const;
   virtual double StrangeFA    (const Interaction * interaction) const;
+
+  // the elastic and axial form factors computed by the attached models
+  // (returned by value: the instance is shared by event generation threads)
+  ELFormFactors   ELFF (const Interaction * interaction) const;
+  AxialFormFactor AxFF (const Interaction * interaction) const;
   
   const ELFormFactorsModelI   * fElFFModel;
   const AxialFormFactorModelI * fAxFFModel;
 
-  mutable ELFormFactors   fELFF;
-  mutable AxialFormFactor fAxFF;
-
   double fMuP;
   double fMuN;
   double fSin28w;
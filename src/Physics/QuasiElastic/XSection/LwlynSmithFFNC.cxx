@@ -50,9 +50,9 @@ double LwlynSmithFFNC::F1V(const Interaction * interaction) const
   double F1V_CC = LwlynSmithFF::F1V(interaction);
 
   //-- calculate F1p (see hep-ph/0107261)
-  fELFF.Calculate(interaction);
+  ELFormFactors elff = this->ELFF(interaction);
   double t   = LwlynSmithFF::tau(interaction);
-  double F1p = fELFF.Gep() - t * fELFF.Gmp();
+  double F1p = elff.Gep() - t * elff.Gmp();
 
   //-- calculate F1V-NC
   double F1V_NC = 0.5*F1V_CC - 2*fSin28w*F1p;
@@ -65,8 +65,8 @@ double LwlynSmithFFNC::xiF2V(const Interaction * interaction) const
   double xiF2V_CC = LwlynSmithFF::xiF2V(interaction);
 
   //-- calculate F2p (see hep-ph/0107261)
-  fELFF.Calculate(interaction);
-  double F2p = (fELFF.Gmp() - fELFF.Gep()) / fMuP;
+  ELFormFactors elff = this->ELFF(interaction);
+  double F2p = (elff.Gmp() - elff.Gep()) / fMuP;
 
   //-- calculate xiF2-NC
   double xiF2V_NC = 0.5*xiF2V_CC - 2*fSin28w*(fMuP-1)*F2p;
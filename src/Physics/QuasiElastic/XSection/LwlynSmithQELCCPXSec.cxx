@@ -18,9 +18,14 @@
    momentum, then integrate.
  @ 2015 - AF
    Added FullDifferentialXSec method to work with QELEventGenerator
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The form factors are computed in a local object (FormFactors()), so that
+   an instance can be used by several event generation threads.
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -42,12 +47,14 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::utils;
+using std::vector;
 
 //____________________________________________________________________________
 LwlynSmithQELCCPXSec::LwlynSmithQELCCPXSec() :
@@ -90,57 +97,28 @@ double LwlynSmithQELCCPXSec::XSec(
   const Target & target = init_state.Tgt();
 
   double E  = init_state.ProbeE(kRfHitNucRest);
-  double E2 = TMath::Power(E,2);
   double ml = interaction->FSPrimLepton()->Mass();
   double M  = target.HitNucMass();
   double q2 = kinematics.q2();
 
   // One of the xsec terms changes sign for antineutrinos
   bool is_neutrino = pdg::IsNeutrino(init_state.ProbePdg());
-  int sign = (is_neutrino) ? -1 : 1;
 
   // Calculate the QEL form factors
-  fFormFactors.Calculate(interaction);
-
-  double F1V   = fFormFactors.F1V();
-  double xiF2V = fFormFactors.xiF2V();
-  double FA    = fFormFactors.FA();
-  double Fp    = fFormFactors.Fp();
+  QELFormFactors form_factors = this->FormFactors(interaction);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("LwlynSmith", pDEBUG) << "\n" << fFormFactors;
+  LOG("LwlynSmith", pDEBUG) << "\n" << form_factors;
 #endif
 
-  // Calculate auxiliary parameters
-  double ml2     = TMath::Power(ml,    2);
-  double M2      = TMath::Power(M,     2);
-  double M4      = TMath::Power(M2,    2);
-  double FA2     = TMath::Power(FA,    2);
-  double Fp2     = TMath::Power(Fp,    2);
-  double F1V2    = TMath::Power(F1V,   2);
-  double xiF2V2  = TMath::Power(xiF2V, 2);
-  double Gfactor = M2*kGF2*fCos8c2 / (8*kPi*E2);
-  double s_u     = 4*E*M + q2 - ml2;
-  double q2_M2   = q2/M2;
-
   // Compute free nucleon differential cross section
-  double A = (0.25*(ml2-q2)/M2) * (
-	      (4-q2_M2)*FA2 - (4+q2_M2)*F1V2 - q2_M2*xiF2V2*(1+0.25*q2_M2)
-              -4*q2_M2*F1V*xiF2V - (ml2/M2)*(
-               (F1V2+xiF2V2+2*F1V*xiF2V)+(FA2+4*Fp2+4*FA*Fp)+(q2_M2-4)*Fp2));
-  double B = -1 * q2_M2 * FA*(F1V+xiF2V);
-  double C = 0.25*(FA2 + F1V2 - 0.25*q2_M2*xiF2V2);
-
-  double xsec = Gfactor * (A + sign*B*s_u/M2 + C*s_u*s_u/M4);
-
-  // Apply given scaling factor
-  xsec *= fXSecScale;
+  double xsec = this->FreeNucleonXSec(E, ml, M, is_neutrino, q2,
+       form_factors.F1V(), form_factors.xiF2V(),
+       form_factors.FA(),  form_factors.Fp());
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("LwlynSmith", pDEBUG)
      << "dXSec[QEL]/dQ2 [FreeN](E = "<< E << ", Q2 = "<< -q2 << ") = "<< xsec;
-  LOG("LwlynSmith", pDEBUG)
-                 << "A(Q2) = " << A << ", B(Q2) = " << B << ", C(Q2) = " << C;
 #endif
 
   //----- The algorithm computes dxsec/dQ2
@@ -161,7 +139,7 @@ double LwlynSmithQELCCPXSec::XSec(
 
   //----- compute nuclear suppression factor
   //      (R(Q2) is adapted from NeuGEN - see comments therein)
-  double R = nuclear::NuclQELXSecSuppression("Default", 0.5, interaction);
+  double R = nuclear::NuclQELXSecSuppression(fPauliBlocking, interaction);
 
   //----- number of scattering centers in the target
   int nucpdgc = target.HitNucPdg();
@@ -177,6 +155,119 @@ double LwlynSmithQELCCPXSec::XSec(
   return xsec;
 }
 //____________________________________________________________________________
+void LwlynSmithQELCCPXSec::BatchXSec(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    unsigned int npoints, unsigned int nkv, const KineVar_t * kv,
+    const double * kine, double * xsec) const
+{
+// Computes dxsec/dQ2 (transformed to the requested phase space) at a batch of
+// Q2 points. The init-state dependent factors are computed once, the form
+// factors are computed for all points first and then combined in a single
+// arithmetic loop.
+
+  if (kps == kPSTnctnBnctl || kps == kPSQELEvGen) {
+    XSecAlgorithmI::BatchXSec(interaction, kps, npoints, nkv, kv, kine, xsec);
+    return;
+  }
+  if(! this -> ValidProcess(interaction) ) {
+    for(unsigned int i = 0; i < npoints; i++) xsec[i] = 0.;
+    return;
+  }
+
+  Interaction in(*interaction);
+  in.CopyFlags(*interaction);
+  Kinematics * kinematics = in.KinePtr();
+  const InitialState & init_state = in.InitState();
+  const Target & target = init_state.Tgt();
+
+  double E  = init_state.ProbeE(kRfHitNucRest);
+  double ml = in.FSPrimLepton()->Mass();
+  double M  = target.HitNucMass();
+  bool is_neutrino = pdg::IsNeutrino(init_state.ProbePdg());
+
+  bool free_nucleon = in.TestBit(kIAssumeFreeNucleon);
+  int nucpdgc = target.HitNucPdg();
+  int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N();
+
+  // form factors (& whether the kinematics are valid) at each point
+  vector<bool>   valid(npoints, false);
+  vector<double> q2   (npoints, 0.);
+  vector<double> F1V  (npoints, 0.);
+  vector<double> xiF2V(npoints, 0.);
+  vector<double> FA   (npoints, 0.);
+  vector<double> Fp   (npoints, 0.);
+  for(unsigned int i = 0; i < npoints; i++) {
+    for(unsigned int j = 0; j < nkv; j++) {
+      kinematics->SetKV(kv[j], kine[i*nkv + j]);
+    }
+    if(! this -> ValidKinematics(&in) ) continue;
+    valid[i] = true;
+    q2[i]    = kinematics->q2();
+    QELFormFactors form_factors = this->FormFactors(&in);
+    F1V  [i] = form_factors.F1V();
+    xiF2V[i] = form_factors.xiF2V();
+    FA   [i] = form_factors.FA();
+    Fp   [i] = form_factors.Fp();
+  }
+
+  // free nucleon xsec
+  for(unsigned int i = 0; i < npoints; i++) {
+    xsec[i] = this->FreeNucleonXSec(
+       E, ml, M, is_neutrino, q2[i], F1V[i], xiF2V[i], FA[i], Fp[i]);
+  }
+
+  // phase space transformation & nuclear xsec
+  for(unsigned int i = 0; i < npoints; i++) {
+    if(!valid[i]) { xsec[i] = 0.; continue; }
+    if(kps == kPSQ2fE && free_nucleon) continue;
+    for(unsigned int j = 0; j < nkv; j++) {
+      kinematics->SetKV(kv[j], kine[i*nkv + j]);
+    }
+    if(kps != kPSQ2fE) {
+      xsec[i] *= utils::kinematics::Jacobian(&in,kPSQ2fE,kps);
+    }
+    if(free_nucleon) continue;
+    double R = nuclear::NuclQELXSecSuppression(fPauliBlocking, &in);
+    xsec[i] *= (R*NNucl);
+  }
+}
+//____________________________________________________________________________
+double LwlynSmithQELCCPXSec::FreeNucleonXSec(
+    double E, double ml, double M, bool is_neutrino,
+    double q2, double F1V, double xiF2V, double FA, double Fp) const
+{
+  // One of the xsec terms changes sign for antineutrinos
+  int sign = (is_neutrino) ? -1 : 1;
+
+  // Calculate auxiliary parameters
+  double E2      = E*E;
+  double ml2     = ml*ml;
+  double M2      = M*M;
+  double M4      = M2*M2;
+  double FA2     = FA*FA;
+  double Fp2     = Fp*Fp;
+  double F1V2    = F1V*F1V;
+  double xiF2V2  = xiF2V*xiF2V;
+  double Gfactor = M2*kGF2*fCos8c2 / (8*kPi*E2);
+  double s_u     = 4*E*M + q2 - ml2;
+  double q2_M2   = q2/M2;
+
+  // Compute free nucleon differential cross section
+  double A = (0.25*(ml2-q2)/M2) * (
+	      (4-q2_M2)*FA2 - (4+q2_M2)*F1V2 - q2_M2*xiF2V2*(1+0.25*q2_M2)
+              -4*q2_M2*F1V*xiF2V - (ml2/M2)*(
+               (F1V2+xiF2V2+2*F1V*xiF2V)+(FA2+4*Fp2+4*FA*Fp)+(q2_M2-4)*Fp2));
+  double B = -1 * q2_M2 * FA*(F1V+xiF2V);
+  double C = 0.25*(FA2 + F1V2 - 0.25*q2_M2*xiF2V2);
+
+  double xsec = Gfactor * (A + sign*B*s_u/M2 + C*s_u*s_u/M4);
+
+  // Apply given scaling factor
+  xsec *= fXSecScale;
+
+  return xsec;
+}
+//____________________________________________________________________________
 double LwlynSmithQELCCPXSec::FullDifferentialXSec(const Interaction *  interaction)const{
 
   // First we need access to all of the particles in the interaction
@@ -206,12 +297,12 @@ double LwlynSmithQELCCPXSec::FullDifferentialXSec(const Interaction *  interacti
 //  LOG("LwlynSmith",pDEBUG) << "Q2 difference (tilde - not) = " << Q2tilde + qP4.Mag2();
 
   // Calculate the QEL form factors
-  fFormFactors.Calculate(interaction);
+  QELFormFactors form_factors = this->FormFactors(interaction);
 
-  double F1V   = fFormFactors.F1V();
-  double xiF2V = fFormFactors.xiF2V();
-  double FA    = fFormFactors.FA();
-  double Fp    = fFormFactors.Fp();
+  double F1V   = form_factors.F1V();
+  double xiF2V = form_factors.xiF2V();
+  double FA    = form_factors.FA();
+  double Fp    = form_factors.Fp();
 
   double Gfactor = kGF2*fCos8c2 / (8*kPi*kPi*inNucleonMom->E()*neutrinoMom->E()*outNucleonMom.E()*leptonMom.E());
 
@@ -244,7 +335,7 @@ double LwlynSmithQELCCPXSec::FullDifferentialXSec(const Interaction *  interacti
 
   //----- compute nuclear suppression factor
   //      (R(Q2) is adapted from NeuGEN - see comments therein)
-  double R = nuclear::NuclQELXSecSuppression("Default", 0.5, interaction);
+  double R = nuclear::NuclQELXSecSuppression(fPauliBlocking, interaction);
   // LOG("LwlynSmith",pINFO)  << "Nuclear Suppression Factor = " << R;
 
   //----- number of scattering centers in the target
@@ -307,19 +398,27 @@ double LwlynSmithQELCCPXSec::Integral(const Interaction * in) const
     // each nucleon
     VertexGenerator * vg = new VertexGenerator();
     vg->Configure("Default");
+    vector<double> radius(nnuc);
     for(int inuc=0;inuc<nnuc;inuc++){
       // Generate a position in the nucleus
       TVector3 nucpos = vg->GenerateVertex(&in_curr,tgt->A());
-      tgt->SetHitNucPosition(nucpos.Mag());
+      radius[inuc] = nucpos.Mag();
+    }
+
+    // Generate the nucleons in one batch
+    vector<double> p3N(3*nnuc), wN(nnuc);
+    fNuclModel->GenerateNucleons(*tgt, nnuc, RandomGen::Instance()->RndGen(),
+                                 &radius[0], &p3N[0], &wN[0]);
+
+    for(int inuc=0;inuc<nnuc;inuc++){
+      tgt->SetHitNucPosition(radius[inuc]);
 
-      // Generate a nucleon
-      fNuclModel->GenerateNucleon(*tgt, nucpos.Mag());
-      TVector3 p3N = fNuclModel->Momentum3();
-      double   EN  = Mi - TMath::Sqrt(p3N.Mag2() + Mf*Mf);
+      const double * pN = &p3N[3*inuc];
+      double EN  = Mi - TMath::Sqrt(pN[0]*pN[0] + pN[1]*pN[1] + pN[2]*pN[2] + Mf*Mf);
       TLorentzVector* p4N = tgt->HitNucP4Ptr();
-      p4N->SetPx (p3N.Px());
-      p4N->SetPy (p3N.Py());
-      p4N->SetPz (p3N.Pz());
+      p4N->SetPx (pN[0]);
+      p4N->SetPy (pN[1]);
+      p4N->SetPz (pN[2]);
       p4N->SetE  (EN);
 
       double xsec = fXSecIntegrator->Integrate(this,&in_curr);
@@ -368,8 +467,20 @@ void LwlynSmithQELCCPXSec::Configure(string config)
   this->LoadConfig();
 }
 //____________________________________________________________________________
+QELFormFactors LwlynSmithQELCCPXSec::FormFactors(
+                                    const Interaction * interaction) const
+{
+  QELFormFactors form_factors;
+  form_factors.SetModel(fFormFactorsModel);
+  form_factors.Calculate(interaction);
+  return form_factors;
+}
+//____________________________________________________________________________
 void LwlynSmithQELCCPXSec::LoadConfig(void)
 {
+  // Fermi momenta used for the nuclear suppression factor
+  fPauliBlocking = nuclear::LoadPauliBlockingContext("Default", 0.5);
+
   // Cross section scaling factor
   GetParamDef( "QEL-CC-XSecScale", fXSecScale, 1. ) ;
 
@@ -381,7 +492,6 @@ void LwlynSmithQELCCPXSec::LoadConfig(void)
   fFormFactorsModel = dynamic_cast<const QELFormFactorsModelI *> (
                                              this->SubAlg("FormFactorsAlg"));
   assert(fFormFactorsModel);
-  fFormFactors.SetModel(fFormFactorsModel); // <-- attach algorithm
 
    // load XSec Integrator
   fXSecIntegrator =
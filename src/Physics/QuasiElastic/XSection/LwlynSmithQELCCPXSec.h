@@ -25,6 +25,7 @@
 
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 
 namespace genie {
@@ -43,6 +44,10 @@ public:
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral        (const Interaction * i) const;
   bool   ValidProcess    (const Interaction * i) const;
+  void   BatchXSec       (const Interaction * i, KinePhaseSpace_t k,
+                          unsigned int npoints, unsigned int nkv,
+                          const KineVar_t * kv, const double * kine,
+                          double * xsec) const;
 
   // Override the Algorithm::Configure methods to load configuration
   // data to private data members
@@ -52,9 +57,17 @@ public:
 private:
   double FullDifferentialXSec(const Interaction * i) const;
 
+  //! Free nucleon dxsec/dQ2 for the input energy, masses, q2 & form factors
+  double FreeNucleonXSec (double E, double ml, double M, bool is_neutrino,
+                          double q2, double F1V, double xiF2V,
+                          double FA, double Fp) const;
+
   void LoadConfig (void);
 
-  mutable QELFormFactors       fFormFactors;      ///<
+  //! The QEL form factors computed by the attached model (returned by
+  //! value: the instance is shared by event generation threads)
+  QELFormFactors FormFactors (const Interaction * interaction) const;
+
   const QELFormFactorsModelI * fFormFactorsModel; ///<
   const XSecIntegratorI *      fXSecIntegrator;   ///<
   double                       fCos8c2;           ///< cos^2(cabibbo angle)
@@ -67,6 +80,8 @@ private:
   bool   fDoAvgOverNucleonMomentum;    ///< Average cross section over hit nucleon monentum?
   double fEnergyCutOff;                ///< Average only for energies below this cutoff defining
                                        ///< the region where nuclear modeling details do matter
+
+  utils::nuclear::PauliBlockingContext fPauliBlocking; ///< settings of the nuclear suppression factor
 };
 
 }       // genie namespace
@@ -20,6 +20,7 @@
 #include <complex>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactorsModelI.h"
@@ -40,8 +41,10 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Physics/NuclearState/NuclearModelSampler.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/ThreadPool.h"
 #include "Framework/Numerical/GSLUtils.h"
 
 
@@ -49,28 +52,94 @@
 #include <fstream> // Used for testing code
 #include "Physics/NuclearState/NuclearModelI.h"
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+namespace { // anonymous namespace (file only visibility)
+
+  // One item of the nucleon averaging loop in NievesQELCCPXSec::Integral():
+  // Integrates the cross section for a given hit nucleon position & 4-momentum
+  class NievesQELAvgTask : public ParallelTask {
+  public:
+    NievesQELAvgTask(const Interaction * in,
+        const vector<double> & radius, const vector<TLorentzVector> & p4,
+        const vector<const XSecAlgorithmI *> & models,
+        const vector<const XSecIntegratorI *> & integrators, UInt_t seed0) :
+      fRadius(radius), fP4(p4), fModels(models), fIntegrators(integrators),
+      fSeed0(seed0), fXSec(radius.size(), 0.)
+    {
+      for(unsigned int iw = 0; iw < models.size(); iw++) {
+        fInteractions.push_back(new Interaction(*in));
+        fRnd.push_back(new TRandom3(1));
+      }
+    }
+   ~NievesQELAvgTask()
+    {
+      for(unsigned int iw = 0; iw < fInteractions.size(); iw++) {
+        delete fInteractions[iw];
+        delete fRnd[iw];
+      }
+    }
+    void Run(unsigned int worker, unsigned int item)
+    {
+      Interaction * in  = fInteractions[worker];
+      Target *      tgt = in->InitState().TgtPtr();
+      tgt->SetHitNucPosition(fRadius[item]);
+      tgt->SetHitNucP4(fP4[item]);
+
+      UInt_t seed = fSeed0 + item;
+      fRnd[worker]->SetSeed( (seed==0) ? 1 : seed );
+      RandomGen::SetThreadStream(fRnd[worker]);
+      try {
+        fXSec[item] = fIntegrators[worker]->Integrate(fModels[worker], in);
+      }
+      catch(...) {
+        RandomGen::SetThreadStream(0);
+        throw;
+      }
+      RandomGen::SetThreadStream(0);
+    }
+    const vector<double> & XSec(void) const { return fXSec; }
+
+  private:
+    const vector<double> &                  fRadius;
+    const vector<TLorentzVector> &          fP4;
+    const vector<const XSecAlgorithmI *> &  fModels;
+    const vector<const XSecIntegratorI *> & fIntegrators;
+    UInt_t                                  fSeed0;
+    vector<Interaction *>                   fInteractions;
+    vector<TRandom3 *>                      fRnd;
+    vector<double>                          fXSec;
+  };
+
+}
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec() :
-XSecAlgorithmI("genie::NievesQELCCPXSec")
+XSecAlgorithmI("genie::NievesQELCCPXSec"),
+fNuclSampler(0),
+fThreadPool(0)
 {
 
 }
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec(string config) :
-XSecAlgorithmI("genie::NievesQELCCPXSec", config)
+XSecAlgorithmI("genie::NievesQELCCPXSec", config),
+fNuclSampler(0),
+fThreadPool(0)
 {
 
 }
 //____________________________________________________________________________
 NievesQELCCPXSec::~NievesQELCCPXSec()
 {
-
- }
+  this->DeleteWorkers();
+  if(fNuclSampler) delete fNuclSampler;
+}
 //____________________________________________________________________________
 double NievesQELCCPXSec::XSec(const Interaction * interaction,
                        KinePhaseSpace_t kps) const
@@ -295,7 +364,7 @@ double NievesQELCCPXSec::XSec(const Interaction * interaction,
   //----- compute nuclear suppression factor
   //      (R(Q2) is adapted from NeuGEN - see comments therein)
   double R;
-  R = nuclear::NuclQELXSecSuppression("Default", 0.5, interaction);
+  R = nuclear::NuclQELXSecSuppression(fPauliBlocking, interaction);
 
   //----- number of scattering centers in the target
   int nucpdgc = target.HitNucPdg();
@@ -353,41 +422,117 @@ double NievesQELCCPXSec::Integral(const Interaction * in) const
 
     // throw nucleons with fermi momenta and binding energies
     // generated according to the current nuclear model for the
-    // input target and average the cross section
-    double xsec_sum = 0.;
-    const int nnuc = 2000;
-    // VertexGenerator for generating a position before generating
-    // each nucleon
-    VertexGenerator * vg = new VertexGenerator();
-    vg->Configure("Default");
-    for(int inuc=0;inuc<nnuc;inuc++){
-      // Generate a position in the nucleus
-      TVector3 nucpos = vg->GenerateVertex(&in_curr,tgt->A());
-      tgt->SetHitNucPosition(nucpos.Mag());
-
-      // Generate a nucleon
-      fNuclModel->GenerateNucleon(*tgt, nucpos.Mag());
-      TVector3 p3N = fNuclModel->Momentum3();
-      double   EN  = Mi - TMath::Sqrt(p3N.Mag2() + Mf*Mf);
-      TLorentzVector* p4N = tgt->HitNucP4Ptr();
-      p4N->SetPx (p3N.Px());
-      p4N->SetPy (p3N.Py());
-      p4N->SetPz (p3N.Pz());
-      p4N->SetE  (EN);
-
-      double xsec;
-      xsec = fXSecIntegrator->Integrate(this,&in_curr);
-
-      xsec_sum += xsec;
+    // input target. This is done up front, on the calling thread, as
+    // the nuclear model & the vertex generator use the shared random
+    // number generator
+    unsigned int nnuc = fNumOfNucleonThrows;
+    vector<double>         radius(nnuc);
+    vector<TLorentzVector> p4(nnuc);
+    if(fNucleonSampling == kNSmpPseudoRandom) {
+      // Generate positions in the nucleus
+      for(unsigned int inuc=0;inuc<nnuc;inuc++){
+        TVector3 nucpos = fVertexGenerator->GenerateVertex(&in_curr,tgt->A());
+        radius[inuc] = nucpos.Mag();
+      }
+
+      // Generate the nucleons in one batch
+      vector<double> p3N(3*nnuc), wN(nnuc);
+      fNuclModel->GenerateNucleons(*tgt, nnuc, RandomGen::Instance()->RndGen(),
+                                   &radius[0], &p3N[0], &wN[0]);
+      for(unsigned int inuc=0;inuc<nnuc;inuc++){
+        const double * pN = &p3N[3*inuc];
+        double EN = Mi - TMath::Sqrt(pN[0]*pN[0] + pN[1]*pN[1] + pN[2]*pN[2] + Mf*Mf);
+        p4[inuc].SetPxPyPzE(pN[0], pN[1], pN[2], EN);
+      }
+    } else {
+      // Quasi-random or stratified nucleon positions & momenta
+      if(!fNuclSampler) {
+        fNuclSampler = new NuclearModelSampler(fNuclModel, fNucleonSampling, fR0);
+      }
+      fNuclSampler->Generate(*tgt, nnuc);
+      for(unsigned int inuc=0;inuc<nnuc;inuc++){
+        const TVector3 & p3N = fNuclSampler->Momentum3(inuc);
+        double EN = Mi - TMath::Sqrt(p3N.Mag2() + Mf*Mf);
+
+        radius[inuc] = fNuclSampler->Radius(inuc);
+        p4[inuc].SetPxPyPzE(p3N.Px(), p3N.Py(), p3N.Pz(), EN);
+      }
     }
-    double xsec_avg = xsec_sum / nnuc;
-    delete vg;
-    return xsec_avg;
+
+    // and average the cross section
+    return this->AvgIntegralOverNucleons(&in_curr, radius, p4);
   }else{
     return fXSecIntegrator->Integrate(this,in);
   }
 }
 //____________________________________________________________________________
+double NievesQELCCPXSec::AvgIntegralOverNucleons(const Interaction * in,
+      const vector<double> & radius, const vector<TLorentzVector> & p4) const
+{
+  unsigned int nnuc = radius.size();
+  if(nnuc == 0) return 0.;
+
+  if(!fThreadPool) {
+    fThreadPool = new ThreadPool(fNumOfThreads);
+  }
+  unsigned int nworkers = fThreadPool->NWorkers();
+
+  // Each worker needs its own copy of this algorithm (the form factors
+  // and the sub-algorithms keep state while evaluating the cross section).
+  // The calling thread is idle while the pool runs, so a single worker
+  // can simply use this instance.
+  if(nworkers > 1 && fWorkers.empty()) {
+    AlgFactory * algf = AlgFactory::Instance();
+    for(unsigned int iw = 0; iw < nworkers; iw++) {
+      NievesQELCCPXSec * worker =
+         dynamic_cast<NievesQELCCPXSec *> (algf->AdoptAlgorithm(this->Id()));
+      assert(worker);
+      worker->AdoptSubstructure();
+      worker->Configure(this->GetConfig());
+      fWorkers.push_back(worker);
+    }
+  }
+
+  vector<const XSecAlgorithmI *>  models     (nworkers, this);
+  vector<const XSecIntegratorI *> integrators(nworkers, fXSecIntegrator);
+  for(unsigned int iw = 0; iw < fWorkers.size(); iw++) {
+    models     [iw] = fWorkers[iw];
+    integrators[iw] = fWorkers[iw]->fXSecIntegrator;
+  }
+
+  // The cross section evaluation throws random numbers (the outgoing lepton
+  // azimuth), so every nucleon gets its own random number stream seeded
+  // from the shared generator. This keeps the result independent of the
+  // number of workers and of the order in which the items are processed.
+  UInt_t seed0 = RandomGen::Instance()->RndNum().Integer(kMaxUInt);
+
+  // The first nucleon is processed on the calling thread, so that any
+  // algorithm looked-up lazily while computing the cross section is
+  // instantiated before the workers start
+  NievesQELAvgTask task(in, radius, p4, models, integrators, seed0);
+  task.Run(0, 0);
+  fThreadPool->Execute(task, nnuc, 1);
+
+  const vector<double> & xsec = task.XSec();
+  double xsec_sum = 0.;
+  for(unsigned int inuc = 0; inuc < nnuc; inuc++) {
+    xsec_sum += xsec[inuc];
+  }
+  return xsec_sum / nnuc;
+}
+//____________________________________________________________________________
+void NievesQELCCPXSec::DeleteWorkers(void) const
+{
+  if(fThreadPool) {
+    delete fThreadPool;
+    fThreadPool = 0;
+  }
+  for(unsigned int iw = 0; iw < fWorkers.size(); iw++) {
+    delete fWorkers[iw];
+  }
+  fWorkers.clear();
+}
+//____________________________________________________________________________
 bool NievesQELCCPXSec::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
@@ -425,6 +570,9 @@ void NievesQELCCPXSec::Configure(string config)
 //____________________________________________________________________________
 void NievesQELCCPXSec::LoadConfig(void)
 {
+  // Fermi momenta used for the nuclear suppression factor
+  fPauliBlocking = nuclear::LoadPauliBlockingContext("Default", 0.5);
+
   double thc;
   GetParam( "CabibboAngle", thc ) ;
   fCos8c2 = TMath::Power(TMath::Cos(thc), 2);
@@ -489,6 +637,32 @@ void NievesQELCCPXSec::LoadConfig(void)
 
   }
 
+  // Vertex generator & number of threads used for the nucleon averaging
+  fVertexGenerator = 0;
+  if(fDoAvgOverNucleonMomentum) {
+    fVertexGenerator = dynamic_cast<const VertexGenerator *> (
+                               this->SubAlg("IntegralVertexGenerator"));
+    assert(fVertexGenerator);
+  }
+  GetParamDef( "IntegralNumOfThreads", fNumOfThreads, 1 ) ;
+  if(fNumOfThreads < 0) fNumOfThreads = 1;
+
+  // Number of nucleons & method used to sample them in the averaging loop
+  GetParamDef( "IntegralNumOfNucleonThrows", fNumOfNucleonThrows, 2000 ) ;
+  if(fNumOfNucleonThrows < 1) fNumOfNucleonThrows = 1;
+  string sampling ;
+  GetParamDef( "IntegralNucleonSampling", sampling, string("PseudoRandom") ) ;
+  fNucleonSampling = NuclearModelSampler::MethodFromString(sampling);
+  assert(fNucleonSampling != kNSmpUndefined);
+  GetParamDef( "NUCL-R0", fR0, 1.4 ) ; // fm
+  if(fNuclSampler) {
+    delete fNuclSampler;
+    fNuclSampler = 0;
+  }
+
+  // Drop workers cloned from a previous configuration
+  this->DeleteWorkers();
+
   // TESTING CODE
   GetParamDef( "PrintDebugData", fCompareNievesTensors, false ) ;
   // END TESTING CODE
@@ -512,10 +686,10 @@ void NievesQELCCPXSec::CNCTCLimUcalc(TLorentzVector qTildeP4,
 
     //Density gives the nuclear density, normalized to 1
     //Input radius r must be in fm
-    double rhop = nuclear::Density(r,A)*Z;
-    double rhon = nuclear::Density(r,A)*N;
+    double rhop = nuclear::DensityTabulated(r,A)*Z;
+    double rhon = nuclear::DensityTabulated(r,A)*N;
     double rho = rhop + rhon;
-    double rho0 = A*nuclear::Density(0,A);
+    double rho0 = A*nuclear::DensityTabulated(0,A);
 
     double fPrime = (0.33*rho/rho0+0.45*(1-rho/rho0))*c0;
 
@@ -1289,7 +1463,7 @@ unsigned int utils::gsl::wrap::NievesQELvcrIntegrand::NDim(void) const
 //____________________________________________________________________________
 double utils::gsl::wrap::NievesQELvcrIntegrand::DoEval(double rin) const
 {
-  double rhop = fZ*nuclear::Density(rin,fA);
+  double rhop = fZ*nuclear::DensityTabulated(rin,fA);
   if(rin<fRcurr){
     return rhop*rin*rin/fRcurr;
   }else{
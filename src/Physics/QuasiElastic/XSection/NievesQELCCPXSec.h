@@ -24,16 +24,21 @@
 #define _NIEVES_QELCC_CROSS_SECTION_H_
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include <complex>
+#include <vector>
 #include <Math/IFunction.h>
 #include "Physics/NuclearState/NuclearModelI.h"
+#include "Physics/NuclearState/NuclearModelSampler.h"
 
 namespace genie {
 
 class QELFormFactorsModelI;
 class XSecIntegratorI;
+class VertexGenerator;
+class ThreadPool;
 
 class NievesQELCCPXSec : public XSecAlgorithmI {
 
@@ -55,6 +60,14 @@ public:
 private:
   void LoadConfig (void);
 
+  // Integrate the cross section for each of the input hit nucleon positions
+  // and 4-momenta and return the average. Uses fNumOfThreads workers, each
+  // with its own clone of this algorithm and of the input interaction.
+  double AvgIntegralOverNucleons (const Interaction * in,
+                                  const std::vector<double> & radius,
+                                  const std::vector<TLorentzVector> & p4) const;
+  void   DeleteWorkers (void) const;
+
   mutable QELFormFactors       fFormFactors;      ///<
   const QELFormFactorsModelI * fFormFactorsModel; ///<
   const XSecIntegratorI *      fXSecIntegrator;   ///<
@@ -75,9 +88,21 @@ private:
   const FermiMomentumTable *   fKFTable;
   string                       fKFTableName;
 
+  utils::nuclear::PauliBlockingContext fPauliBlocking; ///< settings of the nuclear suppression factor
+
   bool   fDoAvgOverNucleonMomentum;    ///< Average cross section over hit nucleon monentum?
   double fEnergyCutOff;                ///< Average only for energies below this cutoff defining
                                        ///< the region where nuclear modeling details do matter
+  const VertexGenerator * fVertexGenerator; ///< Hit nucleon position generator for Integral()
+  int    fNumOfThreads;                ///< Number of threads used in Integral() (0: one per core)
+  int    fNumOfNucleonThrows;          ///< Number of nucleons averaged over in Integral()
+  NucleonSampling_t fNucleonSampling;  ///< How these nucleons are sampled
+  double fR0;                          ///< Nuclear size parameter (fm), for the nucleon radii
+
+  mutable NuclearModelSampler *       fNuclSampler; ///< Quasi-random/stratified nucleon sampler
+
+  mutable ThreadPool *                fThreadPool; ///< Workers for the nucleon averaging loop
+  mutable std::vector<NievesQELCCPXSec *> fWorkers;   ///< Per-worker clones owning their substructure
 
   //Functions needed to calculate XSec:
 
@@ -88,12 +88,20 @@ double QELXSec::Integrate(
   interaction->SetBit(kISkipProcessChk);
   interaction->SetBit(kISkipKinematicChk);
 
+  double abstol = 0; //We mostly care about relative tolerance
+
+  if(this->UseBatchIntegrator()) {
+    double xsec = this->IntegrateBatch<utils::gsl::dXSec_dQ2_E>(
+        model, interaction, &rQ2.min, &rQ2.max, abstol) * (1E-38 * units::cm2);
+    delete interaction;
+    return xsec;
+  }
+
   ROOT::Math::IBaseFunctionOneDim * func = new 
       utils::gsl::dXSec_dQ2_E(model, interaction);
   ROOT::Math::IntegrationOneDim::Type ig_type = 
       utils::gsl::Integration1DimTypeFromString(fGSLIntgType);
   
-  double abstol = 0; //We mostly care about relative tolerance
   ROOT::Math::Integrator ig(*func,ig_type,abstol,fGSLRelTol,fGSLMaxSizeOfSubintervals, fGSLRule);
   double xsec = ig.Integral(rQ2.min, rQ2.max) * (1E-38 * units::cm2);
      
@@ -129,6 +137,12 @@ void QELXSec::LoadConfig(void)
 	GetParamDef( "gsl-rule", rule, 3);
 	fGSLRule = (unsigned int) rule;
     if (fGSLRule>6) fGSLRule=3;
+	// Used by the batch integrators only
+	int max_eval;
+	GetParamDef( "gsl-max-eval", max_eval, 100000);
+	fGSLMaxEval = (unsigned int) max_eval;
+	GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0);
+	GetParamDef( "batch-warm-start", fBatchWarmStart, true);
 }
 //____________________________________________________________________________
 
@@ -15,6 +15,9 @@
  @ Nov 26, 2009 - CA
    Fix mistake in convertion from dsigma/dOmega --> dsigma/dQ2 uncovered at
    the first comparison against electron QE data.
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The form factors are computed in a local object rather than in a mutable
+   data member, so that an instance can be used by several threads.
 
 */
 //____________________________________________________________________________
@@ -90,9 +93,11 @@ double RosenbluthPXSec::XSec(
   double tan2_halftheta = sin2_halftheta/cos2_halftheta;
 
   // Calculate the elastic nucleon form factors
-  fELFF.Calculate(interaction);
-  double Gm  = pdg::IsProton(nucpdgc) ? fELFF.Gmp() : fELFF.Gmn();
-  double Ge  = pdg::IsProton(nucpdgc) ? fELFF.Gep() : fELFF.Gen();
+  ELFormFactors elff;
+  elff.SetModel(fElFFModel);
+  elff.Calculate(interaction);
+  double Gm  = pdg::IsProton(nucpdgc) ? elff.Gmp() : elff.Gmn();
+  double Ge  = pdg::IsProton(nucpdgc) ? elff.Gep() : elff.Gen();
   double Ge2 = Ge*Ge;
   double Gm2 = Gm*Gm;
 
@@ -134,7 +139,7 @@ double RosenbluthPXSec::XSec(
 
   // Compute & apply nuclear suppression factor
   // (R(Q2) is adapted from NeuGEN - see comments therein)
-  double R = nuclear::NuclQELXSecSuppression("Default", 0.5, interaction);
+  double R = nuclear::NuclQELXSecSuppression(fPauliBlocking, interaction);
   xsec *= R;
 
   return xsec;
@@ -182,6 +187,9 @@ void RosenbluthPXSec::Configure(string config)
 //____________________________________________________________________________
 void RosenbluthPXSec::LoadConfig(void)
 {
+  // Fermi momenta used for the nuclear suppression factor
+  fPauliBlocking = nuclear::LoadPauliBlockingContext("Default", 0.5);
+
   fElFFModel = 0;
 
   // load elastic form factors model
@@ -198,7 +206,6 @@ void RosenbluthPXSec::LoadConfig(void)
     dynamic_cast<const TransverseEnhancementFFModel*>(fElFFModel)->SetElFFBaseModel( sub_alg );
     fCleanUpfElFFModel = true;
   }
-  fELFF.SetModel(fElFFModel);
 
   // load XSec Integrator
   fXSecIntegrator =
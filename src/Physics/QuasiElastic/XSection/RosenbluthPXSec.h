@@ -24,6 +24,7 @@
 #define _ROSENBLUTH_CROSS_SECTION_H_
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/QuasiElastic/XSection/ELFormFactors.h"
 
 namespace genie {
@@ -53,8 +54,8 @@ private:
 
   const   XSecIntegratorI *     fXSecIntegrator;
   const   ELFormFactorsModelI * fElFFModel;
-  mutable ELFormFactors         fELFF;
   bool fCleanUpfElFFModel;
+  utils::nuclear::PauliBlockingContext fPauliBlocking; ///< settings of the nuclear suppression factor
 };
 
 }       // genie namespace
@@ -24,9 +24,14 @@
    is set to the event, set the corresponding KinePhaseSpace_t value too.
  @ Jul 26, 2018 - IL (Afroditi Papadopoulou, Adi Ashkenazi - Massachusetts Institute of Technology)
    Included importance sampling envelop both for neutrino and electron scattering
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The importance sampling envelope is kept in per-thread scratch state, so
+   that one instance can generate kinematics on several threads.
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
 #include <TMath.h>
 #include <TF2.h>
 #include <TROOT.h>
@@ -44,6 +49,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/PiecewiseProposal2D.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/Utils/KineUtils.h"
@@ -53,22 +59,55 @@ using namespace genie;
 using namespace genie::controls;
 using namespace genie::utils;
 
+//___________________________________________________________________________
+namespace {
+
+  // serializes the creation of the envelopes (in ROOT's list of functions)
+  std::mutex gEnvelopeMutex;
+
+  // Per-thread state of RESKinematicsGenerator
+  class RESKineScratch : public KineGeneratorScratch {
+  public:
+    RESKineScratch(TF2 * envelope) : Envelope(envelope) {}
+   ~RESKineScratch() { delete Envelope; }
+    TF2 * Envelope; ///< 2-D envelope used for importance sampling
+  };
+}
+
 //___________________________________________________________________________
 RESKinematicsGenerator::RESKinematicsGenerator() :
 KineGeneratorWithCache("genie::RESKinematicsGenerator")
 {
-  fEnvelope = 0;
+
 }
 //___________________________________________________________________________
 RESKinematicsGenerator::RESKinematicsGenerator(string config) :
 KineGeneratorWithCache("genie::RESKinematicsGenerator", config)
 {
-  fEnvelope = 0;
+
 }
 //___________________________________________________________________________
 RESKinematicsGenerator::~RESKinematicsGenerator()
 {
-  if(fEnvelope) delete fEnvelope;
+
+}
+//___________________________________________________________________________
+AlgScratchI * RESKinematicsGenerator::NewScratch(void) const
+{
+  // envelope employed when importance sampling is used
+  // (initialize with dummy range)
+  std::lock_guard<std::mutex> lock(gEnvelopeMutex);
+  TF2 * envelope = new TF2("res-envelope",
+        kinematics::RESImportanceSamplingEnvelope,0.01,1,0.01,1,4);
+  // stop ROOT from deleting this object of its own volition
+  gROOT->GetListOfFunctions()->Remove(envelope);
+
+  return new RESKineScratch(envelope);
+}
+//___________________________________________________________________________
+TF2 * RESKinematicsGenerator::Envelope(void) const
+{
+  return static_cast<RESKineScratch *>(this->Scratch())->Envelope;
 }
 //___________________________________________________________________________
 void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -84,7 +123,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
 
   //-- Get the interaction from the GHEP record
   Interaction * interaction = evrec->Summary();
@@ -114,17 +153,26 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //  double M = init_state.Tgt().HitNucP4().M();
   //  double ml  = interaction->FSPrimLepton()->Mass();
 
+  //-- If requested, importance sample the kinematics using a proposal
+  //   built over the (W,QD2) range (mapped onto the unit square)
+  PiecewiseProposal2D * proposal = 0;
+  if(fUseImportanceSampling && !fGenerateUniformly) {
+    proposal = this->Proposal(interaction);
+    if(proposal->Integral() <= 0) proposal = 0;
+  }
+
   //-- For the subsequent kinematic selection with the rejection method:
   //   Calculate the max differential cross section or retrieve it from the
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space, or importance sampled, the max xsec is irrelevant
+  double xsec_max = (fGenerateUniformly || proposal) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid W, Q2 pair using the rejection method
   double dW   = W.max - W.min;
   double xsec = -1;
+  TF2 *  envelope = this->Envelope();
 
   unsigned int iter = 0;
   bool accept = false;
@@ -145,7 +193,14 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      double gQ2  = 0; // current momentum transfer
      double gQD2 = 0; // tranformed Q2 to take out dipole form
 
-     if(fGenerateUniformly) {
+     if(proposal) {
+       //-- Importance sampled W,Q2: the trial computes the xsec and decides
+       //   whether to accept the kinematics
+       accept = this->ImportanceSamplingTrial(interaction, proposal, xsec);
+       gW  = interaction->KinePtr()->W();
+       gQ2 = interaction->KinePtr()->Q2();
+     }
+     else if(fGenerateUniformly) {
        //-- Generate a W uniformly in the kinematically allowed range.
        //   For the generated W, compute the Q2 range and generate a value
        //   uniformly over that range
@@ -166,10 +221,6 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
          // first pass, configure the sampling envelope
          if(iter==1) {
             LOG("RESKinematics", pINFO) << "Initializing the sampling envelope";
-            if(!fEnvelope) {
-               LOG("RESKinematics", pFATAL) << "Null sampling envelope!";
-               exit(1);
-            }
             interaction->KinePtr()->SetW(W.min);
             Range1D_t Q2 = kps.Q2Lim_W();
 	    double Q2min  = -99.;
@@ -200,15 +251,15 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
                <<  "(m,g) = (" << mR << ", " << gR
                << "), max(xsec,W) = (" << xsec_max << ", " << W.max << ")";
 #endif
-            fEnvelope->SetRange(QD2min,W.min,QD2max,W.max); // range
-            fEnvelope->SetParameter(0,  mR);                // resonance mass
-            fEnvelope->SetParameter(1,  gR);                // resonance width
-            fEnvelope->SetParameter(2,  xsec_max);          // max differential xsec
-            fEnvelope->SetParameter(3,  W.max);             // kinematically allowed Wmax
+            envelope->SetRange(QD2min,W.min,QD2max,W.max); // range
+            envelope->SetParameter(0,  mR);                // resonance mass
+            envelope->SetParameter(1,  gR);                // resonance width
+            envelope->SetParameter(2,  xsec_max);          // max differential xsec
+            envelope->SetParameter(3,  W.max);             // kinematically allowed Wmax
          }// first pass
 
          // Generate W,QD2 using the 2-D envelope as PDF
-         fEnvelope->GetRandom2(gQD2,gW);
+         envelope->GetRandom2(gQD2,gW);
 
          // QD2 -> Q2
          gQ2 = utils::kinematics::QD2toQ2(gQD2);
@@ -221,10 +272,10 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      interaction->KinePtr()->SetQ2(gQ2);
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+     if(!proposal) xsec = this->XSecModel()->XSec(interaction, kPSWQ2fE);
 
      //-- Decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
+     if(!fGenerateUniformly && !proposal) {
         // > charged lepton scattering
         if(is_em) {
           this->AssertXSecLimits(interaction, xsec, xsec_max);
@@ -234,7 +285,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
       }
         // > neutrino scattering (using importance sampling envelope)
         else {
-          double max = fEnvelope->Eval(gQD2, gW);
+          double max = envelope->Eval(gQD2, gW);
           double t   = max * rnd->RndKine().Rndm();
           double J   = kinematics::Jacobian(interaction,kPSWQ2fE,kPSWQD2fE);
 
@@ -247,7 +298,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
           accept = (t < J*xsec);
         } // charged lepton or neutrino scattering?
      }
-     else {
+     else if(fGenerateUniformly) {
         accept = (xsec>0);
      } // uniformly over phase space
 
@@ -328,13 +379,44 @@ void RESKinematicsGenerator::LoadConfig(void)
   // an event weight?
   this->GetParamDef("UniformOverPhaseSpace", fGenerateUniformly, false);
 
-  // Envelope employed when importance sampling is used
-  // (initialize with dummy range)
-  if(fEnvelope) delete fEnvelope;
-  fEnvelope = new TF2("res-envelope",
-        kinematics::RESImportanceSamplingEnvelope,0.01,1,0.01,1,4);
-  // stop ROOT from deleting this object of its own volition
-  gROOT->GetListOfFunctions()->Remove(fEnvelope);
+  // Importance sampling of (W,QD2) with a piecewise-constant proposal
+  this->LoadImportanceSamplingConfig();
+}
+//____________________________________________________________________________
+double RESKinematicsGenerator::UnitSquareXSec(
+           Interaction * interaction, double u, double v, double * xsec) const
+{
+// Maps (u,v) onto (W,QD2) over the W,QD2 limits of the input interaction,
+// where the dipole form of the Q2 dependence is taken out. Returns the xsec
+// d^2xsec/dWdQD2 (up to the constant Jacobian of the linear map)
+
+  if(xsec) *xsec = 0;
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W = kps.Limits(kKVW);
+  if(W.max <=0 || W.min>=W.max) return 0.;
+
+  interaction->KinePtr()->SetW(W.min);
+  Range1D_t Q2 = kps.Q2Lim_W();
+  double Q2min = (interaction->ProcInfo().IsEM()) ?
+                     Q2.min + kASmallNum : kASmallNum;
+  double Q2max = Q2.max - kASmallNum;
+  double QD2min = utils::kinematics::Q2toQD2(Q2max);
+  double QD2max = utils::kinematics::Q2toQD2(Q2min);
+
+  double gW   = W.min  + u * (W.max  - W.min);
+  double gQD2 = QD2min + v * (QD2max - QD2min);
+  double gQ2  = utils::kinematics::QD2toQ2(gQD2);
+
+  interaction->KinePtr()->SetW(gW);
+  interaction->KinePtr()->SetQ2(gQ2);
+
+  double xs = this->XSecModel()->XSec(interaction, kPSWQ2fE);
+  if(xsec) *xsec = xs;
+  if(xs <= 0) return 0.;
+
+  double J = kinematics::Jacobian(interaction,kPSWQ2fE,kPSWQD2fE);
+  return J*xs;
 }
 //____________________________________________________________________________
 double RESKinematicsGenerator::ComputeMaxXSec(
@@ -392,7 +474,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
     for(int iq2=0; iq2<NQ2; iq2++) {
       double Q2 = TMath::Exp(logQ2min + iq2 * dlogQ2);
       interaction->KinePtr()->SetQ2(Q2);
-      double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+      double xsec = this->XSecModel()->XSec(interaction, kPSWQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("RESKinematics", pDEBUG)
                 << "xsec(W= " << md << ", Q2= " << Q2 << ") = " << xsec;
@@ -410,7 +492,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
 	  Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
           if(Q2 < rQ2.min) continue;
           interaction->KinePtr()->SetQ2(Q2);
-          xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+          xsec = this->XSecModel()->XSec(interaction, kPSWQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
           LOG("RESKinematics", pDEBUG)
                  << "xsec(W= " << md << ", Q2= " << Q2 << ") = " << xsec;
@@ -462,7 +544,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
       for(int iq2=0; iq2<NQ2; iq2++) {
         double Q2 = TMath::Exp(logQ2min + iq2 * dlogQ2);
         interaction->KinePtr()->SetQ2(Q2);
-        double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+        double xsec = this->XSecModel()->XSec(interaction, kPSWQ2fE);
         LOG("RESKinematics", pDEBUG)
                 << "xsec(W= " << W << ", Q2= " << Q2 << ") = " << xsec;
         max_xsec = TMath::Max(xsec, max_xsec);
@@ -478,7 +560,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
 	   Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
            if(Q2 < rQ2.min) continue;
            interaction->KinePtr()->SetQ2(Q2);
-           xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+           xsec = this->XSecModel()->XSec(interaction, kPSWQ2fE);
            LOG("RESKinematics", pDEBUG)
                  << "xsec(W= " << W << ", Q2= " << Q2 << ") = " << xsec;
            max_xsec = TMath::Max(xsec, max_xsec);
@@ -497,7 +579,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("RESKinematics", pDEBUG) << interaction->AsString();
   LOG("RESKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  LOG("RESKinematics", pDEBUG) << "Computed using " << fXSecModel->Id();
+  LOG("RESKinematics", pDEBUG) << "Computed using " << this->XSecModel()->Id();
 #endif
 
   return max_xsec;
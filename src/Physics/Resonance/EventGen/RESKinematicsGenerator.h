@@ -42,11 +42,18 @@ public :
   void Configure(const Registry & config);
   void Configure(string config);
 
+  // importance sampling: (u,v) -> (W,QD2) over the W,QD2 limits of 'in'
+  double UnitSquareXSec(Interaction * in, double u, double v,
+                        double * xsec = 0) const;
+
 private:
-  void   LoadConfig      (void);
-  double ComputeMaxXSec  (const Interaction * interaction) const;
+  void          LoadConfig      (void);
+  double        ComputeMaxXSec  (const Interaction * interaction) const;
+  AlgScratchI * NewScratch      (void) const;
+
+  // the 2-D envelope used for importance sampling, kept per thread
+  TF2 *         Envelope        (void) const;
 
-  mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
   double fWcut;            ///< Wcut parameter in DIS/RES join scheme
 };
 
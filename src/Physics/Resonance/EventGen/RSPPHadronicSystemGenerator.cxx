@@ -15,10 +15,15 @@
    performed further upstream in the processing chain.
  @ Mar 03, 2009 - CA
    Moved into the new RES package from its previous location (EVGModules).
+ @ Oct 17, 2026 - The GENIE Collaboration
+   Use a phase space generator local to each call rather than a mutable
+   data member, so that threads can share the generator.
 
 */
 //____________________________________________________________________________
 
+#include <TGenPhaseSpace.h>
+
 #include "Framework/Conventions/Constants.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepRecord.h"
@@ -104,14 +109,15 @@ void RSPPHadronicSystemGenerator::AddResonanceDecayProducts(
   LOG("RESHadronicVtx", pINFO)
                  << "\n RES 4-P = " << utils::print::P4AsString(p4);
 
-  bool is_permitted = fPhaseSpaceGenerator.SetDecay(*p4, 2, mass);
+  TGenPhaseSpace phase_space_generator;
+  bool is_permitted = phase_space_generator.SetDecay(*p4, 2, mass);
   assert(is_permitted);
 
-  fPhaseSpaceGenerator.Generate();
+  phase_space_generator.Generate();
 
   //-- add the two hadrons at the event record
-  TLorentzVector & p4_nuc = *fPhaseSpaceGenerator.GetDecay(0);
-  TLorentzVector & p4_pi  = *fPhaseSpaceGenerator.GetDecay(1);
+  TLorentzVector & p4_nuc = *phase_space_generator.GetDecay(0);
+  TLorentzVector & p4_pi  = *phase_space_generator.GetDecay(1);
   TLorentzVector vdummy(0,0,0,0); // dummy 'vertex'
 
   // decide the particle status
@@ -24,8 +24,6 @@
 #ifndef _RSPP_HADRONIC_SYSTEM_GENERATOR_H_
 #define _RSPP_HADRONIC_SYSTEM_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
-
 #include "Physics/Common/HadronicSystemGenerator.h"
 
 namespace genie {
@@ -42,8 +40,6 @@ public :
 
 private:
   void AddResonanceDecayProducts (GHepRecord * event_rec) const;
-
-  mutable TGenPhaseSpace fPhaseSpaceGenerator;
 };
 
 }      // genie namespace
@@ -16,10 +16,16 @@
  @ July 4, 2018 - Afroditi Papadopoulou
    For electromagnetic (EM) interactions, the weak g2 was still used for the
    calculation of the helicity amplitude. Fixed by replacing with the correct EM g2
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The FKR parameters are computed in a local object and the helicity
+   amplitude tables are built under a lock, so that an instance can be used
+   by several event generation threads.
 
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
 #include <TMath.h>
 #include <TSystem.h>
 
@@ -43,6 +49,7 @@
 #include "Physics/Resonance/XSection/BSKLNBaseRESPXSec2014.h"
 #include "Physics/Resonance/XSection/RSHelicityAmplModelI.h"
 #include "Physics/Resonance/XSection/RSHelicityAmpl.h"
+#include "Physics/Resonance/XSection/RSHelicityAmplTable.h"
 #include "Physics/NuclearState/FermiMomentumTablePool.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include "Physics/NuclearState/NuclearUtils.h"
@@ -50,6 +57,11 @@
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // guards the lazily filled helicity amplitude tables
+  std::mutex gHAmplTablesMutex;
+}
+
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::BSKLNBaseRESPXSec2014(string name) :
 XSecAlgorithmI(name)
@@ -65,18 +77,52 @@ XSecAlgorithmI(name, config)
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::~BSKLNBaseRESPXSec2014()
 {
-
+  this->DeleteHelicityAmplTables();
 }
 //____________________________________________________________________________
 double BSKLNBaseRESPXSec2014::XSec(
     const Interaction * interaction, KinePhaseSpace_t kps) const
 {
   if(! this -> ValidProcess    (interaction) ) return 0.;
-  if(! this -> ValidKinematics (interaction) ) return 0.;
 
-  const InitialState & init_state = interaction -> InitState();
-  const ProcessInfo &  proc_info  = interaction -> ProcInfo();
-  const Target & target = init_state.Tgt();
+  RESInitStateParams ist;
+  this->InitStateParams(interaction, ist);
+
+  return this->KineXSec(interaction, kps, ist);
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::BatchXSec(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    unsigned int npoints, unsigned int nkv, const KineVar_t * kv,
+    const double * kine, double * xsec) const
+{
+// The init-state & resonance dependent quantities (resonance parameters,
+// helicity amplitude model, Fermi momentum lookup, nutau reduction factor,
+// scaling factors) are computed only once for the whole batch
+
+  bool valid = this->ValidProcess(interaction);
+
+  RESInitStateParams ist;
+  if(valid) this->InitStateParams(interaction, ist);
+
+  Interaction in(*interaction);
+  in.CopyFlags(*interaction);
+  Kinematics * kinematics = in.KinePtr();
+
+  for(unsigned int i = 0; i < npoints; i++) {
+    if(!valid || ist.Zero) { xsec[i] = 0.; continue; }
+    for(unsigned int j = 0; j < nkv; j++) {
+      kinematics->SetKV(kv[j], kine[i*nkv + j]);
+    }
+    xsec[i] = this->KineXSec(&in, kps, ist);
+  }
+}
+//____________________________________________________________________________
+double BSKLNBaseRESPXSec2014::KineXSec(const Interaction * interaction,
+                 KinePhaseSpace_t kps, const RESInitStateParams & ist) const
+{
+  if(ist.Zero) return 0.;
+  if(! this -> ValidKinematics (interaction) ) return 0.;
 
   // Get kinematical parameters
   const Kinematics & kinematics = interaction -> Kine();
@@ -96,38 +142,27 @@ double BSKLNBaseRESPXSec2014::XSec(
     }
   }
 
-  // Get the input baryon resonance
-  Resonance_t resonance = interaction->ExclTag().Resonance();
-  string      resname   = utils::res::AsString(resonance);
-  bool        is_delta  = utils::res::IsDelta (resonance);
-
-  // Get the neutrino, hit nucleon & weak current
-  int  nucpdgc   = target.HitNucPdg();
-  int  probepdgc = init_state.ProbePdg();
-  bool is_nu     = pdg::IsNeutrino         (probepdgc);
-  bool is_nubar  = pdg::IsAntiNeutrino     (probepdgc);
-  bool is_lplus  = pdg::IsPosChargedLepton (probepdgc);
-  bool is_lminus = pdg::IsNegChargedLepton (probepdgc);
-  bool is_p      = pdg::IsProton  (nucpdgc);
-  bool is_n      = pdg::IsNeutron (nucpdgc);
-  bool is_CC     = proc_info.IsWeakCC();
-  bool is_NC     = proc_info.IsWeakNC();
-  bool is_EM     = proc_info.IsEM();
+  // Get the input baryon resonance, neutrino, hit nucleon & weak current
+  bool is_delta  = ist.IsDelta;
+  bool is_nu     = ist.IsNu;
+  bool is_nubar  = ist.IsNuBar;
+  bool is_lplus  = ist.IsLPlus;
+  bool is_lminus = ist.IsLMinus;
+  bool is_p      = ist.IsP;
+  bool is_n      = ist.IsN;
+  bool is_CC     = ist.IsCC;
+  bool is_EM     = ist.IsEM;
 
   //  bool new_GV = fGA; //JN
   //  bool new_GA = fGV; //JN
 
 
-  if(is_CC && !is_delta) {
-    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
-  }
-
   // Get baryon resonance parameters
-  int    IR  = utils::res::ResonanceIndex    (resonance);
-  int    LR  = utils::res::OrbitalAngularMom (resonance);
-  double MR  = utils::res::Mass              (resonance);
-  double WR  = utils::res::Width             (resonance);
-   double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+  int    IR  = ist.IR;
+  int    LR  = ist.LR;
+  double MR  = ist.MR;
+  double WR  = ist.WR;
+  double NR  = ist.NR;
 
   // Following NeuGEN, avoid problems with underlying unphysical
   // model assumptions by restricting the allowed W phase space
@@ -139,8 +174,8 @@ double BSKLNBaseRESPXSec2014::XSec(
   }
 
   // Compute auxiliary & kinematical factors
-  double E      = init_state.ProbeE(kRfHitNucRest);
-  double Mnuc   = target.HitNucMass();
+  double E      = ist.E;
+  double Mnuc   = ist.Mnuc;
   double W2     = TMath::Power(W,    2);
   double Mnuc2  = TMath::Power(Mnuc, 2);
   double k      = 0.5 * (W2 - Mnuc2)/Mnuc;
@@ -168,10 +203,7 @@ double BSKLNBaseRESPXSec2014::XSec(
   double ml    = interaction->FSPrimLepton()->Mass();
   double Pl    = TMath::Sqrt(Eprime*Eprime - ml*ml);
 
-  double vstar = (Mnuc*v + q2)/W;  //missing W
-  double Qstar = TMath::Sqrt(-q2 + vstar*vstar);
   double sqrtq2 = TMath::Sqrt(-q2);
-  double a = 1. + 0.5*(W2-q2+Mnuc2)/Mnuc/W;
 
   double KNL_Alambda_plus  = 0;
   double KNL_Alambda_minus = 0;
@@ -287,142 +319,6 @@ double BSKLNBaseRESPXSec2014::XSec(
     << "Kinematical params V = " << V << ", U = " << U;
 #endif
 
-  // Calculate the Feynman-Kislinger-Ravndall parameters
-
-  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
-  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
-  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
-
-  if(fGV){
-
-    LOG("BSKLNBaseRESPXSec2014",pDEBUG) <<"Using new GV";
-    double CV0 =  1./(1-q2/fMv2/4.);
-    double CV3 =  2.13 * CV0 * TMath::Power( 1-q2/fMv2,-2);
-    double CV4 = -1.51 * CV0 * TMath::Power( 1-q2/fMv2,-2);
-    double CV5 =  0.48 * CV0 * TMath::Power( 1-q2/fMv2/0.766, -2);
-
-    double GV3 =  0.5 / TMath::Sqrt(3) * ( CV3 * (W + Mnuc)/Mnuc
-                  + CV4 * (W2 + q2 -Mnuc2)/2./Mnuc2
-                  + CV5 * (W2 - q2 -Mnuc2)/2./Mnuc2 );
-
-    double GV1 = - 0.5 / TMath::Sqrt(3) * ( CV3 * (Mnuc2 -q2 +Mnuc*W)/W/Mnuc
-                 + CV4 * (W2 +q2 - Mnuc2)/2./Mnuc2
-                 + CV5 * (W2 -q2 - Mnuc2)/2./Mnuc2 );
-
-    GV = 0.5 * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR)
-         * TMath::Sqrt( 3 * GV3*GV3 + GV1*GV1);
-  }
-
-  if(fGA){
-    LOG("BSKLNBaseRESPXSec2014",pDEBUG) << "Using new GA";
-
-    double CA5_0 = 1.2;
-    double CA5 = CA5_0 *  TMath::Power( 1./(1-q2/fMa2), 2);
-    //  GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5/fZeta;
-    GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5;
-
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"GA= " <<GA << "  C5A= " <<CA5;
-  }
-  //JN end of new form factors code
-
-  if(is_EM) {
-    GA = 0.; // zero the axial term for EM scattering
-  }
-
-  double d      = TMath::Power(W+Mnuc,2.) - q2;
-  double sq2omg = TMath::Sqrt(2./fOmega);
-  double nomg   = IR * fOmega;
-  double mq_w   = Mnuc*Q/W;
-
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
-
-  //JN KNL
-  double KNL_S_plus = 0;
-  double KNL_S_minus = 0;
-  double KNL_B_plus = 0;
-  double KNL_B_minus = 0;
-  double KNL_C_plus = 0;
-  double KNL_C_minus = 0;
-
-  if(is_CC && is_KLN){
-    KNL_S_plus  = (KNL_vstar_plus*vstar  - KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2; //possibly missing minus sign ()
-    KNL_S_minus = (KNL_vstar_minus*vstar - KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
-
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
-
-    KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_plus  + KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
-    KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_minus + KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
-
-    KNL_C_plus = ( (KNL_Qstar_plus*Qstar - KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
-
-    KNL_C_minus = ( (KNL_Qstar_minus*Qstar - KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
-
-    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
-  }
-  double BRS_S_plus = 0;
-  double BRS_S_minus = 0;
-  double BRS_B_plus = 0;
-  double BRS_B_minus = 0;
-  double BRS_C_plus = 0;
-  double BRS_C_minus = 0;
-
-
-  if(is_CC && is_BRS){
-
-    KNL_S_plus  = (KNL_vstar_plus*vstar  - KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
-    KNL_S_minus = (KNL_vstar_minus*vstar - KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
-
-
-    KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_plus  + KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
-    KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_minus + KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
-
-
-    KNL_C_plus = ( (KNL_Qstar_plus*Qstar - KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
-
-    KNL_C_minus = ( (KNL_Qstar_minus*Qstar - KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
-
-    BRS_S_plus = KNL_S_plus;
-    BRS_S_minus = KNL_S_minus;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
-
-    BRS_B_plus = KNL_B_plus + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
-      *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
-
-    BRS_B_minus = KNL_B_minus + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
-      *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
-
-    BRS_C_plus = KNL_C_plus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
-      * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
-
-    BRS_C_minus = KNL_C_minus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
-      * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
-  }
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("FKR", pDEBUG)
-    << "FKR params for RES = " << resname << " : " << fFKR;
-#endif
-
   // Calculate the Rein-Sehgal Helicity Amplitudes
   double sigL_minus = 0;
   double sigR_minus = 0;
@@ -432,12 +328,6 @@ double BSKLNBaseRESPXSec2014::XSec(
   double sigR_plus = 0;
   double sigS_plus = 0;
 
-  const RSHelicityAmplModelI * hamplmod = 0;
-  const RSHelicityAmplModelI * hamplmod_KNL_minus = 0;
-  const RSHelicityAmplModelI * hamplmod_KNL_plus = 0;
-  const RSHelicityAmplModelI * hamplmod_BRS_minus = 0;
-  const RSHelicityAmplModelI * hamplmod_BRS_plus = 0;
-
   // These lines were ~ 100 lines below, which means that, for EM interactions, the coefficients below were still calculated using the weak coupling constant - Afro
   double g2 = kGF2;
 
@@ -471,81 +361,23 @@ double BSKLNBaseRESPXSec2014::XSec(
   double sigRSR =0;
   double sigRSS =0;
 
-  if(is_CC && !(is_KLN || is_BRS) ) {
-
-    hamplmod = fHAmplModelCC;
-  }
-  else
-    if(is_NC) {
-      if (is_p) { hamplmod = fHAmplModelNCp;}
-      else      { hamplmod = fHAmplModelNCn;}
-    }
-    else
-      if(is_EM) {
-        if (is_p) { hamplmod = fHAmplModelEMp;}
-        else      { hamplmod = fHAmplModelEMn;}
-      }
-      else
-        if(is_CC && is_KLN ){
-          fFKR.S = KNL_S_minus;        //2 times fFKR.S?
-          fFKR.B = KNL_B_minus;
-          fFKR.C = KNL_C_minus;
-
-          hamplmod_KNL_minus = fHAmplModelCC;
-
-          assert(hamplmod_KNL_minus);
-
-          const RSHelicityAmpl & hampl_KNL_minus = hamplmod_KNL_minus->Compute(resonance, fFKR);
-
-          sigL_minus = (hampl_KNL_minus.Amp2Plus3 () + hampl_KNL_minus.Amp2Plus1 ());
-          sigR_minus = (hampl_KNL_minus.Amp2Minus3() + hampl_KNL_minus.Amp2Minus1());
-          sigS_minus = (hampl_KNL_minus.Amp20Plus () + hampl_KNL_minus.Amp20Minus());
-
-
-          fFKR.S = KNL_S_plus;
-          fFKR.B = KNL_B_plus;
-          fFKR.C = KNL_C_plus;
-          hamplmod_KNL_plus = fHAmplModelCC;
-          assert(hamplmod_KNL_plus);
-
-          const RSHelicityAmpl & hampl_KNL_plus = hamplmod_KNL_plus->Compute(resonance, fFKR);
-
-          sigL_plus = (hampl_KNL_plus.Amp2Plus3 () + hampl_KNL_plus.Amp2Plus1 ());
-          sigR_plus = (hampl_KNL_plus.Amp2Minus3() + hampl_KNL_plus.Amp2Minus1());
-          sigS_plus = (hampl_KNL_plus.Amp20Plus () + hampl_KNL_plus.Amp20Minus());
-
-        }
-        else
-          if(is_CC && is_BRS ){
-            fFKR.S = BRS_S_minus;
-            fFKR.B = BRS_B_minus;
-            fFKR.C = BRS_C_minus;
-
-            hamplmod_BRS_minus = fHAmplModelCC;
-            assert(hamplmod_BRS_minus);
-
-            const RSHelicityAmpl & hampl_BRS_minus = hamplmod_BRS_minus->Compute(resonance, fFKR);
-
-            sigL_minus = (hampl_BRS_minus.Amp2Plus3 () + hampl_BRS_minus.Amp2Plus1 ());
-            sigR_minus = (hampl_BRS_minus.Amp2Minus3() + hampl_BRS_minus.Amp2Minus1());
-            sigS_minus = (hampl_BRS_minus.Amp20Plus () + hampl_BRS_minus.Amp20Minus());
-
-            fFKR.S = BRS_S_plus;
-            fFKR.B = BRS_B_plus;
-            fFKR.C = BRS_C_plus;
-            hamplmod_BRS_plus = fHAmplModelCC;
-            assert(hamplmod_BRS_plus);
-
-            const RSHelicityAmpl & hampl_BRS_plus = hamplmod_BRS_plus->Compute(resonance, fFKR);
-
-            sigL_plus = (hampl_BRS_plus.Amp2Plus3 () + hampl_BRS_plus.Amp2Plus1 ());
-            sigR_plus = (hampl_BRS_plus.Amp2Minus3() + hampl_BRS_plus.Amp2Minus1());
-            sigS_plus = (hampl_BRS_plus.Amp20Plus () + hampl_BRS_plus.Amp20Minus());
-          }
+  // Sums of the squared helicity amplitudes, possibly from the pre-computed
+  // (W,Q2) table
+  double hsums[3];
 
   // Compute the cross section
   if(is_KLN || is_BRS) {
 
+     this->HelicityAmplSums(ist, W, q2, KNL_Qstar_minus, KNL_vstar_minus, hsums);
+     sigL_minus = hsums[0];
+     sigR_minus = hsums[1];
+     sigS_minus = hsums[2];
+
+     this->HelicityAmplSums(ist, W, q2, KNL_Qstar_plus, KNL_vstar_plus, hsums);
+     sigL_plus  = hsums[0];
+     sigR_plus  = hsums[1];
+     sigS_plus  = hsums[2];
+
      sigL_minus *= scLR;
      sigR_minus *= scLR;
      sigS_minus *= scS;
@@ -559,13 +391,11 @@ double BSKLNBaseRESPXSec2014::XSec(
          << "sL,R,S plus = " << sigL_plus << "," << sigR_plus << "," << sigS_plus;
   }
   else {
-     assert(hamplmod);
+     this->HelicityAmplSums(ist, W, q2, 0., 0., hsums);
 
-     const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR);
-
-     sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
-     sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
-     sigS = scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
+     sigL = scLR* hsums[0];
+     sigR = scLR* hsums[1];
+     sigS = scS * hsums[2];
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -586,7 +416,6 @@ double BSKLNBaseRESPXSec2014::XSec(
       LOG("BSKLNBaseRESPXSec2014",pINFO) << "A-="<<KNL_Alambda_minus<<" A+="<<KNL_Alambda_plus;
       // protect against sigRSR=sigRSL=sigRSS=0
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<q2<<"\t"<<xsec<<"\t"<<sig0*(V2*sigR + U2*sigL + 2*UV*sigS)<<"\t"<<xsec/TMath::Max(sig0*(V2*sigRSR + U2*sigRSL + 2*UV*sigRSS),1.0e-100);
-      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"fFKR.B="<<fFKR.B<<" fFKR.C="<<fFKR.C<<" fFKR.S="<<fFKR.S;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CL-="<<TMath::Power(KNL_cL_minus,2)<<" CL+="<<TMath::Power(KNL_cL_plus,2)<<" U2="<<U2;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"SL-="<<sigL_minus<<" SL+="<<sigL_plus<<" SL="<<sigRSL;
 
@@ -620,7 +449,7 @@ double BSKLNBaseRESPXSec2014::XSec(
   }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BSKLNBaseRESPXSec2014", pDEBUG)
-      << "BreitWigner(RES=" << resname << ", W=" << W << ") = " << bw;
+      << "BreitWigner(RES=" << utils::res::AsString(ist.Res) << ", W=" << W << ") = " << bw;
 #endif
   xsec *= bw;
 
@@ -638,21 +467,15 @@ double BSKLNBaseRESPXSec2014::XSec(
   }
 
   // Apply given scaling factor
-  if      (is_CC) { xsec *= fXSecScaleCC; }
-  else if (is_NC) { xsec *= fXSecScaleNC; }
+  xsec *= ist.XSecScale;
 
   // If requested return the free nucleon xsec even for input nuclear tgt
   if ( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
 
-  int Z = target.Z();
-  int A = target.A();
-  int N = A-Z;
-
   // Take into account the number of scattering centers in the target
-  int NNucl = (is_p) ? Z : N;
-  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor)
+  xsec*=ist.NNucl; // nuclear xsec (no nuclear suppression factor)
 
-  if ( fUsePauliBlocking && A!=1 )
+  if ( fUsePauliBlocking && ist.PFermi >= 0. )
   {
     // Calculation of Pauli blocking according references:
     //
@@ -668,23 +491,8 @@ double BSKLNBaseRESPXSec2014::XSec(
     //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
     //         [arXiv: hep-ph/0308130].
 
-    double P_Fermi = 0.0;
-
     // Maximum value of Fermi momentum of target nucleon (GeV)
-    if ( A<6 || ! fUseRFGParametrization )
-    {
-        // look up the Fermi momentum for this target
-        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
-        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
-     }
-     else {
-        // define the Fermi momentum for this target
-        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
-        // correct the Fermi momentum for the struck nucleon
-        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
-        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
-     }
+    double P_Fermi = ist.PFermi;
 
      double FactorPauli_RES = 1.0;
 
@@ -710,6 +518,333 @@ double BSKLNBaseRESPXSec2014::XSec(
   return xsec;
 }
 //____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::HelicityAmplSums(const RESInitStateParams & ist,
+   double W, double q2, double KNL_Qstar, double KNL_vstar, double * sums) const
+{
+// Sums of squared helicity amplitudes (L,R,S), looked-up from the table if
+// available. For the KLN & BRS CC models the amplitudes depend on the lepton
+// kinematics through KNL_Qstar and KNL_vstar. The FKR parameters S, B & C are
+// linear in these, so the sums are quadratic forms in (KNL_Qstar,KNL_vstar)
+// whose 6 coefficients (per sum) are tabulated
+
+  const RSHelicityAmplTable * table = ist.HAmplTable;
+  if(table) {
+    double c[18];
+    if(table->Evaluate(W, -q2, c)) {
+      if(table->NComp() == 3) {
+        for(int i = 0; i < 3; i++) sums[i] = c[i];
+      } else {
+        double Q = KNL_Qstar;
+        double v = KNL_vstar;
+        for(int i = 0; i < 3; i++) {
+          const double * a = c + 6*i;
+          sums[i] = a[0] + a[1]*Q + a[2]*v + a[3]*Q*Q + a[4]*Q*v + a[5]*v*v;
+        }
+      }
+      return;
+    }
+  }
+
+  this->ComputeHelicityAmplSums(ist, W, q2, KNL_Qstar, KNL_vstar, sums);
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::ComputeHelicityAmplSums(
+   const RESInitStateParams & ist,
+   double W, double q2, double KNL_Qstar, double KNL_vstar, double * sums) const
+{
+  Resonance_t resonance = ist.Res;
+  int    IR    = ist.IR;
+  double Mnuc  = ist.Mnuc;
+  double W2    = TMath::Power(W,    2);
+  double Mnuc2 = TMath::Power(Mnuc, 2);
+  double k     = 0.5 * (W2 - Mnuc2)/Mnuc;
+  double v     = k - 0.5 * q2/Mnuc;
+  double v2    = TMath::Power(v, 2);
+  double Q2    = v2 - q2;
+  double Q     = TMath::Sqrt(Q2);
+
+  bool is_KLN = (fKLN && ist.IsCC);
+  bool is_BRS = (fBRS && ist.IsCC);
+
+  double vstar = (Mnuc*v + q2)/W;  //missing W
+  double Qstar = TMath::Sqrt(-q2 + vstar*vstar);
+  double a = 1. + 0.5*(W2-q2+Mnuc2)/Mnuc/W;
+
+  // Calculate the Feynman-Kislinger-Ravndall parameters
+
+  FKR fkr;
+
+  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
+  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
+  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+
+  if(fGV){
+
+    LOG("BSKLNBaseRESPXSec2014",pDEBUG) <<"Using new GV";
+    double CV0 =  1./(1-q2/fMv2/4.);
+    double CV3 =  2.13 * CV0 * TMath::Power( 1-q2/fMv2,-2);
+    double CV4 = -1.51 * CV0 * TMath::Power( 1-q2/fMv2,-2);
+    double CV5 =  0.48 * CV0 * TMath::Power( 1-q2/fMv2/0.766, -2);
+
+    double GV3 =  0.5 / TMath::Sqrt(3) * ( CV3 * (W + Mnuc)/Mnuc
+                  + CV4 * (W2 + q2 -Mnuc2)/2./Mnuc2
+                  + CV5 * (W2 - q2 -Mnuc2)/2./Mnuc2 );
+
+    double GV1 = - 0.5 / TMath::Sqrt(3) * ( CV3 * (Mnuc2 -q2 +Mnuc*W)/W/Mnuc
+                 + CV4 * (W2 +q2 - Mnuc2)/2./Mnuc2
+                 + CV5 * (W2 -q2 - Mnuc2)/2./Mnuc2 );
+
+    GV = 0.5 * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR)
+         * TMath::Sqrt( 3 * GV3*GV3 + GV1*GV1);
+  }
+
+  if(fGA){
+    LOG("BSKLNBaseRESPXSec2014",pDEBUG) << "Using new GA";
+
+    double CA5_0 = 1.2;
+    double CA5 = CA5_0 *  TMath::Power( 1./(1-q2/fMa2), 2);
+    //  GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5/fZeta;
+    GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5;
+
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"GA= " <<GA << "  C5A= " <<CA5;
+  }
+  //JN end of new form factors code
+
+  if(ist.IsEM) {
+    GA = 0.; // zero the axial term for EM scattering
+  }
+
+  double d      = TMath::Power(W+Mnuc,2.) - q2;
+  double sq2omg = TMath::Sqrt(2./fOmega);
+  double nomg   = IR * fOmega;
+  double mq_w   = Mnuc*Q/W;
+
+  fkr.Lamda  = sq2omg * mq_w;
+  fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.R      = fkr.Rv;
+  fkr.Rplus  = - (fkr.Rv + fkr.Ra);
+  fkr.Rminus = - (fkr.Rv - fkr.Ra);
+  fkr.T      = fkr.Tv;
+  fkr.Tplus  = - (fkr.Tv + fkr.Ta);
+  fkr.Tminus = - (fkr.Tv - fkr.Ta);
+
+  //JN KNL
+  if(is_KLN || is_BRS){
+    double KNL_S = (KNL_vstar*vstar - KNL_Qstar*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2; //possibly missing minus sign ()
+    double KNL_B = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar + KNL_vstar*Qstar/a/Mnuc ) * GA;
+    double KNL_C = ( (KNL_Qstar*Qstar - KNL_vstar*vstar ) * ( 1./3. + vstar/a/Mnuc)
+        + KNL_vstar*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
+
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S<<"\t"<<fkr.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B<<"\t"<<fkr.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL C= " <<KNL_C<<"\t"<<fkr.C;
+
+    fkr.S = KNL_S;
+    fkr.B = KNL_B;
+    fkr.C = KNL_C;
+
+    if(!is_KLN) {
+      fkr.B += fZeta*GA/2./W/Qstar*( KNL_Qstar*vstar - KNL_vstar*Qstar)
+        *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
+      fkr.C += fZeta*GA/2./W/Qstar*( KNL_Qstar*vstar - KNL_vstar*Qstar)
+        * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
+
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<fkr.B;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<fkr.C;
+    }
+  }
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("FKR", pDEBUG)
+    << "FKR params for RES = " << utils::res::AsString(resonance) << " : " << fkr;
+#endif
+
+  // Calculate the Rein-Sehgal Helicity Amplitudes
+
+  const RSHelicityAmpl & hampl = ist.HAmplModel->Compute(resonance, fkr);
+
+  sums[0] = hampl.Amp2Plus3 () + hampl.Amp2Plus1 ();
+  sums[1] = hampl.Amp2Minus3() + hampl.Amp2Minus1();
+  sums[2] = hampl.Amp20Plus () + hampl.Amp20Minus();
+}
+//____________________________________________________________________________
+const RSHelicityAmplTable * BSKLNBaseRESPXSec2014::HelicityAmplTable(
+                                     const RESInitStateParams & ist) const
+{
+// The helicity amplitude sums depend on the resonance, the helicity amplitude
+// model and (through its mass) the hit nucleon, but not on the probe energy
+// or on the final state lepton mass. Tables are built on first use and kept
+// until the algorithm is reconfigured
+
+  HAmplTableKey_t key(ist.HAmplModel, 2*(int)ist.Res + (ist.IsP ? 0 : 1));
+
+  std::lock_guard<std::mutex> lock(gHAmplTablesMutex);
+
+  map<HAmplTableKey_t, RSHelicityAmplTable *>::const_iterator it =
+                                                    fHAmplTables.find(key);
+  if(it != fHAmplTables.end()) return it->second;
+
+  LOG("BSKLNBaseRESPXSec2014", pNOTICE)
+     << "Tabulating helicity amplitudes for RES = "
+     << utils::res::AsString(ist.Res) << " on nucleon = " << ist.NucPdg;
+
+  // For the KLN & BRS CC models, tabulate the coefficients of the quadratic
+  // forms in (KNL_Qstar,KNL_vstar), extracted from 6 evaluations per node
+  bool is_quadratic = ist.IsCC && (fKLN || fBRS);
+
+  RSHelicityAmplTable * table = new RSHelicityAmplTable(
+     (is_quadratic ? 18 : 3),
+     fHAmplTableNW,  fHAmplTableWMin, fHAmplTableWMax,
+     fHAmplTableNQ2, fHAmplTableQ2Max);
+
+  double f00[3], f10[3], fm10[3], f01[3], f0m1[3], f11[3];
+  double c[18];
+  for(unsigned int iW = 0; iW < table->NW(); iW++) {
+    for(unsigned int iQ2 = 0; iQ2 < table->NQ2(); iQ2++) {
+      double W  =  table->W (iW);
+      double q2 = -table->Q2(iQ2);
+      this->ComputeHelicityAmplSums(ist, W, q2, 0., 0., f00);
+      if(!is_quadratic) {
+        table->Set(iW, iQ2, f00);
+        continue;
+      }
+      this->ComputeHelicityAmplSums(ist, W, q2,  1.,  0., f10 );
+      this->ComputeHelicityAmplSums(ist, W, q2, -1.,  0., fm10);
+      this->ComputeHelicityAmplSums(ist, W, q2,  0.,  1., f01 );
+      this->ComputeHelicityAmplSums(ist, W, q2,  0., -1., f0m1);
+      this->ComputeHelicityAmplSums(ist, W, q2,  1.,  1., f11 );
+      for(int i = 0; i < 3; i++) {
+        double * a = c + 6*i;
+        a[0] = f00[i];
+        a[1] = 0.5 * (f10[i] - fm10[i]);
+        a[2] = 0.5 * (f01[i] - f0m1[i]);
+        a[3] = 0.5 * (f10[i] + fm10[i]) - a[0];
+        a[5] = 0.5 * (f01[i] + f0m1[i]) - a[0];
+        a[4] = f11[i] - a[0] - a[1] - a[2] - a[3] - a[5];
+      }
+      table->Set(iW, iQ2, c);
+    }
+  }
+
+  fHAmplTables.insert(
+     map<HAmplTableKey_t, RSHelicityAmplTable *>::value_type(key, table));
+
+  return table;
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::DeleteHelicityAmplTables(void)
+{
+  map<HAmplTableKey_t, RSHelicityAmplTable *>::iterator it;
+  for(it = fHAmplTables.begin(); it != fHAmplTables.end(); ++it) {
+    delete it->second;
+  }
+  fHAmplTables.clear();
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::InitStateParams(
+       const Interaction * interaction, RESInitStateParams & ist) const
+{
+  const InitialState & init_state = interaction -> InitState();
+  const ProcessInfo &  proc_info  = interaction -> ProcInfo();
+  const Target & target = init_state.Tgt();
+
+  // Get the input baryon resonance
+  Resonance_t resonance = interaction->ExclTag().Resonance();
+  ist.Res      = resonance;
+  ist.IsDelta  = utils::res::IsDelta (resonance);
+
+  // Get the neutrino, hit nucleon & weak current
+  int  nucpdgc   = target.HitNucPdg();
+  int  probepdgc = init_state.ProbePdg();
+  ist.NucPdg   = nucpdgc;
+  ist.ProbePdg = probepdgc;
+  ist.IsNu     = pdg::IsNeutrino         (probepdgc);
+  ist.IsNuBar  = pdg::IsAntiNeutrino     (probepdgc);
+  ist.IsLPlus  = pdg::IsPosChargedLepton (probepdgc);
+  ist.IsLMinus = pdg::IsNegChargedLepton (probepdgc);
+  ist.IsP      = pdg::IsProton  (nucpdgc);
+  ist.IsN      = pdg::IsNeutron (nucpdgc);
+  ist.IsCC     = proc_info.IsWeakCC();
+  ist.IsNC     = proc_info.IsWeakNC();
+  ist.IsEM     = proc_info.IsEM();
+
+  ist.Zero = false;
+  if(ist.IsCC && !ist.IsDelta) {
+    if((ist.IsNu && ist.IsP) || (ist.IsNuBar && ist.IsN)) ist.Zero = true;
+  }
+
+  // Get baryon resonance parameters
+  ist.IR = utils::res::ResonanceIndex    (resonance);
+  ist.LR = utils::res::OrbitalAngularMom (resonance);
+  ist.MR = utils::res::Mass              (resonance);
+  ist.WR = utils::res::Width             (resonance);
+  ist.NR = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+
+  ist.E    = init_state.ProbeE(kRfHitNucRest);
+  ist.Mnuc = target.HitNucMass();
+
+  // Rein-Sehgal helicity amplitude model (the KLN & BRS modifications of
+  // the CC amplitudes are selected with the kinematics)
+  ist.HAmplModel = 0;
+  if(ist.IsCC) {
+    ist.HAmplModel = fHAmplModelCC;
+  }
+  else
+  if(ist.IsNC) {
+    if (ist.IsP) { ist.HAmplModel = fHAmplModelNCp;}
+    else         { ist.HAmplModel = fHAmplModelNCn;}
+  }
+  else
+  if(ist.IsEM) {
+    if (ist.IsP) { ist.HAmplModel = fHAmplModelEMp;}
+    else         { ist.HAmplModel = fHAmplModelEMn;}
+  }
+
+  // Pre-computed helicity amplitude table, if requested
+  ist.HAmplTable = (fUseHAmplTables) ? this->HelicityAmplTable(ist) : 0;
+
+  // No nutau cross section reduction factors in this model
+  ist.NuTauRF = 1.0;
+
+  // Given scaling factor
+  ist.XSecScale = 1.;
+  if      (ist.IsCC) { ist.XSecScale = fXSecScaleCC; }
+  else if (ist.IsNC) { ist.XSecScale = fXSecScaleNC; }
+
+  // Number of scattering centers in the target
+  int Z = target.Z();
+  int A = target.A();
+  int N = A-Z;
+  ist.NNucl = (ist.IsP) ? Z : N;
+
+  // Maximum value of Fermi momentum of target nucleon (GeV), for Pauli
+  // blocking (negative if not applicable)
+  ist.PFermi = -1.;
+  if ( fUsePauliBlocking && A!=1 )
+  {
+    if ( A<6 || ! fUseRFGParametrization )
+    {
+        // look up the Fermi momentum for this target
+        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
+        ist.PFermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
+     }
+     else {
+        // define the Fermi momentum for this target
+        ist.PFermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
+        // correct the Fermi momentum for the struck nucleon
+        if(ist.IsP) { ist.PFermi *= TMath::Power( 2.*Z/A, 1./3); }
+        else        { ist.PFermi *= TMath::Power( 2.*N/A, 1./3); }
+     }
+  }
+}
+//____________________________________________________________________________
 double BSKLNBaseRESPXSec2014::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
@@ -830,6 +965,17 @@ void BSKLNBaseRESPXSec2014::LoadConfig(void)
   this->GetParamDef( "MaxNWidthForN0Res", fN0ResMaxNWidths, 6.0 ) ;
   this->GetParamDef( "MaxNWidthForGNRes", fGnResMaxNWidths, 4.0 ) ;
 
+  // Optionally, tabulate the helicity amplitudes on a (W,Q2) grid rather
+  // than computing them at every kinematical point. Outside the grid the
+  // amplitudes are still computed directly
+  this->DeleteHelicityAmplTables();
+  this->GetParamDef( "UseHelicityAmplTables",  fUseHAmplTables,  false ) ;
+  this->GetParamDef( "HelicityAmplTable-NW",   fHAmplTableNW,    200   ) ;
+  this->GetParamDef( "HelicityAmplTable-NQ2",  fHAmplTableNQ2,   200   ) ;
+  this->GetParamDef( "HelicityAmplTable-WMin", fHAmplTableWMin,  1.0   ) ;
+  this->GetParamDef( "HelicityAmplTable-WMax", fHAmplTableWMax,  3.5   ) ;
+  this->GetParamDef( "HelicityAmplTable-Q2Max",fHAmplTableQ2Max, 10.0  ) ;
+
   // Load the differential cross section integrator
   fXSecIntegrator =
     dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
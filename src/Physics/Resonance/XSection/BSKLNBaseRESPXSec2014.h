@@ -36,13 +36,20 @@
 #ifndef _BSKLN_BASE_RES_PXSEC_2014_H_
 #define _BSKLN_BASE_RES_PXSEC_2014_H_
 
+#include <map>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Physics/Resonance/XSection/FKR.h"
+#include "Physics/Resonance/XSection/RESInitStateParams.h"
+
+using std::map;
+using std::pair;
 
 namespace genie {
 
   class RSHelicityAmplModelI;
+  class RSHelicityAmplTable;
   class Spline;
   class XSecIntegratorI;
 
@@ -55,6 +62,10 @@ namespace genie {
       double XSec         (const Interaction * i, KinePhaseSpace_t k) const;
       double Integral     (const Interaction * i) const;
       bool   ValidProcess (const Interaction * i) const;
+      void   BatchXSec    (const Interaction * i, KinePhaseSpace_t k,
+                           unsigned int npoints, unsigned int nkv,
+                           const KineVar_t * kv, const double * kine,
+                           double * xsec) const;
 
       // overload the Algorithm::Configure() methods to load private data
       // members from configuration options
@@ -68,7 +79,26 @@ namespace genie {
 
       void LoadConfig (void);
 
-      mutable FKR fFKR;
+      //! Init-state dependent part of the calculation & xsec for given init-state
+      void   InitStateParams (const Interaction * i, RESInitStateParams & ist) const;
+      double KineXSec        (const Interaction * i, KinePhaseSpace_t k,
+                              const RESInitStateParams & ist) const;
+
+      //! Sums of squared helicity amplitudes (L,R,S) at the given W, q2 and,
+      //! for the KLN & BRS CC models, the given lepton current Qstar & vstar
+      void   HelicityAmplSums        (const RESInitStateParams & ist,
+                                      double W, double q2, double KNL_Qstar,
+                                      double KNL_vstar, double * sums) const;
+      void   ComputeHelicityAmplSums (const RESInitStateParams & ist,
+                                      double W, double q2, double KNL_Qstar,
+                                      double KNL_vstar, double * sums) const;
+      const RSHelicityAmplTable *
+             HelicityAmplTable       (const RESInitStateParams & ist) const;
+      void   DeleteHelicityAmplTables(void);
+
+      typedef pair<const RSHelicityAmplModelI *, int> HAmplTableKey_t;
+
+      mutable map<HAmplTableKey_t, RSHelicityAmplTable *> fHAmplTables;
 
       const RSHelicityAmplModelI * fHAmplModelCC;
       const RSHelicityAmplModelI * fHAmplModelNCp;
@@ -97,6 +127,12 @@ namespace genie {
      
       double   fXSecScaleCC;       ///< external CC xsec scaling factor
       double   fXSecScaleNC;       ///< external NC xsec scaling factor
+      bool     fUseHAmplTables;    ///< tabulate helicity amplitudes on a (W,Q2) grid?
+      int      fHAmplTableNW;      ///< number of W grid points
+      int      fHAmplTableNQ2;     ///< number of Q2 grid points
+      double   fHAmplTableWMin;    ///< W range of the grid
+      double   fHAmplTableWMax;    ///<
+      double   fHAmplTableQ2Max;   ///< max Q2 of the grid
 
       bool fKLN;
       bool fBRS;
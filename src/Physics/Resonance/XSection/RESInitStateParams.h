@@ -0,0 +1,64 @@
+//____________________________________________________________________________
+/*!
+
+\struct   genie::RESInitStateParams
+
+\brief    The quantities of the Rein-Sehgal-type resonance production
+          cross section calculation which depend only on the initial state,
+          process & resonance (and not on W, Q2). They are computed once per
+          call of XSec(), or once per batch of kinematical points in
+          BatchXSec().
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _RES_INIT_STATE_PARAMS_H_
+#define _RES_INIT_STATE_PARAMS_H_
+
+#include "Framework/ParticleData/BaryonResonance.h"
+
+namespace genie {
+
+class RSHelicityAmplModelI;
+class RSHelicityAmplTable;
+
+struct RESInitStateParams {
+
+  bool         Zero;        ///< xsec vanishes for this initial state / resonance
+
+  Resonance_t  Res;         ///< baryon resonance
+  bool         IsDelta;
+  int          NucPdg;      ///< hit nucleon
+  int          ProbePdg;    ///< probe
+  bool         IsNu, IsNuBar, IsLPlus, IsLMinus;
+  bool         IsP, IsN;
+  bool         IsCC, IsNC, IsEM;
+
+  int          IR;          ///< resonance index
+  int          LR;          ///< orbital angular momentum
+  double       MR;          ///< mass
+  double       WR;          ///< width
+  double       NR;          ///< Breit-Wigner normalization
+
+  double       E;           ///< probe energy in the hit nucleon rest frame
+  double       Mnuc;        ///< hit nucleon mass
+
+  const RSHelicityAmplModelI * HAmplModel; ///< helicity amplitude model
+  const RSHelicityAmplTable  * HAmplTable; ///< tabulated amplitudes (0: compute directly)
+
+  double       NuTauRF;     ///< nutau xsec reduction factor
+  double       XSecScale;   ///< external xsec scaling factor
+  int          NNucl;       ///< number of scattering centres
+  double       PFermi;      ///< Fermi momentum for Pauli blocking (<=0: none)
+};
+
+}       // genie namespace
+
+#endif  // _RES_INIT_STATE_PARAMS_H_
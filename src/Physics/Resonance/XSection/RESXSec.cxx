@@ -70,17 +70,25 @@ double RESXSec::Integrate(
   interaction->SetBit(kISkipProcessChk);
   //interaction->SetBit(kISkipKinematicChk);
 
+  double abstol = 1E-16; //We mostly care about relative tolerance.
+  double kine_min[2] = { Wl.min, Q2l.min };
+  double kine_max[2] = { Wl.max, Q2l.max };
+
+  if(this->UseBatchIntegrator()) {
+    double xsec = this->IntegrateBatch<utils::gsl::d2XSec_dWdQ2_E>(
+         model, interaction, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
+    delete interaction;
+    return xsec;
+  }
+
   ROOT::Math::IBaseFunctionMultiDim * func = 
       new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
   
   ROOT::Math::IntegrationMultiDim::Type ig_type = 
       utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-  double abstol = 1E-16; //We mostly care about relative tolerance.
   
   ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
 
-  double kine_min[2] = { Wl.min, Q2l.min };
-  double kine_max[2] = { Wl.max, Q2l.max };
   double xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
 
   LOG("RESXSec", pERROR)  << "Integrator opt / Integrator = " <<  ig.Options().Integrator();
@@ -121,5 +129,7 @@ void RESXSec::LoadConfig(void)
   GetParamDef( "gsl-min-eval", min, 5000 ) ;
   fGSLMaxEval  = (unsigned int) max ;
   fGSLMinEval  = (unsigned int) min ;
+  GetParamDef( "batch-num-of-threads", fBatchNumOfThreads, 0 ) ;
+  GetParamDef( "batch-warm-start", fBatchWarmStart, true ) ;
 }
 //____________________________________________________________________________
@@ -31,6 +31,10 @@ public:
   virtual ~RSHelicityAmplModelI();
 
   // define the RSHelicityAmplModelI interface
+  // Helicity amplitude models are shared by all the algorithms looking them
+  // up in the AlgFactory, so Compute() may be called concurrently from
+  // several threads: the returned amplitudes are stored per thread and are
+  // valid until the next call to Compute() on the same thread.
   virtual const RSHelicityAmpl & Compute(Resonance_t res, const FKR & fkr) const = 0;
 
 protected:
@@ -50,6 +50,8 @@ const RSHelicityAmpl &
    RSHelicityAmplModelNCp::Compute(
         Resonance_t res, const FKR & fkr) const
 {
+  static thread_local RSHelicityAmpl ampl; // per-thread, see RSHelicityAmplModelI
+
   double xi = fSin28w;
 
   switch(res) {
@@ -60,12 +62,12 @@ const RSHelicityAmpl &
      double Rm2xiR = fkr.Rminus + rx;
      double Rp2xiR = fkr.Rplus  + rx;
 
-     fAmpl.fMinus1 =  -kSqrt2 * Rm2xiR;
-     fAmpl.fPlus1  =   kSqrt2 * Rp2xiR;
-     fAmpl.fMinus3 =  -kSqrt6 * Rm2xiR;
-     fAmpl.fPlus3  =   kSqrt6 * Rp2xiR;
-     fAmpl.f0Minus = 2*kSqrt2 * fkr.C;
-     fAmpl.f0Plus  =   fAmpl.f0Minus;
+     ampl.fMinus1 =  -kSqrt2 * Rm2xiR;
+     ampl.fPlus1  =   kSqrt2 * Rp2xiR;
+     ampl.fMinus3 =  -kSqrt6 * Rm2xiR;
+     ampl.fPlus3  =   kSqrt6 * Rp2xiR;
+     ampl.f0Minus = 2*kSqrt2 * fkr.C;
+     ampl.f0Plus  =   ampl.f0Minus;
      break;
    }
    case (kS11_1535) :
@@ -79,12 +81,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_2 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = kSqrt2_3 * (fkr.Lamda * fkr.C - 3*fkr.B);
 
-     fAmpl.fMinus1 =     kSqrt3 * Tm2xiT + kSqrt2_3 * LRm3xiR;
-     fAmpl.fPlus1  = -1.*kSqrt3 * Tp2xiT - kSqrt2_3 * LRp3xiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -a + b;
-     fAmpl.f0Plus  =  a + b;
+     ampl.fMinus1 =     kSqrt3 * Tm2xiT + kSqrt2_3 * LRm3xiR;
+     ampl.fPlus1  = -1.*kSqrt3 * Tp2xiT - kSqrt2_3 * LRp3xiR;
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus = -a + b;
+     ampl.f0Plus  =  a + b;
      break;
    }
    case (kD13_1520) :
@@ -98,22 +100,22 @@ const RSHelicityAmpl &
      double a       = kSqrt3 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = (2./kSqrt3) * fkr.Lamda * fkr.C;
 
-     fAmpl.fMinus1 = kSqrt3_2 * Tm2xiT - k2_Sqrt3 * LRm3xiR;
-     fAmpl.fPlus1  = kSqrt3_2 * Tp2xiT - k2_Sqrt3 * LRp3xiR;
-     fAmpl.fMinus3 = k3_Sqrt2 * Tm2xiT;
-     fAmpl.fPlus3  = k3_Sqrt2 * Tp2xiT;
-     fAmpl.f0Minus = -a + b;
-     fAmpl.f0Plus  = -a - b;
+     ampl.fMinus1 = kSqrt3_2 * Tm2xiT - k2_Sqrt3 * LRm3xiR;
+     ampl.fPlus1  = kSqrt3_2 * Tp2xiT - k2_Sqrt3 * LRp3xiR;
+     ampl.fMinus3 = k3_Sqrt2 * Tm2xiT;
+     ampl.fPlus3  = k3_Sqrt2 * Tp2xiT;
+     ampl.f0Minus = -a + b;
+     ampl.f0Plus  = -a - b;
      break;
    }
    case (kS11_1650) :
    {
-     fAmpl.fMinus1 =  k1_Sqrt24 * fkr.Lamda * fkr.Rminus;
-     fAmpl.fPlus1  = -k1_Sqrt24 * fkr.Lamda * fkr.Rplus;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt24 * fkr.Lamda * fkr.Rminus;
+     ampl.fPlus1  = -k1_Sqrt24 * fkr.Lamda * fkr.Rplus;
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus = -k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kD13_1700) :
@@ -121,12 +123,12 @@ const RSHelicityAmpl &
      double LRm     = fkr.Lamda * fkr.Rminus;
      double LRp     = fkr.Lamda * fkr.Rplus;
 
-     fAmpl.fMinus1 =  k1_Sqrt120 * LRm;
-     fAmpl.fPlus1  =  k1_Sqrt120 * LRp;
-     fAmpl.fMinus3 =  k3_Sqrt40  * LRm;
-     fAmpl.fPlus3  =  k3_Sqrt40  * LRp;
-     fAmpl.f0Minus =  k1_Sqrt30  * fkr.Lamda * fkr.C;
-     fAmpl.f0Plus  =  -1.* fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt120 * LRm;
+     ampl.fPlus1  =  k1_Sqrt120 * LRp;
+     ampl.fMinus3 =  k3_Sqrt40  * LRm;
+     ampl.fPlus3  =  k3_Sqrt40  * LRp;
+     ampl.f0Minus =  k1_Sqrt30  * fkr.Lamda * fkr.C;
+     ampl.f0Plus  =  -1.* ampl.f0Minus;
      break;
    }
    case (kD15_1675) :
@@ -134,12 +136,12 @@ const RSHelicityAmpl &
      double LRm     = fkr.Lamda * fkr.Rminus;
      double LRp     = fkr.Lamda * fkr.Rplus;
 
-     fAmpl.fMinus1 = -kSqrt3_40 * LRm;
-     fAmpl.fPlus1  =  kSqrt3_40 * LRp;
-     fAmpl.fMinus3 = -kSqrt3_20 * LRm;
-     fAmpl.fPlus3  =  kSqrt3_20 * LRp;
-     fAmpl.f0Minus =  kSqrt3_10 * fkr.Lamda * fkr.C;
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 = -kSqrt3_40 * LRm;
+     ampl.fPlus1  =  kSqrt3_40 * LRp;
+     ampl.fMinus3 = -kSqrt3_20 * LRm;
+     ampl.fPlus3  =  kSqrt3_20 * LRp;
+     ampl.f0Minus =  kSqrt3_10 * fkr.Lamda * fkr.C;
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kS31_1620) :
@@ -153,12 +155,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_2 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
 
-     fAmpl.fMinus1 =  kSqrt3 * Tm2xiT - k1_Sqrt6 * LRm2xiR;
-     fAmpl.fPlus1  = -kSqrt3 * Tp2xiT + k1_Sqrt6 * LRp2xiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -a-b;
-     fAmpl.f0Plus  =  a-b;
+     ampl.fMinus1 =  kSqrt3 * Tm2xiT - k1_Sqrt6 * LRm2xiR;
+     ampl.fPlus1  = -kSqrt3 * Tp2xiT + k1_Sqrt6 * LRp2xiR;
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus = -a-b;
+     ampl.f0Plus  =  a-b;
      break;
    }
    case (kD33_1700) :
@@ -172,12 +174,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k1_Sqrt3 * fkr.Lamda * fkr.C;
 
-     fAmpl.fMinus1 = kSqrt3_2 * Tm2xiT + k1_Sqrt3 * LRm2xiR;
-     fAmpl.fPlus1  = kSqrt3_2 * Tp2xiT + k1_Sqrt3 * LRp2xiR;
-     fAmpl.fMinus3 = k3_Sqrt2 * Tm2xiT;
-     fAmpl.fPlus3  = k3_Sqrt2 * Tp2xiT;
-     fAmpl.f0Minus = -a-b;
-     fAmpl.f0Plus  = -a+b;
+     ampl.fMinus1 = kSqrt3_2 * Tm2xiT + k1_Sqrt3 * LRm2xiR;
+     ampl.fPlus1  = kSqrt3_2 * Tp2xiT + k1_Sqrt3 * LRp2xiR;
+     ampl.fMinus3 = k3_Sqrt2 * Tm2xiT;
+     ampl.fPlus3  = k3_Sqrt2 * Tp2xiT;
+     ampl.f0Minus = -a-b;
+     ampl.f0Plus  = -a+b;
      break;
    }
    case (kP11_1440) :
@@ -190,12 +192,12 @@ const RSHelicityAmpl &
      double a       = 0.25 * kSqrt3 * (1-4*xi) * L2 * fkr.S;
      double b       = c * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 = -c * L2RmxiR;
-     fAmpl.fPlus1  = -c * L2RpxiR;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = -a+b;
-     fAmpl.f0Plus  = -a-b;
+     ampl.fMinus1 = -c * L2RmxiR;
+     ampl.fPlus1  = -c * L2RpxiR;
+     ampl.fMinus3 = 0.;
+     ampl.fPlus3  = 0.;
+     ampl.f0Minus = -a+b;
+     ampl.f0Plus  = -a-b;
      break;
    }
    case (kP33_1600) :
@@ -205,12 +207,12 @@ const RSHelicityAmpl &
      double L2RmxiR = L2 * (fkr.Rminus + xr);
      double L2RpxiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt6 * L2RmxiR;
-     fAmpl.fPlus1  = -k1_Sqrt6 * L2RmxiR;
-     fAmpl.fMinus3 =  k1_Sqrt2 * L2RmxiR;
-     fAmpl.fPlus3  = -k1_Sqrt2 * L2RpxiR;
-     fAmpl.f0Minus = -kSqrt2_3 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt6 * L2RmxiR;
+     ampl.fPlus1  = -k1_Sqrt6 * L2RmxiR;
+     ampl.fMinus3 =  k1_Sqrt2 * L2RmxiR;
+     ampl.fPlus3  = -k1_Sqrt2 * L2RpxiR;
+     ampl.f0Minus = -kSqrt2_3 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kP13_1720) :
@@ -225,12 +227,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_20 * (1-4*xi) * L2 * fkr.S;
      double b       = kSqrt5_12 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 = -kSqrt27_40 * LTm4xiT - kSqrt5_12 * L2RmxiR;
-     fAmpl.fPlus1  =  kSqrt27_40 * LTp4xiT + kSqrt5_12 * L2RpxiR;
-     fAmpl.fMinus3 =  k3_Sqrt40  * LTm4xiT;
-     fAmpl.fPlus3  = -k3_Sqrt40  * LTp4xiT;
-     fAmpl.f0Minus =  a-b;
-     fAmpl.f0Plus  = -a-b;
+     ampl.fMinus1 = -kSqrt27_40 * LTm4xiT - kSqrt5_12 * L2RmxiR;
+     ampl.fPlus1  =  kSqrt27_40 * LTp4xiT + kSqrt5_12 * L2RpxiR;
+     ampl.fMinus3 =  k3_Sqrt40  * LTm4xiT;
+     ampl.fPlus3  = -k3_Sqrt40  * LTp4xiT;
+     ampl.f0Minus =  a-b;
+     ampl.f0Plus  = -a-b;
      break;
    }
    case (kF15_1680) :
@@ -245,12 +247,12 @@ const RSHelicityAmpl &
      double a       = k3_Sqrt40 * (1-4*xi)* L2 * fkr.S;
      double b       = kSqrt5_8 * L2 * fkr.C;
 
-     fAmpl.fMinus1 = -k3_Sqrt20 * LTm4xiT + kSqrt5_8 * L2RmxiR;
-     fAmpl.fPlus1  = -k3_Sqrt20 * LTp4xiT + kSqrt5_8 * L2RpxiR;
-     fAmpl.fMinus3 = -kSqrt18_20 * LTm4xiT;
-     fAmpl.fPlus3  = -kSqrt18_20 * LTp4xiT;
-     fAmpl.f0Minus =  a - b;
-     fAmpl.f0Plus  =  a + b;
+     ampl.fMinus1 = -k3_Sqrt20 * LTm4xiT + kSqrt5_8 * L2RmxiR;
+     ampl.fPlus1  = -k3_Sqrt20 * LTp4xiT + kSqrt5_8 * L2RpxiR;
+     ampl.fMinus3 = -kSqrt18_20 * LTm4xiT;
+     ampl.fPlus3  = -kSqrt18_20 * LTp4xiT;
+     ampl.f0Minus =  a - b;
+     ampl.f0Plus  =  a + b;
      break;
    }
    case (kP31_1910) :
@@ -258,12 +260,12 @@ const RSHelicityAmpl &
      double xr       = 2*xi*fkr.R;
      double L2       = TMath::Power(fkr.Lamda, 2);
 
-     fAmpl.fMinus1 = -k1_Sqrt15 * L2 * (fkr.Rminus + xr);
-     fAmpl.fPlus1  = -k1_Sqrt15 * L2 * (fkr.Rplus  + xr);
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -kSqrt4_15 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  = -1.* fAmpl.f0Minus;
+     ampl.fMinus1 = -k1_Sqrt15 * L2 * (fkr.Rminus + xr);
+     ampl.fPlus1  = -k1_Sqrt15 * L2 * (fkr.Rplus  + xr);
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus = -kSqrt4_15 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
+     ampl.f0Plus  = -1.* ampl.f0Minus;
      break;
    }
    case (kP33_1920) :
@@ -273,12 +275,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt15 * L2Rm2xiR;
-     fAmpl.fPlus1  = -k1_Sqrt15 * L2Rp2xiR;
-     fAmpl.fMinus3 = -k1_Sqrt5  * L2Rm2xiR;
-     fAmpl.fPlus3  =  k1_Sqrt5  * L2Rp2xiR;
-     fAmpl.f0Minus = -(2./kSqrt15) * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt15 * L2Rm2xiR;
+     ampl.fPlus1  = -k1_Sqrt15 * L2Rp2xiR;
+     ampl.fMinus3 = -k1_Sqrt5  * L2Rm2xiR;
+     ampl.fPlus3  =  k1_Sqrt5  * L2Rp2xiR;
+     ampl.f0Minus = -(2./kSqrt15) * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kF35_1905) :
@@ -288,12 +290,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt35  * L2Rm2xiR;
-     fAmpl.fPlus1  =  k1_Sqrt35  * L2Rp2xiR;
-     fAmpl.fMinus3 =  kSqrt18_35 * L2Rm2xiR;
-     fAmpl.fPlus3  =  kSqrt18_35 * L2Rp2xiR;
-     fAmpl.f0Minus =  k2_Sqrt35  * L2 * fkr.C;
-     fAmpl.f0Plus  =  -1. * fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt35  * L2Rm2xiR;
+     ampl.fPlus1  =  k1_Sqrt35  * L2Rp2xiR;
+     ampl.fMinus3 =  kSqrt18_35 * L2Rm2xiR;
+     ampl.fPlus3  =  kSqrt18_35 * L2Rp2xiR;
+     ampl.f0Minus =  k2_Sqrt35  * L2 * fkr.C;
+     ampl.f0Plus  =  -1. * ampl.f0Minus;
      break;
    }
    case (kF37_1950) :
@@ -303,12 +305,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  -kSqrt6_35 * L2Rm2xiR;
-     fAmpl.fPlus1  =   kSqrt6_35 * L2Rp2xiR;
-     fAmpl.fMinus3 =  -kSqrt2_7  * L2Rm2xiR;
-     fAmpl.fPlus3  =   kSqrt2_7  * L2Rp2xiR;
-     fAmpl.f0Minus = 2*kSqrt6_35 * L2 * fkr.C;
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  -kSqrt6_35 * L2Rm2xiR;
+     ampl.fPlus1  =   kSqrt6_35 * L2Rp2xiR;
+     ampl.fMinus3 =  -kSqrt2_7  * L2Rm2xiR;
+     ampl.fPlus3  =   kSqrt2_7  * L2Rp2xiR;
+     ampl.f0Minus = 2*kSqrt6_35 * L2 * fkr.C;
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kP11_1710) :
@@ -319,39 +321,39 @@ const RSHelicityAmpl &
      double a       = kSqrt3_8 * (1-2*xi) * L2 * fkr.S;
      double b       = k1_Sqrt6 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 =  k1_Sqrt6 * L2 * Rm3xiR;
-     fAmpl.fPlus1  =  k1_Sqrt6 * L2 * Rp3xiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus =  a-b;
-     fAmpl.f0Plus  =  a+b;
+     ampl.fMinus1 =  k1_Sqrt6 * L2 * Rm3xiR;
+     ampl.fPlus1  =  k1_Sqrt6 * L2 * Rp3xiR;
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus =  a-b;
+     ampl.f0Plus  =  a+b;
      break;
    }
    case (kF17_1970) :
    {
-     fAmpl.fMinus1 = 0.;
-     fAmpl.fPlus1  = 0.;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = 0.;
-     fAmpl.f0Plus  = 0.;
+     ampl.fMinus1 = 0.;
+     ampl.fPlus1  = 0.;
+     ampl.fMinus3 = 0.;
+     ampl.fPlus3  = 0.;
+     ampl.f0Minus = 0.;
+     ampl.f0Plus  = 0.;
      break;
    }
    default:
    {
      LOG("RSHAmpl", pWARN) << "*** UNRECOGNIZED RESONANCE!";
-     fAmpl.fMinus1 = 0.;
-     fAmpl.fPlus1  = 0.;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = 0.;
-     fAmpl.f0Plus  = 0.;
+     ampl.fMinus1 = 0.;
+     ampl.fPlus1  = 0.;
+     ampl.fMinus3 = 0.;
+     ampl.fPlus3  = 0.;
+     ampl.f0Minus = 0.;
+     ampl.f0Plus  = 0.;
      break;
    }
 
   }//switch
 
-  return fAmpl;
+  return ampl;
 }
 //____________________________________________________________________________
 void RSHelicityAmplModelNCp::Configure(const Registry & config)
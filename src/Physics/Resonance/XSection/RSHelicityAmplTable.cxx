@@ -0,0 +1,106 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TMath.h>
+
+#include "Framework/Conventions/Controls.h"
+#include "Physics/Resonance/XSection/RSHelicityAmplTable.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+RSHelicityAmplTable::RSHelicityAmplTable(unsigned int ncomp,
+     unsigned int nW, double Wmin, double Wmax, unsigned int nQ2, double Q2max)
+{
+  assert(ncomp > 0 && nW > 1 && nQ2 > 1);
+  assert(Wmax > Wmin && Q2max > 0.);
+
+  fNComp = ncomp;
+  fNW    = nW;
+  fNQ2   = nQ2;
+  fWmin  = Wmin;
+  fDW    = (Wmax - Wmin) / (nW - 1);
+  fTmin  = this->T(Q2max);
+  fDT    = (1. - fTmin) / (nQ2 - 1);
+
+  fValues.assign(fNW * fNQ2 * fNComp, 0.);
+}
+//____________________________________________________________________________
+RSHelicityAmplTable::~RSHelicityAmplTable()
+{
+
+}
+//____________________________________________________________________________
+double RSHelicityAmplTable::T(double Q2) const
+{
+  return 1. / (1. + Q2/controls::kMQD2);
+}
+//____________________________________________________________________________
+double RSHelicityAmplTable::W(unsigned int iW) const
+{
+  return fWmin + iW * fDW;
+}
+//____________________________________________________________________________
+double RSHelicityAmplTable::Q2(unsigned int iQ2) const
+{
+  // node iQ2=0 is at Q2max, node fNQ2-1 is at Q2=0
+  double t = TMath::Min(1., fTmin + iQ2 * fDT);
+  return controls::kMQD2 * (1./t - 1.);
+}
+//____________________________________________________________________________
+void RSHelicityAmplTable::Set(
+          unsigned int iW, unsigned int iQ2, const double * values)
+{
+  assert(iW < fNW && iQ2 < fNQ2);
+
+  double * node = &fValues[(iW * fNQ2 + iQ2) * fNComp];
+  for(unsigned int ic = 0; ic < fNComp; ic++) {
+    node[ic] = values[ic];
+  }
+}
+//____________________________________________________________________________
+bool RSHelicityAmplTable::Evaluate(
+                            double W, double Q2, double * values) const
+{
+  if(Q2 < 0.) return false;
+
+  double uW = (W - fWmin) / fDW;
+  double uT = (this->T(Q2) - fTmin) / fDT;
+
+  if(uW < 0. || uW > fNW  - 1) return false;
+  if(uT < 0. || uT > fNQ2 - 1) return false;
+
+  unsigned int iW  = TMath::Min((unsigned int) uW, fNW  - 2);
+  unsigned int iQ2 = TMath::Min((unsigned int) uT, fNQ2 - 2);
+
+  double fW = uW - iW;
+  double fT = uT - iQ2;
+
+  double w00 = (1.-fW) * (1.-fT);
+  double w01 = (1.-fW) * fT;
+  double w10 = fW * (1.-fT);
+  double w11 = fW * fT;
+
+  const double * n00 = &fValues[( iW    * fNQ2 + iQ2    ) * fNComp];
+  const double * n01 = &fValues[( iW    * fNQ2 + iQ2 + 1) * fNComp];
+  const double * n10 = &fValues[((iW+1) * fNQ2 + iQ2    ) * fNComp];
+  const double * n11 = &fValues[((iW+1) * fNQ2 + iQ2 + 1) * fNComp];
+
+  for(unsigned int ic = 0; ic < fNComp; ic++) {
+    values[ic] = w00*n00[ic] + w01*n01[ic] + w10*n10[ic] + w11*n11[ic];
+  }
+  return true;
+}
+//____________________________________________________________________________
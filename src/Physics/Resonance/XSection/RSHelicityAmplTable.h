@@ -0,0 +1,72 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RSHelicityAmplTable
+
+\brief    Tabulation of (sums of) squared Rein-Sehgal helicity amplitudes for
+          a single baryon resonance / helicity amplitude model / nucleon, on
+          a regular grid in W and in t = 1/(1+Q2/controls::kMQD2).
+          The (dipole-like) Q2 mapping concentrates the grid points at low Q2
+          where the FKR form factors vary fastest.
+
+          Each grid node holds NComp() components which are interpolated
+          bilinearly. Evaluate() returns false outside the tabulated range
+          so that the caller can fall back to the direct calculation.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _RS_HELICITY_AMPL_TABLE_H_
+#define _RS_HELICITY_AMPL_TABLE_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class RSHelicityAmplTable {
+
+public:
+  RSHelicityAmplTable(unsigned int ncomp,
+     unsigned int nW, double Wmin, double Wmax, unsigned int nQ2, double Q2max);
+ ~RSHelicityAmplTable();
+
+  unsigned int NComp (void) const { return fNComp; }
+  unsigned int NW    (void) const { return fNW;    }
+  unsigned int NQ2   (void) const { return fNQ2;   }
+
+  //! Kinematics at grid node (iW,iQ2)
+  double W  (unsigned int iW ) const;
+  double Q2 (unsigned int iQ2) const;
+
+  //! Store the NComp() values computed at grid node (iW,iQ2)
+  void Set (unsigned int iW, unsigned int iQ2, const double * values);
+
+  //! Interpolate all components at (W,Q2). Returns false if outside the grid
+  bool Evaluate (double W, double Q2, double * values) const;
+
+private:
+
+  double T (double Q2) const;
+
+  unsigned int   fNComp;
+  unsigned int   fNW;
+  unsigned int   fNQ2;
+  double         fWmin;
+  double         fDW;
+  double         fTmin;
+  double         fDT;
+  vector<double> fValues;  ///< [iW][iQ2][icomp]
+};
+
+}      // genie namespace
+
+#endif // _RS_HELICITY_AMPL_TABLE_H_
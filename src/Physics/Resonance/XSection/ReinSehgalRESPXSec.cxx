@@ -21,10 +21,16 @@
    Pick nutau/nutaubar scaling factors from new location.
  @ May 01, 2016 - Libo Jiang
    Add W dependence to Delta->N gamma
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The FKR parameters are computed in a local object and the helicity
+   amplitude tables are built under a lock, so that an instance can be used
+   by several event generation threads.
 
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
 #include <TMath.h>
 #include <TSystem.h>
 
@@ -47,6 +53,7 @@
 #include "Physics/Resonance/XSection/ReinSehgalRESPXSec.h"
 #include "Physics/Resonance/XSection/RSHelicityAmplModelI.h"
 #include "Physics/Resonance/XSection/RSHelicityAmpl.h"
+#include "Physics/Resonance/XSection/RSHelicityAmplTable.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Physics/NuclearState/FermiMomentumTablePool.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
@@ -55,6 +62,11 @@
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // guards the lazily filled helicity amplitude tables
+  std::mutex gHAmplTablesMutex;
+}
+
 //____________________________________________________________________________
 ReinSehgalRESPXSec::ReinSehgalRESPXSec() :
 XSecAlgorithmI("genie::ReinSehgalRESPXSec")
@@ -74,17 +86,53 @@ ReinSehgalRESPXSec::~ReinSehgalRESPXSec()
 {
   if(fNuTauRdSpl)    delete fNuTauRdSpl;
   if(fNuTauBarRdSpl) delete fNuTauBarRdSpl;
+
+  this->DeleteHelicityAmplTables();
 }
 //____________________________________________________________________________
 double ReinSehgalRESPXSec::XSec(
                  const Interaction * interaction, KinePhaseSpace_t kps) const
 {
   if(! this -> ValidProcess    (interaction) ) return 0.;
-  if(! this -> ValidKinematics (interaction) ) return 0.;
 
-  const InitialState & init_state = interaction -> InitState();
-  const ProcessInfo &  proc_info  = interaction -> ProcInfo();
-  const Target & target = init_state.Tgt();
+  RESInitStateParams ist;
+  this->InitStateParams(interaction, ist);
+
+  return this->KineXSec(interaction, kps, ist);
+}
+//____________________________________________________________________________
+void ReinSehgalRESPXSec::BatchXSec(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    unsigned int npoints, unsigned int nkv, const KineVar_t * kv,
+    const double * kine, double * xsec) const
+{
+// The init-state & resonance dependent quantities (resonance parameters,
+// helicity amplitude model, Fermi momentum lookup, nutau reduction factor,
+// scaling factors) are computed only once for the whole batch
+
+  bool valid = this->ValidProcess(interaction);
+
+  RESInitStateParams ist;
+  if(valid) this->InitStateParams(interaction, ist);
+
+  Interaction in(*interaction);
+  in.CopyFlags(*interaction);
+  Kinematics * kinematics = in.KinePtr();
+
+  for(unsigned int i = 0; i < npoints; i++) {
+    if(!valid || ist.Zero) { xsec[i] = 0.; continue; }
+    for(unsigned int j = 0; j < nkv; j++) {
+      kinematics->SetKV(kv[j], kine[i*nkv + j]);
+    }
+    xsec[i] = this->KineXSec(&in, kps, ist);
+  }
+}
+//____________________________________________________________________________
+double ReinSehgalRESPXSec::KineXSec(const Interaction * interaction,
+                 KinePhaseSpace_t kps, const RESInitStateParams & ist) const
+{
+  if(ist.Zero) return 0.;
+  if(! this -> ValidKinematics (interaction) ) return 0.;
 
   // Get kinematical parameters
   const Kinematics & kinematics = interaction -> Kine();
@@ -103,34 +151,23 @@ double ReinSehgalRESPXSec::XSec(
     }
   }
 
-  // Get the input baryon resonance
-  Resonance_t resonance = interaction->ExclTag().Resonance();
-  string      resname   = utils::res::AsString(resonance);
-  bool        is_delta  = utils::res::IsDelta (resonance);
-
-  // Get the neutrino, hit nucleon & weak current
-  int  nucpdgc   = target.HitNucPdg();
-  int  probepdgc = init_state.ProbePdg();
-  bool is_nu     = pdg::IsNeutrino         (probepdgc);
-  bool is_nubar  = pdg::IsAntiNeutrino     (probepdgc);
-  bool is_lplus  = pdg::IsPosChargedLepton (probepdgc);
-  bool is_lminus = pdg::IsNegChargedLepton (probepdgc);
-  bool is_p      = pdg::IsProton  (nucpdgc);
-  bool is_n      = pdg::IsNeutron (nucpdgc);
-  bool is_CC     = proc_info.IsWeakCC();
-  bool is_NC     = proc_info.IsWeakNC();
-  bool is_EM     = proc_info.IsEM();
-
-  if(is_CC && !is_delta) {
-    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
-  }
+  // Get the input baryon resonance, neutrino, hit nucleon & weak current
+  bool is_delta  = ist.IsDelta;
+  bool is_nu     = ist.IsNu;
+  bool is_nubar  = ist.IsNuBar;
+  bool is_lplus  = ist.IsLPlus;
+  bool is_lminus = ist.IsLMinus;
+  bool is_p      = ist.IsP;
+  bool is_n      = ist.IsN;
+  bool is_CC     = ist.IsCC;
+  bool is_EM     = ist.IsEM;
 
   // Get baryon resonance parameters
-  int    IR  = utils::res::ResonanceIndex    (resonance);
-  int    LR  = utils::res::OrbitalAngularMom (resonance);
-  double MR  = utils::res::Mass              (resonance);
-  double WR  = utils::res::Width             (resonance);
-  double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+  int    IR  = ist.IR;
+  int    LR  = ist.LR;
+  double MR  = ist.MR;
+  double WR  = ist.WR;
+  double NR  = ist.NR;
 
   // Following NeuGEN, avoid problems with underlying unphysical
   // model assumptions by restricting the allowed W phase space
@@ -142,8 +179,8 @@ double ReinSehgalRESPXSec::XSec(
   }
 
   // Compute auxiliary & kinematical factors 
-  double E      = init_state.ProbeE(kRfHitNucRest);
-  double Mnuc   = target.HitNucMass(); 
+  double E      = ist.E;
+  double Mnuc   = ist.Mnuc;
   double W2     = TMath::Power(W,    2);
   double Mnuc2  = TMath::Power(Mnuc, 2);
   double k      = 0.5 * (W2 - Mnuc2)/Mnuc;
@@ -163,66 +200,15 @@ double ReinSehgalRESPXSec::XSec(
      << "Kinematical params V = " << V << ", U = " << U;
 #endif
 
-  // Calculate the Feynman-Kislinger-Ravndall parameters
-
-  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
-  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
-  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+  // Sums of the squared Rein-Sehgal helicity amplitudes. They depend only
+  // on W & q2 (for given resonance, nucleon & helicity amplitude model),
+  // so they are looked-up from the (optional) pre-computed table
 
-  if(is_EM) { 
-    GA = 0.; // zero the axial term for EM scattering
+  double hsums[3];
+  if(!ist.HAmplTable || !ist.HAmplTable->Evaluate(W, -q2, hsums)) {
+    this->HelicityAmplSums(ist, W, q2, hsums);
   }
 
-  double d      = TMath::Power(W+Mnuc,2.) - q2;
-  double sq2omg = TMath::Sqrt(2./fOmega);
-  double nomg   = IR * fOmega;
-  double mq_w   = Mnuc*Q/W;
-
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("FKR", pDEBUG) 
-     << "FKR params for RES = " << resname << " : " << fFKR;
-#endif
-
-  // Calculate the Rein-Sehgal Helicity Amplitudes
-
-  const RSHelicityAmplModelI * hamplmod = 0;
-  if(is_CC) { 
-    hamplmod = fHAmplModelCC; 
-  }
-  else 
-  if(is_NC) { 
-    if (is_p) { hamplmod = fHAmplModelNCp;}
-    else      { hamplmod = fHAmplModelNCn;}
-  }
-  else 
-  if(is_EM) { 
-    if (is_p) { hamplmod = fHAmplModelEMp;}
-    else      { hamplmod = fHAmplModelEMn;}
-  }
-  assert(hamplmod);
-  
-  const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR); 
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("RSHAmpl", pDEBUG)
-     << "Helicity Amplitudes for RES = " << resname << " : " << hampl;
-#endif
-
   double g2 = kGF2;
   if(is_CC) g2 = kGF2*fVud2;
   // For EM interaction replace  G_{Fermi} with :
@@ -245,9 +231,9 @@ double ReinSehgalRESPXSec::XSec(
   double sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
   double scLR = W/Mnuc;
   double scS  = (Mnuc/W)*(-Q2/q2);
-  double sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
-  double sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
-  double sigS = scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
+  double sigL = scLR* hsums[0];
+  double sigR = scLR* hsums[1];
+  double sigS = scS * hsums[2];
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("ReinSehgalRes", pDEBUG) << "sig_{0} = " << sig0;
@@ -286,28 +272,15 @@ double ReinSehgalRESPXSec::XSec(
   } 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("ReinSehgalRes", pDEBUG) 
-       << "BreitWigner(RES=" << resname << ", W=" << W << ") = " << bw;
+       << "BreitWigner(RES=" << utils::res::AsString(ist.Res) << ", W=" << W << ") = " << bw;
 #endif
   xsec *= bw; 
 
   // Apply NeuGEN nutau cross section reduction factors
-  double rf = 1.0;
-  Spline * spl = 0;
-  if (is_CC && fUsingNuTauScaling) {
-    if      (pdg::IsNuTau    (probepdgc)) spl = fNuTauRdSpl;
-    else if (pdg::IsAntiNuTau(probepdgc)) spl = fNuTauBarRdSpl;
-
-    if(spl) {
-      if(E <spl->XMax()) rf = spl->Evaluate(E);
-    }
-  }
-  xsec *= rf;
+  xsec *= ist.NuTauRF;
 
   // Apply given scaling factor
-  double xsec_scale = 1.;
-  if      (is_CC) { xsec_scale = fXSecScaleCC; }
-  else if (is_NC) { xsec_scale = fXSecScaleNC; }
-  xsec *= xsec_scale;
+  xsec *= ist.XSecScale;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("ReinSehgalRes", pINFO) 
@@ -326,16 +299,10 @@ double ReinSehgalRESPXSec::XSec(
   if( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
 
   
-  int Z = target.Z();
-  int A = target.A();
-  int N = A-Z;
-  
   // Take into account the number of scattering centers in the target
-  int NNucl = (is_p) ? Z : N;
-
-  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor) 
+  xsec*=ist.NNucl; // nuclear xsec (no nuclear suppression factor) 
   
-  if (fUsePauliBlocking && A!=1)
+  if (fUsePauliBlocking && ist.PFermi >= 0.)
   {
      // Calculation of Pauli blocking according references:
      //
@@ -351,23 +318,8 @@ double ReinSehgalRESPXSec::XSec(
      //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013     
      //         [arXiv: hep-ph/0308130].                                     
   
-     double P_Fermi = 0.0;
-  
      // Maximum value of Fermi momentum of target nucleon (GeV)
-     if (A<6 || !fUseRFGParametrization)
-     {
-         // Look up the Fermi momentum for this target
-         FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-         const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
-         P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
-     }
-     else {
-        // Define the Fermi momentum for this target
-        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
-        // Correct the Fermi momentum for the struck nucleon
-        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
-        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
-     }
+     double P_Fermi = ist.PFermi;
   
      double FactorPauli_RES = 1.0;
   
@@ -394,6 +346,225 @@ double ReinSehgalRESPXSec::XSec(
   return xsec;
 }
 //____________________________________________________________________________
+void ReinSehgalRESPXSec::HelicityAmplSums(const RESInitStateParams & ist,
+                             double W, double q2, double * sums) const
+{
+  Resonance_t resonance = ist.Res;
+  int    IR    = ist.IR;
+  double Mnuc  = ist.Mnuc;
+  double W2    = TMath::Power(W,    2);
+  double Mnuc2 = TMath::Power(Mnuc, 2);
+  double k     = 0.5 * (W2 - Mnuc2)/Mnuc;
+  double v     = k - 0.5 * q2/Mnuc;
+  double v2    = TMath::Power(v, 2);
+  double Q2    = v2 - q2;
+  double Q     = TMath::Sqrt(Q2);
+
+  // Calculate the Feynman-Kislinger-Ravndall parameters
+
+  FKR fkr;
+
+  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
+  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
+  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+
+  if(ist.IsEM) { 
+    GA = 0.; // zero the axial term for EM scattering
+  }
+
+  double d      = TMath::Power(W+Mnuc,2.) - q2;
+  double sq2omg = TMath::Sqrt(2./fOmega);
+  double nomg   = IR * fOmega;
+  double mq_w   = Mnuc*Q/W;
+
+  fkr.Lamda  = sq2omg * mq_w;
+  fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.R      = fkr.Rv;
+  fkr.Rplus  = - (fkr.Rv + fkr.Ra);
+  fkr.Rminus = - (fkr.Rv - fkr.Ra);
+  fkr.T      = fkr.Tv;
+  fkr.Tplus  = - (fkr.Tv + fkr.Ta);
+  fkr.Tminus = - (fkr.Tv - fkr.Ta);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("FKR", pDEBUG) 
+     << "FKR params for RES = " << utils::res::AsString(resonance) << " : " << fkr;
+#endif
+
+  // Calculate the Rein-Sehgal Helicity Amplitudes
+
+  const RSHelicityAmpl & hampl = ist.HAmplModel->Compute(resonance, fkr); 
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("RSHAmpl", pDEBUG)
+     << "Helicity Amplitudes for RES = " << utils::res::AsString(resonance)
+     << " : " << hampl;
+#endif
+
+  sums[0] = hampl.Amp2Plus3 () + hampl.Amp2Plus1 ();
+  sums[1] = hampl.Amp2Minus3() + hampl.Amp2Minus1();
+  sums[2] = hampl.Amp20Plus () + hampl.Amp20Minus();
+}
+//____________________________________________________________________________
+const RSHelicityAmplTable * ReinSehgalRESPXSec::HelicityAmplTable(
+                                     const RESInitStateParams & ist) const
+{
+// The helicity amplitude sums depend on the resonance, the helicity amplitude
+// model and (through its mass) the hit nucleon, but not on the probe energy.
+// Tables are built on first use and kept until the algorithm is reconfigured
+
+  HAmplTableKey_t key(ist.HAmplModel, 2*(int)ist.Res + (ist.IsP ? 0 : 1));
+
+  std::lock_guard<std::mutex> lock(gHAmplTablesMutex);
+
+  map<HAmplTableKey_t, RSHelicityAmplTable *>::const_iterator it =
+                                                    fHAmplTables.find(key);
+  if(it != fHAmplTables.end()) return it->second;
+
+  LOG("ReinSehgalRes", pNOTICE)
+     << "Tabulating helicity amplitudes for RES = "
+     << utils::res::AsString(ist.Res) << " on nucleon = " << ist.NucPdg;
+
+  RSHelicityAmplTable * table = new RSHelicityAmplTable(3,
+     fHAmplTableNW,  fHAmplTableWMin, fHAmplTableWMax,
+     fHAmplTableNQ2, fHAmplTableQ2Max);
+
+  double sums[3];
+  for(unsigned int iW = 0; iW < table->NW(); iW++) {
+    for(unsigned int iQ2 = 0; iQ2 < table->NQ2(); iQ2++) {
+      this->HelicityAmplSums(ist, table->W(iW), -table->Q2(iQ2), sums);
+      table->Set(iW, iQ2, sums);
+    }
+  }
+
+  fHAmplTables.insert(
+     map<HAmplTableKey_t, RSHelicityAmplTable *>::value_type(key, table));
+
+  return table;
+}
+//____________________________________________________________________________
+void ReinSehgalRESPXSec::DeleteHelicityAmplTables(void)
+{
+  map<HAmplTableKey_t, RSHelicityAmplTable *>::iterator it;
+  for(it = fHAmplTables.begin(); it != fHAmplTables.end(); ++it) {
+    delete it->second;
+  }
+  fHAmplTables.clear();
+}
+//____________________________________________________________________________
+void ReinSehgalRESPXSec::InitStateParams(
+       const Interaction * interaction, RESInitStateParams & ist) const
+{
+  const InitialState & init_state = interaction -> InitState();
+  const ProcessInfo &  proc_info  = interaction -> ProcInfo();
+  const Target & target = init_state.Tgt();
+
+  // Get the input baryon resonance
+  Resonance_t resonance = interaction->ExclTag().Resonance();
+  ist.Res      = resonance;
+  ist.IsDelta  = utils::res::IsDelta (resonance);
+
+  // Get the neutrino, hit nucleon & weak current
+  int  nucpdgc   = target.HitNucPdg();
+  int  probepdgc = init_state.ProbePdg();
+  ist.NucPdg   = nucpdgc;
+  ist.ProbePdg = probepdgc;
+  ist.IsNu     = pdg::IsNeutrino         (probepdgc);
+  ist.IsNuBar  = pdg::IsAntiNeutrino     (probepdgc);
+  ist.IsLPlus  = pdg::IsPosChargedLepton (probepdgc);
+  ist.IsLMinus = pdg::IsNegChargedLepton (probepdgc);
+  ist.IsP      = pdg::IsProton  (nucpdgc);
+  ist.IsN      = pdg::IsNeutron (nucpdgc);
+  ist.IsCC     = proc_info.IsWeakCC();
+  ist.IsNC     = proc_info.IsWeakNC();
+  ist.IsEM     = proc_info.IsEM();
+
+  ist.Zero = false;
+  if(ist.IsCC && !ist.IsDelta) {
+    if((ist.IsNu && ist.IsP) || (ist.IsNuBar && ist.IsN)) ist.Zero = true;
+  }
+
+  // Get baryon resonance parameters
+  ist.IR = utils::res::ResonanceIndex    (resonance);
+  ist.LR = utils::res::OrbitalAngularMom (resonance);
+  ist.MR = utils::res::Mass              (resonance);
+  ist.WR = utils::res::Width             (resonance);
+  ist.NR = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+
+  ist.E    = init_state.ProbeE(kRfHitNucRest);
+  ist.Mnuc = target.HitNucMass();
+
+  // Rein-Sehgal helicity amplitude model
+  ist.HAmplModel = 0;
+  if(ist.IsCC) {
+    ist.HAmplModel = fHAmplModelCC;
+  }
+  else
+  if(ist.IsNC) {
+    if (ist.IsP) { ist.HAmplModel = fHAmplModelNCp;}
+    else         { ist.HAmplModel = fHAmplModelNCn;}
+  }
+  else
+  if(ist.IsEM) {
+    if (ist.IsP) { ist.HAmplModel = fHAmplModelEMp;}
+    else         { ist.HAmplModel = fHAmplModelEMn;}
+  }
+  assert(ist.HAmplModel);
+
+  // Pre-computed helicity amplitude table, if requested
+  ist.HAmplTable = (fUseHAmplTables) ? this->HelicityAmplTable(ist) : 0;
+
+  // NeuGEN nutau cross section reduction factors
+  ist.NuTauRF = 1.0;
+  Spline * spl = 0;
+  if (ist.IsCC && fUsingNuTauScaling) {
+    if      (pdg::IsNuTau    (probepdgc)) spl = fNuTauRdSpl;
+    else if (pdg::IsAntiNuTau(probepdgc)) spl = fNuTauBarRdSpl;
+
+    if(spl) {
+      if(ist.E <spl->XMax()) ist.NuTauRF = spl->Evaluate(ist.E);
+    }
+  }
+
+  // Given scaling factor
+  ist.XSecScale = 1.;
+  if      (ist.IsCC) { ist.XSecScale = fXSecScaleCC; }
+  else if (ist.IsNC) { ist.XSecScale = fXSecScaleNC; }
+
+  // Number of scattering centers in the target
+  int Z = target.Z();
+  int A = target.A();
+  int N = A-Z;
+  ist.NNucl = (ist.IsP) ? Z : N;
+
+  // Maximum value of Fermi momentum of target nucleon (GeV), for Pauli
+  // blocking (negative if not applicable)
+  ist.PFermi = -1.;
+  if (fUsePauliBlocking && A!=1)
+  {
+     if (A<6 || !fUseRFGParametrization)
+     {
+         // Look up the Fermi momentum for this target
+         FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+         const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
+         ist.PFermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
+     }
+     else {
+        // Define the Fermi momentum for this target
+        ist.PFermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
+        // Correct the Fermi momentum for the struck nucleon
+        if(ist.IsP) { ist.PFermi *= TMath::Power( 2.*Z/A, 1./3); }
+        else        { ist.PFermi *= TMath::Power( 2.*N/A, 1./3); }
+     }
+  }
+}
+//____________________________________________________________________________
 double ReinSehgalRESPXSec::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
@@ -511,6 +682,17 @@ void ReinSehgalRESPXSec::LoadConfig(void)
   this->GetParamDef( "MaxNWidthForN0Res", fN0ResMaxNWidths, 6.0 ) ;
   this->GetParamDef( "MaxNWidthForGNRes", fGnResMaxNWidths, 4.0 ) ;
 
+  // Optionally, tabulate the helicity amplitudes on a (W,Q2) grid rather
+  // than computing them at every kinematical point. Outside the grid the
+  // amplitudes are still computed directly
+  this->DeleteHelicityAmplTables();
+  this->GetParamDef( "UseHelicityAmplTables",  fUseHAmplTables,  false ) ;
+  this->GetParamDef( "HelicityAmplTable-NW",   fHAmplTableNW,    200   ) ;
+  this->GetParamDef( "HelicityAmplTable-NQ2",  fHAmplTableNQ2,   200   ) ;
+  this->GetParamDef( "HelicityAmplTable-WMin", fHAmplTableWMin,  1.0   ) ;
+  this->GetParamDef( "HelicityAmplTable-WMax", fHAmplTableWMax,  3.5   ) ;
+  this->GetParamDef( "HelicityAmplTable-Q2Max",fHAmplTableQ2Max, 10.0  ) ;
+
   // NeuGEN reduction factors for nu_tau: a gross estimate of the effect of
   // neglected form factors in the R/S model
   this->GetParamDef( "UseNuTauScalingFactors", fUsingNuTauScaling, true ) ;
@@ -82,8 +82,12 @@ ReinSehgalRESXSecWithCacheFast::~ReinSehgalRESXSecWithCacheFast()
 void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSec(
                                                  const Interaction * in) const
 {
-// Cache resonance neutrino production data from free nucleons
+// Cache resonance neutrino production data from free nucleons.
+// Runs with the cache locked and skips the branches another thread has
+// created meanwhile; each branch is added once complete, as it is read
+// without locking.
 
+  CacheLock lock;
   Cache * cache = Cache::Instance();
 
   assert(fSingleResXSecModel);
@@ -118,17 +122,15 @@ void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSec(
          // Get a unique cache branch name
          string key = this->CacheBranchName(res, wkcur, nu_code, nuc_code);
 
-         // Make sure the cache branch does not already exists
+         // Skip the cache branch if it already exists
          CacheBranchFx * cache_branch =
              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
-         assert(!cache_branch);
+         if(cache_branch) continue;
 
          // Create the new cache branch
          LOG("ReinSehgalResCF", pNOTICE)
                         << "\n ** Creating cache branch - key = " << key;
          cache_branch = new CacheBranchFx("RES Excitation XSec");
-         cache->AddCacheBranch(key, cache_branch);
-         assert(cache_branch);
 
          const KPhaseSpace & kps = interaction->PhaseSpace();
          double Ethr = kps.Threshold();
@@ -195,8 +197,9 @@ void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSec(
                << " x 1E-38 cm^2";
          }//spline knots
 
-         // Build the spline
+         // Build the spline and add the complete branch to the cache
          cache_branch->CreateSpline();
+         cache->AddCacheBranch(key, cache_branch);
   }//ires
 
   delete [] E;
@@ -70,7 +70,7 @@ void SKKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
-  fXSecModel = evg->CrossSectionAlg();
+  this->SetXSecModel(evg->CrossSectionAlg());
   CalculateKin_AtharSingleKaon(evrec);
 }
 //___________________________________________________________________________
@@ -189,7 +189,7 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
 
 
      // computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSTkTlctl);
+     xsec = this->XSecModel()->XSec(interaction, kPSTkTlctl);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -308,7 +308,7 @@ double SKKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
         in->KinePtr()->SetKV(kKVctl, ctl);
         in->KinePtr()->SetKV(kKVphikq, phikq);
 
-        double xsec = fXSecModel->XSec(in, kPSTkTlctl);
+        double xsec = this->XSecModel()->XSec(in, kPSTkTlctl);
 
         // xsec returned by model is d4sigma/(dtk dtl dcosthetal dphikq)
         // convert lepton theta to log(1-costheta) by multiplying by jacobian 1 - costheta
@@ -333,7 +333,7 @@ double SKKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("SKKinematics", pDEBUG) << in->AsString();
   SLOG("SKKinematics", pDEBUG) << "Max xsec in phase space = " << max_xsec;
-  SLOG("SKKinematics", pDEBUG) << "Computed using alg = " << fXSecModel->Id();
+  SLOG("SKKinematics", pDEBUG) << "Computed using alg = " << this->XSecModel()->Id();
 #endif
 
 
@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The form factors are computed in a local object rather than in a mutable
+   data member, so that an instance can be used by several threads.
 
 */
 //____________________________________________________________________________
@@ -94,12 +97,14 @@ double PaisQELLambdaPXSec::XSec(
   int sign = (is_neutrino) ? -1 : 1;
 
 // Calculate the QEL form factors
-  fFormFactors.Calculate(interaction);
+  QELFormFactors form_factors;
+  form_factors.SetModel(fFormFactorsModel);
+  form_factors.Calculate(interaction);
 
-  double F1V   = fFormFactors.F1V();
-  double xiF2V = fFormFactors.xiF2V();
-  double FA    = fFormFactors.FA();
-//  double Fp    = fFormFactors.Fp();
+  double F1V   = form_factors.F1V();
+  double xiF2V = form_factors.xiF2V();
+  double FA    = form_factors.FA();
+//  double Fp    = form_factors.Fp();
 
 // calculate w coefficients
    //start with Mass terms
@@ -234,7 +239,6 @@ void PaisQELLambdaPXSec::LoadConfig(void)
   fFormFactorsModel = dynamic_cast<const QELFormFactorsModelI *> (
                                              this->SubAlg("FormFactorsAlg"));
   assert(fFormFactorsModel);
-  fFormFactors.SetModel(fFormFactorsModel); // <-- attach algorithm
 
   // load XSec Integrator
   fXSecIntegrator =
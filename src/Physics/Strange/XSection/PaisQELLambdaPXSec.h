@@ -59,7 +59,6 @@ private:
   void  LoadConfig (void);
   double MHyperon(const Interaction * interaction) const;
 
-  mutable QELFormFactors          fFormFactors;
   const   QELFormFactorsModelI *  fFormFactorsModel; 
   const   XSecIntegratorI *       fXSecIntegrator;
   double                          fSin8c2; 
@@ -69,6 +69,20 @@ ROOT::Math::IBaseFunctionOneDim *
   return
     new genie::utils::gsl::dXSec_dQ2_E(fModel,fInteraction);
 }
+unsigned int genie::utils::gsl::dXSec_dQ2_E::BatchKine(
+     const double * xin, KineVar_t * kv, double * kine) const
+{
+  kv[0] = kKVQ2; kine[0] = xin[0];
+  return 1;
+}
+KinePhaseSpace_t genie::utils::gsl::dXSec_dQ2_E::BatchPhaseSpace(void) const
+{
+  return kPSQ2fE;
+}
+double genie::utils::gsl::dXSec_dQ2_E::BatchScale(void) const
+{
+  return 1./(1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::dXSec_dy_E::dXSec_dy_E(
      const XSecAlgorithmI * m, const Interaction * i) :
@@ -146,6 +160,28 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dxdy_E(fModel,fInteraction);
 }
+unsigned int genie::utils::gsl::d2XSec_dxdy_E::BatchKine(
+     const double * xin, KineVar_t * kv, double * kine) const
+{
+  Kinematics * kinem = fInteraction->KinePtr();
+  kinem->Setx(xin[0]);
+  kinem->Sety(xin[1]);
+  kinematics::UpdateWQ2FromXY(fInteraction);
+  kv[0] = kKVx;
+  kv[1] = kKVy;
+  kv[2] = kKVQ2;
+  kv[3] = kKVW;
+  for(unsigned int i = 0; i < 4; i++) kine[i] = kinem->GetKV(kv[i]);
+  return 4;
+}
+KinePhaseSpace_t genie::utils::gsl::d2XSec_dxdy_E::BatchPhaseSpace(void) const
+{
+  return kPSxyfE;
+}
+double genie::utils::gsl::d2XSec_dxdy_E::BatchScale(void) const
+{
+  return 1./(1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dy_E::d2XSec_dQ2dy_E(
      const XSecAlgorithmI * m, const Interaction * i) :
@@ -185,6 +221,27 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dQ2dy_E(fModel,fInteraction);
 }
+unsigned int genie::utils::gsl::d2XSec_dQ2dy_E::BatchKine(
+     const double * xin, KineVar_t * kv, double * kine) const
+{
+  Kinematics * kinem = fInteraction->KinePtr();
+  kinem->SetQ2(xin[0]);
+  kinem->Sety(xin[1]);
+  kinematics::UpdateXFromQ2Y(fInteraction);
+  kv[0] = kKVQ2;
+  kv[1] = kKVy;
+  kv[2] = kKVx;
+  for(unsigned int i = 0; i < 3; i++) kine[i] = kinem->GetKV(kv[i]);
+  return 3;
+}
+KinePhaseSpace_t genie::utils::gsl::d2XSec_dQ2dy_E::BatchPhaseSpace(void) const
+{
+  return kPSQ2yfE;
+}
+double genie::utils::gsl::d2XSec_dQ2dy_E::BatchScale(void) const
+{
+  return 1./(1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dydt_E::d2XSec_dQ2dydt_E(
      const XSecAlgorithmI * m, const Interaction * i) :
@@ -228,6 +285,29 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dQ2dydt_E(fModel,fInteraction);
 }
+unsigned int genie::utils::gsl::d2XSec_dQ2dydt_E::BatchKine(
+     const double * xin, KineVar_t * kv, double * kine) const
+{
+  Kinematics * kinem = fInteraction->KinePtr();
+  kinem->SetQ2(xin[0]);
+  kinem->Sety(xin[1]);
+  kinem->Sett(xin[2]);
+  kinematics::UpdateXFromQ2Y(fInteraction);
+  kv[0] = kKVQ2;
+  kv[1] = kKVy;
+  kv[2] = kKVt;
+  kv[3] = kKVx;
+  for(unsigned int i = 0; i < 4; i++) kine[i] = kinem->GetKV(kv[i]);
+  return 4;
+}
+KinePhaseSpace_t genie::utils::gsl::d2XSec_dQ2dydt_E::BatchPhaseSpace(void) const
+{
+  return kPSQ2yfE;
+}
+double genie::utils::gsl::d2XSec_dQ2dydt_E::BatchScale(void) const
+{
+  return 1./(1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d3XSec_dxdydt_E::d3XSec_dxdydt_E(
      const XSecAlgorithmI * m, const Interaction * i) :
@@ -270,6 +350,22 @@ ROOT::Math::IBaseFunctionMultiDim *
   return
     new genie::utils::gsl::d3XSec_dxdydt_E(fModel,fInteraction);
 }
+unsigned int genie::utils::gsl::d3XSec_dxdydt_E::BatchKine(
+     const double * xin, KineVar_t * kv, double * kine) const
+{
+  kv[0] = kKVx; kine[0] = xin[0];
+  kv[1] = kKVy; kine[1] = xin[1];
+  kv[2] = kKVt; kine[2] = xin[2];
+  return 3;
+}
+KinePhaseSpace_t genie::utils::gsl::d3XSec_dxdydt_E::BatchPhaseSpace(void) const
+{
+  return kPSxytfE;
+}
+double genie::utils::gsl::d3XSec_dxdydt_E::BatchScale(void) const
+{
+  return 1./(1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dWdQ2_E::d2XSec_dWdQ2_E(
      const XSecAlgorithmI * m, const Interaction * i) :
@@ -317,6 +413,33 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dWdQ2_E(fModel,fInteraction);
 }
+unsigned int genie::utils::gsl::d2XSec_dWdQ2_E::BatchKine(
+     const double * xin, KineVar_t * kv, double * kine) const
+{
+  double W  = xin[0];
+  double Q2 = xin[1];
+  kv[0] = kKVW;  kine[0] = W;
+  kv[1] = kKVQ2; kine[1] = Q2;
+  if(fInteraction->ProcInfo().IsDeepInelastic() ||
+     fInteraction->ProcInfo().IsDarkMatterDeepInelastic()) {
+    double x=0,y=0;
+    double E = fInteraction->InitState().ProbeE(kRfHitNucRest);
+    double M = fInteraction->InitState().Tgt().HitNucP4Ptr()->M();
+    kinematics::WQ2toXY(E,M,W,Q2,x,y);
+    kv[2] = kKVx; kine[2] = x;
+    kv[3] = kKVy; kine[3] = y;
+    return 4;
+  }
+  return 2;
+}
+KinePhaseSpace_t genie::utils::gsl::d2XSec_dWdQ2_E::BatchPhaseSpace(void) const
+{
+  return kPSWQ2fE;
+}
+double genie::utils::gsl::d2XSec_dWdQ2_E::BatchScale(void) const
+{
+  return 1./(1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dxdy_Ex::d2XSec_dxdy_Ex(
      const XSecAlgorithmI * m, const Interaction * i, double x) :
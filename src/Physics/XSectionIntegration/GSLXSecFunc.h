@@ -22,6 +22,9 @@
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
+#include "Framework/Conventions/KineVar.h"
+#include "Framework/Conventions/KinePhaseSpace.h"
+
 namespace genie {
 
 class XSecAlgorithmI;
@@ -46,6 +49,12 @@ public:
   double                            DoEval (double xin) const;
   ROOT::Math::IBaseFunctionOneDim * Clone  (void)             const;
 
+  // batch evaluation (see XSecBatchFunc): the kinematic variables DoEval()
+  // sets at xin, and the phase space & scale of the xsec it returns
+  unsigned int                      BatchKine       (const double * xin, KineVar_t * kv, double * kine) const;
+  KinePhaseSpace_t                  BatchPhaseSpace (void) const;
+  double                            BatchScale      (void) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -88,6 +97,11 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // batch evaluation, see dXSec_dQ2_E
+  unsigned int                        BatchKine       (const double * xin, KineVar_t * kv, double * kine) const;
+  KinePhaseSpace_t                    BatchPhaseSpace (void) const;
+  double                              BatchScale      (void) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -109,6 +123,11 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // batch evaluation, see dXSec_dQ2_E
+  unsigned int                        BatchKine       (const double * xin, KineVar_t * kv, double * kine) const;
+  KinePhaseSpace_t                    BatchPhaseSpace (void) const;
+  double                              BatchScale      (void) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -130,6 +149,11 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // batch evaluation, see dXSec_dQ2_E
+  unsigned int                        BatchKine       (const double * xin, KineVar_t * kv, double * kine) const;
+  KinePhaseSpace_t                    BatchPhaseSpace (void) const;
+  double                              BatchScale      (void) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -151,6 +175,11 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // batch evaluation, see dXSec_dQ2_E
+  unsigned int                        BatchKine       (const double * xin, KineVar_t * kv, double * kine) const;
+  KinePhaseSpace_t                    BatchPhaseSpace (void) const;
+  double                              BatchScale      (void) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -172,6 +201,11 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // batch evaluation, see dXSec_dQ2_E
+  unsigned int                        BatchKine       (const double * xin, KineVar_t * kv, double * kine) const;
+  KinePhaseSpace_t                    BatchPhaseSpace (void) const;
+  double                              BatchScale      (void) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
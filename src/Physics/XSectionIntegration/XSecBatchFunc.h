@@ -0,0 +1,102 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::XSecBatchFunc
+
+\brief    Adapts any of the differential cross section function wrappers of
+          GSLXSecFunc.h (template argument T, constructed from a model and an
+          interaction) to the BatchFunctionMultiDimI interface used by the
+          batch (multi-threaded) integrators.
+          Every worker evaluates its own instance of T, built on its own
+          copy of the interaction and on the cross section model given for
+          that worker. The models must either be distinct instances or be
+          safe to call concurrently.
+          The points of a block are converted to kinematics by T (see
+          T::BatchKine()) and the whole block is handed to the worker's
+          model in a single XSecAlgorithmI::BatchXSec() call.
+
+\author   The GENIE Collaboration
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _XSEC_BATCH_FUNC_H_
+#define _XSEC_BATCH_FUNC_H_
+
+#include <vector>
+
+#include "Framework/Conventions/KineVar.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Numerical/BatchMCIntegrator.h"
+
+using std::vector;
+
+namespace genie {
+
+template<class T> class XSecBatchFunc : public BatchFunctionMultiDimI {
+
+public:
+  XSecBatchFunc(const vector<const XSecAlgorithmI *> & models, const Interaction * in) :
+  fModels(models),
+  fKine  (models.size())
+  {
+    for(unsigned int iw = 0; iw < models.size(); iw++) {
+      Interaction * interaction = new Interaction(*in);
+      interaction->CopyFlags(*in);
+      fInteractions.push_back(interaction);
+      fFuncs.push_back(new T(models[iw], interaction));
+    }
+  }
+ ~XSecBatchFunc()
+  {
+    for(unsigned int iw = 0; iw < fFuncs.size(); iw++) {
+      delete fFuncs[iw];
+      delete fInteractions[iw];
+    }
+  }
+
+  // BatchFunctionMultiDimI interface
+  unsigned int NDim (void) const { return fFuncs[0]->NDim(); }
+  void EvalBatch (unsigned int worker, unsigned int npoints,
+                  const double * x, double * f) const
+  {
+    if(npoints == 0) return;
+
+    const T & func = *fFuncs[worker];
+    unsigned int ndim = func.NDim();
+
+    // kinematic variables at each point of the block, [ip*nkv+ikv]
+    KineVar_t kv[kMaxKV];
+    vector<double> & kine = fKine[worker];
+    if(kine.size() < npoints*kMaxKV) kine.resize(npoints*kMaxKV);
+    unsigned int nkv = func.BatchKine(x, kv, &kine[0]);
+    for(unsigned int ip = 1; ip < npoints; ip++) {
+      func.BatchKine(x + ip*ndim, kv, &kine[ip*nkv]);
+    }
+
+    fModels[worker]->BatchXSec(fInteractions[worker], func.BatchPhaseSpace(),
+                               npoints, nkv, kv, &kine[0], f);
+
+    double scale = func.BatchScale();
+    for(unsigned int ip = 0; ip < npoints; ip++) {
+      f[ip] *= scale;
+    }
+  }
+
+private:
+  static const unsigned int kMaxKV = 4; ///< max kinematic variables set by T
+
+  vector<const XSecAlgorithmI *>  fModels;
+  vector<Interaction *>           fInteractions;
+  vector<T *>                     fFuncs;
+  mutable vector< vector<double> > fKine;  ///< kinematics buffer per worker
+};
+
+}      // genie namespace
+#endif // _XSEC_BATCH_FUNC_H_
@@ -10,35 +10,205 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - The GENIE Collaboration
+   The batch integrators keep their worker threads and the per-worker copies
+   of each cross section model for the life of the integrator, instead of
+   re-creating them for every integral.
 
 */
 //____________________________________________________________________________
 
+#include <cassert>
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BatchMCIntegrator.h"
+#include "Framework/Utils/ThreadPool.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 
 using namespace genie;
 
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI() :
-Algorithm()
+Algorithm(),
+fGSLMinEval(0),
+fBatchNumOfThreads(0),
+fBatchWarmStart(true),
+fLastRelError(0.),
+fLastNCalls(0),
+fBatchThreadPool(0),
+fBatchPoolThreads(0)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI(string name) :
-Algorithm(name)
+Algorithm(name),
+fGSLMinEval(0),
+fBatchNumOfThreads(0),
+fBatchWarmStart(true),
+fLastRelError(0.),
+fLastNCalls(0),
+fBatchThreadPool(0),
+fBatchPoolThreads(0)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI(string name, string config) :
-Algorithm(name, config)
+Algorithm(name, config),
+fGSLMinEval(0),
+fBatchNumOfThreads(0),
+fBatchWarmStart(true),
+fLastRelError(0.),
+fLastNCalls(0),
+fBatchThreadPool(0),
+fBatchPoolThreads(0)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::~XSecIntegratorI()
 {
+  this->DeleteWorkerModels();
+  delete fBatchThreadPool;
+}
+//___________________________________________________________________________
+bool XSecIntegratorI::UseBatchIntegrator(void) const
+{
+  return BatchMCIntegrator::IsBatchType(fGSLIntgType);
+}
+//___________________________________________________________________________
+ThreadPool * XSecIntegratorI::BatchThreadPool(void) const
+{
+// The pool is made at the first batch integration and re-made only if the
+// integrator was reconfigured for a different number of threads (the model
+// copies are then re-made too, as there is one per worker).
+
+  if(fBatchThreadPool && fBatchPoolThreads == fBatchNumOfThreads) {
+    return fBatchThreadPool;
+  }
+  this->DeleteWorkerModels();
+  delete fBatchThreadPool;
+
+  fBatchPoolThreads = fBatchNumOfThreads;
+  fBatchThreadPool  = new ThreadPool(TMath::Max(0, fBatchNumOfThreads));
+
+  return fBatchThreadPool;
+}
+//___________________________________________________________________________
+const vector<const XSecAlgorithmI *> & XSecIntegratorI::WorkerModels(
+     const XSecAlgorithmI * model, unsigned int nworkers) const
+{
+// Each worker needs its own copy of the cross section model (models and
+// their sub-algorithms keep state while evaluating the cross section).
+// A single worker runs on the calling thread and can use the input model.
+// The copies are made at the first integration of each model and reused
+// by all later ones (a spline is built from many integrals of one model).
+// They are checked against the model id, should a deleted model's address
+// have been reused by another model.
+
+  vector<const XSecAlgorithmI *> & models = fWorkerModels[model];
+  if(models.size() == nworkers &&
+     models[0]->Id().KeyHash() == model->Id().KeyHash()) return models;
+
+  for(unsigned int iw = 0; iw < models.size(); iw++) {
+    if(models[iw] != model) delete models[iw];
+  }
+  models.clear();
+
+  if(nworkers <= 1) {
+    models.push_back(model);
+    return models;
+  }
+  LOG("XSecIntegrator", pINFO)
+     << "Making " << nworkers << " worker copies of " << model->Id().Key();
+
+  AlgFactory * algf = AlgFactory::Instance();
+  for(unsigned int iw = 0; iw < nworkers; iw++) {
+    XSecAlgorithmI * worker =
+       dynamic_cast<XSecAlgorithmI *> (algf->AdoptAlgorithm(model->Id()));
+    assert(worker);
+    worker->AdoptSubstructure();
+    worker->Configure(model->GetConfig());
+    models.push_back(worker);
+  }
+  return models;
+}
+//___________________________________________________________________________
+void XSecIntegratorI::DeleteWorkerModels(void) const
+{
+  map<const XSecAlgorithmI *, vector<const XSecAlgorithmI *> >::iterator it;
+  for(it = fWorkerModels.begin(); it != fWorkerModels.end(); ++it) {
+    const XSecAlgorithmI * model = it->first;
+    vector<const XSecAlgorithmI *> & models = it->second;
+    for(unsigned int iw = 0; iw < models.size(); iw++) {
+      if(models[iw] != model) delete models[iw];
+    }
+  }
+  fWorkerModels.clear();
+}
+//___________________________________________________________________________
+void XSecIntegratorI::ReportBatch(
+   const BatchMCIntegrator & ig, const Interaction * in, double result) const
+{
+  fLastNCalls   = ig.NCalls();
+  fLastRelError = (result != 0.) ? TMath::Abs(ig.Error()/result) : 0.;
+
+  LOG("XSecIntegrator", pNOTICE)
+     << "E = " << in->InitState().ProbeE(kRfLab) << " GeV: "
+     << fGSLIntgType << " integral = " << result << " +/- " << ig.Error()
+     << " (rel. error = " << fLastRelError << ") after " << ig.NCalls()
+     << " calls in " << ig.NIterations() << " iterations on "
+     << ig.NWorkers() << " threads"
+     << ((ig.Status() == BatchMCIntegrator::kConverged) ?
+            "" : " - requested accuracy not reached");
+}
+//___________________________________________________________________________
+void XSecIntegratorI::WarmStartBatch(
+   BatchMCIntegrator & ig, const Interaction * in) const
+{
+// Splines are built by integrating the same interaction at increasing
+// energies. The vegas grid adapted at the nearest energy integrated so far
+// is a good starting point and saves the first (cold grid) iterations.
+
+  if(!fBatchWarmStart) return;
+
+  string key = in->AsString();
+  if(key != fWarmKey) {
+    fWarmKey = key;
+    fWarmGrids.clear();
+    return;
+  }
+  if(fWarmGrids.empty()) return;
+
+  double E = in->InitState().ProbeE(kRfLab);
+  map<double, vector<double> >::const_iterator next = fWarmGrids.lower_bound(E);
+  map<double, vector<double> >::const_iterator nearest = next;
+  if(next == fWarmGrids.end()) {
+    --nearest;
+  } else if(next != fWarmGrids.begin()) {
+    map<double, vector<double> >::const_iterator prev = next;
+    --prev;
+    if(E - prev->first < next->first - E) nearest = prev;
+  }
+  ig.WarmStart(nearest->second);
+
+  LOG("XSecIntegrator", pINFO)
+     << "E = " << E << " GeV: Starting from the grid adapted at E = "
+     << nearest->first << " GeV";
+}
+//___________________________________________________________________________
+void XSecIntegratorI::SaveBatchGrid(
+   const BatchMCIntegrator & ig, const Interaction * in) const
+{
+  if(!fBatchWarmStart) return;
+  if(ig.NCalls() == 0) return;
+  if(ig.Status() != BatchMCIntegrator::kConverged) return;
 
+  fWarmKey = in->AsString();
+  fWarmGrids[in->InitState().ProbeE(kRfLab)] = ig.Grid();
 }
 //___________________________________________________________________________
@@ -19,13 +19,24 @@
 #ifndef _XSEC_INTEGRATOR_I_H_
 #define _XSEC_INTEGRATOR_I_H_
 
+#include <map>
+#include <vector>
+
+#include <TMath.h>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Interaction/Interaction.h"
+#include "Framework/Numerical/BatchMCIntegrator.h"
+#include "Physics/XSectionIntegration/XSecBatchFunc.h"
+
+using std::map;
+using std::vector;
 
 namespace genie {
 
 class IntegratorI;
+class ThreadPool;
 
  class XSecIntegratorI : public Algorithm {
 
@@ -35,11 +46,29 @@ public:
   virtual double Integrate(const XSecAlgorithmI * model, 
                            const Interaction * interaction 
                        /*, const KPhaseSpaceCut * cut=0*/) const= 0;
+
+  //! Error (relative) & number of integrand evaluations of the last
+  //! integration. Only available for the batch integrators.
+  double        LastRelError (void) const { return fLastRelError; }
+  unsigned long LastNCalls   (void) const { return fLastNCalls;   }
+
 protected:
   XSecIntegratorI();
   XSecIntegratorI(string name);
   XSecIntegratorI(string name, string config);
 
+  //! Does the gsl-integration-type parameter select a batch integrator
+  //! (multi-threaded, see BatchMCIntegrator) rather than a GSL one?
+  bool UseBatchIntegrator (void) const;
+
+  //! Integrate the cross section function T (one of the GSLXSecFunc.h
+  //! wrappers) over [kmin,kmax] with the selected batch integrator.
+  //! Each worker thread evaluates its own copy of the model. The threads
+  //! and the model copies are kept for the life of the integrator.
+  template<class T>
+    double IntegrateBatch (const XSecAlgorithmI * model, const Interaction * in,
+                           const double * kmin, const double * kmax, double abstol) const;
+
   const IntegratorI * fIntegrator; ///< GENIE numerical integrator 
 
   string fGSLIntgType;                     ///< name of GSL numerical integrator
@@ -48,8 +77,46 @@ protected:
   int    fGSLMinEval;                      ///< GSL min evaluations. Ignored by some integrators.
   unsigned int fGSLMaxSizeOfSubintervals;  ///< GSL maximum number of sub-intervals for 1D integrator
   unsigned int fGSLRule;                   ///< GSL Gauss-Kronrod integration rule (only for GSL 1D adaptive type)
-
+  int    fBatchNumOfThreads;               ///< number of threads used by the batch integrators (0: one per core)
+  bool   fBatchWarmStart;                  ///< start batch-vegas from the grid of the nearest energy already integrated?
+
+private:
+  ThreadPool * BatchThreadPool (void) const;
+  const vector<const XSecAlgorithmI *> &
+         WorkerModels   (const XSecAlgorithmI * model, unsigned int nworkers) const;
+  void   DeleteWorkerModels (void) const;
+  void   ReportBatch    (const BatchMCIntegrator & ig, const Interaction * in,
+                         double result) const;
+  void   WarmStartBatch (BatchMCIntegrator & ig, const Interaction * in) const;
+  void   SaveBatchGrid  (const BatchMCIntegrator & ig, const Interaction * in) const;
+
+  mutable double        fLastRelError;
+  mutable unsigned long fLastNCalls;
+
+  mutable string                         fWarmKey;   ///< interaction the saved grids belong to
+  mutable map<double, vector<double> >   fWarmGrids; ///< batch-vegas grids per probe energy
+
+  mutable ThreadPool *  fBatchThreadPool;  ///< worker threads of the batch integrators
+  mutable int           fBatchPoolThreads; ///< fBatchNumOfThreads the pool was made with
+  mutable map<const XSecAlgorithmI *,
+              vector<const XSecAlgorithmI *> > fWorkerModels; ///< per-worker copies of each model
 };
+//____________________________________________________________________________
+template<class T>
+  double XSecIntegratorI::IntegrateBatch(const XSecAlgorithmI * model,
+    const Interaction * in, const double * kmin, const double * kmax, double abstol) const
+{
+  BatchMCIntegrator ig(fGSLIntgType, abstol, fGSLRelTol,
+                       fGSLMaxEval, fGSLMinEval, this->BatchThreadPool());
+
+  XSecBatchFunc<T> func(this->WorkerModels(model, ig.NWorkers()), in);
+  this->WarmStartBatch(ig, in);
+  double result = ig.Integral(func, kmin, kmax);
+  this->SaveBatchGrid(ig, in);
+  this->ReportBatch(ig, in, result);
+
+  return result;
+}
 
 }       // genie namespace
 #endif  // _XSEC_INTEGRATOR_I_H_
@@ -97,6 +97,13 @@ namespace flux {
     fNCycles = TMath::Max(0L, ncycle);
   }
   //___________________________________________________________________________
+  void GFluxFileConfigI::ShiftStartEntry(double frac)
+  {
+    // drivers that don't read ntuple entries sequentially ignore it
+    LOG("Flux", pWARN)
+      << "Flux driver can not shift its start entry (by " << frac << ")";
+  }
+  //___________________________________________________________________________
   void GFluxFileConfigI::SetFluxParticles(const PDGCodeList & particles)
   {
     fPdgCList->Copy(particles);
@@ -89,6 +89,12 @@ namespace flux {
     /// limit cycling through input files
     virtual void         SetNumOfCycles(long int ncycle);
 
+    /// move the first entry to be read by a fraction frac of the entries
+    /// (wrapping around), eg so that worker processes sharing the flux
+    /// ntuples start at different entries; call before the first
+    /// GenerateNext()
+    virtual void         ShiftStartEntry(double frac);
+
   protected:  // visible to derived classes
 
     PDGCodeList * fPdgCList;     ///< list of neutrino pdg-codes to generate  
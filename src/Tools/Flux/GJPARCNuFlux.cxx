@@ -908,6 +908,20 @@ void GJPARCNuFlux::RandomOffset()
   fIEntry = fOffset = offset;
 }
 //___________________________________________________________________________
+void GJPARCNuFlux::ShiftStartEntry(double frac)
+{
+// Move the starting entry (the offset) by a fraction frac of the entries,
+// wrapping around, so that e.g. worker processes sharing the flux ntuple
+// start at different entries. Must be called before any call to
+// GenerateNext is made.
+//
+  if(fNEntries <= 0) return;
+  long int shift = (long int) floor(frac * fNEntries);
+  fIEntry = fOffset = (fOffset + shift) % fNEntries;
+  LOG("Flux", pNOTICE) << "Setting flux driver to start looping over entries "
+                       << "with offset of "<< fOffset;
+}
+//___________________________________________________________________________
 void GJPARCNuFlux::Clear(Option_t * opt)
 {
 // If opt = "CycleHistory" then:
@@ -83,6 +83,7 @@ public :
   void SetNumOfCycles   (int n);                               ///< set how many times to cycle through the ntuple (default: 1 / n=0 means 'infinite')
   void DisableOffset    (void){fUseRandomOffset = false;}      ///< switch off random offset, must be called before LoadBeamSimData to have any effect 
   void RandomOffset     (void);                                ///< choose a random offset as starting entry in flux ntuple 
+  void ShiftStartEntry  (double frac);                         ///< move the starting entry by a fraction of the entries (eg for worker processes)
 
   double   POT_1cycle     (void);                              ///< flux POT per cycle
   double   POT_curravg    (void);                              ///< current average POT
@@ -682,6 +682,17 @@ void GSimpleNtpFlux::PrintCurrent(void)
   LOG("Flux", pNOTICE) << "CurrentEntry:" << *fCurEntry;
 }
 //___________________________________________________________________________
+void GSimpleNtpFlux::ShiftStartEntry(double frac)
+{
+// Move the first entry to be read by a fraction frac of the entries.
+// fIEntry is the entry before the first one read by GenerateNext()
+//
+  if ( fNEntries <= 0 ) return;
+  Long64_t shift = (Long64_t) TMath::Floor(frac * fNEntries);
+  fIEntry = (fIEntry + 1 + shift) % fNEntries - 1;
+  LOG("Flux",pNOTICE) << "Start with entry fIEntry=" << fIEntry;
+}
+//___________________________________________________________________________
 void GSimpleNtpFlux::Clear(Option_t * opt)
 {
 // Clear the driver state
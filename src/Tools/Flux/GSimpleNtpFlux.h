@@ -272,6 +272,7 @@ public :
                               std::vector<std::string>& branchClassNames,
                               std::vector<void**>&      branchObjPointers);
   virtual TTree* GetMetaDataTree();
+  virtual void   ShiftStartEntry(double frac);
 
   //
   // configuration of GSimpleNtpFlux
@@ -0,0 +1,138 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestARCOHTables
+
+\brief   Program used for testing / benchmarking the tabulated pion
+         wavefunctions of the Alvarez-Ruso coherent pion production model
+         (see the `UseLookupTable' option of AlvarezRusoCOHPiPXSec).
+         It evaluates the 5-d differential cross section at random forward
+         kinematics (a different pion energy at every call, as during the
+         cross section integration) with and without the table, and reports
+         the number of calls per second for each, the time spent building
+         the table and the max deviation (relative to the max cross section).
+         If a file name is given the table is written to it and read back.
+
+         Syntax :
+           gtestARCOHTables [--tune tune_name] [-n npoints] [-e E]
+                            [-z Z] [-a A] [-f table_file]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TStopwatch.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+using namespace genie::alvarezruso;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  RunOpt::Instance()->BuildTune();
+
+  CmdLnArgParser parser(argc,argv);
+  int    npoints = (parser.OptionExists('n')) ? parser.ArgAsInt   ('n') : 2000;
+  double Ev      = (parser.OptionExists('e')) ? parser.ArgAsDouble('e') : 1.0;
+  int    Z       = (parser.OptionExists('z')) ? parser.ArgAsInt   ('z') : 6;
+  int    A       = (parser.OptionExists('a')) ? parser.ArgAsInt   ('a') : 12;
+  string file    = (parser.OptionExists('f')) ? parser.ArgAsString('f') : "";
+
+  AlvarezRusoCOHPiPDXSec direct    (Z, A, kCC, kMu, kNu);
+  AlvarezRusoCOHPiPDXSec tabulated (Z, A, kCC, kMu, kNu);
+
+  TStopwatch timer;
+
+  // build the table (default binning of AlvarezRusoCOHPiPXSec)
+  timer.Start();
+  ARWavefunctionTable * table = tabulated.BuildWavefunctionTable(200, 0.01, 2.0);
+  timer.Stop();
+  LOG("test", pNOTICE)
+     << "Built table for Z = " << Z << ", A = " << A << " in "
+     << timer.RealTime() << " s";
+
+  if(file.size() > 0) {
+    bool written = table->Write(file);
+    assert(written);
+    ARWavefunctionTable * read = ARWavefunctionTable::Read(file);
+    assert(read && read->NP() == table->NP() && read->N() == table->N());
+    for(unsigned int ip = 0; ip < table->NP(); ip++) {
+      assert(read->Value(ip,0,0,0) == table->Value(ip,0,0,0));
+    }
+    delete table;
+    table = read;
+    LOG("test", pNOTICE) << "Table written to and read back from " << file;
+  }
+  tabulated.SetWavefunctionTable(table);
+
+  // random forward kinematics
+  RandomGen * rnd = RandomGen::Instance();
+  double hbar = direct.GetConstants().HBar();
+  double m_l  = direct.GetLeptonMass() * hbar;
+  double m_pi = direct.GetPiMass()     * hbar;
+  vector<double> El(npoints), thl(npoints), phl(npoints), thpi(npoints), phpi(npoints);
+  for(int i = 0; i < npoints; i++) {
+    El  [i] = m_l + (Ev - m_pi - m_l) * rnd->RndGen().Rndm();
+    thl [i] = 0.5 * rnd->RndGen().Rndm();
+    phl [i] = 2*TMath::Pi() * rnd->RndGen().Rndm();
+    thpi[i] = 0.5 * rnd->RndGen().Rndm();
+    phpi[i] = 2*TMath::Pi() * rnd->RndGen().Rndm();
+  }
+
+  vector<double> xsec_direct(npoints), xsec_tab(npoints);
+
+  timer.Start();
+  for(int i = 0; i < npoints; i++) {
+    xsec_direct[i] = direct.DXSec(Ev, El[i], thl[i], phl[i], thpi[i], phpi[i]);
+  }
+  timer.Stop();
+  double tdirect = timer.RealTime();
+
+  timer.Start();
+  for(int i = 0; i < npoints; i++) {
+    xsec_tab[i] = tabulated.DXSec(Ev, El[i], thl[i], phl[i], thpi[i], phpi[i]);
+  }
+  timer.Stop();
+  double ttab = timer.RealTime();
+
+  double xsec_max = 0, dev_max = 0;
+  for(int i = 0; i < npoints; i++) {
+    xsec_max = TMath::Max(xsec_max, xsec_direct[i]);
+    dev_max  = TMath::Max(dev_max,  TMath::Abs(xsec_tab[i]-xsec_direct[i]));
+  }
+  double rel_dev = (xsec_max > 0) ? dev_max/xsec_max : 0;
+
+  LOG("test", pNOTICE)
+     << "E = " << Ev << " GeV, " << npoints << " calls : direct = "
+     << npoints/tdirect << " calls/s, tabulated = " << npoints/ttab
+     << " calls/s, max deviation = " << rel_dev;
+
+  tabulated.SetWavefunctionTable(0);
+  delete table;
+
+  LOG("test", pINFO)  << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
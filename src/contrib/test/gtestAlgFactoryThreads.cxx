@@ -0,0 +1,267 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestAlgFactoryThreads
+
+\brief   Program used for detecting data races between event generation
+         threads sharing the algorithms of the AlgFactory pool.
+         It runs three checks on N threads:
+          - each thread configures its own GEVGDriver for the same initial
+            state at the same time; all drivers must get the same (shared)
+            event generator instances from the AlgFactory,
+          - each thread updates the per-thread scratch state (AlgScratchI)
+            of a single shared algorithm; no thread may see another thread's
+            updates,
+          - each thread generates events with its own driver and random
+            number stream, starting with cold caches. The same event
+            sequences are then generated again one thread at a time: any
+            difference between the two runs points to per-event state
+            shared between threads.
+         Build GENIE with -fsanitize=thread to have the races located.
+
+         Syntax :
+           gtestAlgFactoryThreads [-t nthreads] [-n nev] [-p probe]
+                                  [-g target] [-e energy] [-s seed]
+                                  [--cross-sections xml_file] [--tune tune]
+                                  [--event-generator-list list]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Algorithm/Algorithm.h"
+#include "Framework/Algorithm/AlgScratchI.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/ThreadPool.h"
+
+using std::string;
+using std::vector;
+using namespace genie;
+
+typedef vector<double> EventSummary_t;
+
+//____________________________________________________________________________
+// An algorithm counting calls in its per-thread scratch state
+class CountScratch : public AlgScratchI {
+public:
+  CountScratch() : N(0) {}
+  unsigned int N;
+};
+class CountingAlg : public Algorithm {
+public:
+  CountingAlg() : Algorithm("genie::CountingAlg") {}
+  CountScratch * Count (void) const {
+    return static_cast<CountScratch *>(this->Scratch());
+  }
+protected:
+  AlgScratchI * NewScratch (void) const { return new CountScratch; }
+};
+//____________________________________________________________________________
+class ConfigureTask : public ParallelTask {
+public:
+  ConfigureTask(vector<GEVGDriver *> & d, const InitialState & is) :
+    fDrivers(d), fInitState(is) {}
+  void Run(unsigned int /*worker*/, unsigned int item) {
+    fDrivers[item]->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    fDrivers[item]->Configure(fInitState);
+    fDrivers[item]->UseSplines();
+  }
+private:
+  vector<GEVGDriver *> & fDrivers;
+  const InitialState &   fInitState;
+};
+//____________________________________________________________________________
+class ScratchTask : public ParallelTask {
+public:
+  ScratchTask(const CountingAlg & alg, unsigned int nworkers) :
+    fAlg(alg), fScratch(nworkers, 0), fNErrors(nworkers, 0) {}
+  void Run(unsigned int worker, unsigned int /*item*/) {
+    CountScratch * scratch = fAlg.Count();
+    if(fScratch[worker] && fScratch[worker] != scratch) fNErrors[worker]++;
+    fScratch[worker] = scratch;
+    unsigned int n0 = scratch->N;
+    for(unsigned int i = 0; i < 100000; i++) fAlg.Count()->N++;
+    if(scratch->N != n0 + 100000) fNErrors[worker]++;
+  }
+  const CountingAlg &    fAlg;
+  vector<CountScratch *> fScratch;
+  vector<unsigned int>   fNErrors;
+};
+//____________________________________________________________________________
+class GenerationTask : public ParallelTask {
+public:
+  GenerationTask(vector<GEVGDriver *> & d, vector<TRandom3 *> & rnd,
+                 unsigned int nev, double E) :
+    fDrivers(d), fRnd(rnd), fNEv(nev), fE(E), fEvents(d.size()) {}
+  void Run(unsigned int /*worker*/, unsigned int item) {
+    RandomGen::SetThreadStream(fRnd[item]);
+    TLorentzVector p4(0., 0., fE, fE);
+    fEvents[item].clear();
+    for(unsigned int iev = 0; iev < fNEv; iev++) {
+      EventRecord * event = fDrivers[item]->GenerateEvent(p4);
+      fEvents[item].push_back(Summarize(event));
+      delete event;
+    }
+    RandomGen::SetThreadStream(0);
+  }
+  static EventSummary_t Summarize(const EventRecord * event) {
+    EventSummary_t summary;
+    if(!event) return summary;
+    GHepParticle * p = 0;
+    TIter event_iter(event);
+    while((p = dynamic_cast<GHepParticle *>(event_iter.Next()))) {
+      summary.push_back(p->Pdg());
+      summary.push_back(p->Status());
+      summary.push_back(p->Px());
+      summary.push_back(p->Py());
+      summary.push_back(p->Pz());
+      summary.push_back(p->E());
+    }
+    return summary;
+  }
+  vector<GEVGDriver *> &    fDrivers;
+  vector<TRandom3 *> &      fRnd;
+  unsigned int              fNEv;
+  double                    fE;
+  vector< vector<EventSummary_t> > fEvents;
+};
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+  int nthreads = (parser.OptionExists('t')) ?
+                  parser.ArgAsInt('t') : (int) ThreadPool::MaxNWorkers();
+  int    nev   = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 100;
+  int    probe = (parser.OptionExists('p')) ? parser.ArgAsInt('p')    : kPdgNuMu;
+  int    tgt   = (parser.OptionExists('g')) ? parser.ArgAsInt('g')    : kPdgTgtFreeP;
+  double E     = (parser.OptionExists('e')) ? parser.ArgAsDouble('e') : 1.;
+  long   seed  = (parser.OptionExists('s')) ? parser.ArgAsLong ('s')  : 1234;
+  string xsec  = (parser.OptionExists("cross-sections")) ?
+                  parser.ArgAsString("cross-sections") : "";
+  nthreads = TMath::Max(nthreads, 2);
+
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("test", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+  utils::app_init::RandGen(seed);
+  utils::app_init::XSecTable(xsec, false);
+
+  ThreadPool pool(nthreads);
+  InitialState init_state(tgt, probe);
+  int nerr = 0;
+
+  //
+  // concurrent configuration: shared generators
+  //
+  vector<GEVGDriver *> drivers(nthreads);
+  for(int i = 0; i < nthreads; i++) drivers[i] = new GEVGDriver;
+  ConfigureTask configure(drivers, init_state);
+  pool.Execute(configure, nthreads);
+
+  const EventGeneratorList & evgl0 = *drivers[0]->EventGenerators();
+  for(int i = 1; i < nthreads; i++) {
+    const EventGeneratorList & evgl = *drivers[i]->EventGenerators();
+    bool same = (evgl.size() == evgl0.size());
+    for(unsigned int j = 0; same && j < evgl.size(); j++) {
+      same = (evgl[j] == evgl0[j]);
+    }
+    if(!same) {
+      LOG("test", pERROR)
+        << "Driver " << i << " got event generators different from driver 0";
+      nerr++;
+    }
+  }
+  LOG("test", pNOTICE)
+    << nthreads << " drivers configured concurrently, with "
+    << evgl0.size() << " event generators";
+
+  //
+  // per-thread scratch state of a shared algorithm
+  //
+  CountingAlg alg;
+  ScratchTask scratch(alg, pool.NWorkers());
+  pool.Execute(scratch, 16*pool.NWorkers());
+  for(unsigned int i = 0; i < pool.NWorkers(); i++) {
+    for(unsigned int j = 0; j < i; j++) {
+      if(scratch.fScratch[i] && scratch.fScratch[i] == scratch.fScratch[j]) {
+        LOG("test", pERROR)
+          << "Workers " << j << " and " << i << " share scratch state";
+        nerr++;
+      }
+    }
+    if(scratch.fNErrors[i] > 0) {
+      LOG("test", pERROR)
+        << "Worker " << i << " saw its scratch state modified by others";
+      nerr++;
+    }
+  }
+  LOG("test", pNOTICE) << "Checked per-thread scratch state";
+
+  //
+  // event generation: concurrently (first, with cold caches), then one
+  // thread at a time
+  //
+  vector<TRandom3 *> rnd(nthreads);
+  for(int i = 0; i < nthreads; i++) rnd[i] = new TRandom3(seed + 1 + i);
+
+  GenerationTask parallel(drivers, rnd, nev, E);
+  pool.Execute(parallel, nthreads);
+
+  for(int i = 0; i < nthreads; i++) rnd[i]->SetSeed(seed + 1 + i);
+  GenerationTask serial(drivers, rnd, nev, E);
+  for(int i = 0; i < nthreads; i++) serial.Run(0, i);
+
+  int ndiff = 0;
+  for(int i = 0; i < nthreads; i++) {
+    for(int iev = 0; iev < nev; iev++) {
+      if(serial.fEvents[i][iev] != parallel.fEvents[i][iev]) {
+        if(ndiff == 0) {
+          LOG("test", pERROR)
+            << "Thread " << i << ", event " << iev
+            << " differs from the one generated serially";
+        }
+        ndiff++;
+      }
+    }
+  }
+  LOG("test", pNOTICE)
+    << nthreads << " x " << nev << " events generated concurrently, "
+    << ndiff << " differ from the ones generated serially";
+  if(ndiff > 0) nerr++;
+
+  for(int i = 0; i < nthreads; i++) {
+    delete drivers[i];
+    delete rnd[i];
+  }
+
+  LOG("test", pINFO)  << "Done!";
+  return (nerr == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
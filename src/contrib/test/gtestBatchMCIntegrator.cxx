@@ -0,0 +1,137 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestBatchMCIntegrator
+
+\brief   Program used for testing / benchmarking GENIE's BatchMCIntegrator.
+         Integrates a peaked 2-D function (a Breit-Wigner peak in u times a
+         dipole-like fall-off in v, similar to the RES d2xsec/dWdQ2) over
+         the unit square, known analytically, with GSL's vegas and with the
+         batch-vegas / batch-plain integrators on 1 and on N threads.
+         Reports the result, estimated & true errors, number of calls and
+         wall-clock time for each, and checks that the batch results do not
+         depend on the number of threads.
+
+         Syntax :
+           gtestBatchMCIntegrator [-t nthreads] [-r reltol]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <string>
+
+#include <TMath.h>
+#include <TStopwatch.h>
+#include <Math/IFunction.h>
+#include <Math/IntegratorMultiDim.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BatchMCIntegrator.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/ThreadPool.h"
+
+using std::string;
+using namespace genie;
+
+double func     (double u, double v);
+double func_int (void);
+
+class Func2D : public ROOT::Math::IBaseFunctionMultiDim
+{
+public:
+  unsigned int NDim (void) const { return 2; }
+  double DoEval (const double * x) const { return func(x[0], x[1]); }
+  ROOT::Math::IBaseFunctionMultiDim * Clone (void) const { return new Func2D; }
+};
+
+class BatchFunc2D : public BatchFunctionMultiDimI
+{
+public:
+  unsigned int NDim (void) const { return 2; }
+  void EvalBatch (unsigned int /*worker*/, unsigned int npoints,
+                  const double * x, double * f) const
+  {
+    for(unsigned int ip = 0; ip < npoints; ip++) {
+      f[ip] = func(x[2*ip], x[2*ip+1]);
+    }
+  }
+};
+
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+  int    nthreads = (parser.OptionExists('t')) ?
+                     parser.ArgAsInt('t') : (int) ThreadPool::MaxNWorkers();
+  double reltol   = (parser.OptionExists('r')) ? parser.ArgAsDouble('r') : 1E-3;
+
+  const unsigned int maxeval = 5000000;
+  const unsigned int mineval = 10000;
+
+  double a[2] = { 0., 0. };
+  double b[2] = { 1., 1. };
+  double exact = func_int();
+
+  TStopwatch timer;
+
+  // GSL vegas
+  Func2D f2d;
+  ROOT::Math::IntegratorMultiDim gsl_ig(f2d,
+     ROOT::Math::IntegrationMultiDim::kVEGAS, 0., reltol, maxeval);
+  timer.Start();
+  double gsl_result = gsl_ig.Integral(a, b);
+  timer.Stop();
+  LOG("test", pNOTICE)
+    << "GSL vegas: I = " << gsl_result << " +/- " << gsl_ig.Error()
+    << " (true error = " << gsl_result - exact << "), "
+    << timer.RealTime() << " s";
+
+  // batch integrators
+  BatchFunc2D bf2d;
+  string types[2] = { "batch-vegas", "batch-plain" };
+  for(int it = 0; it < 2; it++) {
+    double result[2] = { 0., 0. };
+    int    nworkers[2] = { 1, nthreads };
+    for(int iw = 0; iw < 2; iw++) {
+      BatchMCIntegrator ig(types[it], 0., reltol, maxeval, mineval, nworkers[iw]);
+      timer.Start();
+      result[iw] = ig.Integral(bf2d, a, b);
+      timer.Stop();
+      LOG("test", pNOTICE)
+        << types[it] << " (" << ig.NWorkers() << " threads): I = "
+        << result[iw] << " +/- " << ig.Error()
+        << " (true error = " << result[iw] - exact << "), "
+        << ig.NCalls() << " calls, " << ig.NIterations() << " iterations, "
+        << timer.RealTime() << " s";
+    }
+    // the points do not depend on the number of threads
+    assert(result[0] == result[1]);
+  }
+
+  LOG("test", pINFO)  << "Done!";
+  return 0;
+}
+
+double func(double u, double v)
+{
+  double m = 0.3, g = 0.05;
+  double bw = g*g / ( (u-m)*(u-m) + g*g/4 );
+  double dp = 1. / TMath::Power(1 + 20*v, 2);
+  return bw * dp;
+}
+
+double func_int(void)
+{
+  // integral of the Breit-Wigner over [0,1] times that of the dipole term
+  double m = 0.3, g = 0.05;
+  double ibw = 2*g * (TMath::ATan((1-m)/(g/2)) + TMath::ATan(m/(g/2)));
+  double idp = (1. - 1./21.) / 20.;
+  return ibw * idp;
+}
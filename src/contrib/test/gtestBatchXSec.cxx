@@ -0,0 +1,191 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestBatchXSec
+
+\brief   Program used for testing the batch cross section evaluation used by
+         the batch integrators (see XSecAlgorithmI::BatchXSec() and
+         XSecBatchFunc). For each model overriding BatchXSec() it evaluates
+         the cross section at random kinematically allowed points, point by
+         point (XSec()) and as a single batch (BatchXSec(), through the same
+         GSLXSecFunc.h wrapper used for integrating the model), and checks
+         that the two agree at every point.
+         The QEL model is also tested with the kIAssumeFreeNucleon flag set,
+         which must be seen by the batch evaluation too.
+
+         Syntax :
+           gtestBatchXSec [--tune tune_name] [-n npoints] [-e E]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/BaryonResUtils.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/Range1.h"
+#include "Physics/XSectionIntegration/GSLXSecFunc.h"
+#include "Physics/XSectionIntegration/XSecBatchFunc.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+const double kTolerance = 1E-9; // max relative deviation
+
+const XSecAlgorithmI * Model (string name);
+void Q2Points  (Interaction * in, int npoints, vector<double> & points);
+void WQ2Points (Interaction * in, int npoints, vector<double> & points);
+
+template<class T>
+  bool Compare (const XSecAlgorithmI * model, Interaction * in,
+                const vector<double> & points, string label);
+
+double Eval (const ROOT::Math::IBaseFunctionOneDim   & f, const double * x) { return f(x[0]); }
+double Eval (const ROOT::Math::IBaseFunctionMultiDim & f, const double * x) { return f(x);    }
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  RunOpt::Instance()->BuildTune();
+
+  CmdLnArgParser parser(argc,argv);
+  int    npoints = (parser.OptionExists('n')) ? parser.ArgAsInt   ('n') : 1000;
+  double E       = (parser.OptionExists('e')) ? parser.ArgAsDouble('e') : 5.0;
+
+  bool ok = true;
+  vector<double> points;
+
+  // QEL, with and without the nucleus
+  const XSecAlgorithmI * qel = Model("genie::LwlynSmithQELCCPXSec");
+  Interaction * in_qel = Interaction::QELCC(kPdgTgtO16, kPdgNeutron, kPdgNuMu, E);
+  Q2Points(in_qel, npoints, points);
+  ok = Compare<utils::gsl::dXSec_dQ2_E>(qel, in_qel, points, "QEL CC, O16") && ok;
+  in_qel->SetBit(kIAssumeFreeNucleon);
+  ok = Compare<utils::gsl::dXSec_dQ2_E>(qel, in_qel, points, "QEL CC, O16 (free nucleon)") && ok;
+  delete in_qel;
+
+  // RES, for a couple of resonances
+  const XSecAlgorithmI * rs = Model("genie::ReinSehgalRESPXSec");
+  const XSecAlgorithmI * bs = Model("genie::BergerSehgalRESPXSec2014");
+  Resonance_t res[2] = { kP33_1232, kS11_1535 };
+  for(int ir = 0; ir < 2; ir++) {
+    Interaction * in_res = Interaction::RESCC(kPdgTgtFreeN, kPdgNeutron, kPdgNuMu, E);
+    in_res->ExclTagPtr()->SetResonance(res[ir]);
+    WQ2Points(in_res, npoints, points);
+    string label = string("RES CC, ") + utils::res::AsString(res[ir]);
+    ok = Compare<utils::gsl::d2XSec_dWdQ2_E>(rs, in_res, points, label + ", Rein-Sehgal")    && ok;
+    ok = Compare<utils::gsl::d2XSec_dWdQ2_E>(bs, in_res, points, label + ", Berger-Sehgal") && ok;
+    delete in_res;
+  }
+
+  // DIS
+  const XSecAlgorithmI * dis = Model("genie::QPMDISPXSec");
+  Interaction * in_dis = Interaction::DISCC(kPdgTgtFreeP, kPdgProton, kPdgNuMu, E);
+  WQ2Points(in_dis, npoints, points);
+  ok = Compare<utils::gsl::d2XSec_dWdQ2_E>(dis, in_dis, points, "DIS CC, p") && ok;
+  delete in_dis;
+
+  if(!ok) {
+    LOG("test", pERROR) << "BatchXSec() and XSec() disagree!";
+    return 1;
+  }
+  LOG("test", pINFO)  << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+const XSecAlgorithmI * Model(string name)
+{
+  const XSecAlgorithmI * model = dynamic_cast<const XSecAlgorithmI *> (
+      AlgFactory::Instance()->GetAlgorithm(name, "Default"));
+  assert(model);
+  return model;
+}
+//____________________________________________________________________________
+void Q2Points(Interaction * in, int npoints, vector<double> & points)
+{
+  RandomGen * rnd = RandomGen::Instance();
+  Range1D_t Q2l = in->PhaseSpace().Q2Lim();
+  points.resize(npoints);
+  for(int i = 0; i < npoints; i++) {
+    points[i] = Q2l.min + (Q2l.max - Q2l.min) * rnd->RndGen().Rndm();
+  }
+}
+//____________________________________________________________________________
+void WQ2Points(Interaction * in, int npoints, vector<double> & points)
+{
+  RandomGen * rnd = RandomGen::Instance();
+  Range1D_t Wl = in->PhaseSpace().WLim();
+  points.resize(2*npoints);
+  for(int i = 0; i < npoints; i++) {
+    double W = Wl.min + (Wl.max - Wl.min) * rnd->RndGen().Rndm();
+    in->KinePtr()->SetW(W);
+    Range1D_t Q2l = in->PhaseSpace().Q2Lim_W();
+    points[2*i]   = W;
+    points[2*i+1] = Q2l.min + (Q2l.max - Q2l.min) * rnd->RndGen().Rndm();
+  }
+}
+//____________________________________________________________________________
+template<class T>
+  bool Compare(const XSecAlgorithmI * model, Interaction * in,
+               const vector<double> & points, string label)
+{
+  T func(model, in);
+  unsigned int ndim    = func.NDim();
+  unsigned int npoints = points.size() / ndim;
+
+  // point by point
+  vector<double> xsec(npoints);
+  for(unsigned int i = 0; i < npoints; i++) {
+    xsec[i] = Eval(func, &points[i*ndim]);
+  }
+
+  // as a single batch
+  vector<double> xsec_batch(npoints);
+  vector<const XSecAlgorithmI *> models(1, model);
+  XSecBatchFunc<T> batch_func(models, in);
+  batch_func.EvalBatch(0, npoints, &points[0], &xsec_batch[0]);
+
+  int    nbad = 0, nzero = 0;
+  double dev_max = 0;
+  for(unsigned int i = 0; i < npoints; i++) {
+    double dev = TMath::Abs(xsec_batch[i] - xsec[i]);
+    double ref = TMath::Max(TMath::Abs(xsec[i]), TMath::Abs(xsec_batch[i]));
+    if(ref == 0) { nzero++; continue; }
+    dev_max = TMath::Max(dev_max, dev/ref);
+    if(dev > kTolerance * ref) {
+      nbad++;
+      LOG("test", pERROR)
+         << label << " : point " << i << " : xsec = " << xsec[i]
+         << ", batch xsec = " << xsec_batch[i];
+    }
+  }
+
+  LOG("test", pNOTICE)
+     << label << " : " << npoints << " points (" << nzero << " with xsec = 0)"
+     << ", max relative deviation = " << dev_max
+     << ((nbad == 0) ? "" : " - FAILED");
+
+  return (nbad == 0);
+}
+//____________________________________________________________________________
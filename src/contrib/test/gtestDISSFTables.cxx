@@ -0,0 +1,187 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestDISSFTables
+
+\brief   Program used for testing the tabulated DIS structure functions of
+         QPMDISStrucFuncBase (see its `UseSFTables' option).
+         Computes F1-F5 with and without the tables, for each tabulated
+         hit nucleon / probe / current, at the nodes of the (x,Q2) grid and
+         half-way between them (in log x and log Q2), and reports the max
+         deviation of x*Fi relative to the largest x*Fi at that point.
+         The tables must reproduce the direct calculation at the nodes.
+         The nodes are also evaluated for a bound, off the mass shell, hit
+         nucleon: the charm contribution is tabulated for an on-shell
+         nucleon, so the deviation reported there is that of the tables'
+         approximation of the slow rescaling variable.
+
+         Syntax :
+           gtestDISSFTables [--tune tune_name] [-a model] [-t tolerance]
+                            [-m off_shell_mass]
+
+         Options :
+           -a  DIS SF model [default: genie::QPMDISStrucFunc]
+           -t  tolerance for the deviation between grid nodes, only used
+               to count the points exceeding it [default: 1E-2]
+           -m  off-shell hit nucleon mass, in GeV [default: 0.9]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <string>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
+
+using std::string;
+
+using namespace genie;
+
+// the grid (the SFTable-* defaults of the DIS SF models)
+const int    kNX       = 100;
+const int    kNQ2      = 120;
+const double kXMin     = 1E-4;
+const double kQ2Min    = 1E-2;
+const double kQ2Max    = 1E+4;
+
+const double kNodeTol  = 1E-6; // max deviation at the grid nodes
+
+double Deviation (const DISStructureFuncModelI * direct,
+                  const DISStructureFuncModelI * tabulated,
+                  Interaction * in, double x, double Q2);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  RunOpt::Instance()->BuildTune();
+
+  CmdLnArgParser parser(argc,argv);
+  string model = (parser.OptionExists('a')) ? parser.ArgAsString('a') : "genie::QPMDISStrucFunc";
+  double tol   = (parser.OptionExists('t')) ? parser.ArgAsDouble('t') : 1E-2;
+  double Moff  = (parser.OptionExists('m')) ? parser.ArgAsDouble('m') : 0.9;
+
+  AlgFactory * algf = AlgFactory::Instance();
+
+  DISStructureFuncModelI * direct =
+     dynamic_cast<DISStructureFuncModelI *> (algf->AdoptAlgorithm(model,"Default"));
+  DISStructureFuncModelI * tabulated =
+     dynamic_cast<DISStructureFuncModelI *> (algf->AdoptAlgorithm(model,"Default"));
+  assert(direct && tabulated);
+
+  Registry tables("tables", false);
+  tables.Set("UseSFTables",   true);
+  tables.Set("SFTable-NX",    kNX);
+  tables.Set("SFTable-NQ2",   kNQ2);
+  tables.Set("SFTable-XMin",  kXMin);
+  tables.Set("SFTable-Q2Min", kQ2Min);
+  tables.Set("SFTable-Q2Max", kQ2Max);
+  tabulated->Configure(tables);
+
+  // one interaction per tabulated nucleon / probe / current
+  const int kNIn = 6;
+  Interaction * in[kNIn] = {
+    Interaction::DISCC (kPdgTgtFreeP, kPdgProton,  kPdgNuMu,     10.),
+    Interaction::DISCC (kPdgTgtFreeN, kPdgNeutron, kPdgNuMu,     10.),
+    Interaction::DISCC (kPdgTgtFreeP, kPdgProton,  kPdgAntiNuMu, 10.),
+    Interaction::DISNC (kPdgTgtFreeP, kPdgProton,  kPdgNuMu,     10.),
+    Interaction::DISNC (kPdgTgtFreeN, kPdgNeutron, kPdgAntiNuMu, 10.),
+    Interaction::DISEM (kPdgTgtFreeP, kPdgProton,  kPdgElectron, 10.)
+  };
+  // and the same, on a bound off-shell nucleon
+  Interaction * in_off[kNIn] = {
+    Interaction::DISCC (kPdgTgtO16, kPdgProton,  kPdgNuMu,     10.),
+    Interaction::DISCC (kPdgTgtO16, kPdgNeutron, kPdgNuMu,     10.),
+    Interaction::DISCC (kPdgTgtO16, kPdgProton,  kPdgAntiNuMu, 10.),
+    Interaction::DISNC (kPdgTgtO16, kPdgProton,  kPdgNuMu,     10.),
+    Interaction::DISNC (kPdgTgtO16, kPdgNeutron, kPdgAntiNuMu, 10.),
+    Interaction::DISEM (kPdgTgtO16, kPdgProton,  kPdgElectron, 10.)
+  };
+  for(int i = 0; i < kNIn; i++) {
+    in_off[i]->InitStatePtr()->TgtPtr()->SetHitNucP4(TLorentzVector(0,0,0,Moff));
+  }
+
+  double dlogx  = (TMath::Log(1.)     - TMath::Log(kXMin )) / (kNX -1);
+  double dlogQ2 = (TMath::Log(kQ2Max) - TMath::Log(kQ2Min)) / (kNQ2-1);
+
+  bool ok = true;
+  for(int i = 0; i < kNIn; i++) {
+    double dev_node = 0, dev_mid = 0, dev_off = 0;
+    int    nmid = 0, nmid_bad = 0;
+    // skip x=1, where the scaling variables are singular
+    for(int ix = 0; ix < kNX-1; ix++) {
+      for(int iQ2 = 0; iQ2 < kNQ2; iQ2++) {
+        double x  = TMath::Exp(TMath::Log(kXMin ) + ix *dlogx );
+        double Q2 = TMath::Exp(TMath::Log(kQ2Min) + iQ2*dlogQ2);
+        dev_node = TMath::Max(dev_node, Deviation(direct, tabulated, in    [i], x, Q2));
+        dev_off  = TMath::Max(dev_off,  Deviation(direct, tabulated, in_off[i], x, Q2));
+        if(iQ2 == kNQ2-1) continue;
+        double xm  = x  * TMath::Exp(0.5*dlogx );
+        double Q2m = Q2 * TMath::Exp(0.5*dlogQ2);
+        double dev = Deviation(direct, tabulated, in[i], xm, Q2m);
+        dev_mid = TMath::Max(dev_mid, dev);
+        nmid++;
+        if(dev > tol) nmid_bad++;
+      }
+    }
+    LOG("test", pNOTICE)
+       << in[i]->AsString() << " : max deviation at the grid nodes = "
+       << dev_node << ", between nodes = " << dev_mid << " (" << nmid_bad
+       << "/" << nmid << " points above " << tol << "), at the nodes for M = "
+       << Moff << " GeV = " << dev_off;
+    if(dev_node > kNodeTol) {
+      LOG("test", pERROR)
+         << "The tables do not reproduce the direct calculation at the nodes!";
+      ok = false;
+    }
+    delete in[i];
+    delete in_off[i];
+  }
+
+  delete direct;
+  delete tabulated;
+
+  if(!ok) return 1;
+  LOG("test", pINFO)  << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+double Deviation(const DISStructureFuncModelI * direct,
+                 const DISStructureFuncModelI * tabulated,
+                 Interaction * in, double x, double Q2)
+{
+  in->KinePtr()->Setx (x);
+  in->KinePtr()->SetQ2(Q2);
+
+  direct->Calculate(in);
+  double F[5] = { direct->F1(), direct->F2(), direct->F3(),
+                  direct->F4(), direct->F5() };
+  tabulated->Calculate(in);
+  double Ftab[5] = { tabulated->F1(), tabulated->F2(), tabulated->F3(),
+                     tabulated->F4(), tabulated->F5() };
+
+  double ref = 0, dev = 0;
+  for(int i = 0; i < 5; i++) {
+    ref = TMath::Max(ref, x * TMath::Abs(F[i]));
+    dev = TMath::Max(dev, x * TMath::Abs(Ftab[i] - F[i]));
+  }
+  return (ref > 0) ? dev/ref : 0.;
+}
+//____________________________________________________________________________
@@ -0,0 +1,179 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestFourVector
+
+\brief   Program used for testing / benchmarking the value-type kinematics
+         classes of Framework/Numerical/FourVector.h against TLorentzVector.
+         It times
+          - two-body phase space decays (isotropic in the rest frame of the
+            parent, then boosted to the lab) done with TLorentzVector::Boost()
+            and with a LorentzBoost,
+          - INTRANUKE two-body scattering kinematics, comparing the 2018
+            TwoBodyKinematics() (FourVector based) with the older
+            TLorentzVector based one, for the same random numbers,
+         and reports the number of calls per second for each and the max
+         deviation between the 4-momenta computed either way.
+
+         Syntax :
+           gtestFourVector [-n ncalls]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <vector>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TStopwatch.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/FourVector.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/HadronTransport/INukeUtils.h"
+#include "Physics/HadronTransport/INukeUtils2018.h"
+
+using std::vector;
+
+using namespace genie;
+using namespace genie::constants;
+
+double MaxDeviation (const TLorentzVector & a, const TLorentzVector & b);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+  int n = (parser.OptionExists('n')) ? parser.ArgAsInt('n') : 1000000;
+
+  RandomGen * rnd = RandomGen::Instance();
+  TStopwatch timer;
+
+  //
+  // two-body phase space decays: pi0 -> gamma gamma with a random pi0 momentum
+  //
+  double M = kPi0Mass;
+  vector<double> px(n), py(n), pz(n), costh(n), phi(n);
+  for(int i = 0; i < n; i++) {
+    px   [i] = rnd->RndGen().Gaus(0, 0.5);
+    py   [i] = rnd->RndGen().Gaus(0, 0.5);
+    pz   [i] = rnd->RndGen().Gaus(1, 0.5);
+    costh[i] = -1 + 2 * rnd->RndGen().Rndm();
+    phi  [i] = 2*kPi * rnd->RndGen().Rndm();
+  }
+
+  vector<TLorentzVector> root_g1(n), root_g2(n);
+  timer.Start();
+  for(int i = 0; i < n; i++) {
+    TLorentzVector parent(px[i], py[i], pz[i],
+          TMath::Sqrt(px[i]*px[i]+py[i]*py[i]+pz[i]*pz[i]+M*M));
+    TVector3 beta = parent.BoostVector();
+    double sinth = TMath::Sqrt(1-costh[i]*costh[i]);
+    double pcm   = 0.5*M;
+    TLorentzVector g1( pcm*sinth*TMath::Cos(phi[i]),  pcm*sinth*TMath::Sin(phi[i]),  pcm*costh[i], pcm);
+    TLorentzVector g2(-pcm*sinth*TMath::Cos(phi[i]), -pcm*sinth*TMath::Sin(phi[i]), -pcm*costh[i], pcm);
+    g1.Boost(beta);
+    g2.Boost(beta);
+    root_g1[i] = g1;
+    root_g2[i] = g2;
+  }
+  timer.Stop();
+  double troot = timer.RealTime();
+
+  vector<FourVector> fv_g(2*n);
+  timer.Start();
+  for(int i = 0; i < n; i++) {
+    FourVector parent(px[i], py[i], pz[i],
+          TMath::Sqrt(px[i]*px[i]+py[i]*py[i]+pz[i]*pz[i]+M*M));
+    LorentzBoost boost(parent.BoostVector());
+    double sinth = TMath::Sqrt(1-costh[i]*costh[i]);
+    double pcm   = 0.5*M;
+    FourVector g1(pcm*sinth*TMath::Cos(phi[i]), pcm*sinth*TMath::Sin(phi[i]), pcm*costh[i], pcm);
+    fv_g[2*i]   = boost(g1);
+    fv_g[2*i+1] = boost(FourVector(-g1.Vect(), pcm));
+  }
+  timer.Stop();
+  double tfv = timer.RealTime();
+
+  double dev = 0;
+  for(int i = 0; i < n; i++) {
+    dev = TMath::Max(dev, MaxDeviation(root_g1[i], fv_g[2*i  ].ToTLorentzVector()));
+    dev = TMath::Max(dev, MaxDeviation(root_g2[i], fv_g[2*i+1].ToTLorentzVector()));
+  }
+
+  LOG("test", pNOTICE)
+     << "Two-body decays, " << n << " calls : TLorentzVector = "
+     << n/troot << " calls/s, FourVector = " << n/tfv
+     << " calls/s, max deviation = " << dev << " GeV";
+
+  //
+  // INTRANUKE two-body scattering: pi+ p, random pion momentum & Fermi motion
+  //
+  int nkin = TMath::Min(n, 100000);
+  double mpi = kPionMass, mp = kProtonMass;
+  vector<TLorentzVector> p1(nkin), p2(nkin);
+  vector<double> c3cm(nkin);
+  for(int i = 0; i < nkin; i++) {
+    TVector3 ppi(rnd->RndGen().Gaus(0,0.1), rnd->RndGen().Gaus(0,0.1), 0.2+rnd->RndGen().Rndm());
+    TVector3 pn (rnd->RndGen().Gaus(0,0.1), rnd->RndGen().Gaus(0,0.1), rnd->RndGen().Gaus(0,0.1));
+    p1[i].SetVectM(ppi, mpi);
+    p2[i].SetVectM(pn,  mp);
+    c3cm[i] = -1 + 2 * rnd->RndGen().Rndm();
+  }
+
+  vector<TLorentzVector> old_p3(nkin), old_p4(nkin), new_p3(nkin), new_p4(nkin);
+  TLorentzVector remn;
+
+  rnd->RndFsi().SetSeed(1234);
+  timer.Start();
+  for(int i = 0; i < nkin; i++) {
+    utils::intranuke::TwoBodyKinematics(
+       mpi, mp, p1[i], p2[i], old_p3[i], old_p4[i], c3cm[i], remn);
+  }
+  timer.Stop();
+  double told = timer.RealTime();
+
+  rnd->RndFsi().SetSeed(1234);
+  timer.Start();
+  for(int i = 0; i < nkin; i++) {
+    utils::intranuke2018::TwoBodyKinematics(
+       mpi, mp, p1[i], p2[i], new_p3[i], new_p4[i], c3cm[i], remn);
+  }
+  timer.Stop();
+  double tnew = timer.RealTime();
+
+  dev = 0;
+  for(int i = 0; i < nkin; i++) {
+    dev = TMath::Max(dev, MaxDeviation(old_p3[i], new_p3[i]));
+    dev = TMath::Max(dev, MaxDeviation(old_p4[i], new_p4[i]));
+  }
+
+  LOG("test", pNOTICE)
+     << "TwoBodyKinematics, " << nkin << " calls : TLorentzVector = "
+     << nkin/told << " calls/s, FourVector = " << nkin/tnew
+     << " calls/s, max deviation = " << dev << " GeV";
+  LOG("test", pNOTICE)
+     << "(the TLorentzVector version also formats its per-call diagnostics)";
+
+  LOG("test", pINFO)  << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+double MaxDeviation(const TLorentzVector & a, const TLorentzVector & b)
+{
+  double d = TMath::Abs(a.E() - b.E());
+  d = TMath::Max(d, TMath::Abs(a.Px() - b.Px()));
+  d = TMath::Max(d, TMath::Abs(a.Py() - b.Py()));
+  d = TMath::Max(d, TMath::Abs(a.Pz() - b.Pz()));
+  return d;
+}
+//____________________________________________________________________________
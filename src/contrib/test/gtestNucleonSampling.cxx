@@ -0,0 +1,172 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestNucleonSampling
+
+\brief   Program used for testing / benchmarking the nucleon sampling methods
+         of NuclearModelSampler, used by the loops averaging a quantity over
+         the nuclear phase space (NievesQELCCPXSec::Integral(),
+         QELEventGenerator::ComputeMaxXSec()).
+         Estimates reference averages over the nucleons of a nucleus (the
+         mean squared momentum, the mean squared momentum component along
+         z and the mean removal energy) from samples of N and of N/k
+         nucleons, thrown pseudo-randomly, from the randomly shifted
+         Halton sequence and from a Latin hypercube. Each estimate
+         is repeated with independent samples, and the RMS deviation from
+         the reference (a large pseudo-random sample) is reported.
+         Fails if a quasi-random or stratified sample of N nucleons is less
+         precise than a pseudo-random one.
+
+         Syntax :
+           gtestNucleonSampling [--tune tune_name] [-m model] [-t target]
+                                [-n N] [-k k] [-r repetitions]
+
+         Options :
+           -m  nuclear model [default: genie::LocalFGM]
+           -t  target pdg code [default: 1000060120]
+           -n  sample size N [default: 500]
+           -k  reduction factor of the smaller samples [default: 4]
+           -r  number of repetitions of each estimate [default: 200]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <string>
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Interaction/Target.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Physics/NuclearState/NuclearModelI.h"
+#include "Physics/NuclearState/NuclearModelSampler.h"
+
+using std::string;
+
+using namespace genie;
+
+const int kNAvg = 3; // number of averages estimated
+
+void Averages (NuclearModelSampler & sampler, const Target & tgt,
+               unsigned int nnuc, double * avg);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  RunOpt::Instance()->BuildTune();
+
+  CmdLnArgParser parser(argc,argv);
+  string model  = (parser.OptionExists('m')) ? parser.ArgAsString('m') : "genie::LocalFGM";
+  int    tgtpdg = (parser.OptionExists('t')) ? parser.ArgAsInt   ('t') : kPdgTgtC12;
+  int    N      = (parser.OptionExists('n')) ? parser.ArgAsInt   ('n') : 500;
+  int    k      = (parser.OptionExists('k')) ? parser.ArgAsInt   ('k') : 4;
+  int    nrep   = (parser.OptionExists('r')) ? parser.ArgAsInt   ('r') : 200;
+  assert(N > 0 && k > 0 && N/k > 0 && nrep > 1);
+
+  const NuclearModelI * nucl_model = dynamic_cast<const NuclearModelI *> (
+      AlgFactory::Instance()->GetAlgorithm(model, "Default"));
+  assert(nucl_model);
+
+  Target tgt(tgtpdg);
+  tgt.SetHitNucPdg(kPdgProton);
+
+  const char * avg_name[kNAvg] = { "<p^2>", "<pz^2>", "<Eb>" };
+
+  // reference averages, from 1000 pseudo-random samples of 1000 nucleons
+  double ref[kNAvg] = { 0., 0., 0. };
+  {
+    NuclearModelSampler sampler(nucl_model, kNSmpPseudoRandom);
+    const int nref = 1000;
+    for(int iref = 0; iref < nref; iref++) {
+      double avg[kNAvg];
+      Averages(sampler, tgt, 1000, avg);
+      for(int ia = 0; ia < kNAvg; ia++) ref[ia] += avg[ia]/nref;
+    }
+  }
+  LOG("test", pNOTICE)
+     << model << ", " << tgt.AsString() << " : reference " << avg_name[0]
+     << " = " << ref[0] << " GeV^2, " << avg_name[1] << " = " << ref[1]
+     << " GeV^2, " << avg_name[2] << " = " << ref[2] << " GeV";
+
+  NucleonSampling_t method[3] = { kNSmpPseudoRandom, kNSmpQuasiRandom, kNSmpStratified };
+  const char * method_name[3] = { "PseudoRandom", "QuasiRandom", "Stratified" };
+  int nnuc[2] = { N, N/k };
+
+  // rms deviation from the reference [method][sample size][average]
+  double rms[3][2][kNAvg];
+
+  for(int im = 0; im < 3; im++) {
+    NuclearModelSampler sampler(nucl_model, method[im]);
+    for(int in = 0; in < 2; in++) {
+      double sum2[kNAvg] = { 0., 0., 0. };
+      for(int irep = 0; irep < nrep; irep++) {
+        double avg[kNAvg];
+        Averages(sampler, tgt, nnuc[in], avg);
+        for(int ia = 0; ia < kNAvg; ia++) {
+          sum2[ia] += TMath::Power(avg[ia] - ref[ia], 2);
+        }
+      }
+      for(int ia = 0; ia < kNAvg; ia++) {
+        rms[im][in][ia] = TMath::Sqrt(sum2[ia]/nrep);
+      }
+      LOG("test", pNOTICE)
+         << method_name[im] << ", " << nnuc[in] << " nucleons : rms error "
+         << avg_name[0] << " = " << rms[im][in][0] << " GeV^2, "
+         << avg_name[1] << " = " << rms[im][in][1] << " GeV^2, "
+         << avg_name[2] << " = " << rms[im][in][2] << " GeV";
+    }
+  }
+
+  // the quasi-random & stratified samples of N/k nucleons vs the
+  // pseudo-random sample of N nucleons
+  bool ok = true;
+  for(int im = 1; im < 3; im++) {
+    for(int ia = 0; ia < kNAvg; ia++) {
+      // constant for this model & target (eg. the LocalFGM removal energy)?
+      if(rms[0][0][ia] == 0.) continue;
+      LOG("test", pNOTICE)
+         << avg_name[ia] << " : rms error of " << method_name[im] << " ("
+         << nnuc[1] << " nucleons) / PseudoRandom (" << nnuc[0]
+         << " nucleons) = " << rms[im][1][ia]/rms[0][0][ia];
+      // allow for the statistical uncertainty of the rms estimates
+      if(rms[im][0][ia] > 1.2 * rms[0][0][ia]) {
+        LOG("test", pERROR)
+           << avg_name[ia] << " : " << method_name[im]
+           << " sampling is less precise than PseudoRandom sampling!";
+        ok = false;
+      }
+    }
+  }
+
+  if(!ok) return 1;
+  LOG("test", pINFO)  << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+void Averages(NuclearModelSampler & sampler, const Target & tgt,
+              unsigned int nnuc, double * avg)
+{
+  sampler.Generate(tgt, nnuc);
+
+  for(int ia = 0; ia < kNAvg; ia++) avg[ia] = 0.;
+  for(unsigned int i = 0; i < sampler.NNucleons(); i++) {
+    const TVector3 & p3 = sampler.Momentum3(i);
+    avg[0] += p3.Mag2();
+    avg[1] += p3.Z() * p3.Z();
+    avg[2] += sampler.RemovalEnergy(i);
+  }
+  for(int ia = 0; ia < kNAvg; ia++) avg[ia] /= sampler.NNucleons();
+}
+//____________________________________________________________________________
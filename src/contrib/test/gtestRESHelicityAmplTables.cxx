@@ -0,0 +1,167 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestRESHelicityAmplTables
+
+\brief   Program used for testing / benchmarking the tabulated Rein-Sehgal
+         helicity amplitudes (see the `UseHelicityAmplTables' option of the
+         Rein-Sehgal and Berger-Sehgal RES cross section algorithms).
+         For each baryon resonance in the default resonance list it evaluates
+         d2xsec/dWdQ2 at random kinematically allowed (W,Q2) points with and
+         without the tables, and reports the CPU time spent by each and the
+         max deviation (relative to the max cross section).
+
+         Syntax :
+           gtestRESHelicityAmplTables [--tune tune_name] [-n npoints] [-e E]
+
+\author  The GENIE Collaboration
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TStopwatch.h>
+
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/BaryonResList.h"
+#include "Framework/ParticleData/BaryonResUtils.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/Range1.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+void Benchmark (string model, const BaryonResList & rl, int npoints, double E);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  RunOpt::Instance()->BuildTune();
+
+  CmdLnArgParser parser(argc,argv);
+  int    npoints = (parser.OptionExists('n')) ? parser.ArgAsInt   ('n') : 20000;
+  double E       = (parser.OptionExists('e')) ? parser.ArgAsDouble('e') : 2.0;
+
+  // get the default list of baryon resonances
+  Registry * common = AlgConfigPool::Instance()->CommonParameterList("Resonances");
+  assert(common);
+  BaryonResList rl;
+  rl.DecodeFromNameList(common->GetString("ResonanceNameList"));
+
+  LOG("test", pNOTICE) << "Resonances : " << rl;
+
+  Benchmark("genie::ReinSehgalRESPXSec",      rl, npoints, E);
+  Benchmark("genie::BergerSehgalRESPXSec2014", rl, npoints, E);
+
+  return 0;
+}
+//____________________________________________________________________________
+void Benchmark(string model, const BaryonResList & rl, int npoints, double E)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+
+  XSecAlgorithmI * direct =
+     dynamic_cast<XSecAlgorithmI *> (algf->AdoptAlgorithm(model,"Default"));
+  XSecAlgorithmI * tabulated =
+     dynamic_cast<XSecAlgorithmI *> (algf->AdoptAlgorithm(model,"Default"));
+  assert(direct && tabulated);
+
+  Registry tables("tables", false);
+  tables.Set("UseHelicityAmplTables", true);
+  tabulated->Configure(tables);
+
+  RandomGen * rnd = RandomGen::Instance();
+  TStopwatch timer;
+
+  double tdirect_tot = 0, ttab_tot = 0;
+
+  LOG("test", pNOTICE) << "** " << model << ", E = " << E << " GeV";
+
+  for(unsigned int ires = 0; ires < rl.NResonances(); ires++) {
+
+    Resonance_t res = rl.ResonanceId(ires);
+
+    Interaction * in = Interaction::RESCC(
+                          kPdgTgtFreeN, kPdgNeutron, kPdgNuMu, E);
+    in->ExclTagPtr()->SetResonance(res);
+
+    // pick random points in the allowed phase space
+    vector<double> W(npoints), Q2(npoints);
+    Range1D_t Wl = in->PhaseSpace().WLim();
+    for(int i = 0; i < npoints; i++) {
+      W[i] = Wl.min + (Wl.max - Wl.min) * rnd->RndGen().Rndm();
+      in->KinePtr()->SetW(W[i]);
+      Range1D_t Q2l = in->PhaseSpace().Q2Lim_W();
+      Q2[i] = Q2l.min + (Q2l.max - Q2l.min) * rnd->RndGen().Rndm();
+    }
+
+    // build the tables outside the timed loop
+    in->KinePtr()->SetW (W [0]);
+    in->KinePtr()->SetQ2(Q2[0]);
+    tabulated->XSec(in, kPSWQ2fE);
+
+    vector<double> xsec_direct(npoints), xsec_tab(npoints);
+
+    timer.Start();
+    for(int i = 0; i < npoints; i++) {
+      in->KinePtr()->SetW (W [i]);
+      in->KinePtr()->SetQ2(Q2[i]);
+      xsec_direct[i] = direct->XSec(in, kPSWQ2fE);
+    }
+    timer.Stop();
+    double tdirect = timer.CpuTime();
+
+    timer.Start();
+    for(int i = 0; i < npoints; i++) {
+      in->KinePtr()->SetW (W [i]);
+      in->KinePtr()->SetQ2(Q2[i]);
+      xsec_tab[i] = tabulated->XSec(in, kPSWQ2fE);
+    }
+    timer.Stop();
+    double ttab = timer.CpuTime();
+
+    double xsec_max = 0, dev_max = 0;
+    for(int i = 0; i < npoints; i++) {
+      xsec_max = TMath::Max(xsec_max, xsec_direct[i]);
+      dev_max  = TMath::Max(dev_max,  TMath::Abs(xsec_tab[i]-xsec_direct[i]));
+    }
+    double rel_dev = (xsec_max > 0) ? dev_max/xsec_max : 0;
+
+    LOG("test", pNOTICE)
+       << utils::res::AsString(res) << " : direct = " << tdirect
+       << " s, tabulated = " << ttab << " s, max deviation = " << rel_dev;
+
+    tdirect_tot += tdirect;
+    ttab_tot    += ttab;
+
+    delete in;
+  }
+
+  LOG("test", pNOTICE)
+     << "Total (" << rl.NResonances() << " resonances) : direct = "
+     << tdirect_tot << " s, tabulated = " << ttab_tot << " s";
+
+  delete direct;
+  delete tabulated;
+}
+//____________________________________________________________________________